@@ -28,15 +28,15 @@
 // Die Funktion "setupFS();" muss im Setup aufgerufen werden.
 /**************************************************************************************/
 
-#include <list>
-#include <tuple>
-
 const char WARNING[] PROGMEM = R"(<h2>Der Sketch wurde mit "FS:none" kompilliert!)";
 const char HELPER[] PROGMEM = R"(<form method="POST" action="/upload" enctype="multipart/form-data">
 <input type="file" name="[]" multiple><button>Upload</button></form>Lade die fs.html hoch.)";
 
 void setupFS() {                                                                       // Funktionsaufruf "setupFS();" muss im Setup eingebunden werden
   LittleFS.begin();
+  static const char *headers[] = {"If-None-Match", "Accept-Encoding", "Content-Type"}; // für ETag und gzip in sendStaticFile(), Format von /leddirect
+  server.collectHeaders(headers, 3);
+  loadWebAssets();
   server.on("/format", formatFS);
   server.on("/upload", HTTP_POST, sendResponce, handleUpload);
   server.onNotFound([]() {
@@ -47,56 +47,48 @@ void setupFS() {
 
 bool handleList() {                                                                    // Senden aller Daten an den Client
   FSInfo fs_info;  LittleFS.info(fs_info);                                             // Füllt FSInfo Struktur mit Informationen über das Dateisystem
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);                                     // In Stücken senden, der Speicherbedarf hängt nicht von der Anzahl der Dateien ab
+  server.send(200, "application/json", "");
+  JsonWriter json(sendJsonChunk);
+  char size[16];
+  json.beginArray();
   Dir dir = LittleFS.openDir("/");
-  using namespace std;
-  using records = tuple<String, String, int>;
-  list<records> dirList;
-  while (dir.next()) {                                                                 // Ordner und Dateien zur Liste hinzufügen
+  while (dir.next()) {                                                                 // Ordner und Dateien in der Reihenfolge des Dateisystems, sortiert wird im Browser
     if (dir.isDirectory()) {
-      uint8_t ran {0};
-      Dir fold = LittleFS.openDir(dir.fileName());
+      bool empty {true};
+      String folder = dir.fileName();
+      Dir fold = LittleFS.openDir(folder);
       while (fold.next())  {
-        ran++;
-        dirList.emplace_back(dir.fileName(), fold.fileName(), fold.fileSize());
+        empty = false;
+        sendListEntry(json, folder.c_str(), fold.fileName().c_str(), fold.fileSize());
       }
-      if (!ran) dirList.emplace_back(dir.fileName(), "", 0);
+      if (empty) sendListEntry(json, folder.c_str(), "", 0);
     }
     else {
-      dirList.emplace_back("", dir.fileName(), dir.fileSize());
-    }
-  }
-  dirList.sort([](const records & f, const records & l) {                              // Dateien sortieren
-    if (server.arg(0) == "1") {
-      return get<2>(f) > get<2>(l);
-    } else {
-      for (uint8_t i = 0; i < 31; i++) {
-        if (tolower(get<1>(f)[i]) < tolower(get<1>(l)[i])) return true;
-        else if (tolower(get<1>(f)[i]) > tolower(get<1>(l)[i])) return false;
-      }
-      return false;
-    }
-  });
-  dirList.sort([](const records & f, const records & l) {                              // Ordner sortieren
-    if (get<0>(f)[0] != 0x00 || get<0>(l)[0] != 0x00) {
-      for (uint8_t i = 0; i < 31; i++) {
-          if (tolower(get<0>(f)[i]) < tolower(get<0>(l)[i])) return true;
-          else if (tolower(get<0>(f)[i]) > tolower(get<0>(l)[i])) return false;
-      }
+      sendListEntry(json, "", dir.fileName().c_str(), dir.fileSize());
     }
-    return false;
-  });
-  String temp = "[";
-  for (auto& t : dirList) {
-    if (temp != "[") temp += ',';
-    temp += "{\"folder\":\"" + get<0>(t) + "\",\"name\":\"" + get<1>(t) + "\",\"size\":\"" + formatBytes(get<2>(t)) + "\"}";
   }
-  temp += ",{\"usedBytes\":\"" + formatBytes(fs_info.usedBytes) +                      // Berechnet den verwendeten Speicherplatz
-          "\",\"totalBytes\":\"" + formatBytes(fs_info.totalBytes) +                   // Zeigt die Größe des Speichers
-          "\",\"freeBytes\":\"" + (fs_info.totalBytes - fs_info.usedBytes) + "\"}]";   // Berechnet den freien Speicherplatz
-  server.send(200, "application/json", temp);
+  json.beginObject();
+  json.field("usedBytes", formatBytes(fs_info.usedBytes, size, sizeof(size)));          // Berechnet den verwendeten Speicherplatz
+  json.field("totalBytes", formatBytes(fs_info.totalBytes, size, sizeof(size)));        // Zeigt die Größe des Speichers
+  json.fieldUInt("freeBytes", fs_info.totalBytes - fs_info.usedBytes);                  // Berechnet den freien Speicherplatz
+  json.endObject();
+  json.endArray();
+  json.flush();
+  server.sendContent("");
   return true;
 }
 
+void sendListEntry(JsonWriter &json, const char *folder, const char *name, size_t bytes) {   // Ein Eintrag der Dateiliste
+  char size[16];
+  json.beginObject();
+  json.field("folder", folder);
+  json.field("name", name);
+  json.field("size", formatBytes(bytes, size, sizeof(size)));
+  json.fieldUInt("bytes", bytes);                                                      // Für das Sortieren nach Größe im Browser
+  json.endObject();
+}
+
 void deleteRecursive(const String &path) {
   if (LittleFS.remove(path)) {
     LittleFS.open(path.substring(0, path.lastIndexOf('/')) + "/", "w");
@@ -118,13 +110,14 @@ bool handleFile(String &&path) {
   if (server.hasArg("sort")) return handleList();
   if (server.hasArg("delete")) {
     deleteRecursive(server.arg("delete"));
+    loadWebAssets();                                                                   // gelöschte Dateien wieder aus dem Bundle im Flash
     sendResponce();
     return true;
   }
-  if (!LittleFS.exists("fs.html")) server.send(200, "text/html", LittleFS.begin() ? HELPER : WARNING);     // ermöglicht das hochladen der fs.html
+  if (WebBundle::find("/fs.html") < 0 && !LittleFS.exists("fs.html")) server.send(200, "text/html", LittleFS.begin() ? HELPER : WARNING);     // ermöglicht das hochladen der fs.html
   if (path.endsWith("/")) path += "index.html";
   if (path == "/spiffs.html") sendResponce(); // Vorrübergehend für den Admin Tab
-  return LittleFS.exists(path) ? ({File f = LittleFS.open(path, "r"); server.streamFile(f, mime::getContentType(path)); f.close(); true;}) : false;
+  return sendStaticFile(path);                                                         // gzip-Variante, ETag und Cache-Control
 }
 
 void handleUpload() {                                                                  // Dateien ins Filesystem schreiben
@@ -142,6 +135,7 @@ void handleUpload() {
   } else if (upload.status == UPLOAD_FILE_END) {
     printf(PSTR("handleFileUpload Size: %u\n"), upload.totalSize);
     fsUploadFile.close();
+    loadWebAssets();                                                                   // neue ETags nach dem Hochladen der Weboberfläche
   }
 }
 
@@ -155,6 +149,9 @@ void sendResponce() {
   server.send(303, "message/http");
 }
 
-const String formatBytes(size_t const& bytes) {                                        // lesbare Anzeige der Speichergrößen
-  return bytes < 1024 ? static_cast<String>(bytes) + " Byte" : bytes < 1048576 ? static_cast<String>(bytes / 1024.0) + " KB" : static_cast<String>(bytes / 1048576.0) + " MB";
+const char* formatBytes(size_t const& bytes, char *out, size_t size) {                 // lesbare Anzeige der Speichergrößen
+  if (bytes < 1024) snprintf(out, size, "%u Byte", (unsigned)bytes);
+  else if (bytes < 1048576) snprintf(out, size, "%.2f KB", bytes / 1024.0);
+  else snprintf(out, size, "%.2f MB", bytes / 1048576.0);
+  return out;
 }
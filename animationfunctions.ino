@@ -20,7 +20,7 @@ int spiral(bool init, bool empty, uint8_t size){
   static bool breiter ;
   static int randNum;
   if(init){
-    logger.logString("Init Spiral with empty=" + String(empty));
+    LOG_DEBUG(logger, "Init Spiral with empty=" + String(empty));
     dir1 = down;          // current direction
     x = WIDTH/2;
     y = WIDTH/2;
@@ -256,7 +256,7 @@ int randomtetris(bool init){
   
   
   if(init || gameover){
-    logger.logString("Init Tetris: init=" + String(init) + ", gameover=" +  String(gameover));
+    LOG_DEBUG(logger, "Init Tetris: init=" + String(init) + ", gameover=" +  String(gameover));
     // clear local game screen
     for(int h = 0; h < HEIGHT+3; h++){
       for(int w = 0; w < WIDTH; w++){
@@ -303,14 +303,14 @@ int randomtetris(bool init){
     
     if(noMoreMover){
       // no more moving blocks -> check if game over or spawn new block
-      logger.logString("Tetris: No more Mover");
+      LOG_DEBUG(logger, "Tetris: No more Mover");
       gameover = false;
       // check if game was lost -> one pixel active in 4rd row (top row on the led grid)
       for(int s = 0; s < WIDTH; s++){
         if(screen[3][s] != 0) gameover = true;
       }
       if(gameover || counterID >= (numBlocks-1)){
-        logger.logString("Tetris: Gameover");
+        LOG_DEBUG(logger, "Tetris: Gameover");
         return 1;
       }
 
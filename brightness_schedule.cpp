@@ -0,0 +1,181 @@
+#include "brightness_schedule.h"
+
+/**
+ * @brief Construct a new empty BrightnessSchedule object
+ *
+ */
+BrightnessSchedule::BrightnessSchedule(){
+    clear();
+}
+
+/**
+ * @brief Remove all breakpoints from the schedule
+ *
+ */
+void BrightnessSchedule::clear(){
+    _numPoints = 0;
+}
+
+/**
+ * @brief Insert a breakpoint into the curve, the points are kept sorted by time
+ *
+ * @param secondOfDay time of the breakpoint [0 ... 86399]
+ * @param level brightness at this time
+ * @return true if the point was added, false if the schedule is full or the time is already used
+ */
+bool BrightnessSchedule::addPoint(uint32_t secondOfDay, uint8_t level){
+    secondOfDay %= SECONDS_PER_DAY;
+    if(_numPoints >= BRIGHTNESS_SCHEDULE_MAX_POINTS) return false;
+
+    uint8_t pos = 0;
+    while(pos < _numPoints && _points[pos].second < secondOfDay) pos++;
+    if(pos < _numPoints && _points[pos].second == secondOfDay) return false;
+
+    for(uint8_t i = _numPoints; i > pos; i--){
+        _points[i] = _points[i - 1];
+    }
+    _points[pos].second = secondOfDay;
+    _points[pos].level = level;
+    _numPoints++;
+    return true;
+}
+
+/**
+ * @brief Compile a flat curve (e.g. nightmode deactivated)
+ *
+ * @param level brightness for the whole day
+ */
+void BrightnessSchedule::compileConstant(uint8_t level){
+    clear();
+    addPoint(0, level);
+}
+
+/**
+ * @brief Compile the nightmode settings into a curve:
+ *        fade out from dayLevel to 0 starting at startMinute,
+ *        stay off until endMinute, then fade in back to dayLevel.
+ *        Fades are shortened if the night (or the day) is shorter than the transition.
+ *
+ * @param startMinute start of nightmode in minutes after midnight
+ * @param endMinute end of nightmode in minutes after midnight
+ * @param transitionMinutes duration of fade out/in in minutes
+ * @param dayLevel brightness outside of the nightmode
+ */
+void BrightnessSchedule::compileNightMode(uint16_t startMinute, uint16_t endMinute, uint16_t transitionMinutes, uint8_t dayLevel){
+    uint32_t start = ((uint32_t)startMinute * 60) % SECONDS_PER_DAY;
+    uint32_t end = ((uint32_t)endMinute * 60) % SECONDS_PER_DAY;
+    uint32_t transition = (uint32_t)transitionMinutes * 60;
+
+    if(start == end){
+        compileConstant(dayLevel);
+        return;
+    }
+
+    uint32_t nightLength = (end + SECONDS_PER_DAY - start) % SECONDS_PER_DAY;
+    uint32_t dayLength = SECONDS_PER_DAY - nightLength;
+    uint32_t fadeOut = transition < nightLength ? transition : nightLength;
+    uint32_t fadeIn = transition < dayLength ? transition : dayLength;
+
+    clear();
+    addPoint(start, dayLevel);
+    addPoint(start + fadeOut, 0);
+    addPoint(end, 0);
+    addPoint(end + fadeIn, dayLevel);
+}
+
+/**
+ * @brief Find the segment containing the given time
+ *
+ * @param secondOfDay time [0 ... 86399]
+ * @return uint8_t index of the last point at or before secondOfDay (wraps to the last point of the previous day)
+ */
+uint8_t BrightnessSchedule::findSegment(uint32_t secondOfDay) const{
+    uint8_t prev = _numPoints - 1;
+    for(uint8_t i = 0; i < _numPoints && _points[i].second <= secondOfDay; i++){
+        prev = i;
+    }
+    return prev;
+}
+
+/**
+ * @brief Evaluate the curve at the given time using integer interpolation
+ *
+ * @param secondOfDay time to evaluate [0 ... 86399]
+ * @return uint8_t brightness at this time (0 if the schedule is empty)
+ */
+uint8_t BrightnessSchedule::levelAt(uint32_t secondOfDay) const{
+    if(_numPoints == 0) return 0;
+    if(_numPoints == 1) return _points[0].level;
+    secondOfDay %= SECONDS_PER_DAY;
+
+    uint8_t prev = findSegment(secondOfDay);
+    uint8_t next = (prev + 1) % _numPoints;
+
+    int32_t t0 = _points[prev].second;
+    int32_t t1 = _points[next].second;
+    int32_t t = secondOfDay;
+    if(t0 > t) t0 -= SECONDS_PER_DAY;
+    if(t1 <= t0) t1 += SECONDS_PER_DAY;
+
+    int32_t l0 = _points[prev].level;
+    int32_t l1 = _points[next].level;
+    return (uint8_t)(l0 + (l1 - l0) * (t - t0) / (t1 - t0));
+}
+
+/**
+ * @brief Check if the brightness changes within the segment containing the given time
+ *
+ * @param secondOfDay time [0 ... 86399]
+ * @return true if the segment is a fade, false if the level is constant until the next point
+ */
+bool BrightnessSchedule::isRamping(uint32_t secondOfDay) const{
+    if(_numPoints < 2) return false;
+    uint8_t prev = findSegment(secondOfDay % SECONDS_PER_DAY);
+    return _points[prev].level != _points[(prev + 1) % _numPoints].level;
+}
+
+/**
+ * @brief Check if the given time is in the night interval (the flat segment at zero). The seconds
+ *        at the start of the fade in which truncate to zero do not count, the curve is rising.
+ *
+ * @param secondOfDay time [0 ... 86399]
+ * @return true if the level is zero until the next point
+ */
+bool BrightnessSchedule::isNight(uint32_t secondOfDay) const{
+    if(_numPoints == 0) return false;
+    uint8_t prev = findSegment(secondOfDay % SECONDS_PER_DAY);
+    return _points[prev].level == 0 && _points[(prev + 1) % _numPoints].level == 0;
+}
+
+/**
+ * @brief Get the time until the next breakpoint (the next edge of the curve)
+ *
+ * @param secondOfDay current time [0 ... 86399]
+ * @return uint32_t seconds until the next breakpoint [1 ... 86400]
+ */
+uint32_t BrightnessSchedule::secondsToNextPoint(uint32_t secondOfDay) const{
+    if(_numPoints == 0) return SECONDS_PER_DAY;
+    secondOfDay %= SECONDS_PER_DAY;
+    uint8_t next = (findSegment(secondOfDay) + 1) % _numPoints;
+    uint32_t delta = (_points[next].second + SECONDS_PER_DAY - secondOfDay) % SECONDS_PER_DAY;
+    return delta == 0 ? SECONDS_PER_DAY : delta;
+}
+
+/**
+ * @brief Get the number of breakpoints
+ *
+ * @return uint8_t
+ */
+uint8_t BrightnessSchedule::getNumPoints() const{
+    return _numPoints;
+}
+
+/**
+ * @brief Get a breakpoint by index (sorted by time)
+ *
+ * @param index index of the breakpoint [0 ... getNumPoints()-1]
+ * @return const BrightnessPoint&
+ */
+const BrightnessPoint& BrightnessSchedule::getPoint(uint8_t index) const{
+    return _points[index < _numPoints ? index : 0];
+}
@@ -0,0 +1,46 @@
+/**
+ * @file brightness_schedule.h
+ * @brief Piecewise-linear daily brightness curve (compiled once, evaluated every second)
+ *
+ * The curve consists of up to BRIGHTNESS_SCHEDULE_MAX_POINTS breakpoints (second of day, brightness).
+ * Between two breakpoints the brightness is interpolated linearly with integer math,
+ * the segment from the last to the first point wraps around midnight.
+ *
+ */
+
+#ifndef brightness_schedule_h
+#define brightness_schedule_h
+
+#include <Arduino.h>
+
+#define BRIGHTNESS_SCHEDULE_MAX_POINTS 8
+#define SECONDS_PER_DAY 86400UL
+
+struct BrightnessPoint {
+    uint32_t second;    // second of day [0 ... 86399]
+    uint8_t level;      // brightness at this second [0 ... 255]
+};
+
+class BrightnessSchedule{
+
+    public:
+        BrightnessSchedule();
+        void clear();
+        bool addPoint(uint32_t secondOfDay, uint8_t level);
+        void compileConstant(uint8_t level);
+        void compileNightMode(uint16_t startMinute, uint16_t endMinute, uint16_t transitionMinutes, uint8_t dayLevel);
+        uint8_t levelAt(uint32_t secondOfDay) const;
+        bool isRamping(uint32_t secondOfDay) const;
+        bool isNight(uint32_t secondOfDay) const;
+        uint32_t secondsToNextPoint(uint32_t secondOfDay) const;
+        uint8_t getNumPoints() const;
+        const BrightnessPoint& getPoint(uint8_t index) const;
+
+    private:
+        BrightnessPoint _points[BRIGHTNESS_SCHEDULE_MAX_POINTS];
+        uint8_t _numPoints;
+
+        uint8_t findSegment(uint32_t secondOfDay) const;
+};
+
+#endif
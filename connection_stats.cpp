@@ -0,0 +1,165 @@
+#include "connection_stats.h"
+
+/**
+ * @brief Construct a new ConnectionStats object
+ *
+ */
+ConnectionStats::ConnectionStats(){
+    reset();
+}
+
+/**
+ * @brief Forget all connects
+ *
+ */
+void ConnectionStats::reset(){
+    _connectCount = 0;
+    _failedCount = 0;
+    _resumedCount = 0;
+    _lastResumed = false;
+    _lastHandshake = 0;
+    _maxHandshake = 0;
+    _lastFullHandshake = 0;
+    _lastResumedHandshake = 0;
+    _lastConnectionHeap = 0;
+    _maxConnectionHeap = 0;
+    _minFreeHeap = UINT32_MAX;
+}
+
+/**
+ * @brief Record a connect attempt
+ *
+ * @param success true if the connection (incl. handshake) was established
+ * @param resumed true if a stored TLS session was resumed (abbreviated handshake)
+ * @param durationMs duration of connect and handshake
+ * @param heapBefore free heap before the connect
+ * @param heapAfter free heap after the connect (the connection buffers are allocated)
+ */
+void ConnectionStats::recordConnect(bool success, bool resumed, uint32_t durationMs, uint32_t heapBefore, uint32_t heapAfter){
+    sampleFreeHeap(heapAfter);
+    if(!success){
+        _failedCount++;
+        return;
+    }
+    _connectCount++;
+    _lastResumed = resumed;
+    _lastHandshake = durationMs;
+    if(durationMs > _maxHandshake) _maxHandshake = durationMs;
+    if(resumed){
+        _resumedCount++;
+        _lastResumedHandshake = durationMs;
+    }
+    else{
+        _lastFullHandshake = durationMs;
+    }
+    _lastConnectionHeap = heapBefore > heapAfter ? heapBefore - heapAfter : 0;
+    if(_lastConnectionHeap > _maxConnectionHeap) _maxConnectionHeap = _lastConnectionHeap;
+}
+
+/**
+ * @brief Update the heap high-water mark
+ *
+ * @param freeHeap current free heap
+ */
+void ConnectionStats::sampleFreeHeap(uint32_t freeHeap){
+    if(freeHeap < _minFreeHeap) _minFreeHeap = freeHeap;
+}
+
+/**
+ * @brief Get the number of successful connects
+ *
+ * @return uint32_t
+ */
+uint32_t ConnectionStats::getConnectCount() const{
+    return _connectCount;
+}
+
+/**
+ * @brief Get the number of failed connects
+ *
+ * @return uint32_t
+ */
+uint32_t ConnectionStats::getFailedCount() const{
+    return _failedCount;
+}
+
+/**
+ * @brief Get the number of connects which resumed a stored session
+ *
+ * @return uint32_t
+ */
+uint32_t ConnectionStats::getResumedCount() const{
+    return _resumedCount;
+}
+
+/**
+ * @brief Check if the last successful connect resumed a stored session
+ *
+ * @return true if resumed
+ */
+bool ConnectionStats::isLastResumed() const{
+    return _lastResumed;
+}
+
+/**
+ * @brief Get the duration of the last successful connect
+ *
+ * @return uint32_t milliseconds
+ */
+uint32_t ConnectionStats::getLastHandshakeMillis() const{
+    return _lastHandshake;
+}
+
+/**
+ * @brief Get the duration of the slowest successful connect
+ *
+ * @return uint32_t milliseconds
+ */
+uint32_t ConnectionStats::getMaxHandshakeMillis() const{
+    return _maxHandshake;
+}
+
+/**
+ * @brief Get the duration of the last connect with a full handshake
+ *
+ * @return uint32_t milliseconds (0 if none)
+ */
+uint32_t ConnectionStats::getLastFullHandshakeMillis() const{
+    return _lastFullHandshake;
+}
+
+/**
+ * @brief Get the duration of the last connect with a resumed session
+ *
+ * @return uint32_t milliseconds (0 if none)
+ */
+uint32_t ConnectionStats::getLastResumedHandshakeMillis() const{
+    return _lastResumedHandshake;
+}
+
+/**
+ * @brief Get the heap allocated by the last connection
+ *
+ * @return uint32_t bytes
+ */
+uint32_t ConnectionStats::getLastConnectionHeap() const{
+    return _lastConnectionHeap;
+}
+
+/**
+ * @brief Get the largest heap allocated by a connection
+ *
+ * @return uint32_t bytes
+ */
+uint32_t ConnectionStats::getMaxConnectionHeap() const{
+    return _maxConnectionHeap;
+}
+
+/**
+ * @brief Get the heap high-water mark (lowest free heap seen)
+ *
+ * @return uint32_t bytes (0 if nothing was recorded)
+ */
+uint32_t ConnectionStats::getMinFreeHeap() const{
+    return _minFreeHeap == UINT32_MAX ? 0 : _minFreeHeap;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file connection_stats.h
+ * @brief Statistics of the connects (TLS handshakes) of a network client
+ *
+ * Records the duration of each connect, whether a stored TLS session was resumed and the heap
+ * used by the connection. The heap high-water mark is the lowest free heap seen while a
+ * connection was open (sampled by the owner, e.g. once per slice of work).
+ *
+ */
+
+#ifndef connection_stats_h
+#define connection_stats_h
+
+#include <Arduino.h>
+
+class ConnectionStats{
+
+    public:
+        ConnectionStats();
+        void reset();
+        void recordConnect(bool success, bool resumed, uint32_t durationMs, uint32_t heapBefore, uint32_t heapAfter);
+        void sampleFreeHeap(uint32_t freeHeap);
+        uint32_t getConnectCount() const;
+        uint32_t getFailedCount() const;
+        uint32_t getResumedCount() const;
+        bool isLastResumed() const;
+        uint32_t getLastHandshakeMillis() const;
+        uint32_t getMaxHandshakeMillis() const;
+        uint32_t getLastFullHandshakeMillis() const;
+        uint32_t getLastResumedHandshakeMillis() const;
+        uint32_t getLastConnectionHeap() const;
+        uint32_t getMaxConnectionHeap() const;
+        uint32_t getMinFreeHeap() const;
+
+    private:
+        uint32_t _connectCount;
+        uint32_t _failedCount;
+        uint32_t _resumedCount;
+        bool _lastResumed;
+        uint32_t _lastHandshake;
+        uint32_t _maxHandshake;
+        uint32_t _lastFullHandshake;
+        uint32_t _lastResumedHandshake;
+        uint32_t _lastConnectionHeap;
+        uint32_t _maxConnectionHeap;
+        uint32_t _minFreeHeap;
+};
+
+#endif
@@ -0,0 +1,202 @@
+#include "crash_log.h"
+#include <string.h>
+
+static_assert(sizeof(CrashTailImage) == CRASH_RTC_WORDS * 4, "CrashTailImage does not fill the RTC area");
+static_assert(sizeof(CrashRecord) == CRASH_SLOT_SIZE, "CrashRecord does not fill a slot");
+
+/**
+ * @brief Construct a new empty CrashTail object
+ *
+ */
+CrashTail::CrashTail(){
+    clear();
+}
+
+/**
+ * @brief Remove all text, the whole image has to be written
+ *
+ */
+void CrashTail::clear(){
+    memset(&_image, 0, sizeof(_image));
+    _image.magic = CRASH_TAIL_MAGIC;
+    markDirty(0, sizeof(_image));
+}
+
+/**
+ * @brief Check the image after it was read from RTC memory (getWords()), clear it if it is invalid
+ *
+ * @return true if the image holds a valid tail (e.g. after a soft restart or a crash), false
+ *         after a power-on (RTC memory is random)
+ */
+bool CrashTail::restore(){
+    _dirtyFrom = sizeof(_image);
+    _dirtyTo = 0;
+    if(_image.magic != CRASH_TAIL_MAGIC || _image.head >= CRASH_TAIL_SIZE || _image.used > CRASH_TAIL_SIZE){
+        clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Append text, the oldest text is overwritten when the tail is full
+ *
+ * @param text log line(s)
+ * @param length bytes of text
+ */
+void CrashTail::append(const char *text, size_t length){
+    if(length > CRASH_TAIL_SIZE){
+        text += length - CRASH_TAIL_SIZE;
+        length = CRASH_TAIL_SIZE;
+    }
+    size_t tail = (_image.head + _image.used) % CRASH_TAIL_SIZE;
+    size_t first = CRASH_TAIL_SIZE - tail < length ? CRASH_TAIL_SIZE - tail : length;
+    memcpy(_image.data + tail, text, first);
+    memcpy(_image.data, text + first, length - first);
+    if(first < length){
+        // wrapped: the whole data area changed
+        markDirty(offsetof(CrashTailImage, data), sizeof(_image));
+    }
+    else{
+        markDirty(offsetof(CrashTailImage, data) + tail, offsetof(CrashTailImage, data) + tail + length);
+    }
+    size_t used = _image.used + length;
+    if(used > CRASH_TAIL_SIZE){
+        _image.head = (_image.head + used - CRASH_TAIL_SIZE) % CRASH_TAIL_SIZE;
+        used = CRASH_TAIL_SIZE;
+    }
+    _image.used = used;
+    markDirty(offsetof(CrashTailImage, head), offsetof(CrashTailImage, data));
+}
+
+/**
+ * @brief Copy the text, oldest first
+ *
+ * @param out buffer
+ * @param size size of the buffer, the newest text is kept if it is too small
+ * @return size_t bytes copied (not terminated)
+ */
+size_t CrashTail::copyTo(char *out, size_t size) const{
+    size_t length = _image.used < size ? _image.used : size;
+    size_t start = (_image.head + _image.used - length) % CRASH_TAIL_SIZE;
+    size_t first = CRASH_TAIL_SIZE - start < length ? CRASH_TAIL_SIZE - start : length;
+    memcpy(out, _image.data + start, first);
+    memcpy(out + first, _image.data, length - first);
+    return length;
+}
+
+/**
+ * @brief Get the number of bytes of text
+ *
+ * @return size_t
+ */
+size_t CrashTail::getLength() const{
+    return _image.used;
+}
+
+/**
+ * @brief Get the image as words (for reading and writing RTC memory)
+ *
+ * @return uint32_t* CRASH_RTC_WORDS words
+ */
+uint32_t* CrashTail::getWords(){
+    return (uint32_t*)&_image;
+}
+
+/**
+ * @brief Get the words which were changed since clearDirty()
+ *
+ * @param firstWord first changed word
+ * @param wordCount number of words to write
+ * @return true if there are changes
+ */
+bool CrashTail::getDirty(uint8_t *firstWord, uint8_t *wordCount) const{
+    if(_dirtyFrom >= _dirtyTo) return false;
+    *firstWord = _dirtyFrom / 4;
+    *wordCount = (_dirtyTo + 3) / 4 - *firstWord;
+    return true;
+}
+
+/**
+ * @brief Mark all changes as written
+ *
+ */
+void CrashTail::clearDirty(){
+    _dirtyFrom = sizeof(_image);
+    _dirtyTo = 0;
+}
+
+/**
+ * @brief Extend the changed byte range of the image
+ *
+ * @param from first byte
+ * @param to end (exclusive)
+ */
+void CrashTail::markDirty(size_t from, size_t to){
+    if(from < _dirtyFrom) _dirtyFrom = from;
+    if(to > _dirtyTo) _dirtyTo = to;
+}
+
+/**
+ * @brief Fill a crash record with the reset info and the newest text of the tail
+ *
+ * @param record slot to fill
+ * @param sequence number of the record
+ * @param epoch current time (0 if unknown)
+ * @param reason rst_info.reason
+ * @param exccause rst_info.exccause
+ * @param epc1 rst_info.epc1
+ * @param excvaddr rst_info.excvaddr
+ * @param tail log lines before the reset
+ */
+void CrashLog::makeRecord(CrashRecord *record, uint32_t sequence, uint32_t epoch, uint32_t reason, uint32_t exccause,
+                          uint32_t epc1, uint32_t excvaddr, const CrashTail *tail){
+    memset(record, 0, sizeof(CrashRecord));
+    record->magic = CRASH_RECORD_MAGIC;
+    record->sequence = sequence;
+    record->epoch = epoch;
+    record->reason = reason;
+    record->exccause = exccause;
+    record->epc1 = epc1;
+    record->excvaddr = excvaddr;
+    record->length = tail->copyTo(record->text, sizeof(record->text));
+}
+
+/**
+ * @brief Check if a slot of the crash file holds a record
+ *
+ * @param record slot read from the file
+ * @return true if valid
+ */
+bool CrashLog::isValid(const CrashRecord *record){
+    return record->magic == CRASH_RECORD_MAGIC && record->length <= sizeof(record->text);
+}
+
+/**
+ * @brief Get the position of a record in the crash file
+ *
+ * @param sequence number of the record
+ * @return uint32_t offset in bytes, multiple of CRASH_SLOT_SIZE
+ */
+uint32_t CrashLog::slotOffset(uint32_t sequence){
+    return (sequence % CRASH_SLOT_COUNT) * CRASH_SLOT_SIZE;
+}
+
+/**
+ * @brief Get the name of a reset reason (rst_info.reason)
+ *
+ * @param reason
+ * @return const char*
+ */
+const char* CrashLog::getReasonName(uint32_t reason){
+    switch(reason){
+        case 0: return "power on";
+        case 1: return "hardware watchdog";
+        case 2: return "exception";
+        case 3: return "software watchdog";
+        case 4: return "soft restart";
+        case 5: return "deep sleep wake";
+        case 6: return "external reset";
+    }
+    return "unknown";
+}
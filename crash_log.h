@@ -0,0 +1,83 @@
+/**
+ * @file crash_log.h
+ * @brief Postmortem log: tail of the log lines in RTC memory, crash records in a LittleFS file
+ *
+ * Every log line is mirrored into CrashTail, a byte ring in an image of RTC user memory which
+ * keeps the newest text. RTC memory survives exceptions and watchdog resets, so after such a
+ * reset the tail (and the exception info of the reset) is written into one slot of the
+ * preallocated crash file. The file is a ring of CRASH_SLOT_COUNT slots of CRASH_SLOT_SIZE bytes,
+ * a record is always written as one whole, page-aligned slot.
+ *
+ * Only the words changed by an append have to be written to RTC memory (getDirty()).
+ *
+ */
+
+#ifndef crash_log_h
+#define crash_log_h
+
+#include <Arduino.h>
+#include <stddef.h>
+
+#define CRASH_RTC_BLOCK 40                  // RTC user memory block, behind the RtcTimeRecord (RTC_TIME_BLOCK 32, 7 blocks)
+#define CRASH_RTC_WORDS 88                  // up to the end of the 512 bytes of RTC user memory
+#define CRASH_TAIL_MAGIC 0x4C435257UL       // "WRCL"
+#define CRASH_TAIL_SIZE ((CRASH_RTC_WORDS - 2) * 4)
+
+#define CRASH_FILE "/crashlog.bin"
+#define CRASH_RECORD_MAGIC 0x52435257UL     // "WRCR"
+#define CRASH_SLOT_SIZE 512                 // two flash pages
+#define CRASH_SLOT_COUNT 8
+#define CRASH_FILE_SIZE (CRASH_SLOT_SIZE * CRASH_SLOT_COUNT)
+
+struct CrashTailImage {
+    uint32_t magic;
+    uint16_t head;                          // oldest byte
+    uint16_t used;
+    char data[CRASH_TAIL_SIZE];
+};
+
+struct CrashRecord {
+    uint32_t magic;
+    uint32_t sequence;                      // incremented per record, selects the slot
+    uint32_t epoch;                         // time of the boot after the crash (0 if unknown)
+    uint32_t reason;                        // rst_info of the reset
+    uint32_t exccause;
+    uint32_t epc1;
+    uint32_t excvaddr;
+    uint16_t length;                        // bytes of text
+    uint16_t reserved;
+    char text[CRASH_SLOT_SIZE - 32];        // log lines before the reset, oldest first
+};
+
+class CrashTail{
+
+    public:
+        CrashTail();
+        void clear();
+        bool restore();
+        void append(const char *text, size_t length);
+        size_t copyTo(char *out, size_t size) const;
+        size_t getLength() const;
+        uint32_t* getWords();
+        bool getDirty(uint8_t *firstWord, uint8_t *wordCount) const;
+        void clearDirty();
+
+    private:
+        CrashTailImage _image;
+        uint16_t _dirtyFrom;                // byte range of the image changed since clearDirty()
+        uint16_t _dirtyTo;
+
+        void markDirty(size_t from, size_t to);
+};
+
+class CrashLog{
+
+    public:
+        static void makeRecord(CrashRecord *record, uint32_t sequence, uint32_t epoch, uint32_t reason, uint32_t exccause,
+                               uint32_t epc1, uint32_t excvaddr, const CrashTail *tail);
+        static bool isValid(const CrashRecord *record);
+        static uint32_t slotOffset(uint32_t sequence);
+        static const char* getReasonName(uint32_t reason);
+};
+
+#endif
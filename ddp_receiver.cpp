@@ -0,0 +1,263 @@
+#include "ddp_receiver.h"
+
+#define DDP_MAX_PACKETS_PER_LOOP 8      // packets handled per loop() call at most
+
+/**
+ * @brief Construct a new DdpReceiver object
+ *
+ * @param sink receives the pixels (e.g. LEDMatrix)
+ * @param width width of the matrix
+ * @param height height of the matrix
+ */
+DdpReceiver::DdpReceiver(LedFrameSink *sink, uint8_t width, uint8_t height){
+    _sink = sink;
+    _width = width;
+    _height = height;
+    _lastSequence = 0;
+    _lastPacket = 0;
+    _pixelIndex = 0;
+    _dataRemaining = 0;
+    _pixelLength = 0;
+    _push = false;
+    _packets = 0;
+    _frames = 0;
+    _lost = 0;
+    _late = 0;
+    _invalid = 0;
+}
+
+/**
+ * @brief Start listening
+ *
+ * @param port UDP port (DDP_PORT)
+ */
+void DdpReceiver::begin(uint16_t port){
+    _udp.begin(port);
+}
+
+/**
+ * @brief Handle the received packets (call from the main loop)
+ *
+ * Returns after a packet with the push flag, so the frame can be shown before the next one is
+ * decoded into the same grid.
+ *
+ * @param now millis()
+ * @return DdpResult ddp_frame if a frame is complete and should be shown, ddp_data if only
+ *         pixels were received
+ */
+DdpResult DdpReceiver::loop(uint32_t now){
+    DdpResult result = ddp_ignored;
+    int packetLength;
+    for(uint8_t i = 0; i < DDP_MAX_PACKETS_PER_LOOP && (packetLength = _udp.parsePacket()) > 0; i++){
+        uint8_t header[DDP_HEADER_SIZE_TIMECODE];
+        if(packetLength < DDP_HEADER_SIZE || _udp.read(header, DDP_HEADER_SIZE) != DDP_HEADER_SIZE){
+            _invalid++;
+            continue;
+        }
+        if((header[0] & DDP_FLAG_TIMECODE) && (packetLength < DDP_HEADER_SIZE_TIMECODE ||
+           _udp.read(header + DDP_HEADER_SIZE, DDP_HEADER_SIZE_TIMECODE - DDP_HEADER_SIZE) != DDP_HEADER_SIZE_TIMECODE - DDP_HEADER_SIZE)){
+            _invalid++;
+            continue;
+        }
+        if(!startPacket(header, packetLength, now)) continue;
+        uint8_t chunk[DDP_READ_CHUNK];
+        while(_dataRemaining > 0){
+            int length = _udp.read(chunk, _dataRemaining < sizeof(chunk) ? _dataRemaining : sizeof(chunk));
+            if(length <= 0) break;
+            feed(chunk, length);
+        }
+        DdpResult packetResult = endPacket();
+        if(packetResult > result) result = packetResult;
+        if(result == ddp_frame) break;
+    }
+    return result;
+}
+
+/**
+ * @brief Handle a complete packet from a buffer
+ *
+ * @param data datagram
+ * @param length length of the datagram
+ * @param now millis()
+ * @return DdpResult ddp_frame if a frame is complete and should be shown
+ */
+DdpResult DdpReceiver::handlePacket(const uint8_t *data, size_t length, uint32_t now){
+    if(length < DDP_HEADER_SIZE){
+        _invalid++;
+        return ddp_ignored;
+    }
+    size_t headerLength = (data[0] & DDP_FLAG_TIMECODE) ? DDP_HEADER_SIZE_TIMECODE : DDP_HEADER_SIZE;
+    if(length < headerLength){
+        _invalid++;
+        return ddp_ignored;
+    }
+    if(!startPacket(data, length, now)) return ddp_ignored;
+    feed(data + headerLength, length - headerLength);
+    return endPacket();
+}
+
+/**
+ * @brief Get the number of accepted packets
+ *
+ * @return uint32_t
+ */
+uint32_t DdpReceiver::getPacketCount() const{
+    return _packets;
+}
+
+/**
+ * @brief Get the number of complete frames (packets with push flag)
+ *
+ * @return uint32_t
+ */
+uint32_t DdpReceiver::getFrameCount() const{
+    return _frames;
+}
+
+/**
+ * @brief Get the number of missing packets (gaps in the sequence numbers)
+ *
+ * @return uint32_t
+ */
+uint32_t DdpReceiver::getLostCount() const{
+    return _lost;
+}
+
+/**
+ * @brief Get the number of packets dropped because they arrived late or twice
+ *
+ * @return uint32_t
+ */
+uint32_t DdpReceiver::getLateCount() const{
+    return _late;
+}
+
+/**
+ * @brief Get the number of malformed packets
+ *
+ * @return uint32_t
+ */
+uint32_t DdpReceiver::getInvalidCount() const{
+    return _invalid;
+}
+
+/**
+ * @brief Write a DDP header for RGB data to the default display (used by senders and tests)
+ *
+ * @param out buffer of DDP_HEADER_SIZE bytes
+ * @param flags DDP_FLAG_PUSH or 0 (the version is added)
+ * @param sequence 1..15, 0 = not used
+ * @param offset offset of the data in the frame in bytes
+ * @param length length of the data in bytes
+ * @return size_t DDP_HEADER_SIZE
+ */
+size_t DdpReceiver::writeHeader(uint8_t *out, uint8_t flags, uint8_t sequence, uint32_t offset, uint16_t length){
+    out[0] = DDP_FLAG_VERSION_1 | (flags & ~(DDP_FLAG_VERSION_MASK | DDP_FLAG_TIMECODE));
+    out[1] = sequence & 0x0F;
+    out[2] = DDP_TYPE_RGB8;
+    out[3] = DDP_ID_DISPLAY;
+    out[4] = offset >> 24;
+    out[5] = offset >> 16;
+    out[6] = offset >> 8;
+    out[7] = offset;
+    out[8] = length >> 8;
+    out[9] = length;
+    return DDP_HEADER_SIZE;
+}
+
+/**
+ * @brief Check the header of a packet and prepare the decoding of its pixels
+ *
+ * @param header DDP_HEADER_SIZE bytes (DDP_HEADER_SIZE_TIMECODE with timecode flag)
+ * @param packetLength length of the whole datagram
+ * @param now millis()
+ * @return true if the pixels of the packet should be decoded
+ */
+bool DdpReceiver::startPacket(const uint8_t *header, size_t packetLength, uint32_t now){
+    uint8_t flags = header[0];
+    if((flags & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1){
+        _invalid++;
+        return false;
+    }
+    // queries, replies and storage requests are not supported, other destinations (status, config) neither
+    if((flags & (DDP_FLAG_QUERY | DDP_FLAG_REPLY | DDP_FLAG_STORAGE)) || (header[3] != DDP_ID_DISPLAY && header[3] != DDP_ID_ALL)){
+        return false;
+    }
+    size_t headerLength = (flags & DDP_FLAG_TIMECODE) ? DDP_HEADER_SIZE_TIMECODE : DDP_HEADER_SIZE;
+    uint32_t offset = ((uint32_t)header[4] << 24) | ((uint32_t)header[5] << 16) | ((uint32_t)header[6] << 8) | header[7];
+    uint16_t length = ((uint16_t)header[8] << 8) | header[9];
+    if((header[2] != DDP_TYPE_UNDEFINED && header[2] != DDP_TYPE_RGB8) || offset % 3 != 0 || length > packetLength - headerLength){
+        _invalid++;
+        return false;
+    }
+    if(!checkSequence(header[1] & 0x0F, now)){
+        _late++;
+        return false;
+    }
+    uint32_t pixelCount = (uint32_t)_width * _height;
+    _pixelIndex = offset / 3 < pixelCount ? offset / 3 : pixelCount;
+    _dataRemaining = length;
+    _pixelLength = 0;
+    _push = flags & DDP_FLAG_PUSH;
+    _lastPacket = now;
+    _packets++;
+    return true;
+}
+
+/**
+ * @brief Decode the next pixel bytes of the current packet
+ *
+ * @param data bytes
+ * @param length number of bytes (more than the remaining data are ignored)
+ */
+void DdpReceiver::feed(const uint8_t *data, size_t length){
+    if(length > _dataRemaining) length = _dataRemaining;
+    _dataRemaining -= length;
+    uint16_t pixelCount = (uint16_t)_width * _height;
+    for(size_t i = 0; i < length; i++){
+        _pixel[_pixelLength++] = data[i];
+        if(_pixelLength == 3){
+            // pixels outside of the matrix are ignored (sender configured for a larger display)
+            if(_pixelIndex < pixelCount){
+                uint32_t color = ((uint32_t)_pixel[0] << 16) | ((uint32_t)_pixel[1] << 8) | _pixel[2];
+                _sink->onPixel(_pixelIndex % _width, _pixelIndex / _width, color);
+                _pixelIndex++;
+            }
+            _pixelLength = 0;
+        }
+    }
+}
+
+/**
+ * @brief Finish the current packet
+ *
+ * @return DdpResult ddp_frame if the packet had the push flag
+ */
+DdpResult DdpReceiver::endPacket(){
+    _dataRemaining = 0;
+    if(_push){
+        _frames++;
+        return ddp_frame;
+    }
+    return ddp_data;
+}
+
+/**
+ * @brief Check the sequence number of a packet and count missing packets
+ *
+ * @param sequence 1..15, 0 = not used by the sender
+ * @param now millis()
+ * @return true if the packet is new, false if it is late or a duplicate
+ */
+bool DdpReceiver::checkSequence(uint8_t sequence, uint32_t now){
+    if(sequence == 0 || _lastSequence == 0 || now - _lastPacket >= DDP_SEQUENCE_TIMEOUT){
+        _lastSequence = sequence;
+        return true;
+    }
+    // distance in the cycle 1..15, up to 7 ahead counts as new, otherwise the packet is behind
+    uint8_t ahead = (sequence + 15 - _lastSequence) % 15;
+    if(ahead == 0 || ahead > 7) return false;
+    _lost += ahead - 1;
+    _lastSequence = sequence;
+    return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file ddp_receiver.h
+ * @brief Realtime LED frames via UDP (Distributed Display Protocol, DDP)
+ *
+ * DDP is the protocol of xLights, WLED, ... (port 4048). Every datagram has a header of 10 bytes
+ * (14 with timecode), all values big-endian:
+ *
+ *   0     flags: version 1 (0x40), push (0x01) = show the frame after this packet, query (0x02),
+ *         reply (0x04), storage (0x08), timecode (0x10)
+ *   1     sequence number 1..15 in the low 4 bits, 0 = not used
+ *   2     data type: 0x00 (undefined) or 0x0B (RGB, 8 bit per channel)
+ *   3     destination: 1 (default display) or 255 (all)
+ *   4..7  offset of the data in the frame in bytes (multiple of 3)
+ *   8..9  length of the data in bytes
+ *   (10..13 timecode, ignored)
+ *
+ * The data are RGB pixels row by row (top left first, pixel index = y * width + x), a frame can
+ * be split into several packets at any pixel boundary. The pixels are read from the UDP socket in
+ * small chunks and handed to a LedFrameSink directly, no frame buffer is needed.
+ *
+ * With sequence numbers packets which arrive late (or twice) are dropped and missing packets are
+ * counted. After DDP_SEQUENCE_TIMEOUT ms without packets any sequence number is accepted again
+ * (e.g. a restarted sender).
+ *
+ */
+
+#ifndef ddp_receiver_h
+#define ddp_receiver_h
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "led_frame.h"
+
+#define DDP_PORT 4048
+#define DDP_HEADER_SIZE 10
+#define DDP_HEADER_SIZE_TIMECODE 14
+#define DDP_FLAG_VERSION_MASK 0xC0
+#define DDP_FLAG_VERSION_1 0x40
+#define DDP_FLAG_PUSH 0x01
+#define DDP_FLAG_QUERY 0x02
+#define DDP_FLAG_REPLY 0x04
+#define DDP_FLAG_STORAGE 0x08
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_TYPE_UNDEFINED 0x00
+#define DDP_TYPE_RGB8 0x0B
+#define DDP_ID_DISPLAY 1
+#define DDP_ID_ALL 255
+#define DDP_SEQUENCE_TIMEOUT 1000
+#define DDP_READ_CHUNK 48               // bytes read from the socket at once (multiple of 3)
+
+// Result of a packet
+enum DdpResult {ddp_ignored = 0, ddp_data = 1, ddp_frame = 2};
+
+class DdpReceiver{
+
+    public:
+        DdpReceiver(LedFrameSink *sink, uint8_t width, uint8_t height);
+        void begin(uint16_t port);
+        DdpResult loop(uint32_t now);
+        DdpResult handlePacket(const uint8_t *data, size_t length, uint32_t now);
+        uint32_t getPacketCount() const;
+        uint32_t getFrameCount() const;
+        uint32_t getLostCount() const;
+        uint32_t getLateCount() const;
+        uint32_t getInvalidCount() const;
+        static size_t writeHeader(uint8_t *out, uint8_t flags, uint8_t sequence, uint32_t offset, uint16_t length);
+
+    protected:
+        WiFiUDP _udp;
+
+    private:
+        LedFrameSink *_sink;
+        uint8_t _width;
+        uint8_t _height;
+        uint8_t _lastSequence;          // 0 = no sequence seen (recently)
+        uint32_t _lastPacket;           // millis() of the last accepted packet
+        uint16_t _pixelIndex;           // next pixel of the current packet
+        uint16_t _dataRemaining;        // pixel bytes of the current packet not read yet
+        uint8_t _pixel[3];              // pixel split between two chunks
+        uint8_t _pixelLength;
+        bool _push;
+        uint32_t _packets;
+        uint32_t _frames;
+        uint32_t _lost;
+        uint32_t _late;
+        uint32_t _invalid;
+
+        bool startPacket(const uint8_t *header, size_t packetLength, uint32_t now);
+        void feed(const uint8_t *data, size_t length);
+        DdpResult endPacket();
+        bool checkSequence(uint8_t sequence, uint32_t now);
+};
+
+#endif
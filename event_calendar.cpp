@@ -0,0 +1,174 @@
+#include "event_calendar.h"
+
+/**
+ * @brief Construct a new empty EventCalendar object
+ *
+ */
+EventCalendar::EventCalendar(){
+    clear();
+}
+
+/**
+ * @brief Cancel all events
+ *
+ */
+void EventCalendar::clear(){
+    for(uint8_t i = 0; i < CALENDAR_MAX_EVENTS; i++){
+        _fireTime[i] = CALENDAR_NEVER;
+        _grace[i] = 0;
+    }
+    _nextFireTime = CALENDAR_NEVER;
+}
+
+/**
+ * @brief Set (or replace) the next fire time of an event
+ *
+ * @param id event id [0 ... CALENDAR_MAX_EVENTS-1]
+ * @param fireTime epoch seconds when the event is due
+ * @param graceSeconds maximum delay after which a delivery is reported as missed
+ * @return true if the event was scheduled
+ */
+bool EventCalendar::schedule(uint8_t id, time_t fireTime, uint32_t graceSeconds){
+    if(id >= CALENDAR_MAX_EVENTS || fireTime == CALENDAR_NEVER) return false;
+    _fireTime[id] = fireTime;
+    _grace[id] = graceSeconds;
+    updateNextFireTime();
+    return true;
+}
+
+/**
+ * @brief Remove an event from the calendar
+ *
+ * @param id event id
+ */
+void EventCalendar::cancel(uint8_t id){
+    if(id >= CALENDAR_MAX_EVENTS) return;
+    _fireTime[id] = CALENDAR_NEVER;
+    updateNextFireTime();
+}
+
+/**
+ * @brief Check if an event is pending
+ *
+ * @param id event id
+ * @return true if the event has a fire time
+ */
+bool EventCalendar::isScheduled(uint8_t id) const{
+    return id < CALENDAR_MAX_EVENTS && _fireTime[id] != CALENDAR_NEVER;
+}
+
+/**
+ * @brief Get the fire time of an event
+ *
+ * @param id event id
+ * @return time_t fire time or CALENDAR_NEVER
+ */
+time_t EventCalendar::getFireTime(uint8_t id) const{
+    return id < CALENDAR_MAX_EVENTS ? _fireTime[id] : CALENDAR_NEVER;
+}
+
+/**
+ * @brief Get the earliest fire time of all events (cached)
+ *
+ * @return time_t fire time or CALENDAR_NEVER
+ */
+time_t EventCalendar::getNextFireTime() const{
+    return _nextFireTime;
+}
+
+/**
+ * @brief Cheap check for the main loop if any event is due
+ *
+ * @param now current epoch seconds
+ * @return true if at least one event is due
+ */
+bool EventCalendar::isDue(time_t now) const{
+    return _nextFireTime != CALENDAR_NEVER && now >= _nextFireTime;
+}
+
+/**
+ * @brief Remove and return the earliest due event. Ties are resolved by the lower id,
+ *        so the delivery order after a stall is deterministic.
+ *
+ * @param now current epoch seconds
+ * @param missed set to true if the event is delivered later than its grace period (may be nullptr)
+ * @param fireTime set to the fire time of the event, e.g. to schedule the next one from it (may be nullptr)
+ * @return int16_t id of the due event or -1 if nothing is due
+ */
+int16_t EventCalendar::popDue(time_t now, bool *missed, time_t *fireTime){
+    if(!isDue(now)) return -1;
+    int16_t due = -1;
+    for(uint8_t i = 0; i < CALENDAR_MAX_EVENTS; i++){
+        if(_fireTime[i] != CALENDAR_NEVER && _fireTime[i] <= now){
+            if(due < 0 || _fireTime[i] < _fireTime[due]) due = i;
+        }
+    }
+    if(due < 0) return -1;
+    if(missed != nullptr){
+        *missed = (uint32_t)(now - _fireTime[due]) > _grace[due];
+    }
+    if(fireTime != nullptr){
+        *fireTime = _fireTime[due];
+    }
+    _fireTime[due] = CALENDAR_NEVER;
+    updateNextFireTime();
+    return due;
+}
+
+/**
+ * @brief Calculate the next local time with the given hour, minute and second (strictly after now)
+ *
+ * @param now current epoch seconds
+ * @return time_t epoch seconds of the next occurrence
+ */
+time_t EventCalendar::nextDailyOccurrence(time_t now, uint8_t hour, uint8_t minute, uint8_t second){
+    struct tm t;
+    localtime_r(&now, &t);
+    t.tm_hour = hour;
+    t.tm_min = minute;
+    t.tm_sec = second;
+    t.tm_isdst = -1;
+    time_t candidate = mktime(&t);
+    if(candidate <= now){
+        localtime_r(&now, &t);
+        t.tm_mday += 1;
+        t.tm_hour = hour;
+        t.tm_min = minute;
+        t.tm_sec = second;
+        t.tm_isdst = -1;
+        candidate = mktime(&t);
+    }
+    return candidate;
+}
+
+/**
+ * @brief Calculate the next local time with the given minute and second (strictly after now)
+ *
+ * @param now current epoch seconds
+ * @return time_t epoch seconds of the next occurrence
+ */
+time_t EventCalendar::nextHourlyOccurrence(time_t now, uint8_t minute, uint8_t second){
+    struct tm t;
+    localtime_r(&now, &t);
+    t.tm_min = minute;
+    t.tm_sec = second;
+    t.tm_isdst = -1;
+    time_t candidate = mktime(&t);
+    if(candidate <= now){
+        candidate += 3600;
+    }
+    return candidate;
+}
+
+/**
+ * @brief Recalculate the cached earliest fire time
+ *
+ */
+void EventCalendar::updateNextFireTime(){
+    _nextFireTime = CALENDAR_NEVER;
+    for(uint8_t i = 0; i < CALENDAR_MAX_EVENTS; i++){
+        if(_fireTime[i] != CALENDAR_NEVER && (_nextFireTime == CALENDAR_NEVER || _fireTime[i] < _nextFireTime)){
+            _nextFireTime = _fireTime[i];
+        }
+    }
+}
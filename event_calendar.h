@@ -0,0 +1,44 @@
+/**
+ * @file event_calendar.h
+ * @brief Calendar of time-triggered events (one pending fire time per event id)
+ *
+ * The calendar keeps the next fire time (epoch seconds) of every time based feature
+ * and caches the earliest one, so the main loop only needs one comparison to know
+ * if something is due. Events that were delayed by a loop stall are still delivered
+ * in fire time order, flagged as missed if the delay exceeds the grace period of the event.
+ *
+ */
+
+#ifndef event_calendar_h
+#define event_calendar_h
+
+#include <Arduino.h>
+#include <time.h>
+
+#define CALENDAR_MAX_EVENTS 8
+#define CALENDAR_NEVER 0
+
+class EventCalendar{
+
+    public:
+        EventCalendar();
+        void clear();
+        bool schedule(uint8_t id, time_t fireTime, uint32_t graceSeconds);
+        void cancel(uint8_t id);
+        bool isScheduled(uint8_t id) const;
+        time_t getFireTime(uint8_t id) const;
+        time_t getNextFireTime() const;
+        bool isDue(time_t now) const;
+        int16_t popDue(time_t now, bool *missed, time_t *fireTime = nullptr);
+        static time_t nextDailyOccurrence(time_t now, uint8_t hour, uint8_t minute, uint8_t second);
+        static time_t nextHourlyOccurrence(time_t now, uint8_t minute, uint8_t second);
+
+    private:
+        time_t _fireTime[CALENDAR_MAX_EVENTS];
+        uint32_t _grace[CALENDAR_MAX_EVENTS];
+        time_t _nextFireTime;
+
+        void updateNextFireTime();
+};
+
+#endif
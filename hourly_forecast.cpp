@@ -0,0 +1,234 @@
+#include "hourly_forecast.h"
+#include "weather_parser.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Construct a new HourlyForecast object (empty)
+ *
+ */
+HourlyForecast::HourlyForecast(){
+    clear();
+}
+
+/**
+ * @brief Remove all values
+ *
+ */
+void HourlyForecast::clear(){
+    _startDay = -1;
+    _startHour = 0;
+    _hasBase = false;
+    _base = 0;
+    _shift = 0;
+    for(uint8_t i = 0; i < FORECAST_HOURS; i++){
+        _delta[i] = FORECAST_DELTA_MISSING;
+        _code[i] = FORECAST_CODE_MISSING;
+    }
+}
+
+/**
+ * @brief Set the local time of index 0
+ *
+ * @param isoTime local time as sent by Open-Meteo ("2024-05-10T00:00")
+ * @return true if the time could be parsed
+ */
+bool HourlyForecast::setStart(const char *isoTime){
+    char *end;
+    long year = strtol(isoTime, &end, 10);
+    if(*end != '-') return false;
+    long month = strtol(end + 1, &end, 10);
+    if(*end != '-') return false;
+    long day = strtol(end + 1, &end, 10);
+    if(*end != 'T') return false;
+    long hour = strtol(end + 1, &end, 10);
+    if(year < 1970 || month < 1 || month > 12 || day < 1 || day > 31 || hour < 0 || hour > 23) return false;
+    _startDay = daysFromCivil(year, month, day);
+    _startHour = hour;
+    return true;
+}
+
+/**
+ * @brief Check if the local time of index 0 is known
+ *
+ * @return true if known
+ */
+bool HourlyForecast::hasStart() const{
+    return _startDay >= 0;
+}
+
+/**
+ * @brief Store the temperature of an hour
+ *
+ * @param index hour since the start
+ * @param celsius temperature in degree celsius
+ */
+void HourlyForecast::setTemperature(uint8_t index, float celsius){
+    if(index >= FORECAST_HOURS) return;
+    int32_t tenths = lroundf(celsius * 10);
+    if(!_hasBase){
+        _base = (int16_t)tenths;
+        _hasBase = true;
+    }
+    _delta[index] = FORECAST_DELTA_MISSING;
+    while(true){
+        int32_t unit = 1L << _shift;
+        int32_t diff = tenths - _base;
+        int32_t delta = (diff >= 0 ? diff + unit / 2 : diff - unit / 2) / unit;
+        int32_t low = delta;
+        int32_t high = delta;
+        for(uint8_t i = 0; i < FORECAST_HOURS; i++){
+            if(_delta[i] == FORECAST_DELTA_MISSING) continue;
+            if(_delta[i] < low) low = _delta[i];
+            if(_delta[i] > high) high = _delta[i];
+        }
+        if(high - low > 254 && _shift < 15){
+            // range too wide for the step: coarsen and requantize (halve with rounding away from zero)
+            _shift++;
+            for(uint8_t i = 0; i < FORECAST_HOURS; i++){
+                if(_delta[i] == FORECAST_DELTA_MISSING) continue;
+                _delta[i] = (int8_t)((_delta[i] + (_delta[i] >= 0 ? 1 : -1)) / 2);
+            }
+            continue;
+        }
+        // move the base by whole steps so all deltas fit into -127 ... 127 (-128 marks missing values)
+        int32_t move = high > 127 ? high - 127 : (low < -127 ? low + 127 : 0);
+        if(move != 0){
+            for(uint8_t i = 0; i < FORECAST_HOURS; i++){
+                if(_delta[i] != FORECAST_DELTA_MISSING) _delta[i] = (int8_t)(_delta[i] - move);
+            }
+            _base = (int16_t)(_base + move * unit);
+        }
+        _delta[index] = (int8_t)(delta - move);
+        return;
+    }
+}
+
+/**
+ * @brief Store the weather code of an hour
+ *
+ * @param index hour since the start
+ * @param code WMO weather code
+ */
+void HourlyForecast::setWeatherCode(uint8_t index, int code){
+    if(index >= FORECAST_HOURS) return;
+    _code[index] = (code >= 0 && code < FORECAST_CODE_MISSING) ? (uint8_t)code : FORECAST_CODE_MISSING;
+}
+
+/**
+ * @brief Get the index of a local time
+ *
+ * @param local local time (from localtime)
+ * @return int16_t index, -1 if the time is not covered by the forecast
+ */
+int16_t HourlyForecast::getIndex(const struct tm *local) const{
+    if(_startDay < 0) return -1;
+    int32_t day = daysFromCivil(local->tm_year + 1900, local->tm_mon + 1, local->tm_mday);
+    int32_t index = (day - _startDay) * 24 + local->tm_hour - _startHour;
+    if(index < 0 || index >= FORECAST_HOURS) return -1;
+    return (int16_t)index;
+}
+
+/**
+ * @brief Check if the temperature of an hour is known
+ *
+ * @param index hour since the start
+ * @return true if known
+ */
+bool HourlyForecast::hasTemperature(uint8_t index) const{
+    return index < FORECAST_HOURS && _delta[index] != FORECAST_DELTA_MISSING;
+}
+
+/**
+ * @brief Get the temperature of an hour
+ *
+ * @param index hour since the start
+ * @return int16_t 1/10 degree celsius (WEATHER_MISSING * 10 if missing)
+ */
+int16_t HourlyForecast::getTemperatureTenths(uint8_t index) const{
+    if(!hasTemperature(index)) return WEATHER_MISSING * 10;
+    return _base + _delta[index] * (1 << _shift);
+}
+
+/**
+ * @brief Get the temperature of an hour
+ *
+ * @param index hour since the start
+ * @return float degree celsius (WEATHER_MISSING if missing)
+ */
+float HourlyForecast::getTemperature(uint8_t index) const{
+    if(!hasTemperature(index)) return WEATHER_MISSING;
+    return getTemperatureTenths(index) / 10.0f;
+}
+
+/**
+ * @brief Get the weather code of an hour
+ *
+ * @param index hour since the start
+ * @return int WMO code (WEATHER_MISSING if missing)
+ */
+int HourlyForecast::getWeatherCode(uint8_t index) const{
+    if(index >= FORECAST_HOURS || _code[index] == FORECAST_CODE_MISSING) return WEATHER_MISSING;
+    return _code[index];
+}
+
+/**
+ * @brief Get the resolution of the stored temperatures
+ *
+ * @return uint8_t step in 1/10 degree (1 unless the range exceeds 25.4 degree)
+ */
+uint8_t HourlyForecast::getStep() const{
+    return 1 << _shift;
+}
+
+/**
+ * @brief Copy the forecast to a record with a fixed layout (e.g. to store it in a file)
+ *
+ * @param record
+ */
+void HourlyForecast::pack(HourlyForecastRecord *record) const{
+    memset(record, 0, sizeof(HourlyForecastRecord));
+    record->startDay = _startDay;
+    record->base = _base;
+    record->startHour = _startHour;
+    record->shift = _shift;
+    record->hasBase = _hasBase ? 1 : 0;
+    memcpy(record->delta, _delta, sizeof(_delta));
+    memcpy(record->code, _code, sizeof(_code));
+}
+
+/**
+ * @brief Restore the forecast from a record
+ *
+ * @param record
+ * @return true if the record is plausible, otherwise the forecast is not changed
+ */
+bool HourlyForecast::unpack(const HourlyForecastRecord *record){
+    if(record->startDay < -1 || record->startHour > 23 || record->shift > 15 || record->hasBase > 1) return false;
+    _startDay = record->startDay;
+    _base = record->base;
+    _startHour = record->startHour;
+    _shift = record->shift;
+    _hasBase = record->hasBase == 1;
+    memcpy(_delta, record->delta, sizeof(_delta));
+    memcpy(_code, record->code, sizeof(_code));
+    return true;
+}
+
+/**
+ * @brief Get the number of days since 1970-01-01 of a date (proleptic gregorian calendar)
+ *
+ * @param year e.g. 2024
+ * @param month 1 ... 12
+ * @param day 1 ... 31
+ * @return int32_t days
+ */
+int32_t HourlyForecast::daysFromCivil(int year, int month, int day){
+    year -= month <= 2;
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    int32_t yearOfEra = year - era * 400;
+    int32_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
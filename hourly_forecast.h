@@ -0,0 +1,63 @@
+/**
+ * @file hourly_forecast.h
+ * @brief Packed 48 hour forecast (temperature and weather code per hour)
+ *
+ * Temperatures are stored as int8 deltas to a base temperature in steps of 0.1 degree. The base
+ * is moved by whole steps when a new value does not fit, and if the range of the forecast exceeds
+ * 25.4 degree the step is doubled as often as needed and the stored deltas are requantized, so
+ * values can be added one by one while a response is parsed. Index 0 is the local hour given by setStart(), a lookup
+ * by local time is O(1). For the weather cache the forecast is copied to a HourlyForecastRecord (108 B, no padding).
+ *
+ */
+
+#ifndef hourly_forecast_h
+#define hourly_forecast_h
+
+#include <Arduino.h>
+#include <time.h>
+
+#define FORECAST_HOURS 48
+#define FORECAST_DELTA_MISSING -128
+#define FORECAST_CODE_MISSING 0xFF
+
+struct HourlyForecastRecord {
+    int32_t startDay;               // -1 if unknown
+    int16_t base;
+    uint8_t startHour;
+    uint8_t shift;
+    uint8_t hasBase;
+    uint8_t reserved[3];
+    int8_t delta[FORECAST_HOURS];
+    uint8_t code[FORECAST_HOURS];
+};
+
+class HourlyForecast{
+
+    public:
+        HourlyForecast();
+        void clear();
+        bool setStart(const char *isoTime);
+        bool hasStart() const;
+        void setTemperature(uint8_t index, float celsius);
+        void setWeatherCode(uint8_t index, int code);
+        int16_t getIndex(const struct tm *local) const;
+        bool hasTemperature(uint8_t index) const;
+        int16_t getTemperatureTenths(uint8_t index) const;
+        float getTemperature(uint8_t index) const;
+        int getWeatherCode(uint8_t index) const;
+        uint8_t getStep() const;
+        void pack(HourlyForecastRecord *record) const;
+        bool unpack(const HourlyForecastRecord *record);
+        static int32_t daysFromCivil(int year, int month, int day);
+
+    private:
+        int32_t _startDay;      // local date of index 0 (days since 1970-01-01), -1 if unknown
+        uint8_t _startHour;     // local hour of index 0
+        bool _hasBase;
+        int16_t _base;          // 1/10 degree
+        uint8_t _shift;         // temperature step is (1 << _shift) * 0.1 degree
+        int8_t _delta[FORECAST_HOURS];
+        uint8_t _code[FORECAST_HOURS];
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "ip_api_parser.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define IPAPI_FOUND_SUCCESS 0x01
+#define IPAPI_FOUND_TIMEZONE 0x02
+#define IPAPI_FOUND_OFFSET 0x04
+#define IPAPI_FOUND_LAT 0x08
+#define IPAPI_FOUND_LON 0x10
+
+/**
+ * @brief Construct a new IpApiParser object
+ *
+ */
+IpApiParser::IpApiParser() : _json(this){
+    reset();
+}
+
+/**
+ * @brief Prepare for a new response
+ *
+ */
+void IpApiParser::reset(){
+    _json.reset();
+    _timezone[0] = '\0';
+    _offset = 0;
+    _lat = 0.0;
+    _lon = 0.0;
+    _found = 0;
+}
+
+/**
+ * @brief Parse the next chunk of the response body
+ *
+ * @param data chunk (does not need to be null terminated)
+ * @param length number of bytes in the chunk
+ * @return true if the response is still valid JSON
+ */
+bool IpApiParser::feed(const char *data, size_t length){
+    return _json.feed(data, length);
+}
+
+/**
+ * @brief Signal the end of the response body
+ *
+ * @return true if the response was complete and valid JSON
+ */
+bool IpApiParser::finish(){
+    return _json.finish();
+}
+
+/**
+ * @brief Check if the response is malformed
+ *
+ * @return true on error
+ */
+bool IpApiParser::hasError() const{
+    return _json.hasError();
+}
+
+/**
+ * @brief Check if the end of the JSON document was reached
+ *
+ * @return true if done
+ */
+bool IpApiParser::isDone() const{
+    return _json.isDone();
+}
+
+/**
+ * @brief Check if the API reported success and the timezone is known
+ *
+ * @return true if the response can be used
+ */
+bool IpApiParser::isSuccess() const{
+    uint8_t needed = IPAPI_FOUND_SUCCESS | IPAPI_FOUND_TIMEZONE;
+    return !_json.hasError() && _json.isDone() && (_found & needed) == needed;
+}
+
+/**
+ * @brief Get the IANA timezone name
+ *
+ * @return const char* e.g. "Europe/Berlin", empty if not found
+ */
+const char* IpApiParser::getTimezone() const{
+    return _timezone;
+}
+
+/**
+ * @brief Get the current UTC offset (including daylight saving time)
+ *
+ * @return long seconds, 0 if not found
+ */
+long IpApiParser::getOffset() const{
+    return _offset;
+}
+
+/**
+ * @brief Check if latitude and longitude were found
+ *
+ * @return true if both are known
+ */
+bool IpApiParser::hasLocation() const{
+    return (_found & (IPAPI_FOUND_LAT | IPAPI_FOUND_LON)) == (IPAPI_FOUND_LAT | IPAPI_FOUND_LON);
+}
+
+/**
+ * @brief Get the latitude of the public IP address
+ *
+ * @return float degree, 0 if not found
+ */
+float IpApiParser::getLatitude() const{
+    return _lat;
+}
+
+/**
+ * @brief Get the longitude of the public IP address
+ *
+ * @return float degree, 0 if not found
+ */
+float IpApiParser::getLongitude() const{
+    return _lon;
+}
+
+/**
+ * @brief Store the value if it is one of the wanted top level fields
+ *
+ * @param json tokenizer with the path of the value
+ * @param type type of the value
+ * @param value text of the value
+ */
+void IpApiParser::onValue(const JsonStream &json, JsonValueType type, const char *value){
+    if(json.getDepth() != 1 || json.isArray(0)) return;
+    const char *key = json.getKey(0);
+
+    if(type == json_string){
+        if(strcmp(key, "status") == 0){
+            if(strcmp(value, "success") == 0) _found |= IPAPI_FOUND_SUCCESS;
+            else _found &= ~IPAPI_FOUND_SUCCESS;
+        }
+        else if(strcmp(key, "timezone") == 0 && value[0] != '\0'){
+            strcpy(_timezone, value);
+            _found |= IPAPI_FOUND_TIMEZONE;
+        }
+    }
+    else if(type == json_number){
+        if(strcmp(key, "offset") == 0){
+            _offset = atol(value);
+            _found |= IPAPI_FOUND_OFFSET;
+        }
+        else if(strcmp(key, "lat") == 0){
+            _lat = atof(value);
+            _found |= IPAPI_FOUND_LAT;
+        }
+        else if(strcmp(key, "lon") == 0){
+            _lon = atof(value);
+            _found |= IPAPI_FOUND_LON;
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/**
+ * @file ip_api_parser.h
+ * @brief Extracts timezone, UTC offset and location from an ip-api.com JSON response
+ *
+ * Only the top level keys are evaluated, so the order of the fields, whitespace and nested
+ * objects in the response do not matter. A response is usable if the status is "success" and
+ * the timezone was found.
+ *
+ */
+
+#ifndef ip_api_parser_h
+#define ip_api_parser_h
+
+#include <Arduino.h>
+#include "json_stream.h"
+
+#define IPAPI_TIMEZONE_SIZE JSON_STREAM_MAX_VALUE
+#define IPAPI_CHUNK_SIZE 64                 // bytes read from the stream per parser call (on the stack)
+
+class IpApiParser : public JsonHandler{
+
+    public:
+        IpApiParser();
+        void reset();
+        bool feed(const char *data, size_t length);
+        bool finish();
+        bool hasError() const;
+        bool isDone() const;
+        bool isSuccess() const;
+        const char* getTimezone() const;
+        long getOffset() const;
+        bool hasLocation() const;
+        float getLatitude() const;
+        float getLongitude() const;
+        void onValue(const JsonStream &json, JsonValueType type, const char *value) override;
+
+    private:
+        JsonStream _json;
+        char _timezone[IPAPI_TIMEZONE_SIZE];
+        long _offset;
+        float _lat;
+        float _lon;
+        uint8_t _found;
+};
+
+#endif
@@ -0,0 +1,308 @@
+#include "json_stream.h"
+#include <ctype.h>
+#include <string.h>
+
+/**
+ * @brief Construct a new JsonStream object
+ *
+ * @param handler receives all scalar values
+ */
+JsonStream::JsonStream(JsonHandler *handler){
+    _handler = handler;
+    reset();
+}
+
+/**
+ * @brief Prepare for a new document
+ *
+ */
+void JsonStream::reset(){
+    _depth = 0;
+    _state = js_value;
+    _stringIsKey = false;
+    _tokenLength = 0;
+    _token[0] = '\0';
+    _unicodeDigits = 0;
+}
+
+/**
+ * @brief Process the next chunk of the document
+ *
+ * @param data chunk (does not need to be null terminated)
+ * @param length number of bytes in the chunk
+ * @return true if the document is still valid
+ */
+bool JsonStream::feed(const char *data, size_t length){
+    for(size_t i = 0; i < length && _state != js_error; i++){
+        processChar(data[i]);
+    }
+    return _state != js_error;
+}
+
+/**
+ * @brief Signal the end of the input (completes a number at the very end of the document)
+ *
+ * @return true if the document was complete and valid
+ */
+bool JsonStream::finish(){
+    if(_state == js_literal && emitLiteral()){
+        endValue();
+    }
+    return _state == js_done;
+}
+
+/**
+ * @brief Check if the document is malformed
+ *
+ * @return true on error
+ */
+bool JsonStream::hasError() const{
+    return _state == js_error;
+}
+
+/**
+ * @brief Check if the root value was parsed completely
+ *
+ * @return true if done
+ */
+bool JsonStream::isDone() const{
+    return _state == js_done;
+}
+
+/**
+ * @brief Get the number of open objects/arrays around the current value
+ *
+ * @return uint8_t
+ */
+uint8_t JsonStream::getDepth() const{
+    return _depth;
+}
+
+/**
+ * @brief Get the key of the current member of an enclosing object
+ *
+ * @param level 0 is the root
+ * @return const char* key ("" for arrays or invalid levels)
+ */
+const char* JsonStream::getKey(uint8_t level) const{
+    if(level >= _depth || _levels[level].isArray) return "";
+    return _levels[level].key;
+}
+
+/**
+ * @brief Check if an enclosing level is an array
+ *
+ * @param level 0 is the root
+ * @return true if array
+ */
+bool JsonStream::isArray(uint8_t level) const{
+    return level < _depth && _levels[level].isArray;
+}
+
+/**
+ * @brief Get the index of the current element of an enclosing array
+ *
+ * @param level 0 is the root
+ * @return uint16_t index (0 for objects or invalid levels)
+ */
+uint16_t JsonStream::getIndex(uint8_t level) const{
+    if(level >= _depth || !_levels[level].isArray) return 0;
+    return _levels[level].index;
+}
+
+/**
+ * @brief Advance the state machine by one character
+ *
+ * @param c
+ * @return true if the document is still valid
+ */
+bool JsonStream::processChar(char c){
+    bool whitespace = (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    switch(_state){
+        case js_value:
+            if(whitespace) return true;
+            if(c == ']' && _depth > 0 && _levels[_depth - 1].isArray) return closeLevel(true);
+            return startValue(c);
+        case js_key:
+            if(whitespace) return true;
+            if(c == '}') return closeLevel(false);
+            if(c != '"') break;
+            _stringIsKey = true;
+            _tokenLength = 0;
+            _state = js_string;
+            return true;
+        case js_colon:
+            if(whitespace) return true;
+            if(c != ':') break;
+            _state = js_value;
+            return true;
+        case js_after_value:
+            if(whitespace) return true;
+            if(c == ']') return closeLevel(true);
+            if(c == '}') return closeLevel(false);
+            if(c != ',') break;
+            if(_levels[_depth - 1].isArray){
+                _levels[_depth - 1].index++;
+                _state = js_value;
+            }
+            else{
+                _state = js_key;
+            }
+            return true;
+        case js_string:
+            if(c == '\\'){
+                _state = js_string_escape;
+            }
+            else if(c == '"'){
+                _token[_tokenLength] = '\0';
+                if(_stringIsKey){
+                    uint8_t keyLength = _tokenLength < JSON_STREAM_MAX_KEY - 1 ? _tokenLength : JSON_STREAM_MAX_KEY - 1;
+                    memcpy(_levels[_depth - 1].key, _token, keyLength);
+                    _levels[_depth - 1].key[keyLength] = '\0';
+                    _state = js_colon;
+                }
+                else{
+                    _handler->onValue(*this, json_string, _token);
+                    endValue();
+                }
+            }
+            else{
+                appendToken(c);
+            }
+            return true;
+        case js_string_escape:
+            switch(c){
+                case 'n': appendToken('\n'); break;
+                case 't': appendToken('\t'); break;
+                case 'r': appendToken('\r'); break;
+                case 'b': appendToken('\b'); break;
+                case 'f': appendToken('\f'); break;
+                case 'u':
+                    // unicode escapes are not decoded, they are replaced by '?'
+                    appendToken('?');
+                    _unicodeDigits = 0;
+                    _state = js_string_unicode;
+                    return true;
+                default: appendToken(c); break;
+            }
+            _state = js_string;
+            return true;
+        case js_string_unicode:
+            if(!isxdigit((unsigned char)c)) break;
+            if(++_unicodeDigits == 4) _state = js_string;
+            return true;
+        case js_literal:
+            if(isalnum((unsigned char)c) || c == '-' || c == '+' || c == '.'){
+                appendToken(c);
+                return true;
+            }
+            if(!emitLiteral()) return false;
+            endValue();
+            return processChar(c);
+        case js_done:
+            if(whitespace) return true;
+            break;
+        case js_error:
+            return false;
+    }
+    _state = js_error;
+    return false;
+}
+
+/**
+ * @brief Handle the first character of a value
+ *
+ * @param c
+ * @return true if the character can start a value
+ */
+bool JsonStream::startValue(char c){
+    if(c == '{') return openLevel(false);
+    if(c == '[') return openLevel(true);
+    _tokenLength = 0;
+    if(c == '"'){
+        _stringIsKey = false;
+        _state = js_string;
+        return true;
+    }
+    if(c == '-' || isalnum((unsigned char)c)){
+        appendToken(c);
+        _state = js_literal;
+        return true;
+    }
+    _state = js_error;
+    return false;
+}
+
+/**
+ * @brief Continue after a complete value
+ *
+ */
+void JsonStream::endValue(){
+    _state = _depth == 0 ? js_done : js_after_value;
+}
+
+/**
+ * @brief Enter an object or array
+ *
+ * @param isArray
+ * @return true if the maximum depth is not exceeded
+ */
+bool JsonStream::openLevel(bool isArray){
+    if(_depth >= JSON_STREAM_MAX_DEPTH){
+        _state = js_error;
+        return false;
+    }
+    _levels[_depth].isArray = isArray;
+    _levels[_depth].index = 0;
+    _levels[_depth].key[0] = '\0';
+    _depth++;
+    _state = isArray ? js_value : js_key;
+    return true;
+}
+
+/**
+ * @brief Leave an object or array
+ *
+ * @param isArray type of the closing bracket
+ * @return true if the bracket matches the open level
+ */
+bool JsonStream::closeLevel(bool isArray){
+    if(_depth == 0 || _levels[_depth - 1].isArray != isArray){
+        _state = js_error;
+        return false;
+    }
+    _depth--;
+    endValue();
+    return true;
+}
+
+/**
+ * @brief Append a character to the current token (truncated at JSON_STREAM_MAX_VALUE-1)
+ *
+ * @param c
+ */
+void JsonStream::appendToken(char c){
+    if(_tokenLength < JSON_STREAM_MAX_VALUE - 1){
+        _token[_tokenLength++] = c;
+    }
+}
+
+/**
+ * @brief Report a number, true, false or null to the handler
+ *
+ * @return true if the literal is valid
+ */
+bool JsonStream::emitLiteral(){
+    _token[_tokenLength] = '\0';
+    JsonValueType type;
+    if(strcmp(_token, "true") == 0) type = json_true;
+    else if(strcmp(_token, "false") == 0) type = json_false;
+    else if(strcmp(_token, "null") == 0) type = json_null;
+    else if(_token[0] == '-' || isdigit((unsigned char)_token[0])) type = json_number;
+    else{
+        _state = js_error;
+        return false;
+    }
+    _handler->onValue(*this, type, _token);
+    return true;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file json_stream.h
+ * @brief Incremental (SAX-style) JSON tokenizer with constant memory
+ *
+ * The input can be fed in chunks of any size (e.g. directly from a network stream), a token
+ * may be split across chunks. For every scalar value (number, string, true, false, null) the
+ * handler is called with the path to the value: the key or array index of each enclosing level.
+ * Keys longer than JSON_STREAM_MAX_KEY-1 and values longer than JSON_STREAM_MAX_VALUE-1 characters
+ * are truncated, nesting deeper than JSON_STREAM_MAX_DEPTH is reported as error.
+ *
+ */
+
+#ifndef json_stream_h
+#define json_stream_h
+
+#include <Arduino.h>
+
+#define JSON_STREAM_MAX_DEPTH 6
+#define JSON_STREAM_MAX_KEY 24
+#define JSON_STREAM_MAX_VALUE 40    // fits the longest IANA timezone names (32 characters)
+
+enum JsonValueType {json_number, json_string, json_true, json_false, json_null};
+
+class JsonStream;
+
+class JsonHandler{
+    public:
+        virtual ~JsonHandler() {}
+        /**
+         * @brief Called for every scalar value
+         *
+         * @param json tokenizer, use getDepth(), getKey() and getIndex() to get the path of the value
+         * @param type type of the value
+         * @param value text of the value (without quotes, escapes are resolved), null terminated
+         */
+        virtual void onValue(const JsonStream &json, JsonValueType type, const char *value) = 0;
+};
+
+class JsonStream{
+
+    public:
+        JsonStream(JsonHandler *handler);
+        void reset();
+        bool feed(const char *data, size_t length);
+        bool finish();
+        bool hasError() const;
+        bool isDone() const;
+        uint8_t getDepth() const;
+        const char* getKey(uint8_t level) const;
+        bool isArray(uint8_t level) const;
+        uint16_t getIndex(uint8_t level) const;
+
+    private:
+        enum State {js_value, js_key, js_colon, js_after_value, js_string, js_string_escape,
+                    js_string_unicode, js_literal, js_done, js_error};
+
+        struct Level {
+            bool isArray;
+            uint16_t index;
+            char key[JSON_STREAM_MAX_KEY];
+        };
+
+        JsonHandler *_handler;
+        Level _levels[JSON_STREAM_MAX_DEPTH];
+        uint8_t _depth;
+        State _state;
+        bool _stringIsKey;
+        char _token[JSON_STREAM_MAX_VALUE];
+        uint8_t _tokenLength;
+        uint8_t _unicodeDigits;
+
+        bool processChar(char c);
+        bool startValue(char c);
+        void endValue();
+        bool openLevel(bool isArray);
+        bool closeLevel(bool isArray);
+        void appendToken(char c);
+        bool emitLiteral();
+};
+
+#endif
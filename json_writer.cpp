@@ -0,0 +1,257 @@
+#include "json_writer.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Construct a new JsonWriter object
+ *
+ * @param output function which gets the full chunks (and the rest on flush())
+ */
+JsonWriter::JsonWriter(JsonChunkOutput output){
+    _output = output;
+    _used = 0;
+    _length = 0;
+    _depth = 0;
+    _hasMembers = 0;
+}
+
+/**
+ * @brief Start an object
+ *
+ * @param key name of the object inside an object, nullptr inside an array or on top level
+ */
+void JsonWriter::beginObject(const char *key){
+    separate(key);
+    write('{');
+    if(_depth < JSON_WRITER_MAX_DEPTH - 1) _depth++;
+    _hasMembers &= ~(1U << _depth);
+}
+
+/**
+ * @brief End the current object
+ *
+ */
+void JsonWriter::endObject(){
+    write('}');
+    if(_depth > 0) _depth--;
+}
+
+/**
+ * @brief Start an array
+ *
+ * @param key name of the array inside an object, nullptr inside an array or on top level
+ */
+void JsonWriter::beginArray(const char *key){
+    separate(key);
+    write('[');
+    if(_depth < JSON_WRITER_MAX_DEPTH - 1) _depth++;
+    _hasMembers &= ~(1U << _depth);
+}
+
+/**
+ * @brief End the current array
+ *
+ */
+void JsonWriter::endArray(){
+    write(']');
+    if(_depth > 0) _depth--;
+}
+
+/**
+ * @brief Write a string member (or array element if key is nullptr)
+ *
+ * @param key name
+ * @param value text, escaped as needed
+ */
+void JsonWriter::field(const char *key, const char *value){
+    beginString(key);
+    writeEscaped(value);
+    endString();
+}
+
+/**
+ * @brief Write a signed number as string member
+ *
+ * @param key name
+ * @param value number
+ */
+void JsonWriter::fieldInt(const char *key, long value){
+    fieldf(key, "%ld", value);
+}
+
+/**
+ * @brief Write an unsigned number as string member
+ *
+ * @param key name
+ * @param value number
+ */
+void JsonWriter::fieldUInt(const char *key, unsigned long value){
+    fieldf(key, "%lu", value);
+}
+
+/**
+ * @brief Write a floating point number as string member
+ *
+ * @param key name
+ * @param value number
+ * @param decimals number of decimal places (String(float) uses 2)
+ */
+void JsonWriter::fieldFloat(const char *key, double value, uint8_t decimals){
+    fieldf(key, "%.*f", decimals, value);
+}
+
+/**
+ * @brief Write a printf formatted string member (up to JSON_WRITER_VALUE - 1 characters)
+ *
+ * @param key name
+ * @param format printf format
+ */
+void JsonWriter::fieldf(const char *key, const char *format, ...){
+    beginString(key);
+    va_list arg;
+    va_start(arg, format);
+    vappendf(format, arg);
+    va_end(arg);
+    endString();
+}
+
+/**
+ * @brief Start a string member which is written in pieces with append() and appendf()
+ *
+ * @param key name
+ */
+void JsonWriter::beginString(const char *key){
+    separate(key);
+    write('"');
+}
+
+/**
+ * @brief Append text to the current string
+ *
+ * @param text text, escaped as needed
+ */
+void JsonWriter::append(const char *text){
+    writeEscaped(text);
+}
+
+/**
+ * @brief Append printf formatted text to the current string (up to JSON_WRITER_VALUE - 1 characters)
+ *
+ * @param format printf format
+ */
+void JsonWriter::appendf(const char *format, ...){
+    va_list arg;
+    va_start(arg, format);
+    vappendf(format, arg);
+    va_end(arg);
+}
+
+/**
+ * @brief End the current string
+ *
+ */
+void JsonWriter::endString(){
+    write('"');
+}
+
+/**
+ * @brief Pass the buffered rest to the output
+ *
+ */
+void JsonWriter::flush(){
+    if(_used == 0) return;
+    _output(_buffer, _used);
+    _used = 0;
+}
+
+/**
+ * @brief Get the number of bytes written so far (including the buffered ones)
+ *
+ * @return size_t
+ */
+size_t JsonWriter::getLength() const{
+    return _length;
+}
+
+/**
+ * @brief Write the comma before all but the first member of a level and the key
+ *
+ * @param key name, nullptr for array elements and the top level value
+ */
+void JsonWriter::separate(const char *key){
+    uint16_t bit = 1U << _depth;
+    if(_hasMembers & bit) write(',');
+    _hasMembers |= bit;
+    if(key == nullptr) return;
+    write('"');
+    writeEscaped(key);
+    write("\":", 2);
+}
+
+/**
+ * @brief Format into a stack buffer and write it escaped
+ *
+ * @param format printf format
+ * @param arg arguments
+ */
+void JsonWriter::vappendf(const char *format, va_list arg){
+    char text[JSON_WRITER_VALUE];
+    vsnprintf(text, sizeof(text), format, arg);
+    writeEscaped(text);
+}
+
+/**
+ * @brief Write text with quotes, backslashes and control characters escaped
+ *
+ * @param text text
+ */
+void JsonWriter::writeEscaped(const char *text){
+    const char *start = text;
+    for(; *text != '\0'; text++){
+        uint8_t c = *text;
+        if(c >= 0x20 && c != '"' && c != '\\') continue;
+        write(start, text - start);
+        if(c == '"' || c == '\\'){
+            write('\\');
+            write(c);
+        }
+        else{
+            char escape[7];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            write(escape, 6);
+        }
+        start = text + 1;
+    }
+    write(start, text - start);
+}
+
+/**
+ * @brief Copy data into the buffer, pass every full buffer to the output
+ *
+ * @param data data
+ * @param length length of the data
+ */
+void JsonWriter::write(const char *data, size_t length){
+    _length += length;
+    while(length > 0){
+        size_t part = JSON_WRITER_CHUNK - _used;
+        if(part > length) part = length;
+        memcpy(_buffer + _used, data, part);
+        _used += part;
+        data += part;
+        length -= part;
+        if(_used == JSON_WRITER_CHUNK){
+            _output(_buffer, _used);
+            _used = 0;
+        }
+    }
+}
+
+/**
+ * @brief Write one character
+ *
+ * @param c character
+ */
+void JsonWriter::write(char c){
+    write(&c, 1);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file json_writer.h
+ * @brief JSON serializer which writes into a fixed chunk buffer
+ *
+ * Commas, quotes and escapes are written by the writer, a full buffer is passed to the
+ * output function (e.g. server.sendContent() of a response with chunked transfer encoding)
+ * and reused. The memory used does not depend on the size of the document, nothing is
+ * allocated. Numbers are written as quoted strings like in all responses of the webserver.
+ *
+ */
+
+#ifndef json_writer_h
+#define json_writer_h
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+#define JSON_WRITER_CHUNK 256
+#define JSON_WRITER_MAX_DEPTH 16    // one bit per level in _hasMembers
+#define JSON_WRITER_VALUE 64        // formatted pieces longer than this are truncated
+
+typedef void (*JsonChunkOutput)(const char *data, size_t length);
+
+class JsonWriter{
+
+    public:
+        JsonWriter(JsonChunkOutput output);
+        void beginObject(const char *key = nullptr);
+        void endObject();
+        void beginArray(const char *key = nullptr);
+        void endArray();
+        void field(const char *key, const char *value);
+        void fieldInt(const char *key, long value);
+        void fieldUInt(const char *key, unsigned long value);
+        void fieldFloat(const char *key, double value, uint8_t decimals);
+        void fieldf(const char *key, const char *format, ...) __attribute__((format(printf, 3, 4)));
+        void beginString(const char *key);
+        void append(const char *text);
+        void appendf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+        void endString();
+        void flush();
+        size_t getLength() const;
+
+    private:
+        JsonChunkOutput _output;
+        char _buffer[JSON_WRITER_CHUNK];
+        size_t _used;
+        size_t _length;             // bytes written in total
+        uint8_t _depth;
+        uint16_t _hasMembers;       // bit per level: a member was written, next one needs a comma
+
+        void separate(const char *key);
+        void vappendf(const char *format, va_list arg);
+        void writeEscaped(const char *text);
+        void write(const char *data, size_t length);
+        void write(char c);
+};
+
+#endif
@@ -0,0 +1,373 @@
+#include "led_frame.h"
+
+#define FRAME_RATE_WINDOW_MS 1000   // the frame rate is measured over windows of this length
+#define FRAME_RATE_TIMEOUT_MS 2000  // no frame for this long: frame rate 0
+
+/**
+ * @brief Construct a new LedFrameDecoder object
+ *
+ * @param sink receives the decoded pixels
+ * @param width width of the matrix (a frame has to match)
+ * @param height height of the matrix
+ */
+LedFrameDecoder::LedFrameDecoder(LedFrameSink *sink, uint8_t width, uint8_t height){
+    _sink = sink;
+    _width = width;
+    _height = height;
+    reset();
+}
+
+/**
+ * @brief Start a new frame
+ *
+ */
+void LedFrameDecoder::reset(){
+    _headerLength = 0;
+    _itemLength = 0;
+    _itemSize = 0;
+    _pixelIndex = 0;
+    _pixelCount = 0;
+    _error = false;
+}
+
+/**
+ * @brief Decode the next bytes of the frame
+ *
+ * @param data bytes
+ * @param length number of bytes
+ * @return true if no error occurred so far
+ */
+bool LedFrameDecoder::feed(const uint8_t *data, size_t length){
+    for(size_t i = 0; i < length && !_error; i++){
+        if(_headerLength < LED_FRAME_HEADER_SIZE){
+            _header[_headerLength++] = data[i];
+            if(_headerLength == LED_FRAME_HEADER_SIZE && !checkHeader()) _error = true;
+            continue;
+        }
+        _item[_itemLength++] = data[i];
+        if(_itemLength == _itemSize){
+            decodeItem();
+            _itemLength = 0;
+        }
+    }
+    return !_error;
+}
+
+/**
+ * @brief Check if the frame is complete (call after the last bytes)
+ *
+ * @return true if a frame has all pixels or a pixel list ends with a complete entry
+ */
+bool LedFrameDecoder::finish(){
+    if(_error || _headerLength < LED_FRAME_HEADER_SIZE || _itemLength != 0){
+        _error = true;
+        return false;
+    }
+    bool list = _header[1] == lf_list_rgb888 || _header[1] == lf_list_rgb565;
+    if(!list && _pixelIndex != (uint16_t)_width * _height){
+        _error = true;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check if the data was invalid
+ *
+ * @return true on error (wrong header, too many bytes, bad pixel index, incomplete frame)
+ */
+bool LedFrameDecoder::hasError() const{
+    return _error;
+}
+
+/**
+ * @brief Get the number of decoded pixels of the current frame
+ *
+ * @return uint16_t
+ */
+uint16_t LedFrameDecoder::getPixelCount() const{
+    return _pixelCount;
+}
+
+/**
+ * @brief Expand a RGB565 color to 24bit (the low bits repeat the high bits, 31 -> 255)
+ *
+ * @param color RGB565
+ * @return uint32_t 24bit color
+ */
+uint32_t LedFrameDecoder::rgb565To888(uint16_t color){
+    uint8_t r = (color >> 11) & 0x1F;
+    uint8_t g = (color >> 5) & 0x3F;
+    uint8_t b = color & 0x1F;
+    return ((uint32_t)((r << 3) | (r >> 2)) << 16) | ((uint32_t)((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/**
+ * @brief Validate the header and set the size of a pixel entry
+ *
+ * @return true if the header matches the matrix
+ */
+bool LedFrameDecoder::checkHeader(){
+    if(_header[0] != LED_FRAME_MAGIC || _header[2] != _width || _header[3] != _height) return false;
+    switch(_header[1]){
+        case lf_rgb888: _itemSize = 3; break;
+        case lf_rgb565: _itemSize = 2; break;
+        case lf_list_rgb888: _itemSize = 4; break;
+        case lf_list_rgb565: _itemSize = 3; break;
+        default: return false;
+    }
+    // pixel lists address the pixels with one byte
+    return _header[1] < lf_list_rgb888 || (uint16_t)_width * _height <= 256;
+}
+
+/**
+ * @brief Hand the complete pixel entry in _item to the sink
+ *
+ */
+void LedFrameDecoder::decodeItem(){
+    uint16_t index;
+    const uint8_t *color = _item;
+    if(_header[1] == lf_list_rgb888 || _header[1] == lf_list_rgb565){
+        index = _item[0];
+        color = _item + 1;
+    }
+    else{
+        index = _pixelIndex++;
+    }
+    if(index >= (uint16_t)_width * _height){
+        _error = true;
+        return;
+    }
+    uint32_t color24bit;
+    if(_header[1] == lf_rgb565 || _header[1] == lf_list_rgb565){
+        color24bit = rgb565To888(((uint16_t)color[0] << 8) | color[1]);
+    }
+    else{
+        color24bit = ((uint32_t)color[0] << 16) | ((uint32_t)color[1] << 8) | color[2];
+    }
+    _sink->onPixel(index % _width, index / _width, color24bit);
+    _pixelCount++;
+}
+
+/**
+ * @brief Construct a new LedBase64Decoder object
+ *
+ * @param sink receives the decoded pixels
+ * @param width width of the matrix
+ * @param height height of the matrix (further pixels are ignored)
+ */
+LedBase64Decoder::LedBase64Decoder(LedFrameSink *sink, uint8_t width, uint8_t height){
+    _sink = sink;
+    _width = width;
+    _height = height;
+    reset(false);
+}
+
+/**
+ * @brief Start a new picture
+ *
+ * @param form true if the body is form data (name=value), false if the body is the base64 string
+ */
+void LedBase64Decoder::reset(bool form){
+    _form = form;
+    _inName = form;
+    _escapeLength = 0;
+    _escape = 0;
+    _ended = false;
+    _quadLength = 0;
+    _pixelLength = 0;
+    _pixelCount = 0;
+    _error = false;
+}
+
+/**
+ * @brief Decode the next characters of the body
+ *
+ * @param data characters
+ * @param length number of characters
+ * @return true if no error occurred so far
+ */
+bool LedBase64Decoder::feed(const uint8_t *data, size_t length){
+    for(size_t i = 0; i < length && !_error && !_ended; i++){
+        decodeChar((char)data[i]);
+    }
+    return !_error;
+}
+
+/**
+ * @brief Decode the last incomplete group of characters (call after the last bytes)
+ *
+ * @return true if at least one pixel was decoded without error
+ */
+bool LedBase64Decoder::finish(){
+    // a group of n < 4 characters (padding omitted or stripped) holds n - 1 bytes
+    if(!_error && _quadLength > 1){
+        uint8_t bytes[3] = {(uint8_t)(_quad[0] << 2 | _quad[1] >> 4),
+                            (uint8_t)(_quad[1] << 4 | _quad[2] >> 2),
+                            (uint8_t)(_quad[2] << 6 | _quad[3])};
+        for(uint8_t i = 0; i < _quadLength - 1; i++) decodeByte(bytes[i]);
+    }
+    _quadLength = 0;
+    if(_pixelCount == 0) _error = true;
+    return !_error;
+}
+
+/**
+ * @brief Check if the data was invalid
+ *
+ * @return true on error (no base64 character, empty picture)
+ */
+bool LedBase64Decoder::hasError() const{
+    return _error;
+}
+
+/**
+ * @brief Get the number of decoded pixels
+ *
+ * @return uint16_t
+ */
+uint16_t LedBase64Decoder::getPixelCount() const{
+    return _pixelCount;
+}
+
+/**
+ * @brief Handle one character of the body (form syntax)
+ *
+ * @param c
+ */
+void LedBase64Decoder::decodeChar(char c){
+    if(!_form){
+        decodeSymbol(c);
+        return;
+    }
+    if(_inName){
+        if(c == '=') _inName = false;
+        return;
+    }
+    if(_escapeLength > 0){
+        uint8_t digit;
+        if(c >= '0' && c <= '9') digit = c - '0';
+        else if(c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else if(c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else{
+            _error = true;
+            return;
+        }
+        _escape = _escape << 4 | digit;
+        if(++_escapeLength == 3){
+            _escapeLength = 0;
+            decodeSymbol((char)_escape);
+        }
+        return;
+    }
+    if(c == '%'){
+        _escapeLength = 1;
+        _escape = 0;
+    }
+    else if(c == '&'){
+        _ended = true;  // only the first field is used
+    }
+    else{
+        // a '+' of the base64 string is often sent unencoded, a space is never part of the data
+        decodeSymbol(c);
+    }
+}
+
+/**
+ * @brief Handle one character of the base64 string, every 4 characters give 3 bytes
+ *
+ * @param c
+ */
+void LedBase64Decoder::decodeSymbol(char c){
+    uint8_t value;
+    if(c >= 'A' && c <= 'Z') value = c - 'A';
+    else if(c >= 'a' && c <= 'z') value = c - 'a' + 26;
+    else if(c >= '0' && c <= '9') value = c - '0' + 52;
+    else if(c == '+') value = 62;
+    else if(c == '/') value = 63;
+    else if(c == '='){
+        _ended = true;  // padding: the last group is decoded by finish()
+        return;
+    }
+    else if(c == ' ' || c == '\r' || c == '\n' || c == '\t') return;
+    else{
+        _error = true;
+        return;
+    }
+    _quad[_quadLength++] = value;
+    if(_quadLength == 4){
+        _quadLength = 0;
+        decodeByte(_quad[0] << 2 | _quad[1] >> 4);
+        decodeByte(_quad[1] << 4 | _quad[2] >> 2);
+        decodeByte(_quad[2] << 6 | _quad[3]);
+    }
+}
+
+/**
+ * @brief Collect the bytes of a pixel and hand complete pixels to the sink
+ *
+ * @param value
+ */
+void LedBase64Decoder::decodeByte(uint8_t value){
+    _pixel[_pixelLength++] = value;
+    if(_pixelLength < 4) return;
+    _pixelLength = 0;
+    if(_pixelCount >= (uint16_t)_width * _height) return;
+    _sink->onPixel(_pixelCount % _width, _pixelCount / _width,
+                   ((uint32_t)_pixel[0] << 16) | ((uint32_t)_pixel[1] << 8) | _pixel[2]);
+    _pixelCount++;
+}
+
+/**
+ * @brief Construct a new FrameRateMeter object
+ *
+ */
+FrameRateMeter::FrameRateMeter(){
+    _frames = 0;
+    _windowStart = 0;
+    _windowFrames = 0;
+    _fpsX10 = 0;
+    _lastFrame = 0;
+}
+
+/**
+ * @brief Count a frame
+ *
+ * @param now millis()
+ */
+void FrameRateMeter::record(uint32_t now){
+    if(_frames == 0 || now - _lastFrame >= FRAME_RATE_TIMEOUT_MS){
+        // first frame of a stream
+        _windowStart = now;
+        _windowFrames = 0;
+        _fpsX10 = 0;
+    }
+    else if(now - _windowStart >= FRAME_RATE_WINDOW_MS){
+        _fpsX10 = (uint32_t)_windowFrames * 10000 / (now - _windowStart);
+        _windowStart = now;
+        _windowFrames = 0;
+    }
+    _windowFrames++;
+    _frames++;
+    _lastFrame = now;
+}
+
+/**
+ * @brief Get the number of frames since boot
+ *
+ * @return uint32_t
+ */
+uint32_t FrameRateMeter::getFrameCount() const{
+    return _frames;
+}
+
+/**
+ * @brief Get the frame rate of the last complete window
+ *
+ * @param now millis()
+ * @return uint16_t frames per second * 10, 0 if no frame was received recently
+ */
+uint16_t FrameRateMeter::getFpsX10(uint32_t now) const{
+    if(_frames == 0 || now - _lastFrame >= FRAME_RATE_TIMEOUT_MS) return 0;
+    return _fpsX10;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file led_frame.h
+ * @brief Streaming decoder of binary LED frames (POST /leddirect) and a frame rate meter
+ *
+ * Format (all values unsigned bytes):
+ *
+ *   0  'W'
+ *   1  format: 1 = RGB888 frame, 2 = RGB565 frame, 3 = RGB888 pixel list, 4 = RGB565 pixel list
+ *   2  width of the matrix
+ *   3  height of the matrix
+ *   4  payload
+ *        frame: width * height pixels row by row (top left first), 3 bytes R G B or 2 bytes RGB565
+ *               (big-endian)
+ *        pixel list: entries of 1 byte pixel index (y * width + x) followed by the color as above,
+ *               pixels which are not listed keep their color
+ *
+ * The decoder can be fed in chunks of any size (e.g. directly from the request stream) and hands
+ * every complete pixel to a LedFrameSink, no frame buffer is needed.
+ *
+ * LedBase64Decoder streams the old format the same way: a base64 string of 4 bytes per pixel
+ * (R G B unused, row by row), sent as the whole body or as the value of a form field
+ * (application/x-www-form-urlencoded, percent-encoded characters are decoded).
+ *
+ */
+
+#ifndef led_frame_h
+#define led_frame_h
+
+#include <Arduino.h>
+
+#define LED_FRAME_MAGIC 'W'
+#define LED_FRAME_HEADER_SIZE 4
+
+enum LedFrameFormat {lf_rgb888 = 1, lf_rgb565 = 2, lf_list_rgb888 = 3, lf_list_rgb565 = 4};
+
+class LedFrameSink{
+    public:
+        virtual ~LedFrameSink() {}
+        /**
+         * @brief Called for every decoded pixel
+         *
+         * @param x column (0 = left)
+         * @param y row (0 = top)
+         * @param color 24bit color
+         */
+        virtual void onPixel(uint8_t x, uint8_t y, uint32_t color) = 0;
+};
+
+class LedFrameDecoder{
+
+    public:
+        LedFrameDecoder(LedFrameSink *sink, uint8_t width, uint8_t height);
+        void reset();
+        bool feed(const uint8_t *data, size_t length);
+        bool finish();
+        bool hasError() const;
+        uint16_t getPixelCount() const;
+        static uint32_t rgb565To888(uint16_t color);
+
+    private:
+        LedFrameSink *_sink;
+        uint8_t _width;
+        uint8_t _height;
+        uint8_t _header[LED_FRAME_HEADER_SIZE];
+        uint8_t _headerLength;
+        uint8_t _item[4];           // bytes of the current pixel (list: index + color)
+        uint8_t _itemLength;
+        uint8_t _itemSize;
+        uint16_t _pixelIndex;       // next pixel of a frame
+        uint16_t _pixelCount;       // decoded pixels
+        bool _error;
+
+        bool checkHeader();
+        void decodeItem();
+};
+
+class LedBase64Decoder{
+
+    public:
+        LedBase64Decoder(LedFrameSink *sink, uint8_t width, uint8_t height);
+        void reset(bool form);
+        bool feed(const uint8_t *data, size_t length);
+        bool finish();
+        bool hasError() const;
+        uint16_t getPixelCount() const;
+
+    private:
+        LedFrameSink *_sink;
+        uint8_t _width;
+        uint8_t _height;
+        bool _form;                 // body is "name=value", only the value is decoded
+        bool _inName;
+        uint8_t _escapeLength;      // hex digits of a %XX escape received so far (form only)
+        uint8_t _escape;
+        bool _ended;                // padding or end of the form field reached
+        uint8_t _quad[4];           // 6 bit values of the current group of 4 characters
+        uint8_t _quadLength;
+        uint8_t _pixel[4];
+        uint8_t _pixelLength;
+        uint16_t _pixelCount;
+        bool _error;
+
+        void decodeChar(char c);
+        void decodeSymbol(char c);
+        void decodeByte(uint8_t value);
+};
+
+class FrameRateMeter{
+
+    public:
+        FrameRateMeter();
+        void record(uint32_t now);
+        uint32_t getFrameCount() const;
+        uint16_t getFpsX10(uint32_t now) const;
+
+    private:
+        uint32_t _frames;
+        uint32_t _windowStart;
+        uint16_t _windowFrames;
+        uint16_t _fpsX10;
+        uint32_t _lastFrame;
+};
+
+#endif
@@ -153,6 +153,18 @@ void LEDMatrix::gridAddPixel(uint8_t x, uint8_t y, uint32_t color)
   }
 }
 
+/**
+ * @brief Receives the pixels of a binary frame (LedFrameSink), same as gridAddPixel()
+ * 
+ * @param x x coordinate (0 = left)
+ * @param y y coordinate (0 = top)
+ * @param color 24bit color
+ */
+void LEDMatrix::onPixel(uint8_t x, uint8_t y, uint32_t color)
+{
+  gridAddPixel(x, y, color);
+}
+
 /**
  * @brief "Deactivates" all pixels in targetgrid
  * 
@@ -222,6 +234,7 @@ void LEDMatrix::drawOnMatrix(float factor){
     (*neomatrix).setBrightness(newBrightness);
   }
   (*neomatrix).show();
+  frameCount++;
 }
 
 /**
@@ -327,4 +340,11 @@ void LEDMatrix::setDynamicColorShiftPhase(int16_t phase)
   dynamicColorShiftActivePhase = phase;
 }
 
-
+/**
+ * @brief Get the number of frames written to the leds since boot (for the render frame rate)
+ * 
+ * @return uint32_t
+ */
+uint32_t LEDMatrix::getFrameCount() const{
+  return frameCount;
+}
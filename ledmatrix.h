@@ -5,6 +5,7 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_NeoMatrix.h>
 #include "udplogger.h"
+#include "led_frame.h"
 
 // width of the led matrix
 #define WIDTH 11
@@ -13,7 +14,7 @@
 
 #define DEFAULT_CURRENT_LIMIT 9999
 
-class LEDMatrix{
+class LEDMatrix : public LedFrameSink{
     public:
         LEDMatrix(Adafruit_NeoMatrix *mymatrix, uint8_t mybrightness, UDPLogger *mylogger);
         static uint32_t Color24bit(uint8_t r, uint8_t g, uint8_t b);
@@ -23,6 +24,7 @@ class LEDMatrix{
         void setupMatrix();
         void setMinIndicator(uint8_t pattern, uint32_t color);
         void gridAddPixel(uint8_t x, uint8_t y, uint32_t color);
+        void onPixel(uint8_t x, uint8_t y, uint32_t color) override;
         void gridFlush(void);
         void drawOnMatrixInstant();
         void drawOnMatrixSmooth(float factor);
@@ -31,6 +33,7 @@ class LEDMatrix{
         void setBrightness(uint8_t mybrightness);
         void setCurrentLimit(uint16_t mycurrentLimit);
         void setDynamicColorShiftPhase(int16_t phase);
+        uint32_t getFrameCount() const;
 
     private:
 
@@ -40,6 +43,7 @@ class LEDMatrix{
         uint8_t brightness;
         uint16_t currentLimit;
         int16_t dynamicColorShiftActivePhase = -1; // -1: not active, 0-255: active phase shift
+        uint32_t frameCount = 0; // frames written to the leds since boot
 
         // target representation of matrix as 2D array
         uint32_t targetgrid[HEIGHT][WIDTH] = {0};
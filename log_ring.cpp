@@ -0,0 +1,184 @@
+#include "log_ring.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Construct a new empty LogRing object
+ *
+ */
+LogRing::LogRing(){
+    reset();
+}
+
+/**
+ * @brief Remove all lines and clear the statistics
+ *
+ */
+void LogRing::reset(){
+    _head = 0;
+    _used = 0;
+    _highWater = 0;
+    _dropped = 0;
+    _lines = 0;
+}
+
+/**
+ * @brief Append a line (prefix + text + '\n'), never blocks
+ *
+ * @param prefix e.g. "Wordclock 2.0: ", may be empty
+ * @param text message, does not need to be terminated
+ * @param length length of text
+ * @return true if the line was queued, false if it was dropped (ring full)
+ */
+bool LogRing::push(const char *prefix, const char *text, size_t length){
+    size_t prefixLength = strlen(prefix);
+    if(prefixLength > LOG_RING_LINE_MAX - 1) prefixLength = LOG_RING_LINE_MAX - 1;
+    if(length > LOG_RING_LINE_MAX - 1 - prefixLength) length = LOG_RING_LINE_MAX - 1 - prefixLength;
+    size_t total = prefixLength + length + 1;
+    if(total > LOG_RING_SIZE - _used){
+        _dropped++;
+        return false;
+    }
+    write(prefix, prefixLength);
+    write(text, length);
+    write("\n", 1);
+    _lines++;
+    if(_used > _highWater) _highWater = _used;
+    return true;
+}
+
+/**
+ * @brief Count a line which could not be queued for another reason (e.g. a format error)
+ *
+ */
+void LogRing::drop(){
+    _dropped++;
+}
+
+/**
+ * @brief Format a line (prefix + message, without '\n') into a buffer of LOG_RING_LINE_MAX bytes
+ *
+ * @param line buffer of LOG_RING_LINE_MAX bytes, zero terminated afterwards
+ * @param prefix e.g. "Wordclock 2.0: ", may be empty
+ * @param format printf format of the message
+ * @param arg arguments of the format
+ * @return int length of the line (truncated to LOG_RING_LINE_MAX - 1), -1 on a format error
+ */
+int LogRing::formatLine(char *line, const char *prefix, const char *format, va_list arg){
+    size_t prefixLength = strlen(prefix);
+    if(prefixLength > LOG_RING_LINE_MAX - 1) prefixLength = LOG_RING_LINE_MAX - 1;
+    memcpy(line, prefix, prefixLength);
+    // the line is truncated to the buffer, the terminating zero takes the place of the '\n'
+    int length = vsnprintf(line + prefixLength, LOG_RING_LINE_MAX - prefixLength, format, arg);
+    if(length < 0){
+        line[prefixLength] = '\0';
+        return -1;
+    }
+    return prefixLength + ((size_t)length < LOG_RING_LINE_MAX - prefixLength ? (size_t)length : LOG_RING_LINE_MAX - 1 - prefixLength);
+}
+
+/**
+ * @brief Get the number of bytes of complete lines at the head which fit into one batch
+ *
+ * @param maxBytes size of the batch (e.g. datagram payload)
+ * @return size_t bytes, 0 if the ring is empty
+ */
+size_t LogRing::nextBatch(size_t maxBytes) const{
+    size_t limit = _used < maxBytes ? _used : maxBytes;
+    size_t batch = 0;
+    for(size_t i = 0; i < limit; i++){
+        if(_buffer[(_head + i) % LOG_RING_SIZE] == '\n') batch = i + 1;
+    }
+    // a single line longer than the batch is split
+    return batch > 0 ? batch : limit;
+}
+
+/**
+ * @brief Get the contiguous bytes starting at an offset from the head
+ *
+ * @param offset bytes from the head (< getUsed())
+ * @param data pointer to the first byte
+ * @return size_t number of contiguous bytes (up to the end of the data or the wrap-around)
+ */
+size_t LogRing::peek(size_t offset, const char **data) const{
+    if(offset >= _used){
+        *data = _buffer;
+        return 0;
+    }
+    size_t start = (_head + offset) % LOG_RING_SIZE;
+    size_t available = _used - offset;
+    size_t contiguous = LOG_RING_SIZE - start;
+    *data = _buffer + start;
+    return available < contiguous ? available : contiguous;
+}
+
+/**
+ * @brief Free bytes at the head (after they were sent)
+ *
+ * @param bytes number of bytes, limited to getUsed()
+ */
+void LogRing::consume(size_t bytes){
+    if(bytes > _used) bytes = _used;
+    _head = (_head + bytes) % LOG_RING_SIZE;
+    _used -= bytes;
+    if(_used == 0) _head = 0;
+}
+
+/**
+ * @brief Check if no line is queued
+ *
+ * @return true if empty
+ */
+bool LogRing::isEmpty() const{
+    return _used == 0;
+}
+
+/**
+ * @brief Get the number of queued bytes
+ *
+ * @return size_t
+ */
+size_t LogRing::getUsed() const{
+    return _used;
+}
+
+/**
+ * @brief Get the largest number of bytes that were queued at the same time
+ *
+ * @return size_t
+ */
+size_t LogRing::getHighWater() const{
+    return _highWater;
+}
+
+/**
+ * @brief Get the number of lines dropped because the ring was full (or counted with drop())
+ *
+ * @return uint32_t
+ */
+uint32_t LogRing::getDropped() const{
+    return _dropped;
+}
+
+/**
+ * @brief Get the number of queued lines since the last reset
+ *
+ * @return uint32_t
+ */
+uint32_t LogRing::getLines() const{
+    return _lines;
+}
+
+/**
+ * @brief Copy bytes to the tail, the caller has checked the free space
+ *
+ * @param data
+ * @param length
+ */
+void LogRing::write(const char *data, size_t length){
+    size_t tail = (_head + _used) % LOG_RING_SIZE;
+    size_t first = LOG_RING_SIZE - tail < length ? LOG_RING_SIZE - tail : length;
+    memcpy(_buffer + tail, data, first);
+    memcpy(_buffer, data + first, length - first);
+    _used += length;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file log_ring.h
+ * @brief Preallocated ring buffer of log lines, filled by the logger and drained in batches
+ *
+ * Lines are stored one after the other, each terminated by '\n'. Pushing a line only copies it,
+ * if it does not fit completely it is dropped and counted. The reader takes whole lines from the
+ * head: nextBatch() returns how many bytes of complete lines fit into a datagram, peek() gives
+ * the contiguous pieces of these bytes (two at most, at the wrap-around) and consume() frees them.
+ * formatLine() formats a printf message behind the prefix in a line buffer on the stack (used by
+ * UDPLogger::logPrintf() and the LOG_* macros), it never allocates heap memory.
+ *
+ */
+
+#ifndef log_ring_h
+#define log_ring_h
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 2048          // bytes of queued log text
+#endif
+#define LOG_RING_LINE_MAX 256       // longer messages are truncated (including the prefix)
+
+class LogRing{
+
+    public:
+        LogRing();
+        void reset();
+        bool push(const char *prefix, const char *text, size_t length);
+        void drop();
+        static int formatLine(char *line, const char *prefix, const char *format, va_list arg);
+        size_t nextBatch(size_t maxBytes) const;
+        size_t peek(size_t offset, const char **data) const;
+        void consume(size_t bytes);
+        bool isEmpty() const;
+        size_t getUsed() const;
+        size_t getHighWater() const;
+        uint32_t getDropped() const;
+        uint32_t getLines() const;
+
+    private:
+        char _buffer[LOG_RING_SIZE];
+        size_t _head;               // first byte of the oldest line
+        size_t _used;
+        size_t _highWater;
+        uint32_t _dropped;
+        uint32_t _lines;
+
+        void write(const char *data, size_t length);
+};
+
+#endif
@@ -36,31 +36,40 @@ def start(filters=None):
 
     # Receive/respond loop
     while True:
-        data, address = sock.recvfrom(1024)
-        data_str = data.decode("utf-8").strip()
-        timestamped_data = f"[{address[0]} - {datetime.now().strftime('%b-%d-%Y_%H:%M:%S')}] {data_str}"
-
-        # Check each filter and process data accordingly
-        for filter_val in filters:
-            if filter_val in data_str:
-                print(timestamped_data)
-                buffers[filter_val].put(timestamped_data)
-                if buffers[filter_val].full():
-                    buffers[filter_val].get()
-
-                # Save data if specific keywords are found or if save counter is active
-                if "NTP-Update not successful" in data_str or "Start program" in data_str:
-                    with open(f"log_{filter_val}.txt", 'a') as f:
-                        while not buffers[filter_val].empty():
-                            f.write(buffers[filter_val].get() + "\n")
-                    save_counters[filter_val] = 20  # Start the save counter
-
-                if save_counters[filter_val] > 0:
-                    with open(f"log_{filter_val}.txt", 'a') as f:
-                        f.write(timestamped_data + "\n")
-                        if save_counters[filter_val] == 1:
-                            f.write("\n")
-                    save_counters[filter_val] -= 1
+        # one datagram holds several log lines
+        data, address = sock.recvfrom(2048)
+        if data[:4] == b"WCTM":
+            # binary telemetry frame, see tools/telemetry
+            continue
+        for data_str in data.decode("utf-8", errors="replace").splitlines():
+            if data_str.strip():
+                process_line(data_str.strip(), address, filters, buffers, save_counters)
+
+
+def process_line(data_str, address, filters, buffers, save_counters):
+    timestamped_data = f"[{address[0]} - {datetime.now().strftime('%b-%d-%Y_%H:%M:%S')}] {data_str}"
+
+    # Check each filter and process data accordingly
+    for filter_val in filters:
+        if filter_val in data_str:
+            print(timestamped_data)
+            buffers[filter_val].put(timestamped_data)
+            if buffers[filter_val].full():
+                buffers[filter_val].get()
+
+            # Save data if specific keywords are found or if save counter is active
+            if "NTP-Update not successful" in data_str or "Start program" in data_str:
+                with open(f"log_{filter_val}.txt", 'a') as f:
+                    while not buffers[filter_val].empty():
+                        f.write(buffers[filter_val].get() + "\n")
+                save_counters[filter_val] = 20  # Start the save counter
+
+            if save_counters[filter_val] > 0:
+                with open(f"log_{filter_val}.txt", 'a') as f:
+                    f.write(timestamped_data + "\n")
+                    if save_counters[filter_val] == 1:
+                        f.write("\n")
+                save_counters[filter_val] -= 1
 
 
 # Main
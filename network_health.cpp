@@ -0,0 +1,314 @@
+#include "network_health.h"
+
+#define NET_DEFAULT_SEED 0x9E3779B9UL
+
+/**
+ * @brief Construct a new NetworkHealth object (link state unknown)
+ *
+ */
+NetworkHealth::NetworkHealth(){
+    _random = NET_DEFAULT_SEED;
+    reset();
+}
+
+/**
+ * @brief Forget all failures, statistics and the link state
+ *
+ */
+void NetworkHealth::reset(){
+    for(uint8_t i = 0; i < NET_ENDPOINT_COUNT; i++){
+        _endpoints[i].failures = 0;
+        _endpoints[i].retryAt = 0;
+        _endpoints[i].waiting = false;
+    }
+    _linkUp = false;
+    _linkKnown = false;
+    _breakerFailures = 0;
+    _breakerOpen = false;
+    _probeRunning = false;
+    _breakerOpenedAt = 0;
+    _breakerCoolDown = NET_BREAKER_OPEN_MS;
+    _reconnectRequested = false;
+    _nextReconnect = 0;
+    _reconnectDelay = NET_RECONNECT_MIN_MS;
+    _reconnectCount = 0;
+    _breakerOpenCount = 0;
+    _stallMillis = 0;
+    _longestStall = 0;
+}
+
+/**
+ * @brief Seed the jitter, so clocks restarted by the same power outage do not retry in sync
+ *
+ * @param seed e.g. ESP.random()
+ */
+void NetworkHealth::setSeed(uint32_t seed){
+    _random = seed != 0 ? seed : NET_DEFAULT_SEED;
+}
+
+/**
+ * @brief Update the state of the WiFi link (call every loop)
+ *
+ * When the link comes back the backoffs of the endpoints are reset (the failures were caused by
+ * the missing link). An open breaker keeps its cool-down, a reconnect requested because of a
+ * ghost connection does not shortcut it.
+ *
+ * @param connected true if WiFi is connected
+ * @param now millis()
+ * @return true if the link was restored after it was down (network-bound subsystems should refresh)
+ */
+bool NetworkHealth::updateLink(bool connected, uint32_t now){
+    bool known = _linkKnown;
+    _linkKnown = true;
+    if(known && connected == _linkUp) return false;
+    _linkUp = connected;
+
+    if(!connected){
+        _reconnectDelay = NET_RECONNECT_MIN_MS;
+        _nextReconnect = now + _reconnectDelay;
+        _probeRunning = false;
+        return false;
+    }
+
+    for(uint8_t i = 0; i < NET_ENDPOINT_COUNT; i++){
+        _endpoints[i].failures = 0;
+        _endpoints[i].waiting = false;
+    }
+    _breakerFailures = 0;
+    _probeRunning = false;
+    _reconnectRequested = false;
+    return known;
+}
+
+/**
+ * @brief Check if the WiFi link is up
+ *
+ * @return true if connected
+ */
+bool NetworkHealth::isLinkUp() const{
+    return _linkUp;
+}
+
+/**
+ * @brief Check if an endpoint may start a request now
+ *
+ * If the breaker is half-open the first caller gets the probe, the result has to be reported
+ * with reportSuccess() or reportFailure().
+ *
+ * @param endpoint
+ * @param now millis()
+ * @return true if the request may be started
+ */
+bool NetworkHealth::mayAttempt(NetworkEndpoint endpoint, uint32_t now){
+    if(!_linkUp) return false;
+    if(_breakerOpen){
+        if(_probeRunning || now - _breakerOpenedAt < _breakerCoolDown) return false;
+        _probeRunning = true;
+        return true;
+    }
+    const Endpoint &state = _endpoints[endpoint];
+    return !state.waiting || (int32_t)(now - state.retryAt) >= 0;
+}
+
+/**
+ * @brief Report a successful request, closes the breaker
+ *
+ * @param endpoint
+ * @param now millis()
+ */
+void NetworkHealth::reportSuccess(NetworkEndpoint endpoint, uint32_t now){
+    (void)now;
+    _endpoints[endpoint].failures = 0;
+    _endpoints[endpoint].waiting = false;
+    _breakerFailures = 0;
+    _breakerOpen = false;
+    _probeRunning = false;
+    _breakerCoolDown = NET_BREAKER_OPEN_MS;
+}
+
+/**
+ * @brief Report a failed request: schedule the retry of the endpoint, open the breaker after
+ *        NET_BREAKER_THRESHOLD consecutive failures or when the probe of a half-open breaker failed
+ *
+ * @param endpoint
+ * @param now millis()
+ */
+void NetworkHealth::reportFailure(NetworkEndpoint endpoint, uint32_t now){
+    Endpoint &state = _endpoints[endpoint];
+    if(state.failures < 0xFFFF) state.failures++;
+    uint32_t delay = NET_BACKOFF_MIN_MS;
+    for(uint16_t i = 1; i < state.failures && delay < NET_BACKOFF_MAX_MS; i++) delay *= 2;
+    if(delay > NET_BACKOFF_MAX_MS) delay = NET_BACKOFF_MAX_MS;
+    state.retryAt = now + withJitter(delay);
+    state.waiting = true;
+
+    if(_probeRunning){
+        _probeRunning = false;
+        _breakerCoolDown = _breakerCoolDown * 2 < NET_BREAKER_OPEN_MAX_MS ? _breakerCoolDown * 2 : NET_BREAKER_OPEN_MAX_MS;
+        openBreaker(now);
+    }
+    else if(!_breakerOpen && ++_breakerFailures >= NET_BREAKER_THRESHOLD){
+        openBreaker(now);
+    }
+}
+
+/**
+ * @brief Record the time the loop was blocked by a network call
+ *
+ * @param durationMs duration of the call
+ */
+void NetworkHealth::recordBlocking(uint32_t durationMs){
+    if(durationMs < NET_STALL_THRESHOLD_MS) return;
+    _stallMillis += durationMs;
+    if(durationMs > _longestStall) _longestStall = durationMs;
+}
+
+/**
+ * @brief Check if WiFi should be reconnected now (the caller does WiFi.reconnect())
+ *
+ * While the link is down reconnects are spaced with an exponential backoff. While the link is
+ * reported up, a reconnect is requested once each time the breaker opens (ghost connection).
+ *
+ * @param now millis()
+ * @return true if a reconnect is due
+ */
+bool NetworkHealth::shouldReconnect(uint32_t now){
+    if(!_linkKnown) return false;
+    if(!_linkUp){
+        if((int32_t)(now - _nextReconnect) < 0) return false;
+        _reconnectDelay = _reconnectDelay * 2 < NET_RECONNECT_MAX_MS ? _reconnectDelay * 2 : NET_RECONNECT_MAX_MS;
+        _nextReconnect = now + withJitter(_reconnectDelay);
+        _reconnectCount++;
+        return true;
+    }
+    if(!_reconnectRequested) return false;
+    _reconnectRequested = false;
+    _reconnectCount++;
+    return true;
+}
+
+/**
+ * @brief Get the state of the circuit breaker
+ *
+ * @param now millis()
+ * @return BreakerState half-open once the cool-down has passed
+ */
+BreakerState NetworkHealth::getBreakerState(uint32_t now) const{
+    if(!_breakerOpen) return br_closed;
+    if(_probeRunning || now - _breakerOpenedAt >= _breakerCoolDown) return br_half_open;
+    return br_open;
+}
+
+/**
+ * @brief Get the time until an endpoint may retry (backoff and breaker)
+ *
+ * @param endpoint
+ * @param now millis()
+ * @return uint32_t ms, 0 if a request may be started
+ */
+uint32_t NetworkHealth::getRetryDelay(NetworkEndpoint endpoint, uint32_t now) const{
+    uint32_t delay = 0;
+    const Endpoint &state = _endpoints[endpoint];
+    if(state.waiting && (int32_t)(state.retryAt - now) > 0) delay = state.retryAt - now;
+    if(_breakerOpen && now - _breakerOpenedAt < _breakerCoolDown){
+        uint32_t breakerDelay = _breakerCoolDown - (now - _breakerOpenedAt);
+        if(breakerDelay > delay) delay = breakerDelay;
+    }
+    return delay;
+}
+
+/**
+ * @brief Get the number of consecutive failures of an endpoint
+ *
+ * @param endpoint
+ * @return uint16_t failures since the last success
+ */
+uint16_t NetworkHealth::getFailures(NetworkEndpoint endpoint) const{
+    return _endpoints[endpoint].failures;
+}
+
+/**
+ * @brief Get the number of requested WiFi reconnects
+ *
+ * @return uint32_t
+ */
+uint32_t NetworkHealth::getReconnectCount() const{
+    return _reconnectCount;
+}
+
+/**
+ * @brief Get the number of times the breaker opened
+ *
+ * @return uint32_t
+ */
+uint32_t NetworkHealth::getBreakerOpenCount() const{
+    return _breakerOpenCount;
+}
+
+/**
+ * @brief Get the total time the loop was blocked by network calls
+ *
+ * @return uint32_t ms
+ */
+uint32_t NetworkHealth::getStallMillis() const{
+    return _stallMillis;
+}
+
+/**
+ * @brief Get the longest time the loop was blocked by a single network call
+ *
+ * @return uint32_t ms
+ */
+uint32_t NetworkHealth::getLongestStallMillis() const{
+    return _longestStall;
+}
+
+/**
+ * @brief Get the name of a breaker state (for logs and the webserver)
+ *
+ * @param state
+ * @return const char*
+ */
+const char* NetworkHealth::getBreakerName(BreakerState state){
+    switch(state){
+        case br_closed: return "closed";
+        case br_open: return "open";
+        case br_half_open: return "half-open";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Next value of the jitter generator (xorshift32)
+ *
+ * @return uint32_t
+ */
+uint32_t NetworkHealth::nextRandom(){
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _random;
+}
+
+/**
+ * @brief Randomize a delay to 50 ... 100 % of its value
+ *
+ * @param delay ms
+ * @return uint32_t ms
+ */
+uint32_t NetworkHealth::withJitter(uint32_t delay){
+    return delay / 2 + nextRandom() % (delay / 2 + 1);
+}
+
+/**
+ * @brief Open the breaker, if the link is reported up a reconnect is requested
+ *
+ * @param now millis()
+ */
+void NetworkHealth::openBreaker(uint32_t now){
+    _breakerOpen = true;
+    _breakerOpenedAt = now;
+    _breakerFailures = 0;
+    _breakerOpenCount++;
+    if(_linkUp) _reconnectRequested = true;
+}
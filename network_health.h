@@ -0,0 +1,81 @@
+/**
+ * @file network_health.h
+ * @brief Shared connectivity policy: retry backoff per endpoint, circuit breaker, WiFi reconnects
+ *
+ * Every network subsystem asks mayAttempt() before it starts a (possibly blocking) request and
+ * reports the result. Failed endpoints are retried after an exponential backoff with jitter.
+ * Failures of all endpoints together feed a circuit breaker: while it is open no endpoint may
+ * start a request, after a cool-down a single probe is allowed (half-open). The link state of
+ * the WiFi connection and the breaker drive one reconnect policy for the whole sketch. Time that
+ * the loop lost in blocking network calls is accumulated as stall time.
+ *
+ */
+
+#ifndef network_health_h
+#define network_health_h
+
+#include <Arduino.h>
+
+#define NET_BACKOFF_MIN_MS 15000UL          // first retry of a failed endpoint
+#define NET_BACKOFF_MAX_MS 900000UL         // longest retry interval of an endpoint (15 min)
+#define NET_BREAKER_THRESHOLD 3             // consecutive failures (all endpoints) that open the breaker
+#define NET_BREAKER_OPEN_MS 60000UL         // first cool-down of the open breaker, doubled while probes fail
+#define NET_BREAKER_OPEN_MAX_MS 600000UL
+#define NET_RECONNECT_MIN_MS 10000UL        // first WiFi reconnect after the link was lost
+#define NET_RECONNECT_MAX_MS 300000UL
+#define NET_STALL_THRESHOLD_MS 20           // shorter blocking calls are not counted as stall
+
+enum NetworkEndpoint {ne_weather, ne_ipapi, NET_ENDPOINT_COUNT};
+enum BreakerState {br_closed, br_open, br_half_open};
+
+class NetworkHealth{
+
+    public:
+        NetworkHealth();
+        void reset();
+        void setSeed(uint32_t seed);
+        bool updateLink(bool connected, uint32_t now);
+        bool isLinkUp() const;
+        bool mayAttempt(NetworkEndpoint endpoint, uint32_t now);
+        void reportSuccess(NetworkEndpoint endpoint, uint32_t now);
+        void reportFailure(NetworkEndpoint endpoint, uint32_t now);
+        void recordBlocking(uint32_t durationMs);
+        bool shouldReconnect(uint32_t now);
+        BreakerState getBreakerState(uint32_t now) const;
+        uint32_t getRetryDelay(NetworkEndpoint endpoint, uint32_t now) const;
+        uint16_t getFailures(NetworkEndpoint endpoint) const;
+        uint32_t getReconnectCount() const;
+        uint32_t getBreakerOpenCount() const;
+        uint32_t getStallMillis() const;
+        uint32_t getLongestStallMillis() const;
+        static const char* getBreakerName(BreakerState state);
+
+    private:
+        struct Endpoint{
+            uint16_t failures;
+            uint32_t retryAt;
+            bool waiting;           // retryAt is valid
+        };
+        Endpoint _endpoints[NET_ENDPOINT_COUNT];
+        uint32_t _random;
+        bool _linkUp;
+        bool _linkKnown;
+        uint8_t _breakerFailures;
+        bool _breakerOpen;
+        bool _probeRunning;
+        uint32_t _breakerOpenedAt;
+        uint32_t _breakerCoolDown;
+        bool _reconnectRequested;   // breaker opened while the link was reported up (ghost connection)
+        uint32_t _nextReconnect;
+        uint32_t _reconnectDelay;
+        uint32_t _reconnectCount;
+        uint32_t _breakerOpenCount;
+        uint32_t _stallMillis;
+        uint32_t _longestStall;
+
+        uint32_t nextRandom();
+        uint32_t withJitter(uint32_t delay);
+        void openBreaker(uint32_t now);
+};
+
+#endif
@@ -26,6 +26,8 @@ void setupOTA(String hostname){
   });
   ArduinoOTA.onEnd([]() {
     //Serial.println("\nEnd");
+    // ArduinoOTA restarts right after this callback, keep the time for the new firmware
+    saveTimeToRTC();
   });
   ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
     //Serial.printf("Progress: %u%%\r", (progress / (total / 100)));
@@ -0,0 +1,62 @@
+#include "rtc_time.h"
+
+/**
+ * @brief Fill a record with the current time and RTC counter
+ *
+ * @param record record to fill
+ * @param epochMicros current system time in microseconds since 1970
+ * @param rtcCounter current value of system_get_rtc_time()
+ * @param rtcCali current value of system_rtc_clock_cali_proc()
+ */
+void RtcTime::encode(RtcTimeRecord *record, int64_t epochMicros, uint32_t rtcCounter, uint32_t rtcCali){
+    record->magic = RTC_TIME_MAGIC;
+    record->version = RTC_TIME_VERSION;
+    record->epochSeconds = (uint32_t)(epochMicros / 1000000);
+    record->epochMicros = (uint32_t)(epochMicros % 1000000);
+    record->rtcCounter = rtcCounter;
+    record->rtcCali = rtcCali;
+    record->crc = crc32((const uint8_t*)record, offsetof(RtcTimeRecord, crc));
+}
+
+/**
+ * @brief Validate a record and calculate the current time from it
+ *
+ * @param record record read from RTC user memory
+ * @param rtcCounterNow current value of system_get_rtc_time()
+ * @param rtcCaliNow current value of system_rtc_clock_cali_proc()
+ * @param maxAgeSeconds records older than this are rejected (the RTC clock is only accurate to about 1%)
+ * @param epochMicros current time in microseconds since 1970 (only set if the record is valid)
+ * @return true if the record is valid and fresh
+ */
+bool RtcTime::decode(const RtcTimeRecord *record, uint32_t rtcCounterNow, uint32_t rtcCaliNow, uint32_t maxAgeSeconds, int64_t *epochMicros){
+    if(record->magic != RTC_TIME_MAGIC || record->version != RTC_TIME_VERSION) return false;
+    if(record->crc != crc32((const uint8_t*)record, offsetof(RtcTimeRecord, crc))) return false;
+    if(record->epochMicros >= 1000000) return false;
+
+    // a counter restart (power loss) shows up as a huge elapsed time after the unsigned subtraction
+    uint32_t ticks = rtcCounterNow - record->rtcCounter;
+    uint64_t cali = ((uint64_t)record->rtcCali + rtcCaliNow) / 2;
+    uint64_t elapsed = ((uint64_t)ticks * cali) >> 12;
+    if(elapsed > (uint64_t)maxAgeSeconds * 1000000) return false;
+
+    *epochMicros = (int64_t)record->epochSeconds * 1000000 + record->epochMicros + (int64_t)elapsed;
+    return true;
+}
+
+/**
+ * @brief Calculate CRC32 (IEEE 802.3, reflected)
+ *
+ * @param data
+ * @param length number of bytes
+ * @return uint32_t
+ */
+uint32_t RtcTime::crc32(const uint8_t *data, size_t length){
+    uint32_t crc = 0xFFFFFFFF;
+    for(size_t i = 0; i < length; i++){
+        crc ^= data[i];
+        for(uint8_t bit = 0; bit < 8; bit++){
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
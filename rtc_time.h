@@ -0,0 +1,40 @@
+/**
+ * @file rtc_time.h
+ * @brief Record to keep the wall-clock time in RTC user memory across soft restarts
+ *
+ * The record holds the epoch and the value of the RTC counter (system_get_rtc_time) at the time of saving.
+ * The RTC counter keeps running through software and watchdog restarts, so after the restart the elapsed time
+ * can be added to the saved epoch. A CRC and a maximum age reject records from an older firmware,
+ * from a power loss (counter restarted) or records which are too old to be accurate.
+ *
+ */
+
+#ifndef rtc_time_h
+#define rtc_time_h
+
+#include <Arduino.h>
+#include <stddef.h>
+
+#define RTC_TIME_MAGIC 0x54524357UL   // "WCRT"
+#define RTC_TIME_VERSION 1
+#define RTC_TIME_BLOCK 32             // offset in RTC user memory (4 byte blocks), the first 128 bytes are used by OTA
+
+struct RtcTimeRecord {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t epochSeconds;  // system time when saved
+    uint32_t epochMicros;   // fraction of the second [0 ... 999999]
+    uint32_t rtcCounter;    // system_get_rtc_time() when saved
+    uint32_t rtcCali;       // system_rtc_clock_cali_proc() when saved (us per tick, Q12)
+    uint32_t crc;           // CRC32 of all fields above
+};
+
+class RtcTime{
+
+    public:
+        static void encode(RtcTimeRecord *record, int64_t epochMicros, uint32_t rtcCounter, uint32_t rtcCali);
+        static bool decode(const RtcTimeRecord *record, uint32_t rtcCounterNow, uint32_t rtcCaliNow, uint32_t maxAgeSeconds, int64_t *epochMicros);
+        static uint32_t crc32(const uint8_t *data, size_t length);
+};
+
+#endif
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Prepare the web UI files in data/ for the clock.
+
+Without option: writes a gzip variant (<file>.gz) of every file which gets smaller by compression
+and the manifest data/assets.txt with one line per file: "<path> <size> <hash>" (size of the
+uncompressed file, first 8 hex digits of its SHA-256) for the upload to LittleFS. The clock sends
+the gzip variants and uses the hashes as ETags (see web_assets.h).
+
+--bundle: writes web_bundle_data.h next to the sketch with the gzip variants of all files and
+their index, the web UI is then compiled into the sketch (see web_bundle.h). Run it after every
+change in data/ (the unit test tests/unit/webbundle fails if the bundle is outdated).
+
+Usage: python3 scripts/build_web_assets.py [--bundle] [data directory]
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+MANIFEST = 'assets.txt'
+MAX_ENTRIES = 32        # WEB_ASSET_MAX
+MAX_LINE = 63           # WEB_ASSET_LINE - 1
+MIN_SAVING = 0.1        # keep the gzip variant only if it is at least 10 % smaller
+BUNDLE = 'web_bundle_data.h'
+
+
+def collect_files(data_dir):
+    files = []
+    for root, _, names in os.walk(data_dir):
+        for name in names:
+            if name.endswith('.gz') or name == MANIFEST:
+                continue
+            path = os.path.join(root, name)
+            files.append('/' + os.path.relpath(path, data_dir).replace(os.sep, '/'))
+    return sorted(files)
+
+
+def compress(content):
+    # mtime 0: same input, same output (no change in git or on the clock)
+    return gzip.compress(content, compresslevel=9, mtime=0)
+
+
+def write_bundle(data_dir, files, out_path):
+    paths = []
+    index = []
+    data = bytearray()
+    for number, name in enumerate(files):
+        with open(os.path.join(data_dir, name[1:]), 'rb') as f:
+            content = f.read()
+        compressed = compress(content)
+        paths.append('static const char WEB_BUNDLE_PATH_%d[] PROGMEM = "%s";' % (number, name))
+        index.append('    {WEB_BUNDLE_PATH_%d, %d, %d, %d, 0x%s},' %
+                     (number, len(data), len(compressed), len(content), hashlib.sha256(content).hexdigest()[:8]))
+        data += compressed
+        print('%-28s %7d -> %7d bytes' % (name, len(content), len(compressed)))
+
+    lines = ['// Generated by scripts/build_web_assets.py --bundle from data/, do not edit.',
+             '// Included only by web_bundle.cpp.',
+             '',
+             '#define WEB_BUNDLE_COUNT %d' % len(files),
+             '']
+    lines += paths
+    lines += ['', 'static const uint8_t WEB_BUNDLE_DATA[] PROGMEM = {']
+    for start in range(0, len(data), 16):
+        lines.append('    ' + ' '.join('0x%02x,' % b for b in data[start:start + 16]))
+    lines += ['};', '', 'static const WebBundleEntry WEB_BUNDLE_INDEX[WEB_BUNDLE_COUNT] PROGMEM = {']
+    lines += index
+    lines += ['};', '']
+    with open(out_path, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+    print('%-28s %7d bytes in flash' % (os.path.basename(out_path), len(data)))
+
+
+def main():
+    args = [arg for arg in sys.argv[1:] if arg != '--bundle']
+    bundle = len(args) < len(sys.argv) - 1
+    data_dir = args[0] if args else os.path.join(os.path.dirname(__file__), '..', 'data')
+    data_dir = os.path.normpath(data_dir)
+    files = collect_files(data_dir)
+    if len(files) > MAX_ENTRIES:
+        sys.exit('%d files, the clock keeps only %d manifest entries' % (len(files), MAX_ENTRIES))
+    if bundle:
+        write_bundle(data_dir, files, os.path.join(data_dir, '..', BUNDLE))
+        return
+
+    lines = []
+    total = 0
+    total_sent = 0
+    for name in files:
+        path = os.path.join(data_dir, name[1:])
+        with open(path, 'rb') as f:
+            content = f.read()
+        digest = hashlib.sha256(content).hexdigest()[:8]
+        line = '%s %d %s' % (name, len(content), digest)
+        if len(line) > MAX_LINE:
+            sys.exit('path too long for the manifest: ' + name)
+        lines.append(line)
+
+        compressed = compress(content)
+        gz_path = path + '.gz'
+        if len(compressed) <= len(content) * (1 - MIN_SAVING):
+            with open(gz_path, 'wb') as f:
+                f.write(compressed)
+            sent = len(compressed)
+        else:
+            if os.path.exists(gz_path):
+                os.remove(gz_path)
+            sent = len(content)
+        total += len(content)
+        total_sent += sent
+        print('%-28s %7d -> %7d bytes  %s' % (name, len(content), sent, digest))
+
+    with open(os.path.join(data_dir, MANIFEST), 'w', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+    print('%-28s %7d -> %7d bytes  (%.0f %%)' % ('total', total, total_sent, 100.0 * total_sent / max(total, 1)))
+
+
+if __name__ == '__main__':
+    main()
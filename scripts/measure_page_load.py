@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Measure the bytes and the time of a page load of the web UI.
+
+Loads the page and all files it references (icons, styles) one after another, like a browser
+with an empty cache. Three passes: without compression, with gzip, and a reload with the ETags
+of the second pass (If-None-Match, the clock answers 304 for unchanged files). Files which are
+only built in (web bundle, gzip only) are answered with 406 in the pass without compression.
+Afterwards the statistics of the clock (/data?key=web) are shown.
+
+Usage: python3 scripts/measure_page_load.py <ip of the clock>[:port] [runs]
+"""
+
+import gzip
+import http.client
+import re
+import sys
+import time
+
+REFERENCE = re.compile(r'(?:src|href)\s*=\s*"\.?(/[^"?#]+\.(?:svg|css|js|png|ico))"')
+
+
+def fetch(host, path, headers):
+    connection = http.client.HTTPConnection(host, timeout=10)
+    start = time.monotonic()
+    connection.request('GET', path, headers=headers)
+    response = connection.getresponse()
+    body = response.read()
+    duration = time.monotonic() - start
+    connection.close()
+    header_bytes = sum(len(k) + len(v) + 4 for k, v in response.getheaders())
+    return response.status, body, header_bytes, duration, response.getheader('ETag')
+
+
+def load(host, paths, mode, etags):
+    total_bytes = 0
+    total_time = 0.0
+    statuses = {}
+    for path in paths:
+        headers = {'Accept-Encoding': 'identity' if mode == 'plain' else 'gzip'}
+        if mode == 'reload' and etags.get(path):
+            headers['If-None-Match'] = etags[path]
+        status, body, header_bytes, duration, etag = fetch(host, path, headers)
+        if mode == 'gzip':
+            etags[path] = etag
+        total_bytes += len(body) + header_bytes
+        total_time += duration
+        statuses[status] = statuses.get(status, 0) + 1
+    return total_bytes, total_time, statuses
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    host = sys.argv[1]
+    runs = int(sys.argv[2]) if len(sys.argv) > 2 else 3
+
+    status, body, _, _, _ = fetch(host, '/', {'Accept-Encoding': 'gzip'})
+    if status != 200:
+        sys.exit('GET / returned %d' % status)
+    if body[:2] == b'\x1f\x8b':
+        body = gzip.decompress(body)
+    paths = ['/'] + sorted(set(REFERENCE.findall(body.decode('utf-8', 'replace'))))
+    print('%d files per page load' % len(paths))
+
+    etags = {}
+    for mode in ('plain', 'gzip', 'reload'):
+        results = [load(host, paths, mode, etags) for _ in range(runs)]
+        size = results[-1][0]
+        best = min(r[1] for r in results)
+        statuses = ', '.join('%d x %d' % (count, code) for code, count in sorted(results[-1][2].items()))
+        print('[BENCH] page load %-6s: %7d bytes, %6.0f ms (best of %d), %s' % (mode, size, best * 1000, runs, statuses))
+
+    status, body, _, _, _ = fetch(host, '/data?key=web', {})
+    if status == 200:
+        print('clock:', body.decode('utf-8', 'replace'))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,255 @@
+#include "solar_calc.h"
+
+#define BAM_QUARTER 0x40000000UL
+#define BAM_HALF 0x80000000UL
+#define Q30_ONE 0x40000000L
+
+// sin(x) in Q30 for a quarter wave in 128 steps
+const int32_t sinTableQ30[129] PROGMEM = {
+    0, 13176464, 26350943, 39521455, 52686014, 65842639,
+    78989349, 92124163, 105245103, 118350194, 131437462, 144504935,
+    157550647, 170572633, 183568930, 196537583, 209476638, 222384147,
+    235258165, 248096755, 260897982, 273659918, 286380643, 299058239,
+    311690799, 324276419, 336813204, 349299266, 361732726, 374111709,
+    386434353, 398698801, 410903207, 423045732, 435124548, 447137835,
+    459083786, 470960600, 482766489, 494499676, 506158392, 517740883,
+    529245404, 540670223, 552013618, 563273883, 574449320, 585538248,
+    596538995, 607449906, 618269338, 628995660, 639627258, 650162530,
+    660599890, 670937767, 681174602, 691308855, 701339000, 711263525,
+    721080937, 730789757, 740388522, 749875788, 759250125, 768510122,
+    777654384, 786681534, 795590213, 804379079, 813046808, 821592095,
+    830013654, 838310216, 846480531, 854523370, 862437520, 870221790,
+    877875009, 885396022, 892783698, 900036924, 907154608, 914135678,
+    920979082, 927683790, 934248793, 940673101, 946955747, 953095785,
+    959092290, 964944360, 970651112, 976211688, 981625251, 986890984,
+    992008094, 996975812, 1001793390, 1006460100, 1010975242, 1015338134,
+    1019548121, 1023604567, 1027506862, 1031254418, 1034846671, 1038283080,
+    1041563127, 1044686319, 1047652185, 1050460278, 1053110176, 1055601479,
+    1057933813, 1060106826, 1062120190, 1063973603, 1065666786, 1067199483,
+    1068571464, 1069782521, 1070832474, 1071721163, 1072448455, 1073014240,
+    1073418433, 1073660973, 1073741824,
+};
+
+// mean longitude and mean anomaly of the sun at J2000.0 (binary angles) and their rates (1/1000 binary angle per day)
+#define SUN_L0 3346018133UL
+#define SUN_L_RATE 11759231523LL
+#define SUN_G0 4265475187UL
+#define SUN_G_RATE 11758669598LL
+
+// equation of center (1.915 deg, 0.020 deg as binary angles)
+#define SUN_C1 22846840LL
+#define SUN_C2 238609LL
+
+// sin(23.439 deg) in Q30, obliquity of the ecliptic
+#define SIN_OBLIQUITY 427104964LL
+
+// equation of time terms in centiseconds (y = tan^2(obliquity / 2), e = eccentricity of the earth orbit)
+#define EQT_Y 59175LL
+#define EQT_2E 45953LL
+#define EQT_4EY 3955LL
+#define EQT_Y2 1273LL
+#define EQT_E2 480LL
+
+// cos(96 deg) in Q30, zenith of civil twilight
+#define COS_ZENITH_CIVIL -112236583L
+
+/**
+ * @brief Integer square root
+ *
+ * @param value
+ * @return uint32_t floor(sqrt(value))
+ */
+static uint32_t isqrt64(uint64_t value){
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while(bit > value) bit >>= 2;
+    while(bit != 0){
+        if(value >= result + bit){
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else{
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/**
+ * @brief Advance a binary angle by a rate for the given time since J2000.0
+ *
+ * @param base angle at J2000.0
+ * @param ratePerDay rate in 1/1000 binary angle per day
+ * @param sinceJ2000 seconds since J2000.0
+ * @return uint32_t angle at the given time
+ */
+static uint32_t advanceAngle(uint32_t base, int64_t ratePerDay, int64_t sinceJ2000){
+    int64_t days = sinceJ2000 / SOLAR_SECONDS_PER_DAY;
+    int64_t seconds = sinceJ2000 % SOLAR_SECONDS_PER_DAY;
+    return base + (uint32_t)(days * ratePerDay / 1000) + (uint32_t)(seconds * ratePerDay / (SOLAR_SECONDS_PER_DAY * 1000));
+}
+
+/**
+ * @brief Construct a new SolarCalc object (location 0/0)
+ *
+ */
+SolarCalc::SolarCalc(){
+    setLocation(0, 0);
+}
+
+/**
+ * @brief Set the location for the calculation
+ *
+ * @param latitudeE4 latitude in 1/10000 degree, north positive
+ * @param longitudeE4 longitude in 1/10000 degree, east positive
+ */
+void SolarCalc::setLocation(int32_t latitudeE4, int32_t longitudeE4){
+    if(latitudeE4 > 900000L) latitudeE4 = 900000L;
+    if(latitudeE4 < -900000L) latitudeE4 = -900000L;
+    if(longitudeE4 > 1800000L) longitudeE4 = 1800000L;
+    if(longitudeE4 < -1800000L) longitudeE4 = -1800000L;
+    _latitudeE4 = latitudeE4;
+    _longitudeE4 = longitudeE4;
+}
+
+/**
+ * @brief Get the latitude
+ *
+ * @return int32_t latitude in 1/10000 degree
+ */
+int32_t SolarCalc::getLatitudeE4() const{
+    return _latitudeE4;
+}
+
+/**
+ * @brief Get the longitude
+ *
+ * @return int32_t longitude in 1/10000 degree
+ */
+int32_t SolarCalc::getLongitudeE4() const{
+    return _longitudeE4;
+}
+
+/**
+ * @brief Calculate begin of morning (dawn) and end of evening (dusk) civil twilight.
+ *        The sun position is evaluated at noon first and then once more at the estimated event time.
+ *
+ * @param year year [2000 ... 2099 for best accuracy]
+ * @param dayOfYear day of the year [1 ... 366]
+ * @param dawnUtc seconds after UTC midnight of the given day when the sun rises above -6 deg (may be negative)
+ * @param duskUtc seconds after UTC midnight of the given day when the sun sets below -6 deg (may exceed one day)
+ * @return SolarDayType solar_normal if dawn and dusk are valid, solar_polarday/solar_polarnight otherwise
+ */
+SolarDayType SolarCalc::calcTwilight(uint16_t year, uint16_t dayOfYear, int32_t *dawnUtc, int32_t *duskUtc) const{
+    int32_t y = year - 1;
+    int32_t daysSince2000 = 365 * y + y / 4 - y / 100 + y / 400 - 730119 + dayOfYear - 1;
+
+    SolarDayType type = calcEvent(daysSince2000, SOLAR_SECONDS_PER_DAY / 2, -1, dawnUtc);
+    if(type != solar_normal) return type;
+    calcEvent(daysSince2000, *dawnUtc, -1, dawnUtc);
+    calcEvent(daysSince2000, SOLAR_SECONDS_PER_DAY / 2, 1, duskUtc);
+    calcEvent(daysSince2000, *duskUtc, 1, duskUtc);
+    return solar_normal;
+}
+
+/**
+ * @brief Get the epoch of UTC midnight of the given day (the reference of dawnUtc and duskUtc)
+ *
+ * @param year year
+ * @param dayOfYear day of the year [1 ... 366]
+ * @return time_t epoch seconds
+ */
+time_t SolarCalc::utcMidnight(uint16_t year, uint16_t dayOfYear){
+    int32_t y = year - 1;
+    int32_t daysSince1970 = 365 * y + y / 4 - y / 100 + y / 400 - 719162 + dayOfYear - 1;
+    return (time_t)daysSince1970 * SOLAR_SECONDS_PER_DAY;
+}
+
+/**
+ * @brief Sine of a binary angle (linear interpolation of the quarter wave table)
+ *
+ * @param angle binary angle, 2^32 is a full turn
+ * @return int32_t sine in Q30
+ */
+int32_t SolarCalc::sinBam(uint32_t angle){
+    uint8_t quadrant = angle >> 30;
+    uint32_t r = angle & (BAM_QUARTER - 1);
+    if(quadrant & 1) r = BAM_QUARTER - r;
+    uint8_t index = r >> 23;
+    int32_t value = (int32_t)pgm_read_dword(&sinTableQ30[index]);
+    if(index < 128){
+        int32_t next = (int32_t)pgm_read_dword(&sinTableQ30[index + 1]);
+        value += (int32_t)(((int64_t)(next - value) * (r & 0x7FFFFF)) >> 23);
+    }
+    return quadrant & 2 ? -value : value;
+}
+
+/**
+ * @brief Cosine of a binary angle
+ *
+ * @param angle binary angle, 2^32 is a full turn
+ * @return int32_t cosine in Q30
+ */
+int32_t SolarCalc::cosBam(uint32_t angle){
+    return sinBam(angle + BAM_QUARTER);
+}
+
+/**
+ * @brief Arccosine by binary search (cosine is monotonic on [0, half turn])
+ *
+ * @param value cosine in Q30 [-2^30 ... 2^30]
+ * @return uint32_t binary angle [0 ... 2^31]
+ */
+uint32_t SolarCalc::acosBam(int32_t value){
+    uint32_t lo = 0;
+    uint32_t hi = BAM_HALF;
+    for(uint8_t i = 0; i < 24; i++){
+        uint32_t mid = lo + (hi - lo) / 2;
+        if(cosBam(mid) > value) lo = mid;
+        else hi = mid;
+    }
+    return lo + (hi - lo) / 2;
+}
+
+/**
+ * @brief Calculate the time of one twilight event with the sun position at the given time
+ *
+ * @param daysSince2000 days from 2000-01-01 to the given day
+ * @param atUtc time (seconds after UTC midnight) at which the sun position is evaluated
+ * @param direction -1 for dawn, 1 for dusk
+ * @param eventUtc result in seconds after UTC midnight (only set for solar_normal)
+ * @return SolarDayType
+ */
+SolarDayType SolarCalc::calcEvent(int32_t daysSince2000, int32_t atUtc, int8_t direction, int32_t *eventUtc) const{
+    int64_t sinceJ2000 = (int64_t)daysSince2000 * SOLAR_SECONDS_PER_DAY + atUtc - SOLAR_SECONDS_PER_DAY / 2;
+    uint32_t meanLongitude = advanceAngle(SUN_L0, SUN_L_RATE, sinceJ2000);
+    uint32_t meanAnomaly = advanceAngle(SUN_G0, SUN_G_RATE, sinceJ2000);
+    int64_t sinG = sinBam(meanAnomaly);
+    int64_t sin2G = sinBam(meanAnomaly * 2);
+
+    // ecliptic longitude and declination (sin, cos)
+    uint32_t longitude = meanLongitude + (uint32_t)(int32_t)((SUN_C1 * sinG + SUN_C2 * sin2G) >> 30);
+    int64_t sinDecl = (SIN_OBLIQUITY * sinBam(longitude)) >> 30;
+    int64_t cosDecl = isqrt64((uint64_t)((int64_t)Q30_ONE * Q30_ONE - sinDecl * sinDecl));
+
+    // equation of time
+    int64_t sin2L = sinBam(meanLongitude * 2);
+    int64_t cos2L = cosBam(meanLongitude * 2);
+    int64_t sin4L = sinBam(meanLongitude * 4);
+    int32_t eqTime = (int32_t)((EQT_Y * sin2L - EQT_2E * sinG + EQT_4EY * ((sinG * cos2L) >> 30) - EQT_Y2 * sin4L - EQT_E2 * sin2G) >> 30);
+
+    // cos(hourangle) = (cos(zenith) - sin(lat) * sin(decl)) / (cos(lat) * cos(decl))
+    uint32_t lat = (uint32_t)(int32_t)((int64_t)_latitudeE4 * 4294967296LL / 3600000);
+    int64_t num = ((int64_t)COS_ZENITH_CIVIL * Q30_ONE) - sinBam(lat) * sinDecl;
+    int64_t den = (cosBam(lat) * cosDecl) >> 30;
+    if(den <= 0) return num > 0 ? solar_polarnight : solar_polarday;
+    int64_t cosHa = num / den;
+    if(cosHa > Q30_ONE) return solar_polarnight;
+    if(cosHa < -Q30_ONE) return solar_polarday;
+
+    int32_t haSeconds = (int32_t)(((uint64_t)acosBam((int32_t)cosHa) * SOLAR_SECONDS_PER_DAY) >> 32);
+    int32_t noon = SOLAR_SECONDS_PER_DAY / 2 - (_longitudeE4 * 3 + (_longitudeE4 >= 0 ? 62 : -62)) / 125 - (eqTime + (eqTime >= 0 ? 50 : -50)) / 100;
+    *eventUtc = noon + direction * haSeconds;
+    return solar_normal;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file solar_calc.h
+ * @brief Fixed-point sunrise/sunset calculation (civil twilight) without network access
+ *
+ * Uses the low precision sun position of the Astronomical Almanac (mean longitude, mean anomaly,
+ * equation of center) with integer math only: angles are binary angles (2^32 = full turn),
+ * sine values are Q30 from a quarter wave table, arccos is done by binary search.
+ * Dawn and dusk are within a few seconds of the full NOAA algorithm for the years 2000 ... 2099.
+ *
+ */
+
+#ifndef solar_calc_h
+#define solar_calc_h
+
+#include <Arduino.h>
+#include <time.h>
+
+#define SOLAR_SECONDS_PER_DAY 86400L
+
+enum SolarDayType {solar_normal, solar_polarday, solar_polarnight};
+
+class SolarCalc{
+
+    public:
+        SolarCalc();
+        void setLocation(int32_t latitudeE4, int32_t longitudeE4);
+        int32_t getLatitudeE4() const;
+        int32_t getLongitudeE4() const;
+        SolarDayType calcTwilight(uint16_t year, uint16_t dayOfYear, int32_t *dawnUtc, int32_t *duskUtc) const;
+        static time_t utcMidnight(uint16_t year, uint16_t dayOfYear);
+        static int32_t sinBam(uint32_t angle);
+        static int32_t cosBam(uint32_t angle);
+        static uint32_t acosBam(int32_t value);
+
+    private:
+        int32_t _latitudeE4;
+        int32_t _longitudeE4;
+
+        SolarDayType calcEvent(int32_t daysSince2000, int32_t atUtc, int8_t direction, int32_t *eventUtc) const;
+};
+
+#endif
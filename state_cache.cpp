@@ -0,0 +1,85 @@
+#include "state_cache.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Construct a new StateCache object, no field has a value yet
+ *
+ * @param names JSON names of the fields (static strings)
+ * @param count number of fields (up to STATE_MAX_FIELDS)
+ */
+StateCache::StateCache(const char *const *names, uint8_t count){
+    _names = names;
+    _count = count < STATE_MAX_FIELDS ? count : STATE_MAX_FIELDS;
+    _present = 0;
+    _changed = 0;
+}
+
+/**
+ * @brief Set the current value of a field, marks it as changed if it differs
+ *
+ * @param field index of the field
+ * @param value new value (truncated to STATE_VALUE_SIZE - 1 characters)
+ */
+void StateCache::set(uint8_t field, const char *value){
+    if(field >= _count) return;
+    uint16_t bit = 1U << field;
+    if((_present & bit) && strncmp(_values[field], value, STATE_VALUE_SIZE - 1) == 0) return;
+    snprintf(_values[field], STATE_VALUE_SIZE, "%s", value);
+    _present |= bit;
+    _changed |= bit;
+}
+
+/**
+ * @brief Set the current value of a field as number
+ *
+ * @param field index of the field
+ * @param value new value
+ */
+void StateCache::setInt(uint8_t field, long value){
+    char text[STATE_VALUE_SIZE];
+    snprintf(text, sizeof(text), "%ld", value);
+    set(field, text);
+}
+
+/**
+ * @brief Check if a value changed since clearChanges()
+ *
+ * @return true if there is something to push
+ */
+bool StateCache::hasChanges() const{
+    return _changed != 0;
+}
+
+/**
+ * @brief Write the fields as JSON object
+ *
+ * @param out buffer
+ * @param size size of the buffer
+ * @param all true: all fields with a value (new client), false: only the changed fields
+ * @return size_t length of the JSON (terminated), 0 if there is no field or the buffer is too small
+ */
+size_t StateCache::writeJson(char *out, size_t size, bool all) const{
+    uint16_t fields = all ? _present : _changed;
+    if(fields == 0 || size < 3) return 0;
+    size_t length = 0;
+    out[length++] = '{';
+    for(uint8_t i = 0; i < _count; i++){
+        if(!(fields & (1U << i))) continue;
+        int written = snprintf(out + length, size - length, "%s\"%s\":\"%s\"", length > 1 ? "," : "", _names[i], _values[i]);
+        if(written < 0 || (size_t)written >= size - length) return 0;
+        length += written;
+    }
+    if(length + 2 > size) return 0;
+    out[length++] = '}';
+    out[length] = '\0';
+    return length;
+}
+
+/**
+ * @brief Mark all values as pushed
+ *
+ */
+void StateCache::clearChanges(){
+    _changed = 0;
+}
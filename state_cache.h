@@ -0,0 +1,38 @@
+/**
+ * @file state_cache.h
+ * @brief Values of the state fields last pushed to the web UI, JSON of the changed fields
+ *
+ * The sketch sets all fields regularly, only values which differ from the last push are marked
+ * as changed. A push then contains only the changed fields, a new client gets all fields. The
+ * JSON is the same as the one of /data?key=mode (all values as strings, which need no escaping),
+ * so the web UI handles both alike. Values and JSON are written into fixed buffers, nothing is allocated.
+ *
+ */
+
+#ifndef state_cache_h
+#define state_cache_h
+
+#include <Arduino.h>
+
+#define STATE_MAX_FIELDS 16
+#define STATE_VALUE_SIZE 12         // longest value + terminating zero
+
+class StateCache{
+
+    public:
+        StateCache(const char *const *names, uint8_t count);
+        void set(uint8_t field, const char *value);
+        void setInt(uint8_t field, long value);
+        bool hasChanges() const;
+        size_t writeJson(char *out, size_t size, bool all) const;
+        void clearChanges();
+
+    private:
+        const char *const *_names;
+        uint8_t _count;
+        char _values[STATE_MAX_FIELDS][STATE_VALUE_SIZE];
+        uint16_t _present;          // bit per field: has a value
+        uint16_t _changed;          // bit per field: changed since clearChanges()
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "telemetry.h"
+#include "rtc_time.h"
+#include <string.h>
+
+static_assert(sizeof(TelemetryFrame) == TELEMETRY_MIN_SIZE, "TelemetryFrame version 1 layout changed");
+
+/**
+ * @brief Set magic, version, size and CRC of a filled frame
+ *
+ * @param frame counters and gauges are set by the caller
+ */
+void Telemetry::encode(TelemetryFrame *frame){
+    frame->magic = TELEMETRY_MAGIC;
+    frame->version = TELEMETRY_VERSION;
+    frame->size = sizeof(TelemetryFrame);
+    frame->crc = RtcTime::crc32((const uint8_t*)frame, offsetof(TelemetryFrame, crc));
+}
+
+/**
+ * @brief Check a received datagram and copy the known fields
+ *
+ * Frames of a newer version are accepted if they are at least as long as version 1: the CRC is
+ * the last field of the received frame, the appended fields are ignored.
+ *
+ * @param data datagram
+ * @param length length of the datagram
+ * @param frame decoded frame (crc is the received one)
+ * @return true if the datagram is a valid telemetry frame
+ */
+bool Telemetry::decode(const uint8_t *data, size_t length, TelemetryFrame *frame){
+    if(length < TELEMETRY_MIN_SIZE) return false;
+    uint32_t magic;
+    memcpy(&magic, data, sizeof(magic));
+    if(magic != TELEMETRY_MAGIC) return false;
+    uint8_t size = data[offsetof(TelemetryFrame, size)];
+    if(data[offsetof(TelemetryFrame, version)] < 1 || size < TELEMETRY_MIN_SIZE || size > length) return false;
+    uint32_t crc;
+    memcpy(&crc, data + size - sizeof(crc), sizeof(crc));
+    if(crc != RtcTime::crc32(data, size - sizeof(crc))) return false;
+    memcpy(frame, data, offsetof(TelemetryFrame, crc));
+    frame->crc = crc;
+    return true;
+}
+
+/**
+ * @brief Construct a new empty LatencyHistogram object
+ *
+ */
+LatencyHistogram::LatencyHistogram(){
+    reset();
+}
+
+/**
+ * @brief Remove all values (start of a new interval)
+ *
+ */
+void LatencyHistogram::reset(){
+    memset(_buckets, 0, sizeof(_buckets));
+    _count = 0;
+    _max = 0;
+}
+
+/**
+ * @brief Record one duration
+ *
+ * @param micros duration in us
+ */
+void LatencyHistogram::record(uint32_t micros){
+    uint16_t &bucket = _buckets[bucketOf(micros)];
+    if(bucket < 0xFFFF) bucket++;
+    _count++;
+    if(micros > _max) _max = micros;
+}
+
+/**
+ * @brief Get the number of recorded durations
+ *
+ * @return uint32_t
+ */
+uint32_t LatencyHistogram::getCount() const{
+    return _count;
+}
+
+/**
+ * @brief Get the longest recorded duration
+ *
+ * @return uint32_t us
+ */
+uint32_t LatencyHistogram::getMax() const{
+    return _max;
+}
+
+/**
+ * @brief Get a percentile of the recorded durations
+ *
+ * @param percent 1 ... 100
+ * @return uint32_t us, upper bound of the bucket (at most the maximum), 0 if empty
+ */
+uint32_t LatencyHistogram::getPercentile(uint8_t percent) const{
+    uint32_t total = 0;
+    for(uint8_t i = 0; i < LATENCY_BUCKETS; i++) total += _buckets[i];
+    if(total == 0) return 0;
+    // rank of the percentile, rounded up
+    uint32_t rank = ((uint64_t)total * percent + 99) / 100;
+    if(rank == 0) rank = 1;
+    uint32_t seen = 0;
+    for(uint8_t i = 0; i < LATENCY_BUCKETS; i++){
+        seen += _buckets[i];
+        if(seen >= rank){
+            uint32_t upper = bucketUpper(i);
+            return upper < _max ? upper : _max;
+        }
+    }
+    return _max;
+}
+
+/**
+ * @brief Get the bucket of a duration (exact below LATENCY_LINEAR, then 4 buckets per power of two)
+ *
+ * @param micros duration in us
+ * @return uint8_t bucket index
+ */
+uint8_t LatencyHistogram::bucketOf(uint32_t micros){
+    if(micros < LATENCY_LINEAR) return micros;
+    uint8_t exponent = 31;
+    while(!(micros & (1UL << exponent))) exponent--;
+    uint32_t bucket = LATENCY_LINEAR + (exponent - 4) * 4 + ((micros >> (exponent - 2)) & 3);
+    return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+/**
+ * @brief Get the largest duration counted in a bucket
+ *
+ * @param bucket bucket index
+ * @return uint32_t us
+ */
+uint32_t LatencyHistogram::bucketUpper(uint8_t bucket){
+    if(bucket < LATENCY_LINEAR) return bucket;
+    uint8_t exponent = 4 + (bucket - LATENCY_LINEAR) / 4;
+    uint8_t sub = (bucket - LATENCY_LINEAR) % 4;
+    uint64_t upper = ((uint64_t)(4 + sub + 1) << (exponent - 2)) - 1;
+    return upper > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : (uint32_t)upper;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file telemetry.h
+ * @brief Binary telemetry frame sent on the multicast log group, and a loop latency histogram
+ *
+ * The frame is a fixed little-endian record (magic "WCTM", version, size, CRC32) with counters
+ * since boot, gauges and the loop latency percentiles of the last interval. It is filled from
+ * integers only, no string formatting on the device. Newer versions only append fields: a
+ * decoder reads the fields it knows and skips the rest (the size field tells the length).
+ *
+ * The histogram records loop durations in log-linear buckets (4 per power of two, exact below
+ * 16 us), so percentiles are accurate to about 25 % with 256 bytes of memory.
+ *
+ */
+
+#ifndef telemetry_h
+#define telemetry_h
+
+#include <Arduino.h>
+#include <stddef.h>
+
+#define TELEMETRY_MAGIC 0x4D544357UL    // "WCTM"
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_MIN_SIZE 76           // size of version 1, accepted by all decoders
+
+#define TELEMETRY_FLAG_LINK 0x01        // WiFi connected
+#define TELEMETRY_FLAG_SYNCED 0x02      // time synchronized by NTP
+#define TELEMETRY_FLAG_NIGHTMODE 0x04
+#define TELEMETRY_FLAG_LEDOFF 0x08
+
+#define LATENCY_LINEAR 16               // values below are counted exactly
+#define LATENCY_BUCKETS 128
+
+struct TelemetryFrame {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t size;               // bytes of the frame including the CRC
+    uint8_t state;              // current mode of the clock
+    int8_t rssi;                // dBm
+    uint32_t chipId;
+    uint32_t sequence;          // incremented per frame, restarts at 0 after boot
+    uint32_t uptimeSeconds;
+    // counters since boot
+    uint32_t loops;
+    uint32_t frames;            // LED frames written to the matrix
+    uint32_t reconnects;
+    uint32_t breakerOpened;
+    uint32_t logDropped;
+    uint32_t stallMillis;
+    // gauges
+    uint32_t freeHeap;
+    uint32_t maxFreeBlock;
+    uint8_t heapFragmentation;  // %
+    uint8_t flags;              // TELEMETRY_FLAG_*
+    uint16_t fpsX10;            // render frame rate of the last interval * 10
+    // loop latency of the last interval (us)
+    uint32_t loopP50;
+    uint32_t loopP90;
+    uint32_t loopP99;
+    uint32_t loopMax;
+    uint32_t crc;               // CRC32 of all fields above
+};
+
+class Telemetry{
+
+    public:
+        static void encode(TelemetryFrame *frame);
+        static bool decode(const uint8_t *data, size_t length, TelemetryFrame *frame);
+};
+
+class LatencyHistogram{
+
+    public:
+        LatencyHistogram();
+        void reset();
+        void record(uint32_t micros);
+        uint32_t getCount() const;
+        uint32_t getMax() const;
+        uint32_t getPercentile(uint8_t percent) const;
+        static uint8_t bucketOf(uint32_t micros);
+        static uint32_t bucketUpper(uint8_t bucket);
+
+    private:
+        uint16_t _buckets[LATENCY_BUCKETS];
+        uint32_t _count;
+        uint32_t _max;
+};
+
+#endif
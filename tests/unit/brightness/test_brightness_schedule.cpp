@@ -0,0 +1,138 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../brightness_schedule.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long a = (long)(actual); \
+    long e = (long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%ld expected=%ld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+static uint32_t hms(uint32_t h, uint32_t m, uint32_t s) {
+  return h * 3600 + m * 60 + s;
+}
+
+// Walk a simulated 24 h second by second and return the largest brightness jump between two seconds
+static int maxStepOverDay(const BrightnessSchedule& schedule) {
+  int maxStep = 0;
+  int last = schedule.levelAt(SECONDS_PER_DAY - 1);
+  for (uint32_t t = 0; t < SECONDS_PER_DAY; t++) {
+    int level = schedule.levelAt(t);
+    int step = std::abs(level - last);
+    if (step > maxStep) maxStep = step;
+    last = level;
+  }
+  return maxStep;
+}
+
+static uint32_t secondsAtLevel(const BrightnessSchedule& schedule, uint8_t level) {
+  uint32_t count = 0;
+  for (uint32_t t = 0; t < SECONDS_PER_DAY; t++) {
+    if (schedule.levelAt(t) == level) count++;
+  }
+  return count;
+}
+
+int main() {
+  std::printf("Running brightness schedule tests...\n");
+
+  // Default settings: night from 22:00 to 07:00, 30 min fades, brightness 40
+  BrightnessSchedule schedule;
+  schedule.compileNightMode(22 * 60, 7 * 60, 30, 40);
+  EXPECT_EQ(schedule.getNumPoints(), 4, "default night compiles to 4 points");
+  EXPECT_EQ(schedule.levelAt(hms(12, 0, 0)), 40, "day level at noon");
+  EXPECT_EQ(schedule.levelAt(hms(21, 59, 59)), 40, "day level just before fade out");
+  EXPECT_EQ(schedule.levelAt(hms(22, 0, 0)), 40, "fade out starts at full level");
+  EXPECT_EQ(schedule.levelAt(hms(22, 15, 0)), 20, "half way through fade out");
+  EXPECT_EQ(schedule.levelAt(hms(22, 30, 0)), 0, "off at end of fade out");
+  EXPECT_EQ(schedule.levelAt(hms(0, 0, 0)), 0, "off at midnight");
+  EXPECT_EQ(schedule.levelAt(hms(3, 0, 0)), 0, "off in the night");
+  EXPECT_EQ(schedule.levelAt(hms(7, 0, 0)), 0, "fade in starts at zero");
+  EXPECT_EQ(schedule.levelAt(hms(7, 15, 0)), 20, "half way through fade in");
+  EXPECT_EQ(schedule.levelAt(hms(7, 30, 0)), 40, "full level after fade in");
+
+  // Sub-minute resolution: the level must change within a minute during the fade
+  EXPECT_TRUE(schedule.levelAt(hms(22, 10, 0)) != schedule.levelAt(hms(22, 10, 50)), "level changes within a minute");
+  EXPECT_EQ(maxStepOverDay(schedule), 1, "24 h walk: no jump larger than one level");
+  // 22:30:00 .. 07:00:00 inclusive plus the first 44 s of the fade in, which truncate to zero
+  EXPECT_EQ(secondsAtLevel(schedule, 0), hms(8, 30, 0) + 1 + 44, "24 h walk: off for 8.5 h");
+
+  // Edges of the curve for the event calendar
+  EXPECT_TRUE(schedule.isRamping(hms(22, 10, 0)), "fade out is a ramp");
+  EXPECT_TRUE(!schedule.isRamping(hms(3, 0, 0)), "night is flat");
+  EXPECT_TRUE(!schedule.isRamping(hms(12, 0, 0)), "day is flat");
+
+  // Night interval: from the end of the fade out to the start of the fade in
+  EXPECT_TRUE(!schedule.isNight(hms(22, 15, 0)), "fade out is not night");
+  EXPECT_TRUE(schedule.isNight(hms(22, 30, 0)), "night starts at the end of the fade out");
+  EXPECT_TRUE(schedule.isNight(hms(6, 59, 59)), "night until the fade in");
+  EXPECT_TRUE(!schedule.isNight(hms(7, 0, 0)), "fade in is not night");
+  EXPECT_EQ(schedule.levelAt(hms(7, 0, 30)), 0, "first seconds of the fade in round to zero");
+  EXPECT_TRUE(!schedule.isNight(hms(7, 0, 30)), "rounded zero of the fade in is not night");
+  EXPECT_TRUE(!schedule.isNight(hms(12, 0, 0)), "day is not night");
+  EXPECT_EQ(schedule.secondsToNextPoint(hms(12, 0, 0)), hms(10, 0, 0), "next edge from noon is 22:00");
+  EXPECT_EQ(schedule.secondsToNextPoint(hms(23, 0, 0)), hms(8, 0, 0), "next edge wraps midnight");
+  EXPECT_EQ(schedule.secondsToNextPoint(hms(22, 0, 0)), hms(0, 30, 0), "next edge exactly at a point");
+
+  // Bright setting: per-second steps stay small (255 levels over 1800 s)
+  schedule.compileNightMode(22 * 60, 7 * 60, 30, 255);
+  EXPECT_EQ(maxStepOverDay(schedule), 1, "24 h walk at full brightness: steps of one level");
+
+  // Night window not wrapping midnight
+  schedule.compileNightMode(1 * 60, 5 * 60 + 30, 30, 100);
+  EXPECT_EQ(schedule.levelAt(hms(0, 59, 59)), 100, "non-wrapping: day before start");
+  EXPECT_EQ(schedule.levelAt(hms(3, 0, 0)), 0, "non-wrapping: off in window");
+  EXPECT_EQ(schedule.levelAt(hms(23, 0, 0)), 100, "non-wrapping: day in the evening");
+
+  // Night shorter than the transition: fade out is shortened to the night length
+  schedule.compileNightMode(22 * 60, 22 * 60 + 10, 30, 60);
+  EXPECT_EQ(schedule.levelAt(hms(22, 5, 0)), 30, "short night: fade out compressed");
+  EXPECT_EQ(schedule.levelAt(hms(22, 10, 0)), 0, "short night: off at end");
+  EXPECT_EQ(schedule.levelAt(hms(22, 40, 0)), 60, "short night: fade in completes");
+
+  // Start equals end: nightmode effectively disabled
+  schedule.compileNightMode(6 * 60, 6 * 60, 30, 50);
+  EXPECT_EQ(secondsAtLevel(schedule, 50), SECONDS_PER_DAY, "start==end keeps full level all day");
+
+  // Constant curve (nightmode deactivated)
+  schedule.compileConstant(80);
+  EXPECT_EQ(secondsAtLevel(schedule, 80), SECONDS_PER_DAY, "constant curve over 24 h");
+
+  // More than two points per day: morning dim, day bright, evening dim, night off
+  schedule.clear();
+  EXPECT_TRUE(schedule.addPoint(hms(6, 0, 0), 10), "add point 06:00");
+  EXPECT_TRUE(schedule.addPoint(hms(9, 0, 0), 200), "add point 09:00");
+  EXPECT_TRUE(schedule.addPoint(hms(18, 0, 0), 200), "add point 18:00");
+  EXPECT_TRUE(schedule.addPoint(hms(21, 0, 0), 50), "add point 21:00");
+  EXPECT_TRUE(schedule.addPoint(hms(23, 0, 0), 0), "add point 23:00");
+  EXPECT_TRUE(schedule.addPoint(hms(5, 0, 0), 0), "add point 05:00 (unsorted insert)");
+  EXPECT_TRUE(!schedule.addPoint(hms(5, 0, 0), 7), "duplicate time is rejected");
+  EXPECT_EQ(schedule.getNumPoints(), 6, "six points stored");
+  EXPECT_EQ(schedule.getPoint(0).second, hms(5, 0, 0), "points are sorted");
+  EXPECT_EQ(schedule.levelAt(hms(7, 30, 0)), 105, "multi-point: interpolate morning ramp");
+  EXPECT_EQ(schedule.levelAt(hms(12, 0, 0)), 200, "multi-point: flat day");
+  EXPECT_EQ(schedule.levelAt(hms(22, 0, 0)), 25, "multi-point: evening ramp");
+  EXPECT_EQ(schedule.levelAt(hms(2, 0, 0)), 0, "multi-point: off across midnight");
+
+  for (int i = 0; i < BRIGHTNESS_SCHEDULE_MAX_POINTS; i++) schedule.addPoint(hms(10, 0, i), 1);
+  EXPECT_EQ(schedule.getNumPoints(), BRIGHTNESS_SCHEDULE_MAX_POINTS, "schedule capacity is bounded");
+
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../event_calendar.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+enum { ev_random, ev_anim, ev_night };
+
+// Build an epoch from local calendar time
+static time_t local(int year, int mon, int day, int h, int m, int s) {
+  struct tm t = {};
+  t.tm_year = year - 1900;
+  t.tm_mon = mon - 1;
+  t.tm_mday = day;
+  t.tm_hour = h;
+  t.tm_min = m;
+  t.tm_sec = s;
+  t.tm_isdst = -1;
+  return mktime(&t);
+}
+
+int main() {
+  std::printf("Running event calendar tests...\n");
+  setenv("TZ", "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00", 1);
+  tzset();
+
+  const time_t base = local(2024, 5, 10, 17, 0, 0);
+
+  // Empty calendar never fires
+  EventCalendar calendar;
+  EXPECT_TRUE(!calendar.isDue(base), "empty calendar is not due");
+  EXPECT_EQ(calendar.popDue(base, nullptr), -1, "empty calendar pops nothing");
+
+  // Earliest fire time is cached
+  calendar.schedule(ev_anim, base + 600, 59);
+  calendar.schedule(ev_random, base + 120, 60);
+  calendar.schedule(ev_night, base + 3600, 0);
+  EXPECT_EQ(calendar.getNextFireTime(), base + 120, "next fire time is the earliest event");
+  EXPECT_TRUE(!calendar.isDue(base + 119), "not due one second early");
+  EXPECT_TRUE(calendar.isDue(base + 120), "due exactly at fire time");
+
+  // On time delivery
+  bool missed = true;
+  EXPECT_EQ(calendar.popDue(base + 120, &missed), ev_random, "random event delivered");
+  EXPECT_TRUE(!missed, "on time delivery is not missed");
+  EXPECT_TRUE(!calendar.isScheduled(ev_random), "delivered event is removed");
+  EXPECT_EQ(calendar.getNextFireTime(), base + 600, "next fire time advances");
+
+  // Stall: loop blocked for over an hour, events come out in fire time order with missed flags
+  calendar.schedule(ev_random, base + 630, 60);
+  time_t late = base + 3700;
+  EXPECT_EQ(calendar.popDue(late, &missed), ev_anim, "stall: earliest event first");
+  EXPECT_TRUE(missed, "stall: event beyond grace is flagged missed");
+  EXPECT_EQ(calendar.popDue(late, &missed), ev_random, "stall: second event next");
+  EXPECT_EQ(calendar.popDue(late, &missed), ev_night, "stall: third event last");
+  EXPECT_TRUE(missed, "stall: zero grace event flagged missed");
+  EXPECT_EQ(calendar.popDue(late, &missed), -1, "stall: each event delivered once");
+
+  // Short stall within grace is caught up without being flagged
+  calendar.schedule(ev_random, base + 10, 60);
+  EXPECT_EQ(calendar.popDue(base + 50, &missed), ev_random, "short stall delivered");
+  EXPECT_TRUE(!missed, "short stall within grace");
+
+  // The fire time of a late event is reported, so the next one can be scheduled from its slot
+  time_t fired = 0;
+  calendar.schedule(ev_random, base + 20, 60);
+  EXPECT_EQ(calendar.popDue(base + 45, &missed, &fired), ev_random, "late event delivered");
+  EXPECT_EQ(fired, base + 20, "fire time of the slot, not the delivery time");
+
+  // Ties are resolved by id
+  calendar.schedule(ev_night, base + 5, 0);
+  calendar.schedule(ev_random, base + 5, 0);
+  EXPECT_EQ(calendar.popDue(base + 5, nullptr), ev_random, "tie: lower id first");
+  EXPECT_EQ(calendar.popDue(base + 5, nullptr), ev_night, "tie: higher id second");
+
+  // Rescheduling replaces the pending fire time, cancel removes it
+  calendar.schedule(ev_anim, base + 100, 0);
+  calendar.schedule(ev_anim, base + 200, 0);
+  EXPECT_EQ(calendar.getFireTime(ev_anim), base + 200, "reschedule replaces fire time");
+  calendar.cancel(ev_anim);
+  EXPECT_EQ(calendar.getNextFireTime(), CALENDAR_NEVER, "cancel clears the calendar");
+  EXPECT_TRUE(!calendar.schedule(CALENDAR_MAX_EVENTS, base, 0), "out of range id is rejected");
+
+  // Daily occurrence (18:07)
+  EXPECT_EQ(EventCalendar::nextDailyOccurrence(base, 18, 7, 0), local(2024, 5, 10, 18, 7, 0), "daily: later today");
+  EXPECT_EQ(EventCalendar::nextDailyOccurrence(local(2024, 5, 10, 18, 7, 0), 18, 7, 0), local(2024, 5, 11, 18, 7, 0), "daily: strictly after now");
+  EXPECT_EQ(EventCalendar::nextDailyOccurrence(local(2024, 5, 31, 19, 0, 0), 18, 7, 0), local(2024, 6, 1, 18, 7, 0), "daily: month rollover");
+  // DST switch (2024-03-31): the day only has 23 h, the next occurrence is still 18:07 local
+  time_t dst = EventCalendar::nextDailyOccurrence(local(2024, 3, 30, 20, 0, 0), 18, 7, 0);
+  EXPECT_EQ(dst, local(2024, 3, 31, 18, 7, 0), "daily: across DST switch");
+  EXPECT_EQ(dst - local(2024, 3, 30, 18, 7, 0), 23 * 3600, "daily: DST day is 23 h");
+
+  // Hourly occurrence (random message minute)
+  EXPECT_EQ(EventCalendar::nextHourlyOccurrence(base, 42, 0), local(2024, 5, 10, 17, 42, 0), "hourly: later this hour");
+  EXPECT_EQ(EventCalendar::nextHourlyOccurrence(local(2024, 5, 10, 17, 50, 0), 42, 0), local(2024, 5, 10, 18, 42, 0), "hourly: next hour");
+  EXPECT_EQ(EventCalendar::nextHourlyOccurrence(local(2024, 5, 10, 23, 59, 0), 0, 0), local(2024, 5, 11, 0, 0, 0), "hourly: day rollover");
+
+  // Simulated day with an hourly event: exactly 24 deliveries, even with a 60 s stall in between
+  calendar.clear();
+  time_t t = local(2024, 5, 10, 0, 0, 30);
+  calendar.schedule(ev_random, EventCalendar::nextHourlyOccurrence(t, 30, 0), 60);
+  int delivered = 0;
+  int missedCount = 0;
+  const time_t end = t + 24 * 3600;
+  while (t < end) {
+    t += (t % 7200 == 29 * 60 + 50) ? 60 : 1; // one stall every two hours right before the event
+    if (calendar.isDue(t)) {
+      bool m = false;
+      EXPECT_EQ(calendar.popDue(t, &m), ev_random, "simulated day: hourly event");
+      delivered++;
+      if (m) missedCount++;
+      calendar.schedule(ev_random, EventCalendar::nextHourlyOccurrence(t, 30, 0), 60);
+    }
+  }
+  EXPECT_EQ(delivered, 24, "simulated day: one delivery per hour");
+  EXPECT_EQ(missedCount, 0, "simulated day: 60 s stalls are caught up within grace");
+
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,355 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+#include "../mocks/Client.h"
+
+// Include the code under test
+#include "../../../weather_fetch.h"
+#include "../../../ip_api_parser.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_NEAR(actual, expected, tol, msg) \
+  do { \
+    double a = (double)(actual); \
+    double e = (double)(expected); \
+    if (std::fabs(a - e) > (tol)) { \
+      std::printf("[FAIL] %s: got=%.3f expected=%.3f\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+// ---- heap accounting (all allocations of the test binary) ----
+
+static size_t g_heapCurrent = 0;
+static size_t g_heapPeak = 0;
+
+void* operator new(size_t size) {
+  size_t *block = (size_t*)std::malloc(size + sizeof(size_t));
+  if (block == nullptr) throw std::bad_alloc();
+  block[0] = size;
+  g_heapCurrent += size;
+  if (g_heapCurrent > g_heapPeak) g_heapPeak = g_heapCurrent;
+  return block + 1;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  size_t *block = (size_t*)ptr - 1;
+  g_heapCurrent -= block[0];
+  std::free(block);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+static void resetHeapPeak() {
+  g_heapPeak = g_heapCurrent;
+}
+
+// ---- stand-in server: recorded response, delivered in irregular pieces ----
+
+class MockClient : public Client {
+public:
+  std::string response;
+  size_t position = 0;
+  size_t delivered = 0;
+  size_t step = 0;
+  bool isConnected = false;
+
+  int connect(const char*, uint16_t) override {
+    isConnected = true;
+    return 1;
+  }
+  size_t write(const uint8_t*, size_t size) override {
+    return size;
+  }
+  int available() override {
+    // every call releases the next piece (1, 13, 64, 200, 7 and 512 bytes)
+    static const size_t pieces[] = {1, 13, 64, 200, 7, 512};
+    if (position == delivered) delivered = std::min(response.length(), delivered + pieces[step++ % 6]);
+    return (int)(delivered - position);
+  }
+  int read() override {
+    if (available() <= 0) return -1;
+    return (uint8_t)response[position++];
+  }
+  int read(uint8_t* buf, size_t size) override {
+    size_t length = std::min(size, (size_t)available());
+    std::memcpy(buf, response.data() + position, length);
+    position += length;
+    return (int)length;
+  }
+  uint8_t connected() override {
+    return isConnected && position < response.length() ? 1 : 0;
+  }
+  void stop() override {
+    isConnected = false;
+  }
+};
+
+static std::string readFile(const char *path) {
+  std::string content;
+  FILE *file = std::fopen(path, "rb");
+  if (file == nullptr) return content;
+  char buffer[512];
+  size_t length;
+  while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, length);
+  std::fclose(file);
+  return content;
+}
+
+// ---- legacy ip-api parser (indexOf/substring on the whole payload), std::string as String ----
+
+static std::string legacyGetJsonParameterValue(std::string json, std::string parameter, bool isString) {
+  std::string value = "";
+  if (isString) {
+    size_t index = json.find("\"" + parameter + "\":\"");
+    if (index != std::string::npos) {
+      size_t start = index + parameter.length() + 4;
+      size_t end = json.find("\"", start);
+      value = json.substr(start, end - start);
+    }
+  }
+  else {
+    size_t index = json.find("\"" + parameter + "\":");
+    if (index != std::string::npos) {
+      size_t start = index + parameter.length() + 3;
+      size_t end = json.find(",", start);
+      value = json.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    }
+  }
+  return value;
+}
+
+// ---- Open-Meteo responses through WeatherFetch ----
+
+struct WeatherCase {
+  const char *file;
+  int status;
+  bool declareLength;       // Content-Length of the complete file
+  bool complete;            // all six noon/daily values expected
+  float temperature[2];
+  int weatherCode[2];
+  float sunshine[2];
+  int forecastHours;        // hours with temperature and weather code
+};
+
+static void testWeatherCase(const WeatherCase &test) {
+  char path[96];
+  std::snprintf(path, sizeof(path), "payloads/%s", test.file);
+  std::string body = readFile(path);
+  EXPECT_TRUE(body.length() > 0, path);
+
+  MockClient client;
+  client.response = "HTTP/1.1 " + std::to_string(test.status) + (test.status == 200 ? " OK" : " Bad Request") +
+                    "\r\nContent-Type: application/json; charset=utf-8\r\n";
+  if (test.declareLength) client.response += "Content-Length: " + std::to_string(body.length() + (test.complete ? 0 : 512)) + "\r\n";
+  client.response += "Connection: close\r\n\r\n" + body;
+
+  WeatherFetch fetch;
+  fetch.start("api.open-meteo.com", 443, "/v1/forecast");
+  for (int i = 0; i < 1000 && fetch.isBusy(); i++) fetch.poll(client, 10);
+
+  char msg[128];
+  std::snprintf(msg, sizeof(msg), "%s: fetch finished", test.file);
+  EXPECT_EQ(fetch.getPhase(), test.status == 200 ? wf_done : wf_failed, msg);
+  if (test.status != 200) return;
+
+  const WeatherParser &parser = fetch.getParser();
+  std::snprintf(msg, sizeof(msg), "%s: complete", test.file);
+  EXPECT_EQ(parser.isComplete(), test.complete, msg);
+  for (int day = 0; day < 2; day++) {
+    std::snprintf(msg, sizeof(msg), "%s day %d: temperature", test.file, day);
+    EXPECT_NEAR(parser.getTemperature(day == 1), test.temperature[day], 0.001, msg);
+    std::snprintf(msg, sizeof(msg), "%s day %d: weathercode", test.file, day);
+    EXPECT_EQ(parser.getWeatherCode(day == 1), test.weatherCode[day], msg);
+    std::snprintf(msg, sizeof(msg), "%s day %d: sunshine", test.file, day);
+    EXPECT_NEAR(parser.getSunshineDuration(day == 1), test.sunshine[day], 0.01, msg);
+  }
+  int hours = 0;
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    if (parser.getForecast().hasTemperature(i) && parser.getForecast().getWeatherCode(i) != WEATHER_MISSING) hours++;
+  }
+  std::snprintf(msg, sizeof(msg), "%s: forecast hours", test.file);
+  EXPECT_EQ(hours, test.forecastHours, msg);
+}
+
+// ---- ip-api responses ----
+
+struct IpApiCase {
+  const char *file;
+  bool success;
+  const char *timezone;
+  long offset;
+  float lat;
+  float lon;
+};
+
+static void testIpApiCase(const IpApiCase &test) {
+  char path[96];
+  std::snprintf(path, sizeof(path), "payloads/%s", test.file);
+  std::string body = readFile(path);
+  EXPECT_TRUE(body.length() > 0, path);
+
+  IpApiParser parser;
+  const size_t chunkSizes[] = {1, 7, IPAPI_CHUNK_SIZE, 256};
+  for (size_t chunkSize : chunkSizes) {
+    parser.reset();
+    for (size_t offset = 0; offset < body.length(); offset += chunkSize) {
+      parser.feed(body.data() + offset, std::min(chunkSize, body.length() - offset));
+    }
+    char msg[128];
+    // the stream is read until the end of the document, without waiting for the connection to close
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: done before finish", test.file, chunkSize);
+    EXPECT_EQ(parser.isDone(), std::strcmp(test.file, "ipapi_truncated.json") != 0, msg);
+    parser.finish();
+
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: success", test.file, chunkSize);
+    EXPECT_EQ(parser.isSuccess(), test.success, msg);
+    if (!test.success) continue;
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: timezone", test.file, chunkSize);
+    EXPECT_TRUE(std::strcmp(parser.getTimezone(), test.timezone) == 0, msg);
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: offset", test.file, chunkSize);
+    EXPECT_EQ(parser.getOffset(), test.offset, msg);
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: location", test.file, chunkSize);
+    EXPECT_TRUE(parser.hasLocation() && std::fabs(parser.getLatitude() - test.lat) < 1e-4 && std::fabs(parser.getLongitude() - test.lon) < 1e-4, msg);
+  }
+
+  // report where the previous parser disagrees (it needs compact JSON and a ',' after numbers)
+  if (test.success) {
+    bool legacyOk = legacyGetJsonParameterValue(body, "timezone", true) == test.timezone &&
+                    std::atol(legacyGetJsonParameterValue(body, "offset", false).c_str()) == test.offset &&
+                    std::fabs(std::atof(legacyGetJsonParameterValue(body, "lat", false).c_str()) - test.lat) < 1e-4;
+    std::printf("[INFO] %s: legacy parser %s\n", test.file, legacyOk ? "agrees" : "gives wrong values");
+  }
+}
+
+// ---- throughput and peak allocation ----
+
+static void benchmarkWeather(const char *file) {
+  char path[96];
+  std::snprintf(path, sizeof(path), "payloads/%s", file);
+  std::string body = readFile(path);
+  WeatherParser parser;
+  const int iterations = 2000;
+
+  resetHeapPeak();
+  size_t base = g_heapCurrent;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    parser.reset();
+    for (size_t offset = 0; offset < body.length(); offset += WEATHER_CHUNK_SIZE) {
+      parser.feed(body.data() + offset, std::min((size_t)WEATHER_CHUNK_SIZE, body.length() - offset));
+    }
+    parser.finish();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("[BENCH] %s (%zu bytes): %.1f MB/s, %.0f ns per response, peak heap %zu B\n",
+              file, body.length(), body.length() * (double)iterations / seconds / 1e6, seconds * 1e9 / iterations, g_heapPeak - base);
+  char msg[128];
+  std::snprintf(msg, sizeof(msg), "%s: weather parser does not allocate", file);
+  EXPECT_EQ(g_heapPeak - base, 0, msg);
+}
+
+static void benchmarkIpApi(const char *file) {
+  char path[96];
+  std::snprintf(path, sizeof(path), "payloads/%s", file);
+  std::string body = readFile(path);
+  IpApiParser parser;
+  const int iterations = 20000;
+
+  resetHeapPeak();
+  size_t base = g_heapCurrent;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    parser.reset();
+    parser.feed(body.data(), body.length());
+    parser.finish();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  size_t streamingPeak = g_heapPeak - base;
+
+  resetHeapPeak();
+  std::string timezone;
+  auto legacyStart = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    timezone = legacyGetJsonParameterValue(body, "timezone", true);
+    legacyGetJsonParameterValue(body, "offset", false);
+    legacyGetJsonParameterValue(body, "lat", false);
+    legacyGetJsonParameterValue(body, "lon", false);
+  }
+  double legacySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - legacyStart).count();
+  size_t legacyPeak = g_heapPeak - base;
+
+  std::printf("[BENCH] %s (%zu bytes): streaming %.1f MB/s, peak heap %zu B (+%zu B parser state) | legacy %.1f MB/s, peak heap %zu B\n",
+              file, body.length(), body.length() * (double)iterations / seconds / 1e6, streamingPeak, sizeof(IpApiParser),
+              body.length() * (double)iterations / legacySeconds / 1e6, legacyPeak);
+  char msg[128];
+  std::snprintf(msg, sizeof(msg), "%s: ip-api parser does not allocate", file);
+  EXPECT_EQ(streamingPeak, 0, msg);
+}
+
+int main() {
+  std::printf("Running payload corpus tests...\n");
+
+  const WeatherCase weatherCases[] = {
+    // daily first, weathercode before temperature_2m, extra variables, null values at hour 5 and 40
+    {"openmeteo_reordered.json", 200, true, true, {12.2f, 10.7f}, {61, 2}, {1840.25f, 22310.0f}, 46},
+    // pretty printed with tabs, CRLF and spaces around the colons, no Content-Length
+    {"openmeteo_whitespace.json", 200, false, true, {28.2f, 28.2f}, {0, 1}, {50400.0f, 31263.47f}, 48},
+    // units sections after the data, daily_units twice (once with an array)
+    {"openmeteo_units_repeated.json", 200, true, true, {-3.9f, -3.9f}, {71, 73}, {0.0f, 3600.0f}, 48},
+    // connection closed inside the hourly temperatures (after hour 12)
+    {"openmeteo_truncated.json", 200, true, false, {28.2f, WEATHER_MISSING}, {WEATHER_MISSING, WEATHER_MISSING},
+     {WEATHER_MISSING, WEATHER_MISSING}, 0},
+    // error document with HTTP 400
+    {"openmeteo_error.json", 400, true, false, {0, 0}, {0, 0}, {0, 0}, 0},
+  };
+  for (const WeatherCase &test : weatherCases) testWeatherCase(test);
+
+  const IpApiCase ipApiCases[] = {
+    {"ipapi_success.json", true, "Europe/Berlin", 7200, 49.2394f, 9.2553f},
+    // pretty printed, status last, negative offset and longitude, escaped quotes in a value
+    {"ipapi_reordered.json", true, "America/Los_Angeles", -25200, 37.7749f, -122.4194f},
+    // longest IANA name (32 characters)
+    {"ipapi_long_timezone.json", true, "America/Argentina/ComodRivadavia", -10800, -45.8641f, -67.4966f},
+    {"ipapi_fail.json", false, "", 0, 0, 0},
+    {"ipapi_truncated.json", false, "", 0, 0, 0},
+  };
+  for (const IpApiCase &test : ipApiCases) testIpApiCase(test);
+
+  benchmarkWeather("openmeteo_reordered.json");
+  benchmarkWeather("openmeteo_whitespace.json");
+  benchmarkIpApi("ipapi_success.json");
+  benchmarkIpApi("ipapi_reordered.json");
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
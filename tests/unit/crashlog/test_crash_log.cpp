@@ -0,0 +1,150 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../crash_log.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// Simulated RTC user memory area of the tail
+static uint32_t g_rtc[CRASH_RTC_WORDS];
+static size_t g_rtcWordsWritten = 0;
+
+static void writeToRtc(CrashTail &tail) {
+  uint8_t first;
+  uint8_t count;
+  if (tail.getDirty(&first, &count)) {
+    std::memcpy(g_rtc + first, tail.getWords() + first, count * 4);
+    g_rtcWordsWritten += count;
+    tail.clearDirty();
+  }
+}
+
+static void appendLine(CrashTail &tail, const std::string &line) {
+  tail.append(line.c_str(), line.size());
+  tail.append("\n", 1);
+  writeToRtc(tail);
+}
+
+static std::string content(const CrashTail &tail) {
+  char buffer[CRASH_TAIL_SIZE];
+  size_t length = tail.copyTo(buffer, sizeof(buffer));
+  return std::string(buffer, length);
+}
+
+static void testTail() {
+  EXPECT_EQ(sizeof(CrashTailImage) / 4 + CRASH_RTC_BLOCK, 128, "tail ends with the RTC user memory");
+
+  // power on: random RTC memory is rejected
+  std::memset(g_rtc, 0xA5, sizeof(g_rtc));
+  CrashTail tail;
+  std::memcpy(tail.getWords(), g_rtc, sizeof(g_rtc));
+  EXPECT_TRUE(!tail.restore(), "random RTC memory rejected");
+  EXPECT_EQ(tail.getLength(), 0, "cleared after power on");
+  writeToRtc(tail);
+  EXPECT_EQ(g_rtcWordsWritten, CRASH_RTC_WORDS, "whole image written after clear");
+
+  // an append writes only the changed words
+  g_rtcWordsWritten = 0;
+  appendLine(tail, "State change to: Clock");
+  EXPECT_TRUE(g_rtcWordsWritten <= 1 + (23 + 3) / 4 + 1, "append writes only the changed words");
+  EXPECT_TRUE(content(tail) == "State change to: Clock\n", "tail content");
+
+  // the newest text is kept when the tail is full
+  std::string expected;
+  for (int i = 0; i < 100; i++) {
+    std::string line = "line " + std::to_string(i);
+    appendLine(tail, line);
+    expected += line + "\n";
+  }
+  expected = expected.substr(expected.size() - CRASH_TAIL_SIZE);
+  EXPECT_EQ(tail.getLength(), CRASH_TAIL_SIZE, "tail full");
+  EXPECT_TRUE(content(tail) == expected, "tail keeps the newest text");
+
+  // soft restart or crash: the tail is restored from RTC memory
+  CrashTail restored;
+  std::memcpy(restored.getWords(), g_rtc, sizeof(g_rtc));
+  EXPECT_TRUE(restored.restore(), "tail restored from RTC memory");
+  EXPECT_TRUE(content(restored) == expected, "restored tail equals the written one");
+  uint8_t first, count;
+  EXPECT_TRUE(!restored.getDirty(&first, &count), "nothing to write after restore");
+
+  // text longer than the tail
+  std::string longText(1000, 'q');
+  restored.append(longText.c_str(), longText.size());
+  EXPECT_TRUE(content(restored) == std::string(CRASH_TAIL_SIZE, 'q'), "long text keeps its end");
+
+  // corrupted header
+  CrashTail corrupt;
+  std::memcpy(corrupt.getWords(), g_rtc, sizeof(g_rtc));
+  ((CrashTailImage*)corrupt.getWords())->used = CRASH_TAIL_SIZE + 1;
+  EXPECT_TRUE(!corrupt.restore(), "invalid length rejected");
+}
+
+static void testRecords() {
+  CrashTail tail;
+  appendLine(tail, "Heartbeat");
+  appendLine(tail, "Weather request");
+
+  // file with the slots of the crash log
+  std::string file(CRASH_FILE_SIZE, '\0');
+  for (uint32_t sequence = 0; sequence < CRASH_SLOT_COUNT + 3; sequence++) {
+    CrashRecord record;
+    CrashLog::makeRecord(&record, sequence, 1760000000 + sequence, 2, 28, 0x40201234, 0x00000010, &tail);
+    uint32_t offset = CrashLog::slotOffset(sequence);
+    EXPECT_TRUE(offset % 256 == 0 && offset + sizeof(record) <= CRASH_FILE_SIZE, "slot page-aligned inside the file");
+    std::memcpy(&file[offset], &record, sizeof(record));
+  }
+
+  // the oldest records were overwritten
+  uint32_t newest = 0;
+  uint32_t valid = 0;
+  for (uint32_t slot = 0; slot < CRASH_SLOT_COUNT; slot++) {
+    CrashRecord record;
+    std::memcpy(&record, &file[slot * CRASH_SLOT_SIZE], sizeof(record));
+    if (CrashLog::isValid(&record)) {
+      valid++;
+      if (record.sequence > newest) newest = record.sequence;
+    }
+  }
+  EXPECT_EQ(valid, CRASH_SLOT_COUNT, "all slots used");
+  EXPECT_EQ(newest, CRASH_SLOT_COUNT + 2, "newest record found");
+  CrashRecord record;
+  std::memcpy(&record, &file[CrashLog::slotOffset(newest)], sizeof(record));
+  EXPECT_EQ(record.exccause, 28, "exception cause stored");
+  EXPECT_TRUE(std::string(record.text, record.length) == "Heartbeat\nWeather request\n", "log tail stored");
+  EXPECT_TRUE(std::strcmp(CrashLog::getReasonName(record.reason), "exception") == 0, "reason name");
+
+  CrashRecord empty;
+  std::memset(&empty, 0, sizeof(empty));
+  EXPECT_TRUE(!CrashLog::isValid(&empty), "empty slot is not a record");
+}
+
+int main() {
+  std::printf("Running crash log tests...\n");
+
+  testTail();
+  testRecords();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
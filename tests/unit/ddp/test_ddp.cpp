@@ -0,0 +1,264 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+#include "../mocks/WiFiUdp.h"
+
+// Include the code under test
+#include "../../../ddp_receiver.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// Grid of at most 16x16 pixels, unset pixels are 0xFFFFFFFF
+class GridSink : public LedFrameSink {
+ public:
+  uint32_t grid[16][16];
+  int calls = 0;
+  GridSink() { clear(); }
+  void clear() {
+    for (int y = 0; y < 16; y++) for (int x = 0; x < 16; x++) grid[y][x] = 0xFFFFFFFF;
+    calls = 0;
+  }
+  void onPixel(uint8_t x, uint8_t y, uint32_t color) override {
+    grid[y][x] = color;
+    calls++;
+  }
+};
+
+// Gives the tests access to the socket of the receiver
+class TestReceiver : public DdpReceiver {
+ public:
+  using DdpReceiver::DdpReceiver;
+  WiFiUDP &udp() { return _udp; }
+};
+
+static uint32_t testColor(int index) {
+  return ((uint32_t)(index * 7 & 0xFF) << 16) | ((uint32_t)(index * 13 & 0xFF) << 8) | (uint32_t)(255 - index);
+}
+
+// Packet with the pixels [first, first + count) of the test pattern
+static std::vector<uint8_t> packet(uint8_t flags, uint8_t sequence, int first, int count) {
+  std::vector<uint8_t> data(DDP_HEADER_SIZE);
+  DdpReceiver::writeHeader(data.data(), flags, sequence, first * 3, count * 3);
+  for (int i = first; i < first + count; i++) {
+    uint32_t color = testColor(i);
+    data.push_back(color >> 16);
+    data.push_back(color >> 8);
+    data.push_back(color);
+  }
+  return data;
+}
+
+static void testHeader() {
+  uint8_t header[DDP_HEADER_SIZE];
+  EXPECT_EQ(DdpReceiver::writeHeader(header, DDP_FLAG_PUSH, 5, 0x01020304, 363), DDP_HEADER_SIZE, "header size");
+  EXPECT_EQ(header[0], 0x41, "flags version 1 + push");
+  EXPECT_EQ(header[1], 5, "sequence");
+  EXPECT_EQ(header[2], DDP_TYPE_RGB8, "type RGB 8 bit");
+  EXPECT_EQ(header[3], DDP_ID_DISPLAY, "destination display");
+  EXPECT_EQ(header[4] << 24 | header[5] << 16 | header[6] << 8 | header[7], 0x01020304, "offset big-endian");
+  EXPECT_EQ(header[8] << 8 | header[9], 363, "length big-endian");
+}
+
+static void testFrame() {
+  GridSink sink;
+  DdpReceiver receiver(&sink, 11, 11);
+  std::vector<uint8_t> data = packet(DDP_FLAG_PUSH, 1, 0, 121);
+  EXPECT_EQ(receiver.handlePacket(data.data(), data.size(), 1000), ddp_frame, "whole frame with push");
+  EXPECT_EQ(sink.calls, 121, "all pixels");
+  EXPECT_EQ(sink.grid[0][10], testColor(10), "end of first row");
+  EXPECT_EQ(sink.grid[1][0], testColor(11), "start of second row");
+  EXPECT_EQ(sink.grid[10][10], testColor(120), "bottom right");
+
+  // split at pixel boundaries, only the last packet shows the frame
+  sink.clear();
+  std::vector<uint8_t> first = packet(0, 2, 0, 50);
+  std::vector<uint8_t> second = packet(0, 3, 50, 50);
+  std::vector<uint8_t> third = packet(DDP_FLAG_PUSH, 4, 100, 21);
+  EXPECT_EQ(receiver.handlePacket(first.data(), first.size(), 1010), ddp_data, "first part without push");
+  EXPECT_EQ(receiver.handlePacket(second.data(), second.size(), 1010), ddp_data, "second part without push");
+  EXPECT_EQ(receiver.handlePacket(third.data(), third.size(), 1010), ddp_frame, "last part with push");
+  EXPECT_EQ(sink.grid[4][6], testColor(50), "second part placed by offset");
+  EXPECT_EQ(sink.grid[9][1], testColor(100), "third part placed by offset");
+  EXPECT_EQ(receiver.getFrameCount(), 2, "frames counted");
+  EXPECT_EQ(receiver.getPacketCount(), 4, "packets counted");
+
+  // push only (no data) shows the frame
+  std::vector<uint8_t> push = packet(DDP_FLAG_PUSH, 5, 0, 0);
+  EXPECT_EQ(receiver.handlePacket(push.data(), push.size(), 1010), ddp_frame, "push without data");
+
+  // timecode: 4 more header bytes
+  sink.clear();
+  std::vector<uint8_t> timed = packet(DDP_FLAG_PUSH, 6, 0, 2);
+  timed[0] |= DDP_FLAG_TIMECODE;
+  timed.insert(timed.begin() + DDP_HEADER_SIZE, {0xAA, 0xBB, 0xCC, 0xDD});
+  EXPECT_EQ(receiver.handlePacket(timed.data(), timed.size(), 1010), ddp_frame, "timecode packet");
+  EXPECT_EQ(sink.grid[0][1], testColor(1), "timecode skipped");
+
+  // a sender configured for a larger display: pixels outside of the matrix are ignored
+  sink.clear();
+  std::vector<uint8_t> large = packet(DDP_FLAG_PUSH, 7, 100, 60);
+  EXPECT_EQ(receiver.handlePacket(large.data(), large.size(), 1010), ddp_frame, "oversized frame accepted");
+  EXPECT_EQ(sink.calls, 21, "only pixels of the matrix");
+}
+
+static void testNonSquareMapping() {
+  GridSink sink;
+  DdpReceiver receiver(&sink, 16, 8);
+  std::vector<uint8_t> data = packet(DDP_FLAG_PUSH, 0, 0, 128);
+  EXPECT_EQ(receiver.handlePacket(data.data(), data.size(), 0), ddp_frame, "16x8 frame");
+  EXPECT_EQ(sink.grid[0][15], testColor(15), "16x8 end of first row");
+  EXPECT_EQ(sink.grid[1][0], testColor(16), "16x8 start of second row");
+  EXPECT_EQ(sink.grid[7][15], testColor(127), "16x8 bottom right");
+}
+
+static void testSequence() {
+  GridSink sink;
+  DdpReceiver receiver(&sink, 11, 11);
+  uint32_t now = 0;
+  for (int sequence = 1; sequence <= 15; sequence++) {
+    std::vector<uint8_t> data = packet(DDP_FLAG_PUSH, sequence, 0, 1);
+    receiver.handlePacket(data.data(), data.size(), now += 20);
+  }
+  std::vector<uint8_t> wrapped = packet(DDP_FLAG_PUSH, 1, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(wrapped.data(), wrapped.size(), now += 20), ddp_frame, "sequence wraps 15 -> 1");
+  EXPECT_EQ(receiver.getLostCount(), 0, "no loss in order");
+
+  std::vector<uint8_t> gap = packet(DDP_FLAG_PUSH, 4, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(gap.data(), gap.size(), now += 20), ddp_frame, "packet after a gap");
+  EXPECT_EQ(receiver.getLostCount(), 2, "2 packets lost");
+
+  std::vector<uint8_t> late = packet(DDP_FLAG_PUSH, 3, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(late.data(), late.size(), now += 20), ddp_ignored, "late packet dropped");
+  std::vector<uint8_t> duplicate = packet(DDP_FLAG_PUSH, 4, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(duplicate.data(), duplicate.size(), now += 20), ddp_ignored, "duplicate dropped");
+  EXPECT_EQ(receiver.getLateCount(), 2, "late packets counted");
+
+  // wrap-around gap 14 -> 2 (15 and 1 lost)
+  std::vector<uint8_t> p14 = packet(DDP_FLAG_PUSH, 14, 0, 1);
+  std::vector<uint8_t> p2 = packet(DDP_FLAG_PUSH, 2, 0, 1);
+  receiver.handlePacket(p14.data(), p14.size(), now += DDP_SEQUENCE_TIMEOUT);
+  uint32_t lost = receiver.getLostCount();
+  EXPECT_EQ(receiver.handlePacket(p2.data(), p2.size(), now += 20), ddp_frame, "gap over the wrap-around");
+  EXPECT_EQ(receiver.getLostCount() - lost, 2, "2 packets lost over the wrap-around");
+
+  // a restarted sender may start with any number
+  std::vector<uint8_t> restart = packet(DDP_FLAG_PUSH, 1, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(restart.data(), restart.size(), now + DDP_SEQUENCE_TIMEOUT), ddp_frame,
+            "any sequence after the timeout");
+
+  // sequence 0: not used, never dropped
+  std::vector<uint8_t> unused = packet(DDP_FLAG_PUSH, 0, 0, 1);
+  EXPECT_EQ(receiver.handlePacket(unused.data(), unused.size(), now + DDP_SEQUENCE_TIMEOUT), ddp_frame, "sequence 0");
+  EXPECT_EQ(receiver.handlePacket(unused.data(), unused.size(), now + DDP_SEQUENCE_TIMEOUT), ddp_frame, "sequence 0 again");
+}
+
+static void testInvalid() {
+  GridSink sink;
+  DdpReceiver receiver(&sink, 11, 11);
+  std::vector<uint8_t> data = packet(DDP_FLAG_PUSH, 0, 0, 4);
+
+  std::vector<uint8_t> bad = data;
+  bad[0] = 0x81;                  // version 2
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "wrong version");
+  bad = data;
+  bad[2] = 0x1B;                  // RGB 16 bit
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "unsupported type");
+  bad = data;
+  bad[7] = 1;                     // offset not at a pixel
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "offset not at a pixel boundary");
+  bad = data;
+  bad.pop_back();                 // shorter than the length in the header
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "truncated packet");
+  EXPECT_EQ(receiver.handlePacket(data.data(), 5, 0), ddp_ignored, "shorter than the header");
+  EXPECT_EQ(receiver.getInvalidCount(), 5, "invalid packets counted");
+
+  bad = data;
+  bad[0] |= DDP_FLAG_QUERY;
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "query ignored");
+  bad = data;
+  bad[3] = 251;                   // status
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_ignored, "other destination ignored");
+  bad = data;
+  bad[2] = DDP_TYPE_UNDEFINED;
+  bad[3] = DDP_ID_ALL;
+  EXPECT_EQ(receiver.handlePacket(bad.data(), bad.size(), 0), ddp_frame, "undefined type to all accepted");
+  EXPECT_EQ(receiver.getInvalidCount(), 5, "ignored packets are not invalid");
+  EXPECT_EQ(sink.calls, 4, "only the valid packet drawn");
+}
+
+static void testSocket() {
+  // the pixels are read from the socket in chunks of DDP_READ_CHUNK bytes
+  GridSink sink;
+  TestReceiver receiver(&sink, 11, 11);
+  std::vector<uint8_t> first = packet(0, 1, 0, 61);
+  std::vector<uint8_t> second = packet(DDP_FLAG_PUSH, 2, 61, 60);
+  std::vector<uint8_t> next = packet(DDP_FLAG_PUSH, 3, 0, 1);
+  receiver.udp().enqueuePacket(first.data(), first.size());
+  receiver.udp().enqueuePacket(second.data(), second.size());
+  receiver.udp().enqueuePacket(next.data(), next.size());
+  EXPECT_EQ(receiver.loop(0), ddp_frame, "loop returns after the push");
+  EXPECT_EQ(sink.calls, 121, "frame read from the socket");
+  EXPECT_EQ(sink.grid[5][6], testColor(61), "second packet placed by offset");
+  EXPECT_EQ(sink.grid[10][10], testColor(120), "last pixel");
+  EXPECT_EQ(receiver.loop(0), ddp_frame, "next frame in the next loop");
+  EXPECT_EQ(receiver.loop(0), ddp_ignored, "no more packets");
+
+  std::vector<uint8_t> timed = packet(DDP_FLAG_PUSH, 4, 0, 2);
+  timed[0] |= DDP_FLAG_TIMECODE;
+  timed.insert(timed.begin() + DDP_HEADER_SIZE, {0, 0, 0, 0});
+  receiver.udp().enqueuePacket(timed.data(), timed.size());
+  EXPECT_EQ(receiver.loop(0), ddp_frame, "timecode read from the socket");
+  EXPECT_EQ(sink.grid[0][1], testColor(1), "timecode skipped in the socket");
+
+  receiver.udp().enqueuePacket(timed.data(), 6);
+  EXPECT_EQ(receiver.loop(0), ddp_ignored, "short datagram");
+  EXPECT_EQ(receiver.getInvalidCount(), 1, "short datagram invalid");
+}
+
+static void benchDecode() {
+  GridSink sink;
+  DdpReceiver receiver(&sink, 11, 11);
+  std::vector<uint8_t> data = packet(DDP_FLAG_PUSH, 0, 0, 121);
+  const int frames = 100000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; i++) {
+    receiver.handlePacket(data.data(), data.size(), i);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::printf("[BENCH] decoded %d frames of 11x11 pixels: %.2f us per frame\n", frames, seconds * 1e6 / frames);
+  EXPECT_EQ(receiver.getFrameCount(), frames, "all benchmark frames decoded");
+}
+
+int main() {
+  std::printf("Running DDP receiver tests...\n");
+
+  testHeader();
+  testFrame();
+  testNonSquareMapping();
+  testSequence();
+  testInvalid();
+  testSocket();
+  benchDecode();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
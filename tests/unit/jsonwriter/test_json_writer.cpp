@@ -0,0 +1,291 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../json_writer.h"
+
+static int g_failures = 0;
+
+// ---- allocation counting (glibc: malloc of the test binary replaces the one of libc, also for
+// allocations inside vsnprintf and operator new) ----
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+static size_t g_allocations = 0;
+static size_t g_largestAllocation = 0;
+
+extern "C" void *malloc(size_t size) {
+  g_allocations++;
+  if (size > g_largestAllocation) g_largestAllocation = size;
+  return __libc_malloc(size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+  g_allocations++;
+  if (size > g_largestAllocation) g_largestAllocation = size;
+  return __libc_realloc(ptr, size);
+}
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_STR(actual, expected, msg) \
+  do { \
+    std::string a = (actual); \
+    std::string e = (expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s:\n  got=     %s\n  expected=%s\n", msg, a.c_str(), e.c_str()); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+// Output without allocations (stands in for server.sendContent())
+static char g_out[65536];
+static size_t g_outLength = 0;
+static size_t g_chunks = 0;
+static size_t g_smallChunks = 0;   // chunks shorter than JSON_WRITER_CHUNK
+
+static void collect(const char *data, size_t length) {
+  if (g_outLength + length <= sizeof(g_out)) {
+    std::memcpy(g_out + g_outLength, data, length);
+    g_outLength += length;
+  }
+  g_chunks++;
+  if (length < JSON_WRITER_CHUNK) g_smallChunks++;
+}
+
+static void resetOutput() {
+  g_outLength = 0;
+  g_chunks = 0;
+  g_smallChunks = 0;
+}
+
+static std::string output() {
+  return std::string(g_out, g_outLength);
+}
+
+static void testObject() {
+  resetOutput();
+  JsonWriter json(collect);
+  json.beginObject();
+  json.field("mode", "Clock");
+  json.fieldInt("modeid", 0);
+  json.fieldInt("driftPpb", -1250);
+  json.fieldUInt("epoch", 4000000000UL);
+  json.fieldf("nightModeStart", "%02d-%02d", 22, 5);
+  json.endObject();
+  EXPECT_EQ(g_outLength, 0, "nothing sent before the chunk is full");
+  json.flush();
+  EXPECT_STR(output(), "{\"mode\":\"Clock\",\"modeid\":\"0\",\"driftPpb\":\"-1250\",\"epoch\":\"4000000000\","
+                       "\"nightModeStart\":\"22-05\"}", "object with quoted values like /data");
+  EXPECT_EQ(json.getLength(), g_outLength, "length of the document");
+  json.flush();
+  EXPECT_EQ(g_chunks, 1, "second flush sends nothing");
+
+  resetOutput();
+  JsonWriter empty(collect);
+  empty.beginObject();
+  empty.endObject();
+  empty.flush();
+  EXPECT_STR(output(), "{}", "empty object");
+}
+
+static void testNesting() {
+  // format of handleList: array of file objects and the summary object
+  resetOutput();
+  JsonWriter json(collect);
+  json.beginArray();
+  json.beginObject();
+  json.field("folder", "");
+  json.field("name", "index.html");
+  json.field("size", "4.21 KB");
+  json.endObject();
+  json.beginObject();
+  json.field("folder", "web");
+  json.field("name", "fs.html");
+  json.field("size", "812 Byte");
+  json.endObject();
+  json.beginObject();
+  json.fieldUInt("freeBytes", 1000);
+  json.endObject();
+  json.endArray();
+  json.flush();
+  EXPECT_STR(output(), "[{\"folder\":\"\",\"name\":\"index.html\",\"size\":\"4.21 KB\"},"
+                       "{\"folder\":\"web\",\"name\":\"fs.html\",\"size\":\"812 Byte\"},{\"freeBytes\":\"1000\"}]",
+             "array of objects");
+
+  resetOutput();
+  JsonWriter nested(collect);
+  nested.beginObject();
+  nested.beginArray("list");
+  nested.field(nullptr, "a");
+  nested.fieldInt(nullptr, 2);
+  nested.beginArray();
+  nested.endArray();
+  nested.endArray();
+  nested.beginObject("inner");
+  nested.field("x", "y");
+  nested.endObject();
+  nested.field("last", "z");
+  nested.endObject();
+  nested.flush();
+  EXPECT_STR(output(), "{\"list\":[\"a\",\"2\",[]],\"inner\":{\"x\":\"y\"},\"last\":\"z\"}", "commas on every level");
+}
+
+static void testEscaping() {
+  resetOutput();
+  JsonWriter json(collect);
+  json.beginObject();
+  json.field("name", "say \"hi\"\\now\n\x01");
+  json.field("key \"q\"", "v");
+  json.endObject();
+  json.flush();
+  EXPECT_STR(output(), "{\"name\":\"say \\\"hi\\\"\\\\now\\u000a\\u0001\",\"key \\\"q\\\"\":\"v\"}", "quotes, backslash, control characters");
+}
+
+static void testNumbersAndPieces() {
+  resetOutput();
+  JsonWriter json(collect);
+  json.beginObject();
+  json.fieldFloat("hours", 27000 / 3600.0, 2);
+  json.fieldFloat("tempNow", -3.25f, 1);
+  json.beginString("temperature");
+  const float temps[] = {4.0f, 3.5f, -0.5f};
+  for (int i = 0; i < 3; i++) json.appendf(i > 0 ? ",%.1f" : "%.1f", temps[i]);
+  json.endString();
+  json.beginString("servers");
+  json.append("a.pool");
+  json.append(" ");
+  json.append("b.pool");
+  json.endString();
+  json.endObject();
+  json.flush();
+  EXPECT_STR(output(), "{\"hours\":\"7.50\",\"tempNow\":\"-3.2\",\"temperature\":\"4.0,3.5,-0.5\",\"servers\":\"a.pool b.pool\"}",
+             "floats and strings written in pieces");
+
+  resetOutput();
+  JsonWriter longValue(collect);
+  std::string text(100, 'x');
+  longValue.fieldf(nullptr, "%s", text.c_str());
+  longValue.flush();
+  EXPECT_EQ(g_outLength, JSON_WRITER_VALUE - 1 + 2, "formatted value truncated");
+  resetOutput();
+  JsonWriter plain(collect);
+  plain.field(nullptr, text.c_str());
+  plain.flush();
+  EXPECT_EQ(g_outLength, 100 + 2, "plain value not truncated");
+}
+
+static void testChunks() {
+  resetOutput();
+  JsonWriter json(collect);
+  std::string expected = "[";
+  json.beginArray();
+  for (int i = 0; i < 200; i++) {
+    json.beginObject();
+    json.fieldInt("index", i);
+    json.field("name", "some-longer-file-name.json");
+    json.endObject();
+    if (i > 0) expected += ",";
+    expected += "{\"index\":\"" + std::to_string(i) + "\",\"name\":\"some-longer-file-name.json\"}";
+  }
+  json.endArray();
+  expected += "]";
+  size_t chunksBeforeFlush = g_chunks;
+  json.flush();
+  EXPECT_STR(output(), expected, "document split into chunks");
+  EXPECT_EQ(chunksBeforeFlush, expected.size() / JSON_WRITER_CHUNK, "full chunks while writing");
+  EXPECT_EQ(g_smallChunks, 1, "only the last chunk is shorter");
+  EXPECT_EQ(json.getLength(), expected.size(), "length of the document");
+}
+
+// Former handleList: one String for the whole response, built by concatenation
+static std::string legacyList(int files) {
+  std::string temp = "[";
+  for (int i = 0; i < files; i++) {
+    std::string folder = i % 4 == 0 ? "web" : "";
+    std::string name = "file" + std::to_string(i) + ".html";
+    std::string size = std::to_string(100 + i) + " Byte";
+    if (temp != "[") temp += ',';
+    temp += "{\"folder\":\"" + folder + "\",\"name\":\"" + name + "\",\"size\":\"" + size + "\"}";
+  }
+  temp += ",{\"usedBytes\":\"" + std::string("20.50 KB") + "\",\"totalBytes\":\"" + std::string("1.00 MB") + "\",\"freeBytes\":\"" +
+          std::to_string(1027584) + "\"}]";
+  return temp;
+}
+
+static void writerList(int files) {
+  JsonWriter json(collect);
+  char name[32];
+  char size[16];
+  json.beginArray();
+  for (int i = 0; i < files; i++) {
+    std::snprintf(name, sizeof(name), "file%d.html", i);
+    std::snprintf(size, sizeof(size), "%d Byte", 100 + i);
+    json.beginObject();
+    json.field("folder", i % 4 == 0 ? "web" : "");
+    json.field("name", name);
+    json.field("size", size);
+    json.endObject();
+  }
+  json.beginObject();
+  json.field("usedBytes", "20.50 KB");
+  json.field("totalBytes", "1.00 MB");
+  json.fieldUInt("freeBytes", 1027584);
+  json.endObject();
+  json.endArray();
+  json.flush();
+}
+
+static void testAllocations() {
+  const int sizes[] = {10, 200};
+  for (int files : sizes) {
+    resetOutput();
+    size_t before = g_allocations;
+    g_largestAllocation = 0;
+    writerList(files);
+    size_t writerAllocations = g_allocations - before;
+
+    before = g_allocations;
+    g_largestAllocation = 0;
+    std::string legacy = legacyList(files);
+    size_t legacyAllocations = g_allocations - before;
+    size_t legacyLargest = g_largestAllocation;
+
+    EXPECT_STR(output(), legacy, "same document as the String concatenation");
+    EXPECT_EQ(writerAllocations, 0, "writer does not allocate");
+    EXPECT_TRUE(legacyLargest >= legacy.size(), "legacy response held in one heap block");
+    std::printf("[BENCH] file list of %d entries (%zu bytes): %zu heap allocations, largest 0 bytes (writer, %zu chunks) | "
+                "%zu heap allocations, largest %zu bytes (legacy)\n",
+                files, legacy.size(), writerAllocations, g_chunks, legacyAllocations, legacyLargest);
+  }
+}
+
+int main() {
+  std::printf("Running JSON writer tests...\n");
+  testObject();
+  testNesting();
+  testEscaping();
+  testNumbersAndPieces();
+  testChunks();
+  testAllocations();
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
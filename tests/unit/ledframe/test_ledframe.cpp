@@ -0,0 +1,356 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../led_frame.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// Grid of at most 16x16 pixels, unset pixels are 0xFFFFFFFF
+class GridSink : public LedFrameSink {
+ public:
+  uint32_t grid[16][16];
+  int calls = 0;
+  GridSink() { clear(); }
+  void clear() {
+    for (int y = 0; y < 16; y++) for (int x = 0; x < 16; x++) grid[y][x] = 0xFFFFFFFF;
+    calls = 0;
+  }
+  void onPixel(uint8_t x, uint8_t y, uint32_t color) override {
+    grid[y][x] = color;
+    calls++;
+  }
+};
+
+static std::vector<uint8_t> header(uint8_t format, uint8_t width, uint8_t height) {
+  return std::vector<uint8_t>{'W', format, width, height};
+}
+
+static uint32_t testColor(int index) {
+  return ((uint32_t)(index * 7 & 0xFF) << 16) | ((uint32_t)(index * 13 & 0xFF) << 8) | (uint32_t)(255 - index);
+}
+
+static std::vector<uint8_t> rgb888Frame(uint8_t width, uint8_t height) {
+  std::vector<uint8_t> data = header(lf_rgb888, width, height);
+  for (int i = 0; i < width * height; i++) {
+    uint32_t color = testColor(i);
+    data.push_back(color >> 16);
+    data.push_back(color >> 8);
+    data.push_back(color);
+  }
+  return data;
+}
+
+static void testFrameRgb888() {
+  GridSink sink;
+  LedFrameDecoder decoder(&sink, 11, 11);
+  std::vector<uint8_t> data = rgb888Frame(11, 11);
+  EXPECT_EQ(data.size(), 4 + 11 * 11 * 3, "RGB888 frame size");
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()), "RGB888 frame accepted");
+  EXPECT_TRUE(decoder.finish(), "RGB888 frame complete");
+  EXPECT_EQ(decoder.getPixelCount(), 121, "RGB888 all pixels decoded");
+  EXPECT_EQ(sink.grid[0][0], testColor(0), "RGB888 top left");
+  EXPECT_EQ(sink.grid[0][10], testColor(10), "RGB888 end of first row");
+  EXPECT_EQ(sink.grid[1][0], testColor(11), "RGB888 start of second row");
+  EXPECT_EQ(sink.grid[10][10], testColor(120), "RGB888 bottom right");
+}
+
+static void testChunkedFeed() {
+  // the webserver hands the body over in chunks of any size, also splitting header and pixels
+  std::vector<uint8_t> data = rgb888Frame(11, 11);
+  const size_t chunkSizes[] = {1, 2, 3, 5, 7, 64, 1460};
+  for (size_t chunk : chunkSizes) {
+    GridSink sink;
+    LedFrameDecoder decoder(&sink, 11, 11);
+    bool ok = true;
+    for (size_t pos = 0; pos < data.size(); pos += chunk) {
+      size_t length = data.size() - pos < chunk ? data.size() - pos : chunk;
+      ok = decoder.feed(data.data() + pos, length) && ok;
+    }
+    char msg[80];
+    std::snprintf(msg, sizeof(msg), "chunks of %zu bytes decode the frame", chunk);
+    EXPECT_TRUE(ok && decoder.finish() && sink.calls == 121 && sink.grid[5][7] == testColor(5 * 11 + 7), msg);
+  }
+}
+
+static void testNonSquareMapping() {
+  // y has to be index / width (the old base64 handler used index / HEIGHT)
+  GridSink sink;
+  LedFrameDecoder decoder(&sink, 16, 8);
+  std::vector<uint8_t> data = rgb888Frame(16, 8);
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "16x8 frame accepted");
+  EXPECT_EQ(sink.grid[0][15], testColor(15), "16x8 end of first row");
+  EXPECT_EQ(sink.grid[1][0], testColor(16), "16x8 start of second row");
+  EXPECT_EQ(sink.grid[7][15], testColor(127), "16x8 bottom right");
+  EXPECT_EQ(sink.grid[8][0], 0xFFFFFFFF, "16x8 nothing below the matrix");
+
+  GridSink tall;
+  LedFrameDecoder tallDecoder(&tall, 8, 16);
+  data = rgb888Frame(8, 16);
+  EXPECT_TRUE(tallDecoder.feed(data.data(), data.size()) && tallDecoder.finish(), "8x16 frame accepted");
+  EXPECT_EQ(tall.grid[1][0], testColor(8), "8x16 start of second row");
+  EXPECT_EQ(tall.grid[15][7], testColor(127), "8x16 bottom right");
+  EXPECT_EQ(tall.grid[0][8], 0xFFFFFFFF, "8x16 nothing right of the matrix");
+}
+
+static void testRgb565() {
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0xFFFF), 0xFFFFFF, "RGB565 white");
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0x0000), 0x000000, "RGB565 black");
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0xF800), 0xFF0000, "RGB565 red");
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0x07E0), 0x00FF00, "RGB565 green");
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0x001F), 0x0000FF, "RGB565 blue");
+  EXPECT_EQ(LedFrameDecoder::rgb565To888(0x8410), 0x848284, "RGB565 grey");
+
+  GridSink sink;
+  LedFrameDecoder decoder(&sink, 11, 11);
+  std::vector<uint8_t> data = header(lf_rgb565, 11, 11);
+  for (int i = 0; i < 121; i++) {
+    uint16_t color = i == 12 ? 0xF800 : 0x001F;
+    data.push_back(color >> 8);   // big-endian
+    data.push_back(color & 0xFF);
+  }
+  EXPECT_EQ(data.size(), 4 + 242, "RGB565 frame size");
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "RGB565 frame accepted");
+  EXPECT_EQ(sink.grid[1][1], 0xFF0000, "RGB565 pixel 12 red");
+  EXPECT_EQ(sink.grid[1][2], 0x0000FF, "RGB565 pixel 13 blue");
+}
+
+static void testPixelList() {
+  GridSink sink;
+  LedFrameDecoder decoder(&sink, 11, 11);
+  std::vector<uint8_t> data = header(lf_list_rgb888, 11, 11);
+  const uint8_t entries[][4] = {{0, 1, 2, 3}, {23, 0xAA, 0xBB, 0xCC}, {120, 9, 8, 7}};
+  for (const auto &entry : entries) data.insert(data.end(), entry, entry + 4);
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "RGB888 list accepted");
+  EXPECT_EQ(sink.calls, 3, "RGB888 list only listed pixels");
+  EXPECT_EQ(sink.grid[0][0], 0x010203, "RGB888 list pixel 0");
+  EXPECT_EQ(sink.grid[2][1], 0xAABBCC, "RGB888 list pixel 23");
+  EXPECT_EQ(sink.grid[10][10], 0x090807, "RGB888 list pixel 120");
+  EXPECT_EQ(sink.grid[5][5], 0xFFFFFFFF, "RGB888 list other pixels untouched");
+
+  sink.clear();
+  decoder.reset();
+  data = header(lf_list_rgb565, 11, 11);
+  data.insert(data.end(), {60, 0x07, 0xE0});
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "RGB565 list accepted");
+  EXPECT_EQ(sink.grid[5][5], 0x00FF00, "RGB565 list pixel 60");
+
+  decoder.reset();
+  data = header(lf_list_rgb888, 11, 11);
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "empty list accepted");
+
+  decoder.reset();
+  data = header(lf_list_rgb888, 11, 11);
+  data.insert(data.end(), {121, 1, 2, 3});
+  EXPECT_TRUE(!decoder.feed(data.data(), data.size()) && decoder.hasError(), "list index outside the matrix rejected");
+
+  LedFrameDecoder large(&sink, 32, 16);
+  data = header(lf_list_rgb888, 32, 16);
+  EXPECT_TRUE(!large.feed(data.data(), data.size()), "list rejected for more than 256 pixels");
+}
+
+static void testErrors() {
+  GridSink sink;
+  LedFrameDecoder decoder(&sink, 11, 11);
+
+  std::vector<uint8_t> data = rgb888Frame(11, 11);
+  data[0] = 'X';
+  EXPECT_TRUE(!decoder.feed(data.data(), data.size()) && !decoder.finish(), "wrong magic rejected");
+  EXPECT_EQ(sink.calls, 0, "wrong magic draws nothing");
+
+  decoder.reset();
+  data = rgb888Frame(11, 11);
+  data[1] = 9;
+  EXPECT_TRUE(!decoder.feed(data.data(), data.size()), "unknown format rejected");
+
+  decoder.reset();
+  data = rgb888Frame(12, 11);
+  EXPECT_TRUE(!decoder.feed(data.data(), data.size()), "wrong width rejected");
+
+  decoder.reset();
+  data = rgb888Frame(11, 11);
+  data.pop_back();
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()), "truncated frame fed");
+  EXPECT_TRUE(!decoder.finish() && decoder.hasError(), "truncated frame incomplete");
+
+  decoder.reset();
+  data = rgb888Frame(11, 11);
+  data.resize(data.size() - 3);
+  decoder.feed(data.data(), data.size());
+  EXPECT_TRUE(!decoder.finish(), "missing pixel rejected");
+
+  decoder.reset();
+  data = rgb888Frame(11, 11);
+  data.insert(data.end(), {1, 2, 3});
+  EXPECT_TRUE(!decoder.feed(data.data(), data.size()), "too many pixels rejected");
+
+  decoder.reset();
+  data = header(lf_rgb888, 11, 11);
+  data.pop_back();
+  decoder.feed(data.data(), data.size());
+  EXPECT_TRUE(!decoder.finish(), "incomplete header rejected");
+
+  decoder.reset();
+  data = rgb888Frame(11, 11);
+  EXPECT_TRUE(decoder.feed(data.data(), data.size()) && decoder.finish(), "reset clears the error");
+}
+
+static void testFrameRate() {
+  FrameRateMeter meter;
+  EXPECT_EQ(meter.getFpsX10(0), 0, "no frames: 0 fps");
+  uint32_t now = 5000;
+  for (int i = 0; i < 100; i++) {
+    meter.record(now);
+    now += 25;                    // 40 fps
+  }
+  EXPECT_EQ(meter.getFrameCount(), 100, "frames counted");
+  EXPECT_EQ(meter.getFpsX10(now), 400, "40 fps measured");
+
+  for (int i = 0; i < 60; i++) {
+    meter.record(now);
+    now += 100;                   // 10 fps
+  }
+  EXPECT_EQ(meter.getFpsX10(now), 100, "10 fps measured");
+  EXPECT_EQ(meter.getFpsX10(now + 2000), 0, "stream stopped: 0 fps");
+
+  now += 10000;
+  meter.record(now);
+  EXPECT_EQ(meter.getFpsX10(now + 10), 0, "restarted stream: no stale rate");
+  EXPECT_EQ(meter.getFrameCount(), 161, "frames counted across streams");
+}
+
+// old /leddirect format: base64 string of 4 bytes (R G B unused) per pixel
+static std::string base64Picture(int pixels) {
+  static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::vector<uint8_t> bytes;
+  for (int i = 0; i < pixels; i++) {
+    uint32_t color = testColor(i);
+    bytes.push_back(color >> 16);
+    bytes.push_back(color >> 8);
+    bytes.push_back(color);
+    bytes.push_back(0);
+  }
+  std::string text;
+  for (size_t i = 0; i < bytes.size(); i += 3) {
+    uint32_t group = (uint32_t)bytes[i] << 16;
+    if (i + 1 < bytes.size()) group |= (uint32_t)bytes[i + 1] << 8;
+    if (i + 2 < bytes.size()) group |= bytes[i + 2];
+    text += alphabet[group >> 18 & 0x3F];
+    text += alphabet[group >> 12 & 0x3F];
+    text += i + 1 < bytes.size() ? alphabet[group >> 6 & 0x3F] : '=';
+    text += i + 2 < bytes.size() ? alphabet[group & 0x3F] : '=';
+  }
+  return text;
+}
+
+static std::string formEncode(const std::string &value) {
+  std::string text = "data=";
+  for (char c : value) {
+    if (c == '+') text += "%2B";
+    else if (c == '/') text += "%2f";
+    else if (c == '=') text += "%3D";
+    else text += c;
+  }
+  return text;
+}
+
+static bool feedChunks(LedBase64Decoder &decoder, const std::string &body, size_t chunk) {
+  bool ok = true;
+  for (size_t pos = 0; pos < body.size(); pos += chunk) {
+    size_t length = body.size() - pos < chunk ? body.size() - pos : chunk;
+    ok = decoder.feed((const uint8_t*)body.data() + pos, length) && ok;
+  }
+  return ok;
+}
+
+static void testBase64() {
+  std::string picture = base64Picture(121);
+  EXPECT_EQ(picture.size(), 648, "base64 picture size (484 bytes, padded)");
+  EXPECT_TRUE(picture.find('+') != std::string::npos && picture.find('/') != std::string::npos, "picture uses + and /");
+
+  // raw body (e.g. text/plain) and form field, in chunks which split groups and escapes
+  const size_t chunkSizes[] = {1, 3, 4, 7, 1460};
+  for (size_t chunk : chunkSizes) {
+    GridSink sink;
+    LedBase64Decoder decoder(&sink, 11, 11);
+    decoder.reset(false);
+    char msg[80];
+    std::snprintf(msg, sizeof(msg), "base64 body in chunks of %zu bytes", chunk);
+    EXPECT_TRUE(feedChunks(decoder, picture, chunk) && decoder.finish() && sink.calls == 121 &&
+                sink.grid[0][0] == testColor(0) && sink.grid[5][7] == testColor(5 * 11 + 7) && sink.grid[10][10] == testColor(120), msg);
+
+    sink.clear();
+    decoder.reset(true);
+    std::snprintf(msg, sizeof(msg), "form encoded base64 in chunks of %zu bytes", chunk);
+    EXPECT_TRUE(feedChunks(decoder, formEncode(picture) + "&other=1", chunk) && decoder.finish() && sink.calls == 121 &&
+                sink.grid[3][4] == testColor(3 * 11 + 4) && sink.grid[10][10] == testColor(120), msg);
+  }
+
+  // unencoded '+' in a form field, missing padding, line breaks
+  GridSink sink;
+  LedBase64Decoder decoder(&sink, 11, 11);
+  decoder.reset(true);
+  std::string loose = "data=" + picture.substr(0, 320) + "\r\n" + picture.substr(320, 326);
+  EXPECT_TRUE(feedChunks(decoder, loose, 64) && decoder.finish(), "unencoded form value accepted");
+  EXPECT_EQ(sink.calls, 121, "unencoded form value: all pixels");
+  EXPECT_EQ(sink.grid[10][10], testColor(120), "unencoded form value: last pixel without padding");
+
+  // fewer pixels than the matrix: the rest keeps its color, more pixels: ignored
+  sink.clear();
+  decoder.reset(false);
+  EXPECT_TRUE(feedChunks(decoder, base64Picture(12), 5) && decoder.finish(), "short picture accepted");
+  EXPECT_TRUE(sink.calls == 12 && sink.grid[1][0] == testColor(11) && sink.grid[1][1] == 0xFFFFFFFF, "short picture sets its pixels only");
+  sink.clear();
+  decoder.reset(false);
+  EXPECT_TRUE(feedChunks(decoder, base64Picture(130), 64) && decoder.finish(), "long picture accepted");
+  EXPECT_EQ(sink.calls, 121, "long picture: pixels beyond the matrix ignored");
+
+  // errors
+  decoder.reset(false);
+  EXPECT_TRUE(!decoder.finish(), "empty body rejected");
+  decoder.reset(true);
+  std::string name = "data";
+  EXPECT_TRUE(feedChunks(decoder, name, 4) && !decoder.finish(), "form without value rejected");
+  decoder.reset(false);
+  std::string binary = "W\x01\x0b\x0b";
+  EXPECT_TRUE(!feedChunks(decoder, binary, 4) && decoder.hasError(), "binary data is no base64");
+  decoder.reset(true);
+  std::string badEscape = "data=AAAA%G1";
+  EXPECT_TRUE(!feedChunks(decoder, badEscape, 3), "invalid escape rejected");
+}
+
+int main() {
+  std::printf("Running LED frame tests...\n");
+
+  testFrameRgb888();
+  testChunkedFeed();
+  testNonSquareMapping();
+  testRgb565();
+  testPixelList();
+  testErrors();
+  testFrameRate();
+  testBase64();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+#include <cstdarg>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+#include "../mocks/ESP8266WiFi.h"
+
+// Include the code under test
+#include "../../../log_ring.h"
+#include "../../../udplogger.h"
+
+static int g_failures = 0;
+
+// ---- allocation counting (glibc: malloc of the test binary replaces the one of libc, also for
+// allocations inside vsnprintf and operator new) ----
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+static size_t g_allocations = 0;
+
+extern "C" void *malloc(size_t size) {
+  g_allocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+  g_allocations++;
+  return __libc_realloc(ptr, size);
+}
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// Take one batch like UDPLogger::flush() does (pieces from peek(), then consume())
+static std::string takeBatch(LogRing &ring, size_t maxBytes) {
+  size_t batch = ring.nextBatch(maxBytes);
+  std::string out;
+  size_t offset = 0;
+  while (offset < batch) {
+    const char *data;
+    size_t length = ring.peek(offset, &data);
+    if (length > batch - offset) length = batch - offset;
+    out.append(data, length);
+    offset += length;
+  }
+  ring.consume(batch);
+  return out;
+}
+
+static bool push(LogRing &ring, const char *prefix, const std::string &text) {
+  return ring.push(prefix, text.c_str(), text.size());
+}
+
+static void testPushAndBatch() {
+  LogRing ring;
+  EXPECT_TRUE(ring.isEmpty(), "new ring is empty");
+  EXPECT_EQ(ring.nextBatch(1400), 0, "no batch from an empty ring");
+
+  push(ring, "Log: ", "first");
+  push(ring, "Log: ", "second");
+  EXPECT_EQ(ring.getUsed(), 11 + 12, "prefix, text and newline are stored");
+  EXPECT_EQ(ring.getLines(), 2, "two lines queued");
+  EXPECT_TRUE(takeBatch(ring, 1400) == "Log: first\nLog: second\n", "both lines in one batch");
+  EXPECT_TRUE(ring.isEmpty(), "batch consumed");
+
+  // batches end at line boundaries
+  push(ring, "", "aaaa");
+  push(ring, "", "bbbb");
+  push(ring, "", "cccc");
+  EXPECT_TRUE(takeBatch(ring, 12) == "aaaa\nbbbb\n", "batch holds only complete lines");
+  EXPECT_TRUE(takeBatch(ring, 12) == "cccc\n", "rest in the next batch");
+
+  // a line longer than the batch is split instead of blocking the ring
+  push(ring, "", "0123456789");
+  EXPECT_EQ(ring.nextBatch(4), 4, "long line split");
+
+  // messages are truncated to one line of LOG_RING_LINE_MAX
+  LogRing longRing;
+  std::string text(1000, 'x');
+  EXPECT_TRUE(push(longRing, "Log: ", text), "long message accepted");
+  EXPECT_EQ(longRing.getUsed(), LOG_RING_LINE_MAX, "long message truncated");
+}
+
+static void testWrapAround() {
+  LogRing ring;
+  std::string sent;
+  std::string received;
+  char text[64];
+  // more than 20 times the ring size, batches of different sizes
+  for (int i = 0; i < 2000; i++) {
+    int length = std::snprintf(text, sizeof(text), "line %d %.*s", i, i % 37, "abcdefghijklmnopqrstuvwxyz0123456789ABCDEF");
+    if (ring.push("Clock: ", text, length)) sent += std::string("Clock: ") + text + "\n";
+    if (i % 7 == 0) received += takeBatch(ring, 300 + (i % 1100));
+  }
+  while (!ring.isEmpty()) received += takeBatch(ring, 1400);
+  EXPECT_EQ(ring.getDropped(), 0, "no drops while drained regularly");
+  EXPECT_TRUE(sent == received, "all lines received in order across the wrap-around");
+  EXPECT_TRUE(ring.getHighWater() <= LOG_RING_SIZE, "high water within the ring");
+}
+
+static void testOverflow() {
+  LogRing ring;
+  std::string text(90, 'y');
+  int accepted = 0;
+  for (int i = 0; i < 100; i++) {
+    if (push(ring, "Log: ", text)) accepted++;
+  }
+  // 96 bytes per line
+  EXPECT_EQ(accepted, LOG_RING_SIZE / 96, "ring accepts complete lines until full");
+  EXPECT_EQ(ring.getDropped(), 100 - accepted, "overflow counted as dropped lines");
+  EXPECT_TRUE(ring.getUsed() <= LOG_RING_SIZE, "ring not overrun");
+
+  // queued lines stay intact and space is reusable after draining
+  std::string batch = takeBatch(ring, 1400);
+  EXPECT_EQ(batch.size() % 96, 0, "dropped lines leave no partial line");
+  EXPECT_TRUE(batch.size() <= 1400, "batch fits into a datagram");
+  EXPECT_TRUE(push(ring, "Log: ", text), "space reusable after draining");
+  ring.reset();
+  EXPECT_EQ(ring.getDropped(), 0, "reset clears the statistics");
+}
+
+// Lines given to the mirror of the logger (without prefix)
+static std::string g_mirrored;
+static int g_mirroredLines = 0;
+
+static void mirror(const char *line, size_t length) {
+  g_mirrored.assign(line, length);
+  g_mirroredLines++;
+}
+
+// Former UDPLogger::logPrintf + logString: 64 byte stack buffer with malloc fallback, String
+// of the result, name prefix by concatenation
+static std::string legacyLogPrintf(const std::string &name, const char *format, ...) {
+  char loc_buf[64];
+  char *temp = loc_buf;
+  va_list arg;
+  va_list copy;
+  va_start(arg, format);
+  va_copy(copy, arg);
+  int len = vsnprintf(temp, sizeof(loc_buf), format, copy);
+  va_end(copy);
+  if (len >= (int)sizeof(loc_buf)) {
+    temp = (char*)malloc(len + 1);
+    len = vsnprintf(temp, len + 1, format, arg);
+  }
+  va_end(arg);
+  std::string logmessage(temp);
+  logmessage = name + ": " + logmessage;
+  if (temp != loc_buf) free(temp);
+  return logmessage;
+}
+
+static void testFormat() {
+  // through the logger like the firmware: logPrintf() and LOG_* format into the ring
+  UDPLogger logger;
+  logger.setName("Wordclock 2.0");
+  logger.begin(IPAddress(192, 168, 0, 10), IPAddress(230, 120, 10, 2), 8123);
+  logger.setMirror(mirror);
+  WiFi.state = WL_CONNECTED;
+  const std::string prefix = "Wordclock 2.0: ";
+
+  size_t serialBefore = Serial.written;
+  LOG_INFO(logger, "value %d, %s", 42, "ok");
+  EXPECT_TRUE(g_mirrored == "value 42, ok", "formatted message");
+  logger.logPrintf("state %s", "Clock");
+  logger.flush();
+  EXPECT_EQ(Serial.written - serialBefore, 2 * prefix.size() + 13 + 12, "prefix, message and newline sent");
+
+  int lines = g_mirroredLines;
+  LOG_DEBUG(logger, "hidden %d", 1);
+  EXPECT_EQ(g_mirroredLines, lines, "level above the active one not logged");
+
+  // truncated to one line
+  std::string text(600, 'z');
+  logger.logPrintf("%s", text.c_str());
+  EXPECT_EQ(g_mirrored.size(), LOG_RING_LINE_MAX - 1 - prefix.size(), "formatted line truncated");
+
+  // a format error (wide character without multibyte form in the C locale) is a dropped line
+  const wchar_t invalid[] = {0x100, 0};
+  lines = g_mirroredLines;
+  logger.logPrintf("%ls", invalid);
+  EXPECT_EQ(logger.getDropped(), 1, "format error counted as dropped line");
+  EXPECT_EQ(g_mirroredLines, lines, "nothing logged on a format error");
+  logger.flush();
+
+  // heartbeat of the main loop (without WiFi: the mock UDP keeps the packets in strings)
+  WiFi.state = WL_DISCONNECTED;
+  const char *heartbeat = "Heartbeat, state: %s, FreeHeap: %u, HeapFrag: %u, MaxFreeBlock: %u";
+  size_t before = g_allocations;
+  for (int i = 0; i < 500; i++) {
+    LOG_INFO(logger, heartbeat, "Clock", 31000u + i, 3u, 20000u);
+    logger.logPrintf(heartbeat, "Clock", 31000u + i, 3u, 20000u);
+    logger.loop();
+  }
+  logger.flush();
+  size_t ringAllocations = g_allocations - before;
+  EXPECT_EQ(ringAllocations, 0, "logPrintf and LOG_INFO do not allocate");
+  EXPECT_EQ(logger.getDropped(), 1, "no drops");
+
+  before = g_allocations;
+  size_t length = 0;
+  for (int i = 0; i < 1000; i++) {
+    length += legacyLogPrintf("Wordclock 2.0", heartbeat, "Clock", 31000u + i, 3u, 20000u).size();
+  }
+  size_t legacyAllocations = g_allocations - before;
+  std::printf("[BENCH] heartbeat log call: %.2f heap allocations (ring) | %.2f heap allocations (legacy), %zu bytes\n",
+              ringAllocations / 1000.0, legacyAllocations / 1000.0, length / 1000);
+  EXPECT_TRUE(legacyAllocations >= 2000, "legacy path allocated at least twice per call");
+}
+
+static void testParseLevel() {
+  uint8_t level = 99;
+  EXPECT_TRUE(UDPLogger::parseLevel("debug", &level) && level == LOG_LEVEL_DEBUG, "level by name");
+  EXPECT_TRUE(UDPLogger::parseLevel("WARN", &level) && level == LOG_LEVEL_WARN, "name ignores case");
+  EXPECT_TRUE(UDPLogger::parseLevel("none", &level) && level == LOG_LEVEL_NONE, "logging off by name");
+  EXPECT_TRUE(UDPLogger::parseLevel("0", &level) && level == LOG_LEVEL_NONE, "logging off by number");
+  EXPECT_TRUE(UDPLogger::parseLevel("5", &level) && level == LOG_LEVEL_TRACE, "highest number");
+
+  level = LOG_LEVEL_INFO;
+  const char *invalid[] = {"verbose", "dbg", "", "6", "-1", "3x", "03", "info ", "unknown"};
+  bool rejected = true;
+  for (const char *text : invalid) {
+    if (UDPLogger::parseLevel(text, &level)) {
+      std::printf("       accepted: '%s'\n", text);
+      rejected = false;
+    }
+  }
+  EXPECT_TRUE(rejected, "typos and out of range numbers rejected");
+  EXPECT_EQ(level, LOG_LEVEL_INFO, "level unchanged by a rejected value");
+}
+
+int main() {
+  std::printf("Running log ring tests...\n");
+
+  testPushAndBatch();
+  testWrapAround();
+  testOverflow();
+  testFormat();
+  testParseLevel();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <string>
 
 using byte = uint8_t;
@@ -48,12 +49,32 @@ public:
 
   // Access
   const char* c_str() const { return data_.c_str(); }
+  unsigned int length() const { return (unsigned int)data_.size(); }
 
 private:
   std::string data_;
 };
 
+// Serial output is discarded, only the number of bytes is kept
+class HardwareSerial {
+public:
+  size_t write(const char*, size_t len) { written += len; return len; }
+  size_t written = 0;
+};
+inline HardwareSerial Serial;
+
 // Support "literal" + String concatenation
 inline String operator+(const char* lhs, const String& rhs) {
   return String(std::string(lhs ? lhs : "") + rhs.c_str());
 }
+
+// Flash access helpers (flash is ordinary memory on the host)
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define PGM_P const char *
+#define memcpy_P memcpy
+#define strcmp_P strcmp
@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Minimal Client interface (subset of the Arduino/ESP8266 core Client used by code under test)
+class Client {
+public:
+  virtual ~Client() = default;
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) = 0;
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int read(uint8_t* buf, size_t size) = 0;
+  virtual uint8_t connected() = 0;
+  virtual void stop() = 0;
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdint>
+#include "WiFiUdp.h"
+
+// Connection state of the station interface, set by the test
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_DISCONNECTED = 6, WL_CONNECTED = 3 };
+
+class ESP8266WiFiClass {
+public:
+  wl_status_t status() const { return state; }
+  wl_status_t state = WL_DISCONNECTED;
+};
+inline ESP8266WiFiClass WiFi;
@@ -3,46 +3,75 @@
 #include <cstring>
 #include <queue>
 #include <string>
+#include <vector>
 
-// Minimal IPAddress placeholder to satisfy declarations
+// Minimal IPAddress (IPv4 only)
 class IPAddress {
 public:
   IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address((uint32_t)a | (uint32_t)b << 8 | (uint32_t)c << 16 | (uint32_t)d << 24) {}
+  bool operator==(const IPAddress& other) const { return address == other.address; }
+  bool operator!=(const IPAddress& other) const { return address != other.address; }
+  operator uint32_t() const { return address; }
+
+private:
+  uint32_t address = 0;
 };
 
 class UDP {
 public:
   virtual ~UDP() = default;
   virtual void begin(uint16_t) {}
+  virtual uint8_t beginMulticast(IPAddress, IPAddress, uint16_t) { return 1; }
   virtual void stop() {}
+  // Like the real WiFiUDP: parsePacket() starts the next packet (the rest of the current one is
+  // discarded), read() consumes the current packet in parts
   virtual int parsePacket() {
-    return incoming.empty() ? 0 : (int)incoming.front().size();
+    current.clear();
+    position = 0;
+    if (incoming.empty()) return 0;
+    current = incoming.front();
+    incoming.pop();
+    return (int)current.size();
   }
   virtual void flush() {
     // Simulate clearing any pending received data
     while (!incoming.empty()) incoming.pop();
+    current.clear();
+    position = 0;
   }
   virtual int read(uint8_t* buffer, size_t len) {
-    if (incoming.empty()) return 0;
-    auto& pkt = incoming.front();
-    size_t n = pkt.size() < len ? pkt.size() : len;
-    std::memcpy(buffer, pkt.data(), n);
-    incoming.pop();
+    size_t n = current.size() - position < len ? current.size() - position : len;
+    std::memcpy(buffer, current.data() + position, n);
+    position += n;
     return (int)n;
   }
   virtual void beginPacket(const char*, uint16_t) { /* ignore */ }
   virtual void beginPacket(const IPAddress&, uint16_t) { /* ignore */ }
   virtual void beginPacket(uint32_t, uint16_t) { /* ignore */ }
-  virtual size_t write(const uint8_t*, size_t) { return 0; }
-  virtual void endPacket() {
+  virtual int beginPacketMulticast(IPAddress, uint16_t, IPAddress) {
+    packet.clear();
+    return 1;
+  }
+  virtual size_t write(const uint8_t* data, size_t len) {
+    packet.append(reinterpret_cast<const char*>(data), len);
+    return len;
+  }
+  virtual int endPacket() {
+    sent.push_back(packet);
+    packet.clear();
     // When transmission finishes, deliver any prepared response to the incoming queue
     if (has_prepared) {
       incoming.emplace(prepared);
       prepared.clear();
       has_prepared = false;
     }
+    return 1;
   }
 
+  // Test helper: payloads of the packets sent so far
+  std::vector<std::string> sent;
+
   // Test helper: enqueue a packet to be "received" immediately
   void enqueuePacket(const uint8_t* data, size_t len) {
     incoming.emplace(std::string(reinterpret_cast<const char*>(data), len));
@@ -56,8 +85,11 @@ public:
 
 protected:
   std::queue<std::string> incoming;
+  std::string current;
+  size_t position = 0;
   std::string prepared;
   bool has_prepared = false;
+  std::string packet;
 };
 
 class WiFiUDP : public UDP {
@@ -0,0 +1,3 @@
+#pragma once
+// pgmspace.h of the ESP8266 core (PROGMEM, pgm_read_byte are in the Arduino.h shim)
+#include "Arduino.h"
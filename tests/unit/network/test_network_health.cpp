@@ -0,0 +1,188 @@
+#include <cstdio>
+#include <cstdint>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../network_health.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+static void testBackoff() {
+  NetworkHealth health;
+  uint32_t now = 1000;
+  EXPECT_TRUE(!health.mayAttempt(ne_weather, now), "no attempt before the link state is known");
+  EXPECT_TRUE(!health.updateLink(true, now), "link up at boot is not a reconnect");
+  EXPECT_TRUE(health.mayAttempt(ne_weather, now), "first attempt allowed");
+
+  // two failures: retry after 50 ... 100 % of 15 s, then of 30 s
+  health.reportFailure(ne_weather, now);
+  uint32_t delay = health.getRetryDelay(ne_weather, now);
+  EXPECT_TRUE(delay >= NET_BACKOFF_MIN_MS / 2 && delay <= NET_BACKOFF_MIN_MS, "first backoff with jitter");
+  EXPECT_TRUE(!health.mayAttempt(ne_weather, now + delay - 1), "no attempt during backoff");
+  EXPECT_TRUE(health.mayAttempt(ne_weather, now + delay), "attempt after backoff");
+  EXPECT_TRUE(health.mayAttempt(ne_ipapi, now), "other endpoint is not delayed");
+  now += delay;
+  health.reportFailure(ne_weather, now);
+  delay = health.getRetryDelay(ne_weather, now);
+  EXPECT_TRUE(delay >= NET_BACKOFF_MIN_MS && delay <= 2 * NET_BACKOFF_MIN_MS, "second backoff doubled");
+  EXPECT_EQ(health.getBreakerState(now), br_closed, "breaker closed after two failures");
+
+  health.reportSuccess(ne_weather, now);
+  EXPECT_EQ(health.getFailures(ne_weather), 0, "success resets the failures");
+  EXPECT_EQ(health.getRetryDelay(ne_weather, now), 0, "success ends the backoff");
+
+  // backoff is capped
+  NetworkHealth capped;
+  capped.updateLink(true, 0);
+  for (int i = 0; i < 40; i++) capped.reportSuccess(ne_ipapi, 0), capped.reportFailure(ne_weather, 0);
+  EXPECT_TRUE(capped.getRetryDelay(ne_weather, 0) <= NET_BACKOFF_MAX_MS, "backoff capped");
+
+  // jitter differs between seeds
+  NetworkHealth a, b;
+  a.setSeed(1);
+  b.setSeed(2);
+  a.updateLink(true, 0);
+  b.updateLink(true, 0);
+  a.reportFailure(ne_weather, 0);
+  b.reportFailure(ne_weather, 0);
+  EXPECT_TRUE(a.getRetryDelay(ne_weather, 0) != b.getRetryDelay(ne_weather, 0), "jitter depends on the seed");
+}
+
+static void testBreaker() {
+  NetworkHealth health;
+  uint32_t now = 0;
+  health.updateLink(true, now);
+  for (int i = 0; i < NET_BREAKER_THRESHOLD; i++) {
+    health.reportFailure(i % 2 == 0 ? ne_weather : ne_ipapi, now);
+  }
+  EXPECT_EQ(health.getBreakerState(now), br_open, "breaker opens after failures of all endpoints");
+  EXPECT_EQ(health.getBreakerOpenCount(), 1, "breaker opened once");
+  EXPECT_TRUE(health.shouldReconnect(now), "open breaker with link up requests a reconnect");
+  EXPECT_TRUE(!health.shouldReconnect(now), "reconnect requested only once");
+  EXPECT_TRUE(!health.mayAttempt(ne_ipapi, now + NET_BREAKER_OPEN_MS - 1), "no attempt while open");
+  EXPECT_TRUE(health.getRetryDelay(ne_ipapi, now) >= NET_BREAKER_OPEN_MS - 1, "retry delay includes the breaker");
+
+  now += NET_BREAKER_OPEN_MS;
+  EXPECT_EQ(health.getBreakerState(now), br_half_open, "half-open after the cool-down");
+  EXPECT_TRUE(health.mayAttempt(ne_weather, now), "probe allowed");
+  EXPECT_TRUE(!health.mayAttempt(ne_ipapi, now), "only one probe");
+  health.reportFailure(ne_weather, now);
+  EXPECT_EQ(health.getBreakerState(now + NET_BREAKER_OPEN_MS), br_open, "failed probe doubles the cool-down");
+  EXPECT_TRUE(health.shouldReconnect(now), "failed probe requests a reconnect");
+
+  now += 2 * NET_BREAKER_OPEN_MS;
+  EXPECT_TRUE(health.mayAttempt(ne_weather, now), "second probe");
+  health.reportSuccess(ne_weather, now);
+  EXPECT_EQ(health.getBreakerState(now), br_closed, "successful probe closes the breaker");
+  EXPECT_TRUE(health.mayAttempt(ne_ipapi, now), "all endpoints allowed again");
+}
+
+static void testLink() {
+  NetworkHealth health;
+  uint32_t now = 0;
+  EXPECT_TRUE(!health.shouldReconnect(now), "no reconnect before the link state is known");
+  health.updateLink(false, now);
+  EXPECT_TRUE(!health.mayAttempt(ne_weather, now), "no attempt without link");
+  EXPECT_TRUE(!health.shouldReconnect(now + NET_RECONNECT_MIN_MS - 1), "first reconnect waits");
+  int reconnects = 0;
+  uint32_t last = 0;
+  uint32_t longestGap = 0;
+  for (now = 0; now < 3600000UL; now += 100) {
+    if (health.shouldReconnect(now)) {
+      reconnects++;
+      if (reconnects > 1 && now - last > longestGap) longestGap = now - last;
+      last = now;
+    }
+  }
+  std::printf("[INFO] %d reconnects during one hour without link, longest gap %lu s\n", reconnects, (unsigned long)(longestGap / 1000));
+  EXPECT_TRUE(reconnects >= 12 && reconnects <= 40, "reconnect backoff while the link is down");
+  EXPECT_TRUE(longestGap <= NET_RECONNECT_MAX_MS, "reconnect interval capped");
+
+  EXPECT_TRUE(health.updateLink(true, now), "link restored");
+  EXPECT_TRUE(!health.updateLink(true, now), "no second edge");
+  EXPECT_TRUE(!health.shouldReconnect(now), "no reconnect with link up and closed breaker");
+
+  // failures that were caused by the lost link are forgotten when it comes back
+  for (int i = 0; i < NET_BREAKER_THRESHOLD - 1; i++) health.reportFailure(ne_weather, now);
+  health.updateLink(false, now);
+  health.updateLink(true, now + 1000);
+  EXPECT_EQ(health.getFailures(ne_weather), 0, "endpoint failures reset with the link");
+  EXPECT_TRUE(health.mayAttempt(ne_weather, now + 1000), "attempt right after the link came back");
+  health.reportFailure(ne_weather, now + 1000);
+  EXPECT_EQ(health.getBreakerState(now + 1000), br_closed, "breaker count restarted with the link");
+
+  health.recordBlocking(NET_STALL_THRESHOLD_MS - 1);
+  health.recordBlocking(5000);
+  health.recordBlocking(2000);
+  EXPECT_EQ(health.getStallMillis(), 7000, "stall time without short slices");
+  EXPECT_EQ(health.getLongestStallMillis(), 5000, "longest stall");
+}
+
+// One hour of an access point without internet (link up, every request runs into the 5 s timeout)
+static void testGhostConnection() {
+  const uint32_t timeout = 5000;
+  const uint32_t hour = 3600000UL;
+
+  // previous policy: attempt every 60 s, WiFi.reconnect() after every third failure
+  uint32_t oldBlocked = 0;
+  int oldAttempts = 0;
+  int oldReconnects = 0;
+  for (uint32_t now = 0; now < hour; now += 60000 + timeout) {
+    oldAttempts++;
+    oldBlocked += timeout;
+    if (oldAttempts % 3 == 0) oldReconnects++;
+  }
+
+  NetworkHealth health;
+  health.setSeed(12345);
+  health.updateLink(true, 0);
+  int attempts = 0;
+  for (uint32_t now = 0; now < hour; now += 100) {
+    if (health.shouldReconnect(now)) {
+      // the reconnect drops the link for 3 s
+      health.updateLink(false, now);
+      health.updateLink(true, now + 3000);
+      now += 3000;
+    }
+    if (health.mayAttempt(ne_weather, now)) {
+      attempts++;
+      health.recordBlocking(timeout);
+      now += timeout;
+      health.reportFailure(ne_weather, now);
+    }
+  }
+  std::printf("[INFO] ghost connection, 1 h: previous policy %d attempts, %d reconnects, %lu s blocked | "
+              "NetworkHealth %d attempts, %lu reconnects, %lu s blocked\n",
+              oldAttempts, oldReconnects, (unsigned long)(oldBlocked / 1000), attempts,
+              (unsigned long)health.getReconnectCount(), (unsigned long)(health.getStallMillis() / 1000));
+  EXPECT_TRUE(health.getStallMillis() * 3 < oldBlocked, "less than a third of the blocked time");
+  EXPECT_TRUE(health.getReconnectCount() < (uint32_t)oldReconnects, "fewer reconnects");
+}
+
+int main() {
+  std::printf("Running network health tests...\n");
+
+  testBackoff();
+  testBreaker();
+  testLink();
+  testGhostConnection();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../rtc_time.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// typical calibration: 6.4 us per RTC tick in Q12
+static const uint32_t CALI = (uint32_t)(6.4 * 4096);
+
+int main() {
+  std::printf("Running RTC time tests...\n");
+
+  EXPECT_EQ(RtcTime::crc32((const uint8_t*)"123456789", 9), 0xCBF43926UL, "crc32 check value");
+  EXPECT_EQ(sizeof(RtcTimeRecord) % 4, 0, "record is a multiple of RTC blocks");
+
+  const int64_t epoch = 1715353200LL * 1000000 + 250000; // 2024-05-10 15:00:00.25 UTC
+  RtcTimeRecord record;
+  RtcTime::encode(&record, epoch, 1000000, CALI);
+
+  // Restored immediately and after a restart taking 1.5 s (234375 ticks of 6.4 us)
+  int64_t restored = 0;
+  EXPECT_TRUE(RtcTime::decode(&record, 1000000, CALI, 600, &restored), "fresh record is valid");
+  EXPECT_EQ(restored, epoch, "same counter gives the saved time");
+  EXPECT_TRUE(RtcTime::decode(&record, 1000000 + 234375, CALI, 600, &restored), "record after restart is valid");
+  EXPECT_EQ(restored, epoch + ((234375ULL * CALI) >> 12), "elapsed RTC time is added");
+  EXPECT_TRUE(restored - epoch > 1499900 && restored - epoch <= 1500000, "elapsed RTC time is about 1.5 s");
+
+  // Counter wrap around between save and restore
+  RtcTime::encode(&record, epoch, 0xFFFFFF00UL, CALI);
+  EXPECT_TRUE(RtcTime::decode(&record, 0x100 - 1, CALI, 600, &restored), "counter wrap is handled");
+  EXPECT_EQ(restored, epoch + (((uint64_t)0x1FF * CALI) >> 12), "elapsed time across wrap");
+
+  // Too old
+  RtcTime::encode(&record, epoch, 1000, CALI);
+  EXPECT_TRUE(!RtcTime::decode(&record, 1000 + 601 * 156250, CALI, 600, &restored), "stale record is rejected");
+
+  // Power loss: the counter restarted below the saved value
+  RtcTime::encode(&record, epoch, 50000000, CALI);
+  EXPECT_TRUE(!RtcTime::decode(&record, 2000, CALI, 600, &restored), "counter restart is rejected");
+
+  // Corruption and foreign data
+  RtcTime::encode(&record, epoch, 1000, CALI);
+  RtcTimeRecord corrupted = record;
+  corrupted.epochSeconds ^= 0x10;
+  EXPECT_TRUE(!RtcTime::decode(&corrupted, 1000, CALI, 600, &restored), "corrupted record is rejected");
+  corrupted = record;
+  corrupted.version = RTC_TIME_VERSION + 1;
+  corrupted.crc = RtcTime::crc32((const uint8_t*)&corrupted, offsetof(RtcTimeRecord, crc));
+  EXPECT_TRUE(!RtcTime::decode(&corrupted, 1000, CALI, 600, &restored), "other version is rejected");
+  std::memset(&corrupted, 0xA5, sizeof(corrupted));
+  EXPECT_TRUE(!RtcTime::decode(&corrupted, 1000, CALI, 600, &restored), "random memory is rejected");
+  std::memset(&corrupted, 0, sizeof(corrupted));
+  EXPECT_TRUE(!RtcTime::decode(&corrupted, 1000, CALI, 600, &restored), "zeroed memory is rejected");
+
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
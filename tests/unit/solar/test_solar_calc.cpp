@@ -0,0 +1,183 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../solar_calc.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_NEAR(actual, expected, tol, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (std::llabs(a - e) > (long long)(tol)) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld (tol %lld)\n", msg, a, e, (long long)(tol)); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s (diff %lld)\n", msg, a - e); \
+    } \
+  } while (0)
+
+struct Reference {
+  int32_t latE4;
+  int32_t lonE4;
+  uint16_t year;
+  uint16_t dayOfYear;
+  SolarDayType type;
+  int32_t dawn;   // seconds after UTC midnight
+  int32_t dusk;
+  const char* name;
+};
+
+// Civil twilight reference values computed with the full NOAA solar calculator algorithm
+// (iterated to the event time), rounded to full seconds
+static const Reference references[] = {
+  {492394, 92553, 2024, 21, solar_normal, 23546, 59779, "oedheim 2024-01-21"},
+  {492394, 92553, 2024, 52, solar_normal, 20983, 62663, "oedheim 2024-02-21"},
+  {492394, 92553, 2024, 81, solar_normal, 17473, 65387, "oedheim 2024-03-21"},
+  {492394, 92553, 2024, 112, solar_normal, 13483, 68378, "oedheim 2024-04-21"},
+  {492394, 92553, 2024, 142, solar_normal, 10344, 71270, "oedheim 2024-05-21"},
+  {492394, 92553, 2024, 173, solar_normal, 9254, 72932, "oedheim 2024-06-21"},
+  {492394, 92553, 2024, 203, solar_normal, 10884, 71793, "oedheim 2024-07-21"},
+  {492394, 92553, 2024, 234, solar_normal, 13765, 68488, "oedheim 2024-08-21"},
+  {492394, 92553, 2024, 265, solar_normal, 16603, 64445, "oedheim 2024-09-21"},
+  {492394, 92553, 2024, 295, solar_normal, 19275, 60777, "oedheim 2024-10-21"},
+  {492394, 92553, 2024, 326, solar_normal, 22043, 58202, "oedheim 2024-11-21"},
+  {492394, 92553, 2024, 356, solar_normal, 23873, 57881, "oedheim 2024-12-21"},
+  {492394, 92553, 2024, 91, solar_normal, 16170, 66332, "oedheim 2024-03-31"},
+  {492394, 92553, 2024, 301, solar_normal, 19819, 60148, "oedheim 2024-10-27"},
+  {492394, 92553, 2023, 59, solar_normal, 20171, 63347, "oedheim 2023-02-28"},
+  {-338688, 1512093, 2024, 173, solar_normal, -12460, 26500, "sydney 2024-06-21"},
+  {-338688, 1512093, 2024, 356, solar_normal, -20897, 34491, "sydney 2024-12-21"},
+  {407128, -740060, 2024, 186, solar_normal, 32248, 90206, "newyork 2024-07-04"},
+  {407128, -740060, 2024, 15, solar_normal, 42478, 80580, "newyork 2024-01-15"},
+  {-1807, -784678, 2024, 267, solar_normal, 38526, 84596, "quito 2024-09-23"},
+  {641466, -219426, 2024, 153, solar_polarday, 0, 0, "reykjavik 2024-06-01"},
+  {641466, -219426, 2024, 356, solar_normal, 36196, 60539, "reykjavik 2024-12-21"},
+  {696492, 189553, 2024, 173, solar_polarday, 0, 0, "tromso 2024-06-21"},
+  {696492, 189553, 2024, 356, solar_normal, 30690, 46407, "tromso 2024-12-21"},
+  {782232, 156267, 2024, 356, solar_polarnight, 0, 0, "longyearbyen 2024-12-21"},
+  {782232, 156267, 2024, 116, solar_polarday, 0, 0, "longyearbyen 2024-04-25"},
+};
+
+// Double precision version of the same low precision sun position, to separate fixed-point errors from model errors
+static SolarDayType floatEvent(double lat, double lon, int year, int doy, double at, int direction, double* event) {
+  int y = year - 1;
+  double n = 365 * y + y / 4 - y / 100 + y / 400 - 730119 + doy - 1 + (at - 43200) / 86400;
+  double L = (280.460 + 0.9856474 * n) * M_PI / 180;
+  double g = (357.528 + 0.9856003 * n) * M_PI / 180;
+  double lambda = L + (1.915 * sin(g) + 0.020 * sin(2 * g)) * M_PI / 180;
+  double eps = 23.439 * M_PI / 180;
+  double decl = asin(sin(eps) * sin(lambda));
+  double yy = tan(eps / 2) * tan(eps / 2);
+  double e = 0.016709;
+  double eq = (yy * sin(2 * L) - 2 * e * sin(g) + 4 * e * yy * sin(g) * cos(2 * L) - 0.5 * yy * yy * sin(4 * L) - 1.25 * e * e * sin(2 * g))
+            * 720 / M_PI;
+  double la = lat * M_PI / 180;
+  double c = (cos(96 * M_PI / 180) - sin(la) * sin(decl)) / (cos(la) * cos(decl));
+  if (c > 1) return solar_polarnight;
+  if (c < -1) return solar_polarday;
+  double ha = acos(c) * 180 / M_PI;
+  *event = (720 - 4 * (lon - direction * ha) - eq) * 60;
+  return solar_normal;
+}
+
+static void floatTwilight(double lat, double lon, int year, int doy, double* dawn, double* dusk) {
+  floatEvent(lat, lon, year, doy, 43200, -1, dawn);
+  floatEvent(lat, lon, year, doy, *dawn, -1, dawn);
+  floatEvent(lat, lon, year, doy, 43200, 1, dusk);
+  floatEvent(lat, lon, year, doy, *dusk, 1, dusk);
+}
+
+int main() {
+  std::printf("Running solar calculation tests...\n");
+  char msg[128];
+
+  // Trigonometry in binary angles
+  int maxSinError = 0;
+  for (uint32_t i = 0; i < 4096; i++) {
+    uint32_t angle = i * 1048576u + i * 977u;
+    int err = std::abs(SolarCalc::sinBam(angle) - (int)std::lround(sin((double)angle * 2 * M_PI / 4294967296.0) * 1073741824.0));
+    if (err > maxSinError) maxSinError = err;
+  }
+  EXPECT_NEAR(maxSinError, 0, 25000, "sinBam interpolation error below 2.5e-5");
+  EXPECT_EQ(SolarCalc::sinBam(0x40000000u), 1073741824, "sin(90 deg) is exactly one");
+  EXPECT_EQ(SolarCalc::cosBam(0x80000000u), -1073741824, "cos(180 deg) is exactly minus one");
+  EXPECT_NEAR(SolarCalc::acosBam(0), 0x40000000u, 512, "acos(0) is 90 deg");
+  EXPECT_NEAR(SolarCalc::acosBam(-1073741824), 0x80000000u, 512, "acos(-1) is 180 deg");
+  EXPECT_NEAR(SolarCalc::acosBam(536870912), 0x2AAAAAABu, 16384, "acos(0.5) is 60 deg");
+
+  // Reference table
+  SolarCalc solar;
+  for (const Reference& r : references) {
+    solar.setLocation(r.latE4, r.lonE4);
+    int32_t dawn = 0, dusk = 0;
+    SolarDayType type = solar.calcTwilight(r.year, r.dayOfYear, &dawn, &dusk);
+    std::snprintf(msg, sizeof(msg), "%s: day type", r.name);
+    EXPECT_EQ(type, r.type, msg);
+    if (r.type != solar_normal || type != solar_normal) continue;
+
+    // the low precision sun position is good for a few seconds, near the polar circles the sun
+    // crosses -6 deg at a flat angle and small declination errors are amplified
+    int32_t tol = std::abs(r.latE4) > 600000 ? 30 : 10;
+    std::snprintf(msg, sizeof(msg), "%s: dawn", r.name);
+    EXPECT_NEAR(dawn, r.dawn, tol, msg);
+    std::snprintf(msg, sizeof(msg), "%s: dusk", r.name);
+    EXPECT_NEAR(dusk, r.dusk, tol, msg);
+
+    double fdawn = 0, fdusk = 0;
+    floatTwilight(r.latE4 / 1e4, r.lonE4 / 1e4, r.year, r.dayOfYear, &fdawn, &fdusk);
+    std::snprintf(msg, sizeof(msg), "%s: fixed point matches double precision", r.name);
+    EXPECT_NEAR(dawn + dusk, std::lround(fdawn + fdusk), 4, msg);
+  }
+
+  // Reference day of the results
+  EXPECT_EQ(SolarCalc::utcMidnight(1970, 1), 0, "utcMidnight: epoch");
+  EXPECT_EQ(SolarCalc::utcMidnight(2024, 81), 1710979200, "utcMidnight: 2024-03-21");
+  EXPECT_EQ(SolarCalc::utcMidnight(2025, 1), 1735689600, "utcMidnight: 2025-01-01 after leap year");
+
+  // Whole year sweep against the double precision model (fixed-point error only)
+  solar.setLocation(492394, 92553);
+  int32_t maxDiff = 0;
+  for (uint16_t doy = 1; doy <= 366; doy++) {
+    int32_t dawn = 0, dusk = 0;
+    double fdawn = 0, fdusk = 0;
+    solar.calcTwilight(2024, doy, &dawn, &dusk);
+    floatTwilight(49.2394, 9.2553, 2024, doy, &fdawn, &fdusk);
+    int32_t d = std::max(std::abs(dawn - (int32_t)std::lround(fdawn)), std::abs(dusk - (int32_t)std::lround(fdusk)));
+    if (d > maxDiff) maxDiff = d;
+  }
+  EXPECT_NEAR(maxDiff, 0, 3, "year sweep: fixed point error within 3 s");
+
+  // Cost per calculation
+  const int runs = 20000;
+  volatile int32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    int32_t dawn = 0, dusk = 0;
+    solar.calcTwilight(2024, 1 + i % 366, &dawn, &dusk);
+    sink = sink + dawn + dusk;
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  std::printf("[INFO] calcTwilight: %.3f us per calculation (host)\n", elapsed / 1000.0 / runs);
+
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../telemetry.h"
+#include "../../../rtc_time.h"
+#include "../../../tools/telemetry/telemetry_aggregator.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+static TelemetryFrame makeFrame(uint32_t chipId, uint32_t sequence, uint32_t uptime, uint32_t freeHeap) {
+  TelemetryFrame frame;
+  std::memset(&frame, 0, sizeof(frame));
+  frame.chipId = chipId;
+  frame.sequence = sequence;
+  frame.uptimeSeconds = uptime;
+  frame.freeHeap = freeHeap;
+  frame.loopP99 = 1000 + sequence;
+  frame.fpsX10 = 497;
+  Telemetry::encode(&frame);
+  return frame;
+}
+
+static void testFrame() {
+  TelemetryFrame frame = makeFrame(0xABCDEF, 7, 35, 31000);
+  EXPECT_EQ(sizeof(frame), TELEMETRY_MIN_SIZE, "version 1 frame is 76 bytes");
+  EXPECT_TRUE(std::memcmp(&frame, "WCTM", 4) == 0, "frame starts with the magic");
+  EXPECT_EQ(frame.size, sizeof(frame), "size field");
+
+  TelemetryFrame decoded;
+  EXPECT_TRUE(Telemetry::decode((const uint8_t*)&frame, sizeof(frame), &decoded), "frame decoded");
+  EXPECT_EQ(decoded.chipId, 0xABCDEF, "chip id");
+  EXPECT_EQ(decoded.sequence, 7, "sequence");
+  EXPECT_EQ(decoded.fpsX10, 497, "frame rate");
+
+  TelemetryFrame corrupt = frame;
+  corrupt.freeHeap ^= 1;
+  EXPECT_TRUE(!Telemetry::decode((const uint8_t*)&corrupt, sizeof(corrupt), &decoded), "CRC mismatch rejected");
+  EXPECT_TRUE(!Telemetry::decode((const uint8_t*)&frame, sizeof(frame) - 1, &decoded), "truncated frame rejected");
+  const char text[] = "Wordclock 2.0: Heartbeat, state: Clock, FreeHeap: 31000, HeapFrag: 3, MaxFreeBlock: 20000\n";
+  EXPECT_TRUE(!Telemetry::decode((const uint8_t*)text, sizeof(text), &decoded), "text log line is not a frame");
+
+  // a newer version appends fields and moves the CRC to the end
+  uint8_t v2[TELEMETRY_MIN_SIZE + 8];
+  std::memcpy(v2, &frame, offsetof(TelemetryFrame, crc));
+  v2[offsetof(TelemetryFrame, version)] = 2;
+  v2[offsetof(TelemetryFrame, size)] = sizeof(v2);
+  std::memset(v2 + offsetof(TelemetryFrame, crc), 0x5A, 4);
+  uint32_t crc = RtcTime::crc32(v2, sizeof(v2) - 4);
+  std::memcpy(v2 + sizeof(v2) - 4, &crc, 4);
+  EXPECT_TRUE(Telemetry::decode(v2, sizeof(v2), &decoded), "newer version with appended fields decoded");
+  EXPECT_EQ(decoded.freeHeap, 31000, "known fields of the newer version");
+}
+
+static void testHistogram() {
+  for (uint32_t v : {0u, 15u, 16u, 19u, 20u, 31u, 32u, 1000u, 123456u, 0xFFFFFFFFu}) {
+    uint8_t bucket = LatencyHistogram::bucketOf(v);
+    bool inside = v <= LatencyHistogram::bucketUpper(bucket) && (bucket == 0 || v > LatencyHistogram::bucketUpper(bucket - 1));
+    if (!inside) std::printf("value %u bucket %u\n", v, bucket);
+    EXPECT_TRUE(inside, "value lies in its bucket");
+  }
+
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.getPercentile(50), 0, "empty histogram");
+  // 1000 loops of 900 ... 1099 us, 10 loops of 50 ms (e.g. a blocking request)
+  for (uint32_t i = 0; i < 1000; i++) histogram.record(900 + i % 200);
+  for (uint32_t i = 0; i < 10; i++) histogram.record(50000);
+  EXPECT_EQ(histogram.getCount(), 1010, "count");
+  EXPECT_EQ(histogram.getMax(), 50000, "max");
+  uint32_t p50 = histogram.getPercentile(50);
+  EXPECT_TRUE(p50 >= 1000 && p50 <= 1250, "p50 within the bucket of the median");
+  uint32_t p99 = histogram.getPercentile(99);
+  EXPECT_TRUE(p99 >= 1099 && p99 <= 1300, "p99 below the outliers");
+  EXPECT_EQ(histogram.getPercentile(100), 50000, "p100 is the max");
+  histogram.reset();
+  EXPECT_EQ(histogram.getCount(), 0, "reset");
+}
+
+static void testAggregator() {
+  TelemetryAggregator aggregator;
+  TelemetryFrame a0 = makeFrame(1, 0, 5, 30000);
+  TelemetryFrame a1 = makeFrame(1, 1, 10, 28000);
+  TelemetryFrame a4 = makeFrame(1, 4, 25, 29000);
+  TelemetryFrame b0 = makeFrame(2, 0, 7, 31000);
+  TelemetryFrame a0reboot = makeFrame(1, 0, 5, 32000);
+
+  EXPECT_TRUE(aggregator.add((const uint8_t*)&a0, sizeof(a0), 0x0101A8C0, 100), "first frame of clock 1");
+  aggregator.add((const uint8_t*)&b0, sizeof(b0), 0x0201A8C0, 101);
+  aggregator.add((const uint8_t*)&a1, sizeof(a1), 0x0101A8C0, 105);
+  aggregator.add((const uint8_t*)&a4, sizeof(a4), 0x0101A8C0, 120);
+  aggregator.add((const uint8_t*)&a0reboot, sizeof(a0reboot), 0x0101A8C0, 130);
+  const char text[] = "Wordclock 2.0: State change to: Clock\n";
+  EXPECT_TRUE(!aggregator.add((const uint8_t*)text, sizeof(text) - 1, 0x0101A8C0, 131), "text lines ignored");
+
+  EXPECT_EQ(aggregator.getDeviceCount(), 2, "two clocks");
+  const TelemetryDevice *one = aggregator.findDevice(1);
+  EXPECT_TRUE(one != nullptr, "clock 1 found");
+  if (one != nullptr) {
+    EXPECT_EQ(one->received, 4, "frames of clock 1");
+    EXPECT_EQ(one->lost, 2, "sequence gap counted as lost frames");
+    EXPECT_EQ(one->restarts, 1, "restart detected");
+    EXPECT_EQ(one->minFreeHeap, 28000, "lowest free heap");
+    EXPECT_EQ(one->maxLoopP99, 1004, "worst p99");
+    EXPECT_EQ(one->last.freeHeap, 32000, "last frame after the restart");
+  }
+  EXPECT_EQ(aggregator.getInvalidCount(), 0, "no invalid frames");
+  aggregator.print(stdout, 140);
+}
+
+int main() {
+  std::printf("Running telemetry tests...\n");
+
+  testFrame();
+  testHistogram();
+  testAggregator();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <cstdint>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../time_sync.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+static const int64_t SEC = 1000000LL;
+
+int main() {
+  std::printf("Running time sync tests...\n");
+
+  TimeSync sync;
+  EXPECT_TRUE(!sync.isSynced(), "not synced after boot");
+  EXPECT_EQ(sync.getTimeToFirstSyncMillis(), 0, "no time to first sync yet");
+  EXPECT_EQ(sync.getSecondsSinceLastSync(5 * SEC), 0, "no sync age yet");
+
+  // First sync 2.5 s after boot steps the clock from 1970 to now, this is not a correction
+  const int64_t epoch = 1715353200LL * SEC; // 2024-05-10 15:00:00 UTC
+  sync.recordSync(epoch, 2500000);
+  EXPECT_TRUE(sync.isSynced(), "synced after first sync");
+  EXPECT_EQ(sync.getTimeToFirstSyncMillis(), 2500, "time to first sync");
+  EXPECT_EQ(sync.getLastSyncEpoch(), 1715353200LL, "last sync epoch");
+  EXPECT_EQ(sync.getLastCorrectionMicros(), 0, "first sync has no correction");
+  EXPECT_EQ(sync.getStepCount(), 0, "first sync is not counted as step");
+
+  // Local oscillator is 20 ppm slow: after one hour the clock is 72 ms late
+  uint64_t mono = 2500000 + 3600 * SEC;
+  int64_t now = epoch + 3600 * SEC + 72000;
+  sync.recordSync(now, mono);
+  EXPECT_EQ(sync.getLastCorrectionMicros(), 72000, "correction after one hour");
+  EXPECT_EQ(sync.getDriftPpb(), 20000, "drift of 20 ppm");
+  EXPECT_EQ(sync.getSecondsSinceLastSync(mono + 90 * SEC), 90, "sync age");
+
+  // Jitter of a single sync is smoothed
+  mono += 3600 * SEC;
+  now += 3600 * SEC + 72000 + 36000; // 30 ppm for this interval
+  sync.recordSync(now, mono);
+  EXPECT_EQ(sync.getLastCorrectionMicros(), 108000, "correction of noisy sync");
+  EXPECT_EQ(sync.getDriftPpb(), 22500, "drift is averaged");
+
+  // A short interval (e.g. a retry) does not update the drift
+  mono += 10 * SEC;
+  now += 10 * SEC + 5000;
+  sync.recordSync(now, mono);
+  EXPECT_EQ(sync.getDriftPpb(), 22500, "short interval ignored for drift");
+
+  // A step of several seconds is counted but does not corrupt the drift
+  mono += 3600 * SEC;
+  now += 3600 * SEC - 5 * SEC;
+  sync.recordSync(now, mono);
+  EXPECT_EQ(sync.getStepCount(), 1, "step counted");
+  EXPECT_EQ(sync.getLastCorrectionMicros(), -5 * SEC, "step correction reported");
+  EXPECT_EQ(sync.getDriftPpb(), 22500, "step does not change drift");
+  EXPECT_EQ(sync.getSyncCount(), 5, "sync count");
+
+  // Fast local clock gives negative drift
+  TimeSync fast;
+  fast.recordSync(epoch, 1000);
+  fast.recordSync(epoch + 600 * SEC - 6000, 1000 + 600 * SEC);
+  EXPECT_EQ(fast.getDriftPpb(), -10000, "fast clock: negative drift");
+
+  sync.reset();
+  EXPECT_TRUE(!sync.isSynced(), "reset forgets syncs");
+
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../timezone_table.h"
+#include "../../../timezone_cache.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_STREQ(actual, expected, msg) \
+  do { \
+    if (std::strcmp((actual), (expected)) != 0) { \
+      std::printf("[FAIL] %s: got=\"%s\" expected=\"%s\"\n", msg, (actual), (expected)); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+static void testLookup() {
+  char posix[TZ_POSIX_SIZE];
+  EXPECT_TRUE(TimezoneTable::lookup("Europe/Berlin", posix, sizeof(posix)), "Europe/Berlin found");
+  EXPECT_STREQ(posix, "CET-1CEST,M3.5.0,M10.5.0/3", "Europe/Berlin rule");
+  EXPECT_TRUE(TimezoneTable::lookup("America/Los_Angeles", posix, sizeof(posix)), "America/Los_Angeles found");
+  EXPECT_STREQ(posix, "PST8PDT,M3.2.0,M11.1.0", "America/Los_Angeles rule");
+  EXPECT_TRUE(TimezoneTable::lookup("Africa/Ceuta", posix, sizeof(posix)), "first rule index 0 is not the end marker");
+  EXPECT_TRUE(TimezoneTable::lookup("UTC", posix, sizeof(posix)), "last entry found");
+  EXPECT_STREQ(posix, "UTC0", "UTC rule");
+  EXPECT_TRUE(TimezoneTable::lookup("America/Argentina/ComodRivadavia", posix, sizeof(posix)), "longest name found");
+  EXPECT_TRUE(!TimezoneTable::lookup("Europe/Berl", posix, sizeof(posix)) && posix[0] == '\0', "prefix is not found");
+  EXPECT_TRUE(!TimezoneTable::lookup("Europe/Berlin2", posix, sizeof(posix)), "longer name is not found");
+  EXPECT_TRUE(!TimezoneTable::lookup("Mars/Olympus_Mons", posix, sizeof(posix)), "unknown zone");
+  char small[6];
+  EXPECT_TRUE(TimezoneTable::lookup("Europe/Paris", small, sizeof(small)), "small buffer");
+  EXPECT_STREQ(small, "CET-1", "rule truncated to the buffer");
+  std::printf("[INFO] %u zones in the table\n", TimezoneTable::getZoneCount());
+  EXPECT_TRUE(TimezoneTable::getZoneCount() > 200, "zone count");
+
+  TimezoneTable::fixedOffset(19800, posix, sizeof(posix));
+  EXPECT_STREQ(posix, "<+0530>-5:30", "fixed offset east");
+  TimezoneTable::fixedOffset(-10800, posix, sizeof(posix));
+  EXPECT_STREQ(posix, "<-03>3", "fixed offset west");
+  TimezoneTable::fixedOffset(0, posix, sizeof(posix));
+  EXPECT_STREQ(posix, "UTC0", "fixed offset zero");
+}
+
+static long offsetAt(time_t t) {
+  struct tm local;
+  localtime_r(&t, &local);
+  return local.tm_gmtoff;
+}
+
+// Compare the POSIX rules with the zoneinfo database of the host, hourly for 2025 and 2026
+static void testAgainstZoneinfo() {
+  const char *zones[] = {
+    "Europe/Berlin", "Europe/London", "Europe/Dublin", "Europe/Lisbon", "Europe/Athens", "Europe/Chisinau",
+    "Europe/Kaliningrad", "Europe/Moscow", "Europe/Istanbul", "Europe/Samara", "Atlantic/Reykjavik",
+    "America/New_York", "America/Chicago", "America/Denver", "America/Phoenix", "America/Los_Angeles",
+    "America/Anchorage", "Pacific/Honolulu", "America/Halifax", "America/St_Johns", "America/Regina",
+    "America/Mexico_City", "America/Puerto_Rico", "America/Panama", "America/Havana", "America/Bogota",
+    "America/Caracas", "America/Sao_Paulo", "America/Argentina/ComodRivadavia", "America/Santiago", "America/Nuuk",
+    "Asia/Tokyo", "Asia/Seoul", "Asia/Shanghai", "Asia/Hong_Kong", "Asia/Singapore", "Asia/Manila", "Asia/Bangkok",
+    "Asia/Jakarta", "Asia/Makassar", "Asia/Kolkata", "Asia/Colombo", "Asia/Kathmandu", "Asia/Dhaka", "Asia/Yangon",
+    "Asia/Karachi", "Asia/Tashkent", "Asia/Kabul", "Asia/Tehran", "Asia/Jerusalem", "Asia/Beirut", "Africa/Cairo",
+    "Africa/Johannesburg", "Africa/Maputo", "Africa/Lagos", "Africa/Nairobi", "Africa/Algiers", "Australia/Sydney",
+    "Australia/Brisbane", "Australia/Adelaide", "Australia/Darwin", "Australia/Perth", "Pacific/Auckland",
+    "Pacific/Fiji", "Pacific/Guam", "Asia/Dubai", "UTC"};
+  const time_t start = 1735689600;  // 2025-01-01 00:00 UTC
+  const int hours = 2 * 365 * 24;
+  static long expected[2 * 365 * 24];
+  int checked = 0;
+  for (const char *zone : zones) {
+    char path[96];
+    std::snprintf(path, sizeof(path), "/usr/share/zoneinfo/%s", zone);
+    FILE *file = std::fopen(path, "rb");
+    if (file == nullptr) continue;
+    std::fclose(file);
+
+    char tz[96];
+    std::snprintf(tz, sizeof(tz), ":%s", zone);
+    setenv("TZ", tz, 1);
+    tzset();
+    for (int h = 0; h < hours; h++) expected[h] = offsetAt(start + h * 3600L);
+
+    char posix[TZ_POSIX_SIZE];
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "%s: in table", zone);
+    EXPECT_TRUE(TimezoneTable::lookup(zone, posix, sizeof(posix)), msg);
+    setenv("TZ", posix, 1);
+    tzset();
+    int mismatches = 0;
+    for (int h = 0; h < hours; h++) {
+      if (offsetAt(start + h * 3600L) != expected[h]) mismatches++;
+    }
+    std::snprintf(msg, sizeof(msg), "%s: \"%s\" matches zoneinfo for 2025/2026", zone, posix);
+    EXPECT_EQ(mismatches, 0, msg);
+    checked++;
+  }
+  unsetenv("TZ");
+  tzset();
+  std::printf("[INFO] %d zones compared with the zoneinfo database of the host\n", checked);
+}
+
+static void testCache() {
+  EXPECT_TRUE(sizeof(TimezoneRecord) <= 128, "record size");
+  uint32_t home = TimezoneCache::fingerprint("Wordclock-Net", 0x0100A8C0, 0x00FFFFFF);
+  EXPECT_TRUE(home != 0, "fingerprint is not 0");
+  EXPECT_TRUE(home != TimezoneCache::fingerprint("Wordclock-Net", 0x0101A8C0, 0x00FFFFFF), "other gateway");
+  EXPECT_TRUE(home != TimezoneCache::fingerprint("Other-Net", 0x0100A8C0, 0x00FFFFFF), "other SSID");
+
+  const uint32_t fetched = 1735689600UL;
+  TimezoneRecord record;
+  TimezoneCache::encode(&record, home, fetched, "Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3", false, 492394, 92553);
+  EXPECT_TRUE(TimezoneCache::decode(&record), "record is valid");
+  EXPECT_STREQ(record.posix, "CET-1CEST,M3.5.0,M10.5.0/3", "rule stored");
+  EXPECT_EQ(record.latE4, 492394, "latitude stored");
+  EXPECT_TRUE(TimezoneCache::isUsable(&record, home, fetched + 400 * 86400UL), "table zone does not expire");
+  EXPECT_TRUE(!TimezoneCache::isUsable(&record, home + 1, fetched), "other network resolves again");
+  EXPECT_TRUE(TimezoneCache::isUsable(&record, 0, fetched), "without network the last zone is used");
+
+  TimezoneRecord broken = record;
+  broken.posix[0] = 'X';
+  EXPECT_TRUE(!TimezoneCache::decode(&broken), "corrupted record is rejected");
+  std::memset(&broken, 0xFF, sizeof(broken));
+  EXPECT_TRUE(!TimezoneCache::decode(&broken), "erased flash is rejected");
+
+  TimezoneCache::encode(&record, home, fetched, "Mars/Olympus_Mons", "<+0530>-5:30", true, 0, 0);
+  EXPECT_TRUE(TimezoneCache::isUsable(&record, home, fetched + 86400), "fixed offset usable for a day");
+  EXPECT_TRUE(!TimezoneCache::isUsable(&record, home, fetched + TZ_CACHE_FIXED_MAX_AGE + 1), "fixed offset expires");
+  EXPECT_TRUE(TimezoneCache::isUsable(&record, home, 1000), "fixed offset used while the time is not set");
+  TimezoneCache::encode(&record, home, 0, "Mars/Olympus_Mons", "<+0530>-5:30", true, 0, 0);
+  EXPECT_TRUE(!TimezoneCache::isUsable(&record, home, fetched), "fixed offset without fetch time is resolved again");
+
+  char longName[64];
+  std::memset(longName, 'a', sizeof(longName) - 1);
+  longName[sizeof(longName) - 1] = '\0';
+  TimezoneCache::encode(&record, home, fetched, longName, "UTC0", false, 0, 0);
+  EXPECT_TRUE(TimezoneCache::decode(&record) && std::strlen(record.name) == TZ_CACHE_NAME_SIZE - 1, "long name truncated");
+}
+
+int main() {
+  std::printf("Running timezone tests...\n");
+
+  testLookup();
+  testAgainstZoneinfo();
+  testCache();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,452 @@
+#include <arpa/inet.h>
+#include <malloc.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <set>
+#include <string>
+#include <thread>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+#include "../mocks/Client.h"
+
+// Include the code under test
+#include "../../../connection_stats.h"
+#include "../../../tls_session_policy.h"
+#include "../../../weather_fetch.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// ---- simulated heap (80 KB like the ESP8266, all allocations of the test binary are counted) ----
+
+static const size_t HEAP_SIZE = 80000;
+static std::atomic<size_t> g_heapCurrent(0);
+
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(size_t size) {
+  void *ptr = std::malloc(size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  g_heapCurrent += malloc_usable_size(ptr);
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  g_heapCurrent -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+static uint32_t freeHeap() {
+  return (uint32_t)(HEAP_SIZE - g_heapCurrent);
+}
+
+// millis() of the mock follows the real clock in this test
+static const auto g_start = std::chrono::steady_clock::now();
+static void syncClock() {
+  __mock_millis = (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - g_start).count();
+}
+
+// ---- TLS stand-in server on the loopback interface ----
+// MFLN probe: client sends "PROBE <max fragment length>\n", server answers "MFLN 1\n" or "MFLN 0\n".
+// Handshake: client sends "HELLO <session id|-> <max fragment length|0>\n", server answers
+// "<id> <mfl>\n": the same id for a known session (short delay) or a new one (long delay, the
+// key exchange). Then plain HTTP follows.
+
+static const int FULL_HANDSHAKE_MS = 40;
+static const int RESUMED_HANDSHAKE_MS = 4;
+
+class StandInServer {
+public:
+  std::string body;
+  std::atomic<bool> supportsMfln{true};
+  std::atomic<int> connections{0};
+  std::atomic<int> probes{0};
+
+  bool begin() {
+    _socket = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if (bind(_socket, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(_socket, 4) != 0) return false;
+    socklen_t length = sizeof(addr);
+    getsockname(_socket, (sockaddr*)&addr, &length);
+    _port = ntohs(addr.sin_port);
+    _thread = std::thread([this]() { run(); });
+    return true;
+  }
+
+  void end() {
+    _running = false;
+    shutdown(_socket, SHUT_RDWR);
+    close(_socket);
+    _thread.join();
+  }
+
+  void forgetSessions() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _sessions.clear();
+  }
+
+  uint16_t port() const { return _port; }
+
+private:
+  int _socket = -1;
+  uint16_t _port = 0;
+  std::atomic<bool> _running{true};
+  std::thread _thread;
+  std::mutex _mutex;
+  std::set<std::string> _sessions;
+  int _nextSession = 1;
+
+  static std::string readLine(int fd) {
+    std::string line;
+    char c;
+    while (recv(fd, &c, 1, 0) == 1 && c != '\n') line += c;
+    return line;
+  }
+
+  void run() {
+    while (_running) {
+      int fd = accept(_socket, nullptr, nullptr);
+      if (fd < 0) continue;
+      char session[40] = "";
+      unsigned fragment = 0;
+      std::string hello = readLine(fd);
+      if (hello.compare(0, 6, "PROBE ") == 0) {
+        probes++;
+        std::string reply = supportsMfln ? "MFLN 1\n" : "MFLN 0\n";
+        send(fd, reply.data(), reply.size(), 0);
+        close(fd);
+        continue;
+      }
+      connections++;
+      std::sscanf(hello.c_str(), "HELLO %39s %u", session, &fragment);
+      unsigned accepted = (supportsMfln && fragment > 0) ? fragment : 16384;
+
+      std::string reply;
+      bool resumed;
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        resumed = _sessions.count(session) > 0;
+        if (resumed) {
+          reply = session;
+        } else {
+          reply = "s" + std::to_string(_nextSession++);
+          _sessions.insert(reply);
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(resumed ? RESUMED_HANDSHAKE_MS : FULL_HANDSHAKE_MS));
+      reply += " " + std::to_string(accepted) + "\n";
+      send(fd, reply.data(), reply.size(), 0);
+
+      // HTTP request until the empty line
+      std::string request;
+      while (request.find("\r\n\r\n") == std::string::npos) {
+        char c;
+        if (recv(fd, &c, 1, 0) != 1) break;
+        request += c;
+      }
+      std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: "
+                             + std::to_string(body.size()) + "\r\n\r\n" + body;
+      // deliver in records of the negotiated fragment length
+      for (size_t offset = 0; offset < response.size(); offset += accepted) {
+        send(fd, response.data() + offset, std::min<size_t>(accepted, response.size() - offset), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      close(fd);
+    }
+  }
+};
+
+// ---- client side: the BearSSL part of TlsSessionClient over the stand-in protocol ----
+// connect() calls TlsSessionPolicy in the same order as tls_client.cpp, only the transport
+// (probe, handshake, session id bytes, buffers) is replaced.
+
+class LoopbackTlsClient : public Client {
+public:
+  TlsSessionPolicy policy;
+  uint8_t sessionId[TLS_SESSION_ID_SIZE];
+  uint8_t sessionIdLength = 0;
+  unsigned negotiatedFragment = 0;
+
+  ~LoopbackTlsClient() override { stop(); }
+
+  int connect(const char*, uint16_t port) override {
+    syncClock();
+    if (policy.needsMflnProbe()) {
+      policy.setMflnSupported(probeMaxFragmentLength(port, TLS_CLIENT_RX_BUFFER));
+    }
+    unsigned fragment = policy.useSmallBuffers() ? TLS_CLIENT_RX_BUFFER : 0;
+
+    policy.beginConnect(sessionId, sessionIdLength, freeHeap());
+    bool ok = handshake(port, fragment);
+    syncClock();
+    if (!policy.endConnect(ok, sessionId, sessionIdLength, freeHeap())) {
+      sessionIdLength = 0;  // invalidateSession()
+      stop();
+    }
+    return ok ? 1 : 0;
+  }
+  size_t write(const uint8_t* buf, size_t size) override {
+    return _fd >= 0 && send(_fd, buf, size, 0) == (ssize_t)size ? size : 0;
+  }
+  int available() override {
+    int bytes = 0;
+    if (_fd < 0 || ioctl(_fd, FIONREAD, &bytes) != 0) return 0;
+    return bytes;
+  }
+  int read() override {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(uint8_t* buf, size_t size) override {
+    if (_fd < 0) return -1;
+    // the record buffer limits the amount of plaintext available per read
+    ssize_t length = recv(_fd, buf, std::min<size_t>(size, negotiatedFragment), MSG_DONTWAIT);
+    return length > 0 ? (int)length : -1;
+  }
+  uint8_t connected() override {
+    if (_fd < 0) return 0;
+    char c;
+    ssize_t result = recv(_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return result == 0 ? 0 : 1;
+  }
+  void stop() override {
+    if (_fd >= 0) close(_fd);
+    _fd = -1;
+    delete[] _rxBuffer;
+    delete[] _txBuffer;
+    _rxBuffer = nullptr;
+    _txBuffer = nullptr;
+  }
+
+private:
+  int _fd = -1;
+  char *_rxBuffer = nullptr;
+  char *_txBuffer = nullptr;
+
+  static int open(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (::connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+      close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  static std::string readLine(int fd) {
+    std::string line;
+    char c;
+    while (recv(fd, &c, 1, 0) == 1 && c != '\n') line += c;
+    return line;
+  }
+
+  static bool probeMaxFragmentLength(uint16_t port, unsigned fragment) {
+    int fd = open(port);
+    if (fd < 0) return false;
+    std::string probe = "PROBE " + std::to_string(fragment) + "\n";
+    send(fd, probe.data(), probe.size(), 0);
+    bool supported = readLine(fd) == "MFLN 1";
+    close(fd);
+    return supported;
+  }
+
+  bool handshake(uint16_t port, unsigned fragment) {
+    stop();
+    _fd = open(port);
+    if (_fd < 0) return false;
+    std::string session = sessionIdLength > 0 ? std::string((const char*)sessionId, sessionIdLength) : "-";
+    std::string hello = "HELLO " + session + " " + std::to_string(fragment) + "\n";
+    send(_fd, hello.data(), hello.size(), 0);
+    char id[40] = "";
+    unsigned accepted = 0;
+    if (std::sscanf(readLine(_fd).c_str(), "%39s %u", id, &accepted) != 2) return false;
+    // BearSSL stores the session id of the handshake in the session parameters
+    sessionIdLength = (uint8_t)std::min<size_t>(std::strlen(id), sizeof(sessionId));
+    std::memcpy(sessionId, id, sessionIdLength);
+    negotiatedFragment = accepted;
+    // BearSSL keeps a receive and a transmit buffer of the fragment length for the whole connection
+    _rxBuffer = new char[accepted + 325];
+    _txBuffer = new char[(accepted == 16384 ? accepted : TLS_CLIENT_TX_BUFFER) + 85];
+    return true;
+  }
+};
+
+static bool runFetch(WeatherFetch &fetch, LoopbackTlsClient &client, uint16_t port) {
+  fetch.start("localhost", port, "/v1/forecast?latitude=49.2394");
+  for (int i = 0; i < 5000 && fetch.isBusy(); i++) {
+    syncClock();
+    fetch.poll(client, 10);
+    client.policy.getStats().sampleFreeHeap(freeHeap());
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  return fetch.getPhase() == wf_done;
+}
+
+static std::string readFile(const char *path) {
+  std::string content;
+  FILE *file = std::fopen(path, "rb");
+  if (file == nullptr) return content;
+  char buffer[512];
+  size_t length;
+  while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, length);
+  std::fclose(file);
+  return content;
+}
+
+static void testStats() {
+  ConnectionStats stats;
+  EXPECT_EQ(stats.getMinFreeHeap(), 0, "stats: no heap sample yet");
+  stats.recordConnect(true, false, 1200, 40000, 20000);
+  stats.recordConnect(true, true, 150, 41000, 39000);
+  stats.recordConnect(false, false, 5000, 41000, 40500);
+  stats.sampleFreeHeap(18000);
+  EXPECT_EQ(stats.getConnectCount(), 2, "stats: connects");
+  EXPECT_EQ(stats.getResumedCount(), 1, "stats: resumed");
+  EXPECT_EQ(stats.getFailedCount(), 1, "stats: failed");
+  EXPECT_TRUE(stats.isLastResumed(), "stats: last connect resumed");
+  EXPECT_EQ(stats.getLastFullHandshakeMillis(), 1200, "stats: full handshake time");
+  EXPECT_EQ(stats.getLastResumedHandshakeMillis(), 150, "stats: resumed handshake time");
+  EXPECT_EQ(stats.getMaxHandshakeMillis(), 1200, "stats: failed connects do not count as handshake");
+  EXPECT_EQ(stats.getLastConnectionHeap(), 2000, "stats: heap of last connection");
+  EXPECT_EQ(stats.getMaxConnectionHeap(), 20000, "stats: largest connection heap");
+  EXPECT_EQ(stats.getMinFreeHeap(), 18000, "stats: heap high-water mark");
+}
+
+static void testPolicy() {
+  TlsSessionPolicy policy;
+  EXPECT_TRUE(policy.needsMflnProbe(), "policy: probe before the first connect");
+  EXPECT_EQ(policy.getMflnStatus(), -1, "policy: MFLN unknown");
+  EXPECT_TRUE(!policy.useSmallBuffers(), "policy: large buffers until probed");
+  policy.setMflnSupported(true);
+  EXPECT_TRUE(!policy.needsMflnProbe(), "policy: probed only once");
+  EXPECT_TRUE(policy.useSmallBuffers(), "policy: small buffers with MFLN");
+
+  const uint8_t first[] = {1, 2, 3, 4};
+  const uint8_t second[] = {5, 6, 7, 8};
+  const uint8_t longer[] = {1, 2, 3, 4, 5};
+  __mock_millis = 1000;
+  policy.beginConnect(first, 0, 40000);
+  __mock_millis = 1900;
+  EXPECT_TRUE(policy.endConnect(true, first, sizeof(first), 20000), "policy: session kept after connect");
+  EXPECT_TRUE(!policy.getStats().isLastResumed(), "policy: no stored session, full handshake");
+  EXPECT_EQ(policy.getStats().getLastFullHandshakeMillis(), 900, "policy: duration of the connect");
+  EXPECT_EQ(policy.getStats().getLastConnectionHeap(), 20000, "policy: heap of the connection");
+
+  policy.beginConnect(first, sizeof(first), 40000);
+  __mock_millis = 2000;
+  EXPECT_TRUE(policy.endConnect(true, first, sizeof(first), 38000), "policy: resumed session kept");
+  EXPECT_TRUE(policy.getStats().isLastResumed(), "policy: same session id, resumed");
+  EXPECT_EQ(policy.getStats().getLastResumedHandshakeMillis(), 100, "policy: duration of the resumed connect");
+
+  policy.beginConnect(first, sizeof(first), 40000);
+  policy.endConnect(true, second, sizeof(second), 20000);
+  EXPECT_TRUE(!policy.getStats().isLastResumed(), "policy: new session id, full handshake");
+  policy.beginConnect(first, sizeof(first), 40000);
+  policy.endConnect(true, longer, sizeof(longer), 20000);
+  EXPECT_TRUE(!policy.getStats().isLastResumed(), "policy: longer session id, full handshake");
+
+  policy.beginConnect(second, sizeof(second), 40000);
+  __mock_millis = 7000;
+  EXPECT_TRUE(!policy.endConnect(false, second, sizeof(second), 39000), "policy: session dropped after failed connect");
+  EXPECT_EQ(policy.getLastConnectMillis(), 5000, "policy: duration of the failed connect");
+  EXPECT_EQ(policy.getStats().getFailedCount(), 1, "policy: failed connect recorded");
+  EXPECT_EQ(policy.getStats().getResumedCount(), 1, "policy: one resumed connect");
+}
+
+static void testStandIn() {
+  StandInServer server;
+  server.body = readFile("../weather/openmeteo_summer.json");
+  if (!server.begin()) {
+    EXPECT_TRUE(false, "loopback server started");
+    return;
+  }
+
+  WeatherFetch fetch;
+  LoopbackTlsClient client;
+
+  EXPECT_TRUE(runFetch(fetch, client, server.port()), "first fetch over loopback");
+  EXPECT_TRUE(fetch.getParser().isComplete(), "first fetch: values parsed");
+  EXPECT_TRUE(!client.policy.getStats().isLastResumed(), "first fetch: full handshake");
+  EXPECT_TRUE(client.policy.getStats().getLastConnectionHeap() < 3000, "first fetch: small buffers with MFLN");
+
+  EXPECT_TRUE(runFetch(fetch, client, server.port()), "second fetch over loopback");
+  EXPECT_TRUE(fetch.getParser().isComplete(), "second fetch: values parsed");
+  EXPECT_TRUE(client.policy.getStats().isLastResumed(), "second fetch: session resumed");
+  EXPECT_TRUE(client.policy.getStats().getLastResumedHandshakeMillis() < client.policy.getStats().getLastFullHandshakeMillis(), "resumed handshake is faster");
+
+  server.forgetSessions();
+  EXPECT_TRUE(runFetch(fetch, client, server.port()), "fetch after server lost the session");
+  EXPECT_TRUE(!client.policy.getStats().isLastResumed(), "unknown session falls back to full handshake");
+  EXPECT_EQ(client.policy.getStats().getResumedCount(), 1, "one resumed connect");
+
+  server.supportsMfln = false;
+  LoopbackTlsClient large;
+  EXPECT_TRUE(runFetch(fetch, large, server.port()), "fetch without MFLN");
+  EXPECT_TRUE(large.policy.getStats().getLastConnectionHeap() > 30000, "without MFLN the buffers take >30 KB");
+  EXPECT_TRUE(large.policy.getStats().getMinFreeHeap() < client.policy.getStats().getMinFreeHeap(), "heap high-water mark is lower without MFLN");
+  std::printf("[INFO] full %u ms, resumed %u ms, connection heap %u B (MFLN) / %u B (16 KB records)\n",
+              client.policy.getStats().getLastFullHandshakeMillis(), client.policy.getStats().getLastResumedHandshakeMillis(),
+              client.policy.getStats().getMaxConnectionHeap(), large.policy.getStats().getMaxConnectionHeap());
+
+  uint16_t port = server.port();
+  EXPECT_EQ(server.connections.load(), 4, "one connection per fetch");
+  EXPECT_EQ(server.probes.load(), 2, "MFLN probed once per client");
+  EXPECT_EQ(client.policy.getMflnStatus(), 1, "MFLN supported");
+  EXPECT_EQ(large.policy.getMflnStatus(), 0, "MFLN not supported");
+  server.end();
+
+  EXPECT_TRUE(!runFetch(fetch, client, port), "fetch fails without server");
+  EXPECT_EQ(fetch.getFailedPhase(), wf_connect, "failed in connect phase");
+  EXPECT_EQ(client.policy.getStats().getFailedCount(), 1, "failed connect recorded");
+  EXPECT_EQ(client.sessionIdLength, 0, "session dropped after failed connect");
+}
+
+int main() {
+  std::printf("Running transport tests...\n");
+
+  testStats();
+  testPolicy();
+  testStandIn();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../json_stream.h"
+#include "../../../weather_parser.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_NEAR(actual, expected, tol, msg) \
+  do { \
+    double a = (double)(actual); \
+    double e = (double)(expected); \
+    if (std::fabs(a - e) > (tol)) { \
+      std::printf("[FAIL] %s: got=%.3f expected=%.3f\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+// ---- heap accounting (all allocations of the test binary) ----
+
+static size_t g_heapCurrent = 0;
+static size_t g_heapPeak = 0;
+
+void* operator new(size_t size) {
+  size_t *block = (size_t*)std::malloc(size + sizeof(size_t));
+  if (block == nullptr) throw std::bad_alloc();
+  block[0] = size;
+  g_heapCurrent += size;
+  if (g_heapCurrent > g_heapPeak) g_heapPeak = g_heapCurrent;
+  return block + 1;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr) return;
+  size_t *block = (size_t*)ptr - 1;
+  g_heapCurrent -= block[0];
+  std::free(block);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+static void resetHeapPeak() {
+  g_heapPeak = g_heapCurrent;
+}
+
+// ---- legacy parser (String payload passed by value, indexOf/substring), std::string as String ----
+
+static float legacyExtractValueAtIndex(std::string payload, std::string key, int targetIndex) {
+  size_t startSearch = 0;
+  size_t arrayStart;
+  while (true) {
+    size_t keyPos = payload.find(key, startSearch);
+    if (keyPos == std::string::npos) return -999;
+    size_t cursor = keyPos + key.length();
+    while (cursor < payload.length() && (payload[cursor] == ' ' || payload[cursor] == '\t' || payload[cursor] == '\r' || payload[cursor] == '\n' || payload[cursor] == ':')) {
+      cursor++;
+    }
+    if (cursor < payload.length() && payload[cursor] == '[') {
+      arrayStart = cursor;
+      break;
+    }
+    startSearch = keyPos + 1;
+  }
+  size_t searchPos = arrayStart + 1;
+  for (int currentIndex = 0; currentIndex < targetIndex; currentIndex++) {
+    size_t commaPos = payload.find(',', searchPos);
+    if (commaPos == std::string::npos) return -999;
+    searchPos = commaPos + 1;
+  }
+  size_t nextComma = payload.find(',', searchPos);
+  size_t arrayEnd = payload.find(']', searchPos);
+  size_t endPos = nextComma < arrayEnd ? nextComma : arrayEnd;
+  if (endPos == std::string::npos) return -999;
+  std::string value = payload.substr(searchPos, endPos - searchPos);
+  return std::atof(value.c_str());
+}
+
+static float legacyExtractDailyValueAtIndex(std::string payload, std::string key, int targetIndex) {
+  size_t dailyStart = payload.find("\"daily\":{");
+  if (dailyStart == std::string::npos) dailyStart = payload.find("\"daily\": {");
+  if (dailyStart == std::string::npos) return -999;
+  size_t keyPos = payload.find(key, dailyStart);
+  if (keyPos == std::string::npos) return -999;
+  size_t cursor = keyPos + key.length();
+  while (cursor < payload.length() && (payload[cursor] == ' ' || payload[cursor] == ':')) cursor++;
+  if (cursor >= payload.length() || payload[cursor] != '[') return -999;
+  size_t searchPos = cursor + 1;
+  for (int currentIndex = 0; currentIndex < targetIndex; currentIndex++) {
+    size_t commaPos = payload.find(',', searchPos);
+    if (commaPos == std::string::npos) return -999;
+    searchPos = commaPos + 1;
+  }
+  size_t nextComma = payload.find(',', searchPos);
+  size_t arrayEnd = payload.find(']', searchPos);
+  size_t endPos = nextComma < arrayEnd ? nextComma : arrayEnd;
+  if (endPos == std::string::npos) return -999;
+  std::string value = payload.substr(searchPos, endPos - searchPos);
+  return std::atof(value.c_str());
+}
+
+struct WeatherValues {
+  float temperature[2];
+  int weatherCode[2];
+  float sunshine[2];
+};
+
+static void parseLegacy(const std::string &body, size_t chunkSize, WeatherValues *values) {
+  // readString(): the whole body is collected in one string
+  std::string payload;
+  for (size_t offset = 0; offset < body.length(); offset += chunkSize) {
+    payload.append(body, offset, chunkSize);
+  }
+  values->temperature[0] = legacyExtractValueAtIndex(payload, "\"temperature_2m\"", 12);
+  values->temperature[1] = legacyExtractValueAtIndex(payload, "\"temperature_2m\"", 36);
+  values->weatherCode[0] = (int)legacyExtractValueAtIndex(payload, "\"weathercode\"", 12);
+  values->weatherCode[1] = (int)legacyExtractValueAtIndex(payload, "\"weathercode\"", 36);
+  values->sunshine[0] = legacyExtractDailyValueAtIndex(payload, "\"sunshine_duration\"", 0);
+  values->sunshine[1] = legacyExtractDailyValueAtIndex(payload, "\"sunshine_duration\"", 1);
+}
+
+static bool parseStreaming(WeatherParser &parser, const std::string &body, size_t chunkSize, WeatherValues *values) {
+  parser.reset();
+  char buffer[256];
+  for (size_t offset = 0; offset < body.length(); offset += chunkSize) {
+    size_t length = body.length() - offset < chunkSize ? body.length() - offset : chunkSize;
+    std::memcpy(buffer, body.data() + offset, length);
+    if (!parser.feed(buffer, length)) break;
+  }
+  bool valid = parser.finish();
+  for (int day = 0; day < 2; day++) {
+    values->temperature[day] = parser.getTemperature(day == 1);
+    values->weatherCode[day] = parser.getWeatherCode(day == 1);
+    values->sunshine[day] = parser.getSunshineDuration(day == 1);
+  }
+  return valid;
+}
+
+static std::string readFile(const char *path) {
+  std::string content;
+  FILE *file = std::fopen(path, "rb");
+  if (file == nullptr) return content;
+  char buffer[512];
+  size_t length;
+  while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, length);
+  std::fclose(file);
+  return content;
+}
+
+// ---- tokenizer path tracking ----
+
+struct PathRecorder : public JsonHandler {
+  int count = 0;
+  char last[96];
+  void onValue(const JsonStream &json, JsonValueType type, const char *value) override {
+    count++;
+    int pos = std::snprintf(last, sizeof(last), "%d:", (int)type);
+    for (uint8_t level = 0; level < json.getDepth(); level++) {
+      if (json.isArray(level)) pos += std::snprintf(last + pos, sizeof(last) - pos, "[%u]", json.getIndex(level));
+      else pos += std::snprintf(last + pos, sizeof(last) - pos, ".%s", json.getKey(level));
+    }
+    std::snprintf(last + pos, sizeof(last) - pos, "=%s", value);
+  }
+};
+
+static void testTokenizer() {
+  PathRecorder recorder;
+  JsonStream json(&recorder);
+
+  const char *doc = "{\"a\": [1, {\"b\": \"x\\\"y\\u00e4\"}, [true, null]], \"c\": -2.5e3}";
+  json.feed(doc, std::strlen(doc));
+  EXPECT_TRUE(json.isDone() && !json.hasError(), "tokenizer: nested document is complete");
+  EXPECT_EQ(recorder.count, 5, "tokenizer: all scalars reported");
+  EXPECT_TRUE(std::strcmp(recorder.last, "0:.c=-2.5e3") == 0, "tokenizer: path and value of last scalar");
+
+  json.reset();
+  recorder.count = 0;
+  const char *nested = "{\"a\":[1,{\"b\":\"x\\\"y\\u00e4\"}]}";
+  json.feed(nested, 17);
+  json.feed(nested + 17, std::strlen(nested) - 17);
+  EXPECT_TRUE(std::strcmp(recorder.last, "1:.a[1].b=x\"y?") == 0, "tokenizer: escapes resolved across chunks");
+
+  json.reset();
+  json.feed("42", 2);
+  EXPECT_TRUE(!json.isDone(), "tokenizer: number at end needs finish()");
+  EXPECT_TRUE(json.finish(), "tokenizer: finish() completes root number");
+
+  const char *bad[] = {"{\"a\":1]", "[1 2]", "{\"a\" 1}", "{\"a\":tru}", "[[[[[[[1]]]]]]]", "{} {}"};
+  for (const char *text : bad) {
+    json.reset();
+    json.feed(text, std::strlen(text));
+    json.finish();
+    char msg[64];
+    std::snprintf(msg, sizeof(msg), "tokenizer: rejects %s", text);
+    EXPECT_TRUE(json.hasError(), msg);
+  }
+}
+
+// ---- packed hourly forecast ----
+
+static void testForecastPacking() {
+  HourlyForecast forecast;
+  EXPECT_TRUE(!forecast.hasStart() && forecast.getTemperature(0) == WEATHER_MISSING, "forecast: empty");
+  EXPECT_TRUE(forecast.setStart("2024-12-31T00:00"), "forecast: start parsed");
+  EXPECT_TRUE(!HourlyForecast().setStart("2024-12-31 00:00") && !HourlyForecast().setStart("x"), "forecast: invalid start rejected");
+  EXPECT_EQ(HourlyForecast::daysFromCivil(1970, 1, 1), 0, "days from civil epoch");
+  EXPECT_EQ(HourlyForecast::daysFromCivil(2024, 3, 1) - HourlyForecast::daysFromCivil(2024, 2, 28), 2, "days from civil leap year");
+
+  // small range: exact to 0.1 degree
+  for (int i = 0; i < FORECAST_HOURS; i++) forecast.setTemperature(i, 5.0f + 0.1f * (i % 30) - 1.2f);
+  EXPECT_EQ(forecast.getStep(), 1, "forecast: step 0.1 degree");
+  bool exact = true;
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    if (forecast.getTemperatureTenths(i) != (int)std::lround((5.0 + 0.1 * (i % 30) - 1.2) * 10)) exact = false;
+  }
+  EXPECT_TRUE(exact, "forecast: all hours exact");
+
+  // large range: step is coarsened, error at most half a step
+  HourlyForecast wide;
+  float values[FORECAST_HOURS];
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    values[i] = 2.0f + 14.0f * std::sin(i * 0.26f) + (i > 30 ? 9.5f : 0.0f);
+    wide.setTemperature(i, values[i]);
+  }
+  EXPECT_TRUE(wide.getStep() > 1, "forecast: step coarsened for wide range");
+  double maxError = 0;
+  for (int i = 0; i < FORECAST_HOURS; i++) maxError = std::max(maxError, (double)std::fabs(wide.getTemperature(i) - values[i]));
+  std::printf("[INFO] range %.1f degree: step %.1f degree, max error %.2f degree\n", 2 * 14.0 + 9.5, wide.getStep() / 10.0, maxError);
+  EXPECT_TRUE(maxError <= wide.getStep() * 0.1 + 0.051, "forecast: error within one step");
+
+  // lookup by local time across the new year
+  struct tm local = {};
+  local.tm_year = 125; local.tm_mon = 0; local.tm_mday = 1; local.tm_hour = 5;
+  EXPECT_EQ(forecast.getIndex(&local), 29, "forecast: index on the next day (across new year)");
+  local.tm_year = 124; local.tm_mon = 11; local.tm_mday = 30; local.tm_hour = 23;
+  EXPECT_EQ(forecast.getIndex(&local), -1, "forecast: before the start");
+  local.tm_year = 125; local.tm_mon = 0; local.tm_mday = 2; local.tm_hour = 0;
+  EXPECT_EQ(forecast.getIndex(&local), -1, "forecast: after the end");
+  forecast.setWeatherCode(3, 300);
+  EXPECT_EQ(forecast.getWeatherCode(3), WEATHER_MISSING, "forecast: invalid code is missing");
+  EXPECT_TRUE(sizeof(HourlyForecast) <= 112, "forecast: packed size");
+}
+
+// ---- weather parser ----
+
+static void testPayload(const char *path, const WeatherValues &expected) {
+  std::string body = readFile(path);
+  EXPECT_TRUE(body.length() > 0, path);
+
+  WeatherParser parser;
+  const size_t chunkSizes[] = {1, 7, 64, 256};
+  for (size_t chunkSize : chunkSizes) {
+    WeatherValues values;
+    char msg[96];
+    std::snprintf(msg, sizeof(msg), "%s chunk %zu: valid and complete", path, chunkSize);
+    bool valid = parseStreaming(parser, body, chunkSize, &values);
+    EXPECT_TRUE(valid && parser.isComplete(), msg);
+    for (int day = 0; day < 2; day++) {
+      std::snprintf(msg, sizeof(msg), "%s chunk %zu day %d: temperature", path, chunkSize, day);
+      EXPECT_NEAR(values.temperature[day], expected.temperature[day], 0.001, msg);
+      std::snprintf(msg, sizeof(msg), "%s chunk %zu day %d: weathercode", path, chunkSize, day);
+      EXPECT_EQ(values.weatherCode[day], expected.weatherCode[day], msg);
+      std::snprintf(msg, sizeof(msg), "%s chunk %zu day %d: sunshine", path, chunkSize, day);
+      EXPECT_NEAR(values.sunshine[day], expected.sunshine[day], 0.01, msg);
+    }
+  }
+
+  // All hourly values, compared against a simple scan of the arrays
+  const HourlyForecast &forecast = parser.getForecast();
+  size_t tempPos = body.find('[', body.find("\"temperature_2m\"", body.find("\"hourly\"")));
+  size_t codePos = body.find('[', body.find("\"weathercode\"", body.find("\"hourly\"")));
+  bool allMatch = forecast.hasStart();
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    double temp = std::strtod(body.c_str() + tempPos + 1, nullptr);
+    long code = std::strtol(body.c_str() + codePos + 1, nullptr, 10);
+    if (forecast.getTemperatureTenths(i) != (int)std::lround(temp * 10) || forecast.getWeatherCode(i) != code) allMatch = false;
+    tempPos = body.find(',', tempPos + 1);
+    codePos = body.find(',', codePos + 1);
+  }
+  EXPECT_TRUE(allMatch, "all 48 hourly values stored");
+  struct tm noon = {};
+  std::sscanf(body.c_str() + body.find_first_of("0123456789", body.find("\"time\"", body.find("\"hourly\""))), "%d-%d-%d", &noon.tm_year, &noon.tm_mon, &noon.tm_mday);
+  noon.tm_year -= 1900;
+  noon.tm_mon -= 1;
+  noon.tm_hour = 12;
+  EXPECT_EQ(forecast.getIndex(&noon), WEATHER_INDEX_TODAY_NOON, "noon today by local time");
+
+  // Same values as the previous indexOf/substring parser
+  WeatherValues legacy;
+  parseLegacy(body, 256, &legacy);
+  for (int day = 0; day < 2; day++) {
+    EXPECT_NEAR(legacy.temperature[day], expected.temperature[day], 0.001, "legacy parser: temperature");
+    EXPECT_EQ(legacy.weatherCode[day], expected.weatherCode[day], "legacy parser: weathercode");
+    EXPECT_NEAR(legacy.sunshine[day], expected.sunshine[day], 0.01, "legacy parser: sunshine");
+  }
+}
+
+static void testIncomplete() {
+  WeatherParser parser;
+  WeatherValues values;
+
+  std::string body = readFile("openmeteo_summer.json");
+  std::string truncated = body.substr(0, body.find("\"daily\""));
+  EXPECT_TRUE(!parseStreaming(parser, truncated, 256, &values), "truncated body is not valid");
+  EXPECT_TRUE(!parser.isComplete(), "truncated body is not complete");
+  EXPECT_NEAR(values.temperature[1], 21.7, 0.001, "hourly values before truncation are kept");
+  EXPECT_EQ(values.sunshine[0], WEATHER_MISSING, "missing daily values are marked");
+
+  // the units sections must not be taken as data
+  const char *unitsOnly = "{\"hourly_units\":{\"temperature_2m\":\"°C\"},\"daily_units\":{\"sunshine_duration\":\"s\"},"
+                          "\"hourly\":{\"temperature_2m\":[1,2,3]}}";
+  EXPECT_TRUE(parseStreaming(parser, unitsOnly, 5, &values), "short document is valid");
+  EXPECT_EQ(values.temperature[0], WEATHER_MISSING, "short hourly array gives no noon value");
+  EXPECT_EQ(values.sunshine[0], WEATHER_MISSING, "units section is ignored");
+
+  const char *error = "{\"error\":true,\"reason\":\"Cannot initialize WeatherVariable from invalid String value\"}";
+  EXPECT_TRUE(parseStreaming(parser, error, 256, &values), "API error document is valid JSON");
+  EXPECT_TRUE(!parser.isComplete(), "API error document has no values");
+
+  EXPECT_TRUE(!parseStreaming(parser, "<html>502 Bad Gateway</html>", 256, &values), "HTML error page is rejected");
+}
+
+static void benchmark(const char *path) {
+  std::string body = readFile(path);
+  const int iterations = 2000;
+  WeatherValues values;
+  WeatherParser parser;
+
+  resetHeapPeak();
+  size_t base = g_heapCurrent;
+  parseLegacy(body, 256, &values);
+  size_t legacyPeak = g_heapPeak - base;
+
+  resetHeapPeak();
+  parseStreaming(parser, body, 256, &values);
+  size_t streamingPeak = g_heapPeak - base;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) parseLegacy(body, 256, &values);
+  auto legacyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) parseStreaming(parser, body, 256, &values);
+  auto streamingNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+  std::printf("[BENCH] %s (%zu bytes): legacy peak heap %zu B, %lld ns | streaming peak heap %zu B (+%zu B parser state), %lld ns\n",
+              path, body.length(), legacyPeak, (long long)legacyNs, streamingPeak, sizeof(WeatherParser), (long long)streamingNs);
+  EXPECT_EQ(streamingPeak, 0, "streaming parser does not allocate");
+  EXPECT_TRUE(legacyPeak >= 2 * body.length(), "legacy parser holds the payload at least twice");
+}
+
+int main() {
+  std::printf("Running weather parser tests...\n");
+
+  testTokenizer();
+  testForecastPacking();
+
+  WeatherValues summer = {{19.2f, 21.7f}, {2, 2}, {43193.52f, 38004.11f}};
+  testPayload("openmeteo_summer.json", summer);
+  WeatherValues winter = {{-0.4f, -3.4f}, {73, 3}, {0.0f, 7200.0f}};
+  testPayload("openmeteo_winter.json", winter);
+
+  testIncomplete();
+
+  benchmark("openmeteo_summer.json");
+  benchmark("openmeteo_winter.json");
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
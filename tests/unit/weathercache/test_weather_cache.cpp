@@ -0,0 +1,137 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../weather_cache.h"
+#include "../../../weather_parser.h"
+#include "../../../rtc_time.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+static uint16_t dayKeyOf(uint32_t epoch) {
+  time_t t = (time_t)epoch;
+  struct tm local;
+  gmtime_r(&t, &local);
+  return WeatherCache::dayKey(&local);
+}
+
+int main() {
+  std::printf("Running weather cache tests...\n");
+
+  EXPECT_EQ(sizeof(HourlyForecastRecord), 108, "forecast record size");
+  EXPECT_EQ(sizeof(WeatherRecord), 32 + 108, "record size");
+
+  const uint32_t fetched = 1715335200UL; // 2024-05-10 10:00 UTC
+  const uint16_t today = dayKeyOf(fetched);
+  EXPECT_TRUE(today != dayKeyOf(fetched + 86400), "day key changes at midnight");
+  EXPECT_TRUE(dayKeyOf(1735603200UL) != dayKeyOf(1735689600UL), "day key changes at new year"); // 2024-12-31 / 2025-01-01
+
+  WeatherData data = {{19.24f, -3.46f}, {61, WEATHER_MISSING}, {43193.52f, 0.0f}, HourlyForecast()};
+  data.forecast.setStart("2024-05-10T00:00");
+  for (uint8_t i = 0; i < FORECAST_HOURS; i++) {
+    data.forecast.setTemperature(i, 8.0f + i * 0.3f);
+    if (i != 40) data.forecast.setWeatherCode(i, i % 4);
+  }
+  WeatherRecord record;
+  WeatherCache::encode(&record, &data, fetched, today);
+
+  WeatherData restored;
+  EXPECT_TRUE(WeatherCache::decode(&record, &restored), "record is valid");
+  EXPECT_EQ((int)(restored.temperature[0] * 10 + 0.5f), 192, "temperature today (0.1 degree)");
+  EXPECT_EQ((int)(restored.temperature[1] * 10 - 0.5f), -35, "negative temperature tomorrow");
+  EXPECT_EQ(restored.weatherCode[0], 61, "weather code today");
+  EXPECT_EQ(restored.weatherCode[1], WEATHER_MISSING, "missing weather code");
+  EXPECT_EQ(restored.sunshine[0], 43194, "sunshine today (s)");
+  struct tm hour = {};
+  hour.tm_year = 124; hour.tm_mon = 4; hour.tm_mday = 11; hour.tm_hour = 7;
+  EXPECT_EQ(restored.forecast.getIndex(&hour), 31, "forecast start restored");
+  bool sameForecast = true;
+  for (uint8_t i = 0; i < FORECAST_HOURS; i++) {
+    if (restored.forecast.getTemperatureTenths(i) != data.forecast.getTemperatureTenths(i) ||
+        restored.forecast.getWeatherCode(i) != data.forecast.getWeatherCode(i)) sameForecast = false;
+  }
+  EXPECT_TRUE(sameForecast, "all hourly values restored");
+  EXPECT_EQ(restored.forecast.getWeatherCode(40), WEATHER_MISSING, "missing hourly code restored");
+
+  WeatherRecord broken = record;
+  broken.temperature[0]++;
+  EXPECT_TRUE(!WeatherCache::decode(&broken, &restored), "corrupted record is rejected");
+  broken = record;
+  broken.version = WEATHER_CACHE_VERSION + 1;
+  EXPECT_TRUE(!WeatherCache::decode(&broken, &restored), "other schema version is rejected");
+  std::memset(&broken, 0xFF, sizeof(broken));
+  EXPECT_TRUE(!WeatherCache::decode(&broken, &restored), "erased flash is rejected");
+  broken = record;
+  broken.forecast.startHour = 24;
+  broken.crc = RtcTime::crc32((const uint8_t*)&broken, offsetof(WeatherRecord, crc));
+  WeatherData kept = restored;
+  EXPECT_TRUE(!WeatherCache::decode(&broken, &kept), "implausible forecast is rejected");
+  EXPECT_EQ(kept.forecast.getIndex(&hour), 31, "rejected record leaves the forecast unchanged");
+
+  // Usable after boot
+  EXPECT_TRUE(WeatherCache::isUsable(&record, fetched + 3600, today), "one hour later on the same day");
+  EXPECT_TRUE(!WeatherCache::isUsable(&record, fetched + 86400, dayKeyOf(fetched + 86400)), "next day is not usable");
+  EXPECT_TRUE(!WeatherCache::isUsable(&record, fetched + WEATHER_CACHE_MAX_AGE + 1, today), "too old");
+  EXPECT_TRUE(!WeatherCache::isUsable(&record, fetched - 60, today), "fetched in the future");
+  EXPECT_TRUE(WeatherCache::isUsable(&record, 30, 0), "without system time the record is used");
+
+  // Write throttling
+  WeatherRecord fresh;
+  EXPECT_TRUE(WeatherCache::shouldWrite(nullptr, &record), "first record is written");
+  WeatherCache::encode(&fresh, &data, fetched + 1800, today);
+  EXPECT_TRUE(!WeatherCache::shouldWrite(&record, &fresh), "same values are not written");
+  WeatherData changed = data;
+  changed.temperature[1] = -2.0f;
+  WeatherCache::encode(&fresh, &changed, fetched + 1800, today);
+  EXPECT_TRUE(!WeatherCache::shouldWrite(&record, &fresh), "changed values within the interval are not written");
+  WeatherCache::encode(&fresh, &changed, fetched + WEATHER_CACHE_WRITE_INTERVAL, today);
+  EXPECT_TRUE(WeatherCache::shouldWrite(&record, &fresh), "changed values after the interval are written");
+  WeatherCache::encode(&fresh, &data, fetched + WEATHER_CACHE_WRITE_INTERVAL, today);
+  EXPECT_TRUE(!WeatherCache::shouldWrite(&record, &fresh), "unchanged values after the interval are not written");
+  WeatherCache::encode(&fresh, &data, fetched + WEATHER_CACHE_MAX_AGE / 2, today);
+  EXPECT_TRUE(WeatherCache::shouldWrite(&record, &fresh), "unchanged values are rewritten before the record expires");
+  WeatherCache::encode(&fresh, &data, fetched + 1800, today + 1);
+  EXPECT_TRUE(WeatherCache::shouldWrite(&record, &fresh), "new day is written immediately");
+
+  // One week of refreshes every 30 minutes with values changing every time
+  WeatherRecord stored;
+  bool haveStored = false;
+  int writes = 0;
+  const uint32_t weekStart = 1715299200UL; // 2024-05-10 00:00 UTC
+  for (uint32_t t = weekStart; t < weekStart + 7 * 86400; t += 1800) {
+    WeatherData values = data;
+    values.temperature[0] = 10.0f + (t / 1800 % 20) * 0.5f;
+    WeatherCache::encode(&fresh, &values, t, dayKeyOf(t));
+    if (WeatherCache::shouldWrite(haveStored ? &stored : nullptr, &fresh)) {
+      stored = fresh;
+      haveStored = true;
+      writes++;
+    }
+    if (t == weekStart + 86400 - 1800) EXPECT_TRUE(writes <= 9, "at most 9 writes on the first day");
+  }
+  std::printf("[INFO] %d writes for %d refreshes in one week\n", writes, 7 * 48);
+  EXPECT_TRUE(writes <= 7 * 9, "write throttling over one week");
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
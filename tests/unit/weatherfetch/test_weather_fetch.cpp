@@ -0,0 +1,351 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+#include "../mocks/Client.h"
+
+// Include the code under test
+#include "../../../weather_fetch.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+
+// Client which receives the response in pieces, released by the test with deliver()
+class MockClient : public Client {
+public:
+  std::string response;
+  std::string request;
+  size_t delivered = 0;
+  size_t position = 0;
+  bool isConnected = false;
+  bool connectResult = true;
+  bool closeAtEnd = true;
+  unsigned long connectCostMs = 0;
+  unsigned long readCostMs = 0;
+  int stopCount = 0;
+
+  void deliver(size_t bytes) {
+    delivered = std::min(response.length(), delivered + bytes);
+  }
+
+  int connect(const char*, uint16_t) override {
+    __mock_millis += connectCostMs;
+    isConnected = connectResult;
+    return connectResult ? 1 : 0;
+  }
+  size_t write(const uint8_t* buf, size_t size) override {
+    request.append((const char*)buf, size);
+    return size;
+  }
+  int available() override {
+    return (int)(delivered - position);
+  }
+  int read() override {
+    if (position >= delivered) return -1;
+    __mock_millis += readCostMs;
+    return (uint8_t)response[position++];
+  }
+  int read(uint8_t* buf, size_t size) override {
+    size_t length = std::min(size, delivered - position);
+    std::memcpy(buf, response.data() + position, length);
+    position += length;
+    __mock_millis += readCostMs;
+    return (int)length;
+  }
+  uint8_t connected() override {
+    if (closeAtEnd && isConnected && delivered == response.length() && position == delivered) return 0;
+    return isConnected ? 1 : 0;
+  }
+  void stop() override {
+    isConnected = false;
+    stopCount++;
+  }
+};
+
+static std::string readFile(const char *path) {
+  std::string content;
+  FILE *file = std::fopen(path, "rb");
+  if (file == nullptr) return content;
+  char buffer[512];
+  size_t length;
+  while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, length);
+  std::fclose(file);
+  return content;
+}
+
+static std::string httpResponse(const std::string &body, bool withLength) {
+  std::string response = "HTTP/1.1 200 OK\r\nDate: Fri, 10 May 2024 10:00:00 GMT\r\nContent-Type: application/json; charset=utf-8\r\n";
+  if (withLength) response += "content-length: " + std::to_string(body.length()) + "\r\n";
+  response += "Connection: close\r\n\r\n";
+  return response + body;
+}
+
+static int g_resolveCount = 0;
+static WeatherResolveState resolveOk(const char *, bool) { g_resolveCount++; return wr_resolved; }
+static WeatherResolveState resolveFail(const char *, bool) { return wr_failed; }
+
+// asynchronous lookup: pending until g_dnsAnswer is set
+static int g_dnsStarts = 0;
+static WeatherResolveState g_dnsAnswer = wr_pending;
+static WeatherResolveState resolveAsync(const char *, bool start) {
+  if (start) {
+    g_dnsStarts++;
+    g_dnsAnswer = wr_pending;
+  }
+  return g_dnsAnswer;
+}
+
+static void testPieces() {
+  std::string body = readFile("../weather/openmeteo_summer.json");
+  MockClient client;
+  client.response = httpResponse(body, true);
+  client.readCostMs = 1;
+
+  WeatherFetch fetch;
+  fetch.setResolver(resolveOk);
+  fetch.start("api.open-meteo.com", 443, "/v1/forecast?latitude=49.2394");
+  EXPECT_TRUE(fetch.isBusy(), "fetch is busy after start");
+
+  EXPECT_EQ(fetch.poll(client, 10), wf_connect, "first slice resolves the host");
+  EXPECT_EQ(g_resolveCount, 1, "resolver called once");
+  EXPECT_EQ(fetch.poll(client, 10), wf_send, "second slice connects");
+  EXPECT_EQ(fetch.poll(client, 10), wf_headers, "third slice sends the request");
+  EXPECT_TRUE(client.request.find("GET /v1/forecast?latitude=49.2394 HTTP/1.0\r\n") == 0, "HTTP/1.0 request line");
+  EXPECT_TRUE(client.request.find("Host: api.open-meteo.com\r\n") != std::string::npos, "host header");
+  EXPECT_TRUE(client.request.size() > 4 && client.request.compare(client.request.size() - 4, 4, "\r\n\r\n") == 0, "request ends with empty line");
+
+  EXPECT_EQ(fetch.poll(client, 10), wf_headers, "no data: still waiting for headers");
+
+  // the response arrives in pieces of 100 bytes, each slice may use 10 ms (1 ms per read)
+  int slices = 0;
+  uint8_t lastProgress = 0;
+  bool monotonic = true;
+  while (fetch.isBusy() && slices < 1000) {
+    client.deliver(100);
+    fetch.poll(client, 10);
+    if (fetch.getProgress() < lastProgress && fetch.isBusy()) monotonic = false;
+    lastProgress = fetch.getProgress();
+    slices++;
+  }
+  EXPECT_EQ(fetch.getPhase(), wf_done, "fetch finished");
+  EXPECT_TRUE(slices >= (int)(client.response.length() / 100), "data arrives over many slices");
+  EXPECT_TRUE(monotonic, "progress does not go backwards");
+  EXPECT_EQ(fetch.getProgress(), 100, "progress complete");
+  EXPECT_TRUE(fetch.getLongestSliceMillis() <= 10, "slices stay within budget");
+  EXPECT_EQ(fetch.getStatusCode(), 200, "status code");
+  EXPECT_EQ(fetch.getContentLength(), (long long)body.length(), "content length (case-insensitive header)");
+  EXPECT_EQ(fetch.getBytesReceived(), (long long)body.length(), "all body bytes received");
+  EXPECT_TRUE(fetch.getParser().isComplete(), "parser complete");
+  EXPECT_EQ((int)std::lround(fetch.getParser().getTemperature(true) * 10), 217, "temperature tomorrow");
+  EXPECT_TRUE(client.stopCount > 0 && !client.isConnected, "connection closed");
+}
+
+static void testBudget() {
+  std::string body = readFile("../weather/openmeteo_winter.json");
+  MockClient client;
+  client.response = httpResponse(body, false);
+  client.deliver(client.response.length());
+  client.readCostMs = 2;
+
+  WeatherFetch fetch;
+  fetch.start("example.com", 80, "/");
+  EXPECT_EQ(fetch.poll(client, 20), wf_connect, "without resolver the dns phase is skipped");
+  fetch.poll(client, 20);
+  fetch.poll(client, 20);
+
+  // all data is available, but every slice stops after its budget
+  int slices = 0;
+  while (fetch.isBusy() && slices < 1000) {
+    unsigned long start = millis();
+    fetch.poll(client, 20);
+    if (millis() - start > 20 + 2) break;
+    slices++;
+  }
+  EXPECT_EQ(fetch.getPhase(), wf_done, "fetch finished without content length");
+  EXPECT_TRUE(slices > 1, "work is split into several slices");
+  EXPECT_TRUE(fetch.getLongestSliceMillis() <= 22, "slice ends at most one read after the budget");
+  EXPECT_EQ(fetch.getContentLength(), -1, "content length unknown");
+  EXPECT_TRUE(fetch.getParser().isComplete(), "parser complete");
+}
+
+static void runToEnd(WeatherFetch &fetch, MockClient &client) {
+  for (int i = 0; i < 100 && fetch.isBusy(); i++) {
+    client.deliver(64);
+    fetch.poll(client, 10);
+  }
+}
+
+static void testFailures() {
+  WeatherFetch fetch;
+  MockClient client;
+
+  fetch.setResolver(resolveFail);
+  fetch.start("unknown.invalid", 443, "/");
+  runToEnd(fetch, client);
+  EXPECT_EQ(fetch.getPhase(), wf_failed, "dns failure");
+  EXPECT_EQ(fetch.getFailedPhase(), wf_dns, "failed in dns phase");
+
+  fetch.setResolver(nullptr);
+  client.connectResult = false;
+  fetch.start("example.com", 443, "/");
+  runToEnd(fetch, client);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_connect, "connect failure");
+
+  MockClient error;
+  error.response = "HTTP/1.1 400 Bad Request\r\nContent-Length: 20\r\n\r\n{\"error\":true,\"r\":1}";
+  fetch.start("example.com", 443, "/");
+  runToEnd(fetch, error);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_headers, "HTTP error status fails in headers");
+  EXPECT_EQ(fetch.getStatusCode(), 400, "HTTP error status");
+
+  MockClient empty;
+  empty.response = "HTTP/1.1 200 OK\r\n\r\n";
+  fetch.start("example.com", 443, "/");
+  runToEnd(fetch, empty);
+  EXPECT_EQ(fetch.getPhase(), wf_failed, "empty body fails");
+
+  MockClient stalled;
+  stalled.response = httpResponse(readFile("../weather/openmeteo_summer.json"), true);
+  stalled.closeAtEnd = false;
+  fetch.start("example.com", 443, "/");
+  for (int i = 0; i < 3; i++) fetch.poll(stalled, 10);
+  stalled.deliver(300);
+  fetch.poll(stalled, 10);
+  EXPECT_EQ(fetch.getPhase(), wf_body, "body started");
+  __mock_millis += WEATHER_FETCH_TIMEOUT - 1;
+  fetch.poll(stalled, 10);
+  EXPECT_EQ(fetch.getPhase(), wf_body, "no timeout before WEATHER_FETCH_TIMEOUT");
+  __mock_millis += 2;
+  fetch.poll(stalled, 10);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_body, "stalled body times out");
+  EXPECT_TRUE(!stalled.isConnected, "stalled connection closed");
+
+  MockClient running;
+  running.response = httpResponse("{}", true);
+  fetch.start("example.com", 443, "/");
+  fetch.poll(running, 10);
+  fetch.abort(running);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_connect, "abort reports the current phase");
+  EXPECT_TRUE(!fetch.isBusy(), "not busy after abort");
+}
+
+static void testAsyncDns() {
+  MockClient client;
+  client.response = httpResponse(readFile("../weather/openmeteo_summer.json"), true);
+  WeatherFetch fetch;
+  fetch.setResolver(resolveAsync);
+  fetch.start("api.open-meteo.com", 443, "/");
+
+  // the lookup is started once and polled, each slice returns right away
+  unsigned long start = millis();
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(fetch.poll(client, 10), wf_dns, "dns pending");
+  }
+  EXPECT_EQ(g_dnsStarts, 1, "lookup started once");
+  EXPECT_TRUE(millis() - start < 10, "pending lookup does not block");
+  EXPECT_EQ(fetch.getProgress(), 0, "no progress while resolving");
+  g_dnsAnswer = wr_resolved;
+  EXPECT_EQ(fetch.poll(client, 10), wf_connect, "resolved lookup continues with connect");
+  EXPECT_EQ(g_dnsStarts, 1, "no second lookup");
+  runToEnd(fetch, client);
+  EXPECT_EQ(fetch.getPhase(), wf_done, "fetch after async dns finished");
+
+  // negative answer of the DNS server
+  fetch.start("unknown.invalid", 443, "/");
+  fetch.poll(client, 10);
+  g_dnsAnswer = wr_failed;
+  fetch.poll(client, 10);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_dns, "negative answer fails in dns phase");
+
+  // no answer at all
+  fetch.start("api.open-meteo.com", 443, "/");
+  fetch.poll(client, 10);
+  __mock_millis += WEATHER_FETCH_TIMEOUT - 1;
+  EXPECT_EQ(fetch.poll(client, 10), wf_dns, "no timeout before WEATHER_FETCH_TIMEOUT");
+  __mock_millis += 2;
+  fetch.poll(client, 10);
+  EXPECT_EQ(fetch.getFailedPhase(), wf_dns, "lookup without answer times out");
+}
+
+static void testRejectedResponse() {
+  // values of the previous fetch (or of the cache)
+  WeatherData data = {{21.5f, 23.0f}, {1, 2}, {3600.0f, 7200.0f}, HourlyForecast()};
+  data.forecast.setStart("2024-07-14T00:00");
+  data.forecast.setTemperature(12, 21.5f);
+
+  // the truncated response still ends in wf_done when the server closes the connection
+  MockClient truncated;
+  truncated.response = httpResponse(readFile("../corpus/payloads/openmeteo_truncated.json"), false);
+  WeatherFetch fetch;
+  fetch.start("api.open-meteo.com", 443, "/");
+  runToEnd(fetch, truncated);
+  EXPECT_EQ(fetch.getPhase(), wf_done, "truncated response is received");
+  EXPECT_TRUE(!fetch.getParser().isComplete(), "truncated response is incomplete");
+  EXPECT_TRUE(!fetch.getValues(&data), "truncated response is rejected");
+  EXPECT_EQ((int)std::lround(data.temperature[0] * 10), 215, "previous temperature today stays");
+  EXPECT_EQ((int)std::lround(data.temperature[1] * 10), 230, "previous temperature tomorrow stays");
+  EXPECT_EQ(data.weatherCode[0], 1, "previous weather code stays");
+  EXPECT_EQ((int)data.sunshine[1], 7200, "previous sunshine stays");
+  EXPECT_EQ(data.forecast.getTemperatureTenths(12), 215, "previous forecast stays");
+
+  // a running fetch has no values yet
+  MockClient complete;
+  complete.response = httpResponse(readFile("../weather/openmeteo_summer.json"), true);
+  fetch.start("api.open-meteo.com", 443, "/");
+  fetch.poll(complete, 10);
+  EXPECT_TRUE(!fetch.getValues(&data), "no values while the fetch is running");
+
+  runToEnd(fetch, complete);
+  EXPECT_TRUE(fetch.getValues(&data), "complete response is accepted");
+  EXPECT_EQ((int)std::lround(data.temperature[1] * 10), 217, "new temperature tomorrow");
+  EXPECT_EQ(data.forecast.getTemperatureTenths(12), std::lround(data.temperature[0] * 10), "forecast replaced");
+}
+
+static void testForecastPath() {
+  const std::string query = "&hourly=temperature_2m,weathercode&daily=sunshine_duration&forecast_days=2&timezone=";
+  char path[WEATHER_PATH_SIZE];
+  EXPECT_TRUE(WeatherFetch::formatForecastPath(path, sizeof(path), 492394, 92553, "Europe/Berlin"), "path of the default location");
+  EXPECT_TRUE(path == "/v1/forecast?latitude=49.2394&longitude=9.2553" + query + "Europe%2FBerlin", "same path as before");
+
+  WeatherFetch::formatForecastPath(path, sizeof(path), -338688, -705, "America/Argentina/Buenos_Aires");
+  EXPECT_TRUE(path == "/v1/forecast?latitude=-33.8688&longitude=-0.0705" + query + "America%2FArgentina%2FBuenos_Aires",
+              "negative coordinates and nested zone names");
+  WeatherFetch::formatForecastPath(path, sizeof(path), 0, 1800000, "Etc/GMT+5");
+  EXPECT_TRUE(path == "/v1/forecast?latitude=0.0000&longitude=180.0000" + query + "Etc%2FGMT%2B5", "plus sign encoded");
+
+  char small[120];
+  EXPECT_TRUE(!WeatherFetch::formatForecastPath(small, sizeof(small), 492394, 92553, "America/Argentina/Buenos_Aires"),
+              "path longer than the buffer");
+  EXPECT_TRUE(std::strlen(small) < sizeof(small), "truncated path terminated");
+}
+
+int main() {
+  std::printf("Running weather fetch tests...\n");
+
+  testPieces();
+  testBudget();
+  testFailures();
+  testAsyncDns();
+  testRejectedResponse();
+  testForecastPath();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
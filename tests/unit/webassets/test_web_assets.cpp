@@ -0,0 +1,134 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../web_assets.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_STR(actual, expected, msg) \
+  do { \
+    std::string a = (actual); \
+    std::string e = (expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%s expected=%s\n", msg, a.c_str(), e.c_str()); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+// Lines as written by scripts/build_web_assets.py
+static const char *MANIFEST[] = {
+  "/fs.html 3756 14022907",
+  "/icons/clock.svg 1150 42418861",
+  "/index.html 22274 0a7efbda",
+  "/style.css 1781 c8b4d31b\r",
+};
+
+static void testManifest() {
+  AssetManifest manifest;
+  for (const char *line : MANIFEST) EXPECT_TRUE(manifest.parseLine(line), line);
+  EXPECT_EQ(manifest.getCount(), 4, "entries");
+
+  EXPECT_TRUE(!manifest.parseLine(""), "empty line ignored");
+  EXPECT_TRUE(!manifest.parseLine("# comment"), "comment ignored");
+  EXPECT_TRUE(!manifest.parseLine("/a.svg"), "line without size rejected");
+  EXPECT_TRUE(!manifest.parseLine("/a.svg 12"), "line without hash rejected");
+  EXPECT_TRUE(!manifest.parseLine("/a.svg x 1234abcd"), "invalid size rejected");
+  EXPECT_TRUE(!manifest.parseLine("/a.svg 12 xyz"), "invalid hash rejected");
+  EXPECT_TRUE(!manifest.parseLine("/a.svg 12 12ab34cdx"), "trailing characters rejected");
+  EXPECT_EQ(manifest.getCount(), 4, "invalid lines not added");
+
+  char etag[WEB_ETAG_SIZE];
+  EXPECT_TRUE(manifest.getETag("/index.html", 22274, false, etag), "ETag of a listed file");
+  EXPECT_STR(etag, "\"0a7efbda\"", "strong ETag with quotes");
+  EXPECT_TRUE(manifest.getETag("/index.html", 22274, true, etag), "ETag of the gzip variant");
+  EXPECT_STR(etag, "\"0a7efbda-gz\"", "gzip variant has its own ETag");
+  EXPECT_TRUE(manifest.getETag("/style.css", 1781, false, etag), "carriage return of the line ignored");
+  EXPECT_STR(etag, "\"c8b4d31b\"", "hash of the last line");
+  EXPECT_TRUE(!manifest.getETag("/index.html", 22300, false, etag), "changed file (other size) has no ETag");
+  EXPECT_TRUE(manifest.getETag("/icons/clock.svg", WEB_SIZE_UNKNOWN, true, etag), "only the gzip variant stored");
+  EXPECT_TRUE(!manifest.getETag("/icons/snake.svg", 1213, false, etag), "file not in the manifest");
+
+  AssetManifest full;
+  char line[WEB_ASSET_LINE];
+  for (int i = 0; i < WEB_ASSET_MAX + 2; i++) {
+    std::snprintf(line, sizeof(line), "/file%d.svg %d %08x", i, 100 + i, i);
+    full.parseLine(line);
+  }
+  EXPECT_EQ(full.getCount(), WEB_ASSET_MAX, "manifest limited to WEB_ASSET_MAX entries");
+  EXPECT_TRUE(full.getETag("/file31.svg", 131, false, etag), "last entry which fits");
+  EXPECT_TRUE(!full.getETag("/file32.svg", 132, false, etag), "entries beyond the limit dropped");
+  full.clear();
+  EXPECT_EQ(full.getCount(), 0, "clear");
+}
+
+static void testConditional() {
+  EXPECT_TRUE(AssetManifest::matches("\"0a7efbda\"", "\"0a7efbda\""), "same ETag");
+  EXPECT_TRUE(!AssetManifest::matches("\"0a7efbdb\"", "\"0a7efbda\""), "other ETag");
+  EXPECT_TRUE(!AssetManifest::matches("\"0a7efbda\"", "\"0a7efbda-gz\""), "identity ETag does not match the gzip variant");
+  EXPECT_TRUE(!AssetManifest::matches("", "\"0a7efbda\""), "no header");
+  EXPECT_TRUE(AssetManifest::matches("\"1\", \"0a7efbda\" ,\"2\"", "\"0a7efbda\""), "ETag in a list");
+  EXPECT_TRUE(AssetManifest::matches("W/\"0a7efbda\"", "\"0a7efbda\""), "weak comparison");
+  EXPECT_TRUE(AssetManifest::matches("*", "\"0a7efbda\""), "any ETag");
+  EXPECT_TRUE(!AssetManifest::matches("\"0a7efbda", "\"0a7efbda\""), "incomplete ETag");
+}
+
+static void testEncoding() {
+  EXPECT_TRUE(AssetManifest::acceptsGzip("gzip, deflate, br"), "browser default");
+  EXPECT_TRUE(AssetManifest::acceptsGzip("br;q=1.0, GZIP;q=0.8"), "case and quality");
+  EXPECT_TRUE(!AssetManifest::acceptsGzip("gzip;q=0, deflate"), "gzip excluded");
+  EXPECT_TRUE(!AssetManifest::acceptsGzip("identity"), "identity only");
+  EXPECT_TRUE(!AssetManifest::acceptsGzip("x-gzip"), "other coding with gzip in the name");
+  EXPECT_TRUE(!AssetManifest::acceptsGzip(""), "no header");
+  EXPECT_TRUE(AssetManifest::acceptsGzip("deflate;q=0, gzip"), "quality of another coding");
+}
+
+static void testCacheControl() {
+  EXPECT_STR(AssetManifest::getCacheControl("/index.html"), "no-cache", "html is revalidated");
+  EXPECT_STR(AssetManifest::getCacheControl("/icons/clock.svg"), "max-age=604800", "icons are cached");
+  EXPECT_STR(AssetManifest::getCacheControl("/style.css"), "max-age=604800", "styles are cached");
+}
+
+static void testStats() {
+  AssetStats stats;
+  stats.record(4583, 120, false, true);
+  stats.record(0, 8, true, true);
+  stats.record(1781, 30, false, false);
+  EXPECT_EQ(stats.getRequestCount(), 3, "requests");
+  EXPECT_EQ(stats.getNotModifiedCount(), 1, "304 responses");
+  EXPECT_EQ(stats.getGzipCount(), 2, "gzip responses");
+  EXPECT_EQ(stats.getBytes(), 6364, "bytes");
+  EXPECT_EQ(stats.getMillis(), 158, "time");
+  EXPECT_EQ(stats.getMaxMillis(), 120, "longest response");
+}
+
+int main() {
+  std::printf("Running web asset tests...\n");
+  testManifest();
+  testConditional();
+  testEncoding();
+  testCacheControl();
+  testStats();
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../web_bundle.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_STR(actual, expected, msg) \
+  do { \
+    std::string a = (actual); \
+    std::string e = (expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%s expected=%s\n", msg, a.c_str(), e.c_str()); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+static const char *DATA_DIR = "../../../data";
+
+// CRC-32 of gzip (reflected, polynomial 0xEDB88320)
+static uint32_t crc32(const std::string &data) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (unsigned char c : data) {
+    crc ^= c;
+    for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static uint32_t readLE32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Files of data/ as the build script collects them
+static std::vector<std::string> dataFiles() {
+  std::vector<std::string> files;
+  for (const auto &item : std::filesystem::recursive_directory_iterator(DATA_DIR)) {
+    if (!item.is_regular_file()) continue;
+    std::string name = item.path().filename().string();
+    if (name.size() > 3 && name.compare(name.size() - 3, 3, ".gz") == 0) continue;
+    if (name == "assets.txt") continue;
+    files.push_back("/" + std::filesystem::relative(item.path(), DATA_DIR).generic_string());
+  }
+  return files;
+}
+
+static std::string readFile(const std::string &path) {
+  std::ifstream in(std::string(DATA_DIR) + path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void testUpToDate() {
+  // the bundle has to be written again after every change in data/
+  std::vector<std::string> files = dataFiles();
+  EXPECT_EQ(WebBundle::getCount(), files.size(), "one entry per file of data/");
+  size_t total = 0;
+  size_t bundled = 0;
+  int outdated = 0;
+  for (const std::string &path : files) {
+    int8_t index = WebBundle::find(path.c_str());
+    if (index < 0) {
+      std::printf("[FAIL] %s missing in the bundle\n", path.c_str());
+      ++g_failures;
+      continue;
+    }
+    WebBundleEntry entry;
+    WebBundle::getEntry(index, &entry);
+    const uint8_t *data = (const uint8_t*)WebBundle::getData(entry);
+    std::string content = readFile(path);
+    // gzip member: magic, deflate, ..., CRC-32 and size of the uncompressed data at the end
+    bool valid = entry.length > 18 && data[0] == 0x1f && data[1] == 0x8b && data[2] == 8;
+    bool current = valid && entry.size == content.size() && readLE32(data + entry.length - 4) == content.size() &&
+                   readLE32(data + entry.length - 8) == crc32(content);
+    if (!current) {
+      std::printf("[FAIL] %s outdated, run python3 scripts/build_web_assets.py --bundle\n", path.c_str());
+      ++g_failures;
+      outdated++;
+    }
+    total += content.size();
+    bundled += entry.length;
+  }
+  EXPECT_EQ(outdated, 0, "bundle matches data/ (gzip CRC and size)");
+  std::printf("[BENCH] web bundle: %zu files, %zu bytes -> %zu bytes in flash (%.0f %%)\n",
+              files.size(), total, bundled, 100.0 * bundled / (total ? total : 1));
+}
+
+static void testIndex() {
+  uint32_t offset = 0;
+  bool contiguous = true;
+  for (uint8_t i = 0; i < WebBundle::getCount(); i++) {
+    WebBundleEntry entry;
+    WebBundle::getEntry(i, &entry);
+    if (entry.offset != offset) contiguous = false;
+    offset += entry.length;
+  }
+  EXPECT_TRUE(contiguous, "files stored one after another");
+
+  EXPECT_EQ(WebBundle::find("/index.html") >= 0, 1, "index.html bundled");
+  EXPECT_EQ(WebBundle::find("/icons/clock.svg") >= 0, 1, "icons bundled with their folder");
+  EXPECT_EQ(WebBundle::find("/missing.svg"), -1, "unknown file");
+  EXPECT_EQ(WebBundle::find("/index.htm"), -1, "path compared completely");
+
+  char path[WEB_ASSET_LINE];
+  int8_t index = WebBundle::find("/icons/clock.svg");
+  EXPECT_TRUE(WebBundle::getPath(index, path, sizeof(path)), "path copied from flash");
+  EXPECT_STR(path, "/icons/clock.svg", "path of the entry");
+  EXPECT_TRUE(!WebBundle::getPath(index, path, 8), "path longer than the buffer");
+  EXPECT_STR(path, "/icons/", "truncated path terminated");
+}
+
+static void testETag() {
+  // same ETag as the gzip variant of the file in LittleFS with the manifest of the build script
+  int8_t index = WebBundle::find("/index.html");
+  WebBundleEntry entry;
+  WebBundle::getEntry(index, &entry);
+  char line[WEB_ASSET_LINE];
+  std::snprintf(line, sizeof(line), "/index.html %lu %08lx", (unsigned long)entry.size, (unsigned long)entry.hash);
+  AssetManifest manifest;
+  manifest.parseLine(line);
+  char fromManifest[WEB_ETAG_SIZE];
+  char fromBundle[WEB_ETAG_SIZE];
+  EXPECT_TRUE(manifest.getETag("/index.html", entry.size, true, fromManifest), "manifest entry");
+  WebBundle::getETag(entry, fromBundle);
+  EXPECT_STR(fromBundle, fromManifest, "ETag of the bundle equals the ETag of the gzip file");
+  EXPECT_EQ(std::strlen(fromBundle), WEB_ETAG_SIZE - 1, "ETag fills the buffer");
+}
+
+int main() {
+  std::printf("Running web bundle tests...\n");
+  testUpToDate();
+  testIndex();
+  testETag();
+  std::printf("Failures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
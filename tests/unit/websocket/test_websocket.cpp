@@ -0,0 +1,240 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Include mocks first so they override real headers
+#include "../mocks/Arduino.h"
+
+// Include the code under test
+#include "../../../websocket.h"
+#include "../../../state_cache.h"
+
+static int g_failures = 0;
+
+#define EXPECT_EQ(actual, expected, msg) \
+  do { \
+    long long a = (long long)(actual); \
+    long long e = (long long)(expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=%lld expected=%lld\n", msg, a, e); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+#define EXPECT_TRUE(cond, msg) \
+  do { if (!(cond)) { std::printf("[FAIL] %s\n", msg); ++g_failures; } else { std::printf("[ OK ] %s\n", msg); } } while(0)
+#define EXPECT_STR(actual, expected, msg) \
+  do { \
+    std::string a = (actual); \
+    std::string e = (expected); \
+    if (a != e) { \
+      std::printf("[FAIL] %s: got=\"%s\" expected=\"%s\"\n", msg, a.c_str(), e.c_str()); \
+      ++g_failures; \
+    } else { \
+      std::printf("[ OK ] %s\n", msg); \
+    } \
+  } while (0)
+
+static std::string sha1Hex(const std::string &input) {
+  uint8_t digest[20];
+  WebSocket::sha1((const uint8_t*)input.data(), input.size(), digest);
+  char hex[41];
+  for (int i = 0; i < 20; i++) std::snprintf(hex + i * 2, 3, "%02x", digest[i]);
+  return hex;
+}
+
+static void testSha1() {
+  // lengths around the padding boundaries of the 64 byte blocks
+  EXPECT_STR(sha1Hex(""), "da39a3ee5e6b4b0d3255bfef95601890afd80709", "sha1 empty");
+  EXPECT_STR(sha1Hex("abc"), "a9993e364706816aba3e25717850c26c9cd0d89d", "sha1 abc");
+  EXPECT_STR(sha1Hex(std::string(55, 'a')), "c1c8bbdc22796e28c0e15163d20899b65621d65a", "sha1 55 bytes (one block)");
+  EXPECT_STR(sha1Hex(std::string(56, 'a')), "c2db330f6083854c99d4b5bfb6e8f29f201be699", "sha1 56 bytes (two blocks)");
+  EXPECT_STR(sha1Hex(std::string(64, 'a')), "0098ba824b5c16427bd7a1122a5a442a25ec644d", "sha1 64 bytes");
+  EXPECT_STR(sha1Hex(std::string(119, 'a')), "ee971065aaa017e0632a8ca6c77bb3bf8b1dfc56", "sha1 119 bytes");
+  EXPECT_STR(sha1Hex(std::string(1000, 'a')), "291e9a6c66994949b57ba5e650361e98fc36b1ba", "sha1 1000 bytes");
+}
+
+static WebSocketParseResult feedHandshake(WebSocketHandshake &handshake, const char *request) {
+  WebSocketParseResult result = wsp_more;
+  for (const char *c = request; *c && result == wsp_more; c++) result = handshake.feed(*c);
+  return result;
+}
+
+static void testHandshake() {
+  // example of RFC 6455 section 1.3
+  char accept[WS_ACCEPT_SIZE];
+  WebSocket::acceptKey("dGhlIHNhbXBsZSBub25jZQ==", accept);
+  EXPECT_STR(accept, "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", "accept key of the RFC example");
+
+  WebSocketHandshake handshake;
+  const char *request =
+      "GET / HTTP/1.1\r\n"
+      "Host: 192.168.0.50:81\r\n"
+      "Connection: Upgrade\r\n"
+      "Pragma: no-cache\r\n"
+      "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36\r\n"
+      "upgrade: WebSocket\r\n"
+      "Sec-WebSocket-Version: 13\r\n"
+      "sec-websocket-key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+      "Sec-WebSocket-Extensions: permessage-deflate; client_max_window_bits\r\n"
+      "\r\n";
+  EXPECT_EQ(feedHandshake(handshake, request), wsp_done, "browser request accepted");
+  EXPECT_STR(handshake.getKey(), "dGhlIHNhbXBsZSBub25jZQ==", "key of the request");
+
+  handshake.reset();
+  EXPECT_EQ(feedHandshake(handshake, "GET / HTTP/1.1\nUpgrade: websocket\nSec-WebSocket-Key: abc\n\n"), wsp_done,
+            "LF line ends accepted");
+
+  handshake.reset();
+  EXPECT_EQ(feedHandshake(handshake, "GET / HTTP/1.1\r\nHost: x\r\nSec-WebSocket-Key: abc\r\n\r\n"), wsp_error,
+            "request without upgrade rejected");
+  handshake.reset();
+  EXPECT_EQ(feedHandshake(handshake, "GET / HTTP/1.1\r\nUpgrade: websocket\r\n\r\n"), wsp_error, "request without key rejected");
+  handshake.reset();
+  EXPECT_EQ(feedHandshake(handshake, "POST / HTTP/1.1\r\n"), wsp_error, "POST rejected");
+  handshake.reset();
+  EXPECT_EQ(feedHandshake(handshake, "GET / HTTP/1.1\r\nSec-WebSocket-Key: 0123456789012345678901234567890123456789\r\n"),
+            wsp_error, "too long key rejected");
+
+  handshake.reset();
+  std::string flood = "GET / HTTP/1.1\r\n";
+  while (flood.size() < WS_HANDSHAKE_MAX + 10) flood += "X-Header: 0123456789\r\n";
+  EXPECT_EQ(feedHandshake(handshake, flood.c_str()), wsp_error, "endless request rejected");
+}
+
+// Frame of a client (masked)
+static std::vector<uint8_t> clientFrame(uint8_t first, const std::string &payload) {
+  const uint8_t mask[4] = {0x37, 0xfa, 0x21, 0x3d};
+  std::vector<uint8_t> frame = {first};
+  if (payload.size() < 126) {
+    frame.push_back(0x80 | payload.size());
+  } else {
+    frame.push_back(0x80 | 126);
+    frame.push_back(payload.size() >> 8);
+    frame.push_back(payload.size() & 0xFF);
+  }
+  frame.insert(frame.end(), mask, mask + 4);
+  for (size_t i = 0; i < payload.size(); i++) frame.push_back(payload[i] ^ mask[i % 4]);
+  return frame;
+}
+
+static WebSocketParseResult feedFrame(WebSocketFrameParser &parser, const std::vector<uint8_t> &frame, size_t *used = nullptr) {
+  WebSocketParseResult result = wsp_more;
+  size_t i = 0;
+  for (; i < frame.size() && result == wsp_more; i++) result = parser.feed(frame[i]);
+  if (used) *used = i;
+  return result;
+}
+
+static void testFrames() {
+  WebSocketFrameParser parser;
+  // example of RFC 6455 section 5.7: masked "Hello"
+  std::vector<uint8_t> hello = {0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58};
+  EXPECT_EQ(feedFrame(parser, hello), wsp_done, "RFC example frame");
+  EXPECT_EQ(parser.getOpcode(), ws_text, "RFC example is text");
+  EXPECT_STR(parser.getPayload(), "Hello", "RFC example payload");
+
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x81, "snake=up")), wsp_done, "game control");
+  EXPECT_STR(parser.getPayload(), "snake=up", "game control payload");
+  EXPECT_EQ(parser.getLength(), 8, "game control length");
+
+  // two frames back to back
+  std::vector<uint8_t> both = clientFrame(0x81, "tetris=left");
+  std::vector<uint8_t> second = clientFrame(0x89, "");
+  both.insert(both.end(), second.begin(), second.end());
+  size_t used = 0;
+  EXPECT_EQ(feedFrame(parser, both, &used), wsp_done, "first of two frames");
+  EXPECT_STR(parser.getPayload(), "tetris=left", "first payload");
+  std::vector<uint8_t> rest(both.begin() + used, both.end());
+  EXPECT_EQ(feedFrame(parser, rest), wsp_done, "empty ping");
+  EXPECT_EQ(parser.getOpcode(), ws_ping, "ping opcode");
+  EXPECT_EQ(parser.getLength(), 0, "ping without payload");
+
+  std::string longest(WS_MAX_MESSAGE, 'x');
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x81, longest)), wsp_done, "longest message with 16 bit length");
+  EXPECT_EQ(parser.getLength(), WS_MAX_MESSAGE, "longest message length");
+
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x88, "\x03\xe8")), wsp_done, "close frame");
+  EXPECT_EQ(parser.getOpcode(), ws_close, "close opcode");
+
+  parser.reset();
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x81, std::string(WS_MAX_MESSAGE + 1, 'x'))), wsp_error, "too long message rejected");
+  parser.reset();
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x01, "part")), wsp_error, "fragment rejected");
+  parser.reset();
+  EXPECT_EQ(feedFrame(parser, clientFrame(0xC1, "deflated")), wsp_error, "extension bit rejected");
+  parser.reset();
+  EXPECT_EQ(feedFrame(parser, clientFrame(0x83, "x")), wsp_error, "reserved opcode rejected");
+  parser.reset();
+  std::vector<uint8_t> unmasked = {0x81, 0x02, 'h', 'i'};
+  EXPECT_EQ(feedFrame(parser, unmasked), wsp_error, "unmasked frame rejected");
+  parser.reset();
+  std::vector<uint8_t> huge = {0x81, 0xFF, 0, 0, 0, 0, 0, 1, 0, 0};
+  EXPECT_EQ(feedFrame(parser, huge), wsp_error, "64 bit length rejected");
+}
+
+static void testServerHeader() {
+  uint8_t header[WS_MAX_HEADER];
+  EXPECT_EQ(WebSocket::writeHeader(header, ws_text, 5), 2, "short header");
+  EXPECT_EQ(header[0], 0x81, "FIN + text");
+  EXPECT_EQ(header[1], 5, "unmasked length");
+  EXPECT_EQ(WebSocket::writeHeader(header, ws_pong, 125), 2, "125 bytes short header");
+  EXPECT_EQ(WebSocket::writeHeader(header, ws_text, 300), 4, "extended header");
+  EXPECT_EQ(header[1], 126, "16 bit length marker");
+  EXPECT_EQ(header[2] << 8 | header[3], 300, "16 bit length");
+}
+
+static void testStateCache() {
+  static const char *const names[] = {"mode", "modeid", "ledoff", "nightModeStart"};
+  StateCache cache(names, 4);
+  char json[128];
+  EXPECT_EQ(cache.writeJson(json, sizeof(json), true), 0, "empty cache writes nothing");
+
+  cache.set(0, "Clock");
+  cache.setInt(1, 0);
+  cache.setInt(2, 0);
+  cache.set(3, "22-00");
+  EXPECT_TRUE(cache.hasChanges(), "first values are changes");
+  cache.writeJson(json, sizeof(json), false);
+  EXPECT_STR(json, "{\"mode\":\"Clock\",\"modeid\":\"0\",\"ledoff\":\"0\",\"nightModeStart\":\"22-00\"}", "all fields");
+  cache.clearChanges();
+
+  cache.set(0, "Clock");
+  cache.setInt(1, 0);
+  EXPECT_TRUE(!cache.hasChanges(), "same values are no changes");
+
+  cache.set(0, "Snake");
+  cache.setInt(1, 4);
+  size_t length = cache.writeJson(json, sizeof(json), false);
+  EXPECT_STR(json, "{\"mode\":\"Snake\",\"modeid\":\"4\"}", "only changed fields");
+  EXPECT_EQ(length, std::strlen(json), "length of the JSON");
+  cache.writeJson(json, sizeof(json), true);
+  EXPECT_STR(json, "{\"mode\":\"Snake\",\"modeid\":\"4\",\"ledoff\":\"0\",\"nightModeStart\":\"22-00\"}", "all fields for a new client");
+  cache.clearChanges();
+
+  cache.set(2, "1");
+  EXPECT_EQ(cache.writeJson(json, 10, false), 0, "too small buffer");
+  EXPECT_EQ(cache.writeJson(json, 15, false), 14, "buffer just large enough");
+  EXPECT_STR(json, "{\"ledoff\":\"1\"}", "single field");
+
+  cache.set(9, "x");
+  cache.set(0, "AVeryLongModeName");
+  cache.writeJson(json, sizeof(json), false);
+  EXPECT_STR(json, "{\"mode\":\"AVeryLongMo\",\"ledoff\":\"1\"}", "long value truncated, unknown field ignored");
+}
+
+int main() {
+  std::printf("Running WebSocket tests...\n");
+
+  testSha1();
+  testHandshake();
+  testFrames();
+  testServerHeader();
+  testStateCache();
+
+  std::printf("\nFailures: %d\n", g_failures);
+  return g_failures == 0 ? 0 : 1;
+}
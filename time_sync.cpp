@@ -0,0 +1,129 @@
+#include "time_sync.h"
+
+/**
+ * @brief Construct a new TimeSync object (not synced)
+ *
+ */
+TimeSync::TimeSync(){
+    reset();
+}
+
+/**
+ * @brief Forget all syncs
+ *
+ */
+void TimeSync::reset(){
+    _syncCount = 0;
+    _stepCount = 0;
+    _firstSyncMonotonic = 0;
+    _lastSyncEpoch = 0;
+    _lastSyncMonotonic = 0;
+    _lastCorrection = 0;
+    _driftPpb = 0;
+    _driftValid = false;
+}
+
+/**
+ * @brief Record a sync event (call with values captured right after the time was set)
+ *
+ * @param epochMicros new system time in microseconds since 1970
+ * @param monotonicMicros monotonic time in microseconds since boot (micros64)
+ */
+void TimeSync::recordSync(int64_t epochMicros, uint64_t monotonicMicros){
+    if(_syncCount == 0){
+        _firstSyncMonotonic = monotonicMicros;
+    }
+    else{
+        uint64_t interval = monotonicMicros - _lastSyncMonotonic;
+        int64_t expected = _lastSyncEpoch + (int64_t)interval;
+        _lastCorrection = epochMicros - expected;
+
+        if(_lastCorrection > TIMESYNC_MAX_SLEW_US || _lastCorrection < -TIMESYNC_MAX_SLEW_US){
+            // clock was stepped (e.g. bad first answer of a server), not a drift
+            _stepCount++;
+        }
+        else if(interval >= TIMESYNC_MIN_INTERVAL_US){
+            int32_t drift = (int32_t)(_lastCorrection * 1000000000LL / (int64_t)interval);
+            // exponential moving average (1/4) to smooth the jitter of single syncs
+            _driftPpb = _driftValid ? _driftPpb + (drift - _driftPpb) / 4 : drift;
+            _driftValid = true;
+        }
+    }
+    _lastSyncEpoch = epochMicros;
+    _lastSyncMonotonic = monotonicMicros;
+    _syncCount++;
+}
+
+/**
+ * @brief Check if the time was synced at least once
+ *
+ * @return true if synced
+ */
+bool TimeSync::isSynced() const{
+    return _syncCount > 0;
+}
+
+/**
+ * @brief Get the number of syncs since boot
+ *
+ * @return uint32_t
+ */
+uint32_t TimeSync::getSyncCount() const{
+    return _syncCount;
+}
+
+/**
+ * @brief Get the number of syncs which stepped the clock by more than TIMESYNC_MAX_SLEW_US
+ *
+ * @return uint32_t
+ */
+uint32_t TimeSync::getStepCount() const{
+    return _stepCount;
+}
+
+/**
+ * @brief Get the time from boot to the first sync
+ *
+ * @return uint32_t milliseconds (0 if not synced yet)
+ */
+uint32_t TimeSync::getTimeToFirstSyncMillis() const{
+    return (uint32_t)(_firstSyncMonotonic / 1000);
+}
+
+/**
+ * @brief Get the system time set by the last sync
+ *
+ * @return time_t epoch seconds (0 if not synced yet)
+ */
+time_t TimeSync::getLastSyncEpoch() const{
+    return (time_t)(_lastSyncEpoch / 1000000);
+}
+
+/**
+ * @brief Get the age of the last sync
+ *
+ * @param monotonicMicros current monotonic time in microseconds since boot
+ * @return uint32_t seconds since the last sync (0 if not synced yet)
+ */
+uint32_t TimeSync::getSecondsSinceLastSync(uint64_t monotonicMicros) const{
+    if(_syncCount == 0) return 0;
+    return (uint32_t)((monotonicMicros - _lastSyncMonotonic) / 1000000);
+}
+
+/**
+ * @brief Get the correction applied by the last sync (positive if the local clock was late)
+ *
+ * @return int64_t microseconds (0 before the second sync)
+ */
+int64_t TimeSync::getLastCorrectionMicros() const{
+    return _lastCorrection;
+}
+
+/**
+ * @brief Get the smoothed drift of the local oscillator (positive if the local clock is slow)
+ *
+ * @return int32_t parts per billion (0 until a sync interval of TIMESYNC_MIN_INTERVAL_US was seen)
+ */
+int32_t TimeSync::getDriftPpb() const{
+    return _driftPpb;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file time_sync.h
+ * @brief Quality statistics of the SNTP time synchronization
+ *
+ * Every sync is recorded with the new system time and a monotonic timestamp (micros64).
+ * Between two syncs the system clock only advances with the local oscillator, so the
+ * difference between the new time and the time extrapolated from the previous sync is the
+ * correction applied by SNTP. Dividing it by the sync interval gives the drift of the oscillator.
+ *
+ */
+
+#ifndef time_sync_h
+#define time_sync_h
+
+#include <Arduino.h>
+#include <time.h>
+
+#define TIMESYNC_MAX_SLEW_US 1000000LL      // larger corrections are counted as steps (no drift update)
+#define TIMESYNC_MIN_INTERVAL_US 60000000ULL // shorter sync intervals are too noisy for a drift estimate
+
+class TimeSync{
+
+    public:
+        TimeSync();
+        void reset();
+        void recordSync(int64_t epochMicros, uint64_t monotonicMicros);
+        bool isSynced() const;
+        uint32_t getSyncCount() const;
+        uint32_t getStepCount() const;
+        uint32_t getTimeToFirstSyncMillis() const;
+        time_t getLastSyncEpoch() const;
+        uint32_t getSecondsSinceLastSync(uint64_t monotonicMicros) const;
+        int64_t getLastCorrectionMicros() const;
+        int32_t getDriftPpb() const;
+
+    private:
+        uint32_t _syncCount;
+        uint32_t _stepCount;
+        uint64_t _firstSyncMonotonic;
+        int64_t _lastSyncEpoch;
+        uint64_t _lastSyncMonotonic;
+        int64_t _lastCorrection;
+        int32_t _driftPpb;
+        bool _driftValid;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "timezone_cache.h"
+#include "rtc_time.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Get the fingerprint of a network
+ *
+ * @param ssid name of the WiFi network
+ * @param gateway IPv4 address of the gateway
+ * @param subnet IPv4 subnet mask
+ * @return uint32_t fingerprint, never 0 (0 means no network)
+ */
+uint32_t TimezoneCache::fingerprint(const char *ssid, uint32_t gateway, uint32_t subnet){
+    uint8_t data[32 + 8];
+    size_t length = strlen(ssid);
+    if(length > 32) length = 32;
+    memcpy(data, ssid, length);
+    memcpy(data + length, &gateway, 4);
+    memcpy(data + length + 4, &subnet, 4);
+    uint32_t crc = RtcTime::crc32(data, length + 8);
+    return crc != 0 ? crc : 1;
+}
+
+/**
+ * @brief Fill a record (incl. CRC)
+ *
+ * @param record
+ * @param fingerprint network the zone was resolved in
+ * @param fetchedEpoch UTC time of the request (0 if unknown)
+ * @param name IANA name (truncated to TZ_CACHE_NAME_SIZE - 1)
+ * @param posix POSIX TZ string (truncated to TZ_POSIX_SIZE - 1)
+ * @param fixedOffset true if the POSIX string is a fixed offset
+ * @param latE4 latitude in 1/10000 degree
+ * @param lonE4 longitude in 1/10000 degree
+ */
+void TimezoneCache::encode(TimezoneRecord *record, uint32_t fingerprint, uint32_t fetchedEpoch, const char *name, const char *posix, bool fixedOffset,
+                           int32_t latE4, int32_t lonE4){
+    memset(record, 0, sizeof(TimezoneRecord));
+    record->magic = TZ_CACHE_MAGIC;
+    record->version = TZ_CACHE_VERSION;
+    record->fixedOffset = fixedOffset ? 1 : 0;
+    record->fingerprint = fingerprint;
+    record->fetchedEpoch = fetchedEpoch;
+    record->latE4 = latE4;
+    record->lonE4 = lonE4;
+    size_t length = strlen(name);
+    memcpy(record->name, name, length < TZ_CACHE_NAME_SIZE ? length : TZ_CACHE_NAME_SIZE - 1);
+    length = strlen(posix);
+    memcpy(record->posix, posix, length < TZ_POSIX_SIZE ? length : TZ_POSIX_SIZE - 1);
+    record->crc = RtcTime::crc32((const uint8_t*)record, offsetof(TimezoneRecord, crc));
+}
+
+/**
+ * @brief Check a record
+ *
+ * @param record
+ * @return true if magic, version, CRC and the strings are valid
+ */
+bool TimezoneCache::decode(const TimezoneRecord *record){
+    if(record->magic != TZ_CACHE_MAGIC || record->version != TZ_CACHE_VERSION) return false;
+    if(record->crc != RtcTime::crc32((const uint8_t*)record, offsetof(TimezoneRecord, crc))) return false;
+    return record->name[TZ_CACHE_NAME_SIZE - 1] == '\0' && record->posix[TZ_POSIX_SIZE - 1] == '\0' && record->posix[0] != '\0';
+}
+
+/**
+ * @brief Check if a (valid) record can be used instead of a new request
+ *
+ * Without a network (fingerprint 0, e.g. in AP mode) the last resolved zone is the best guess
+ * and always used.
+ *
+ * @param record
+ * @param fingerprint current network
+ * @param nowEpoch current UTC time
+ * @return true if the record belongs to the network and is not outdated
+ */
+bool TimezoneCache::isUsable(const TimezoneRecord *record, uint32_t fingerprint, uint32_t nowEpoch){
+    if(fingerprint == 0) return true;
+    if(record->fingerprint != fingerprint) return false;
+    if(!record->fixedOffset) return true;
+    if(nowEpoch < TZ_CACHE_MIN_EPOCH) return true;
+    if(record->fetchedEpoch < TZ_CACHE_MIN_EPOCH || nowEpoch < record->fetchedEpoch) return false;
+    return nowEpoch - record->fetchedEpoch <= TZ_CACHE_FIXED_MAX_AGE;
+}
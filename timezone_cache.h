@@ -0,0 +1,51 @@
+/**
+ * @file timezone_cache.h
+ * @brief Binary record of the resolved timezone, stored in LittleFS so the ip-api request is
+ *        only needed on the first boot in a network
+ *
+ * The public IP can not be observed without a request, so the record is bound to a fingerprint
+ * of the local network (SSID, gateway, subnet). A different network means the clock may have
+ * moved and the timezone is resolved again. Zones which are not in the TimezoneTable are stored
+ * as a fixed UTC offset, these records are refreshed after TZ_CACHE_FIXED_MAX_AGE to follow
+ * daylight saving time. The location of the public IP is kept as well (sunrise/sunset).
+ *
+ */
+
+#ifndef timezone_cache_h
+#define timezone_cache_h
+
+#include <Arduino.h>
+#include "timezone_table.h"
+
+#define TZ_CACHE_FILE "/timezone.bin"
+#define TZ_CACHE_MAGIC 0x5A545357UL         // "WSTZ"
+#define TZ_CACHE_VERSION 1
+#define TZ_CACHE_FIXED_MAX_AGE 604800UL     // s, fixed offset records are resolved again after one week
+#define TZ_CACHE_MIN_EPOCH 1577836800UL     // 2020-01-01, earlier system time means the time is not set yet
+#define TZ_CACHE_NAME_SIZE 40
+
+struct TimezoneRecord {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t fixedOffset;            // 1 if the zone was not in the table
+    uint8_t reserved;
+    uint32_t fingerprint;           // network the zone was resolved in (see TimezoneCache::fingerprint)
+    uint32_t fetchedEpoch;          // UTC time of the request, 0 if unknown
+    int32_t latE4;                  // location of the public IP in 1/10000 degree (0/0 if unknown)
+    int32_t lonE4;
+    char name[TZ_CACHE_NAME_SIZE];  // IANA name
+    char posix[TZ_POSIX_SIZE];
+    uint32_t crc;                   // CRC32 of all fields above
+};
+
+class TimezoneCache{
+
+    public:
+        static uint32_t fingerprint(const char *ssid, uint32_t gateway, uint32_t subnet);
+        static void encode(TimezoneRecord *record, uint32_t fingerprint, uint32_t fetchedEpoch, const char *name, const char *posix, bool fixedOffset,
+                           int32_t latE4, int32_t lonE4);
+        static bool decode(const TimezoneRecord *record);
+        static bool isUsable(const TimezoneRecord *record, uint32_t fingerprint, uint32_t nowEpoch);
+};
+
+#endif
@@ -0,0 +1,375 @@
+#include "timezone_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// POSIX TZ strings, referenced by index from timezoneNames
+static const char timezonePosix[] PROGMEM =
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "EET-2EEST,M3.5.0,M10.5.0/3\0"
+    "EET-2\0"
+    "MSK-3\0"
+    "<+03>-3\0"
+    "<+04>-4\0"
+    "GMT0\0"
+    "UTC0\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "MST7\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "HST10\0"
+    "AST4ADT,M3.2.0,M11.1.0\0"
+    "NST3:30NDT,M3.2.0,M11.1.0\0"
+    "CST6\0"
+    "AST4\0"
+    "EST5\0"
+    "CST5CDT,M3.2.0/0,M11.1.0/1\0"
+    "<-05>5\0"
+    "<-04>4\0"
+    "<-03>3\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "<-02>2<-01>,M3.5.0/-1,M10.5.0/0\0"
+    "JST-9\0"
+    "KST-9\0"
+    "CST-8\0"
+    "HKT-8\0"
+    "<+08>-8\0"
+    "PST-8\0"
+    "<+07>-7\0"
+    "WIB-7\0"
+    "WITA-8\0"
+    "IST-5:30\0"
+    "<+0530>-5:30\0"
+    "<+0545>-5:45\0"
+    "<+06>-6\0"
+    "<+0630>-6:30\0"
+    "PKT-5\0"
+    "<+05>-5\0"
+    "<+0430>-4:30\0"
+    "<+0330>-3:30\0"
+    "IST-2IDT,M3.4.4/26,M10.5.0\0"
+    "EET-2EEST,M3.5.0/0,M10.5.0/0\0"
+    "EET-2EEST,M4.5.5/0,M10.5.4/24\0"
+    "SAST-2\0"
+    "CAT-2\0"
+    "WAT-1\0"
+    "EAT-3\0"
+    "CET-1\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "AEST-10\0"
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+    "ACST-9:30\0"
+    "AWST-8\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "<+12>-12\0"
+    "ChST-10\0";
+
+// IANA name, 0, index into timezonePosix (sorted by name, terminated by an empty name)
+static const char timezoneNames[] PROGMEM =
+    "Africa/Abidjan\0\x0a"
+    "Africa/Accra\0\x0a"
+    "Africa/Addis_Ababa\0\x36"
+    "Africa/Algiers\0\x37"
+    "Africa/Bamako\0\x0a"
+    "Africa/Cairo\0\x32"
+    "Africa/Ceuta\0\x00"
+    "Africa/Dakar\0\x0a"
+    "Africa/Dar_es_Salaam\0\x36"
+    "Africa/Douala\0\x35"
+    "Africa/Harare\0\x34"
+    "Africa/Johannesburg\0\x33"
+    "Africa/Kampala\0\x36"
+    "Africa/Kinshasa\0\x35"
+    "Africa/Lagos\0\x35"
+    "Africa/Luanda\0\x35"
+    "Africa/Lusaka\0\x34"
+    "Africa/Maputo\0\x34"
+    "Africa/Monrovia\0\x0a"
+    "Africa/Nairobi\0\x36"
+    "Africa/Tripoli\0\x06"
+    "Africa/Tunis\0\x37"
+    "Africa/Windhoek\0\x34"
+    "America/Anchorage\0\x11"
+    "America/Argentina/Buenos_Aires\0\x1b"
+    "America/Argentina/ComodRivadavia\0\x1b"
+    "America/Argentina/Cordoba\0\x1b"
+    "America/Bahia\0\x1b"
+    "America/Barbados\0\x16"
+    "America/Belem\0\x1b"
+    "America/Bogota\0\x19"
+    "America/Boise\0\x0e"
+    "America/Buenos_Aires\0\x1b"
+    "America/Cancun\0\x17"
+    "America/Caracas\0\x1a"
+    "America/Chicago\0\x0d"
+    "America/Costa_Rica\0\x15"
+    "America/Creston\0\x0f"
+    "America/Denver\0\x0e"
+    "America/Detroit\0\x0c"
+    "America/Edmonton\0\x0e"
+    "America/El_Salvador\0\x15"
+    "America/Fortaleza\0\x1b"
+    "America/Glace_Bay\0\x13"
+    "America/Godthab\0\x1d"
+    "America/Guatemala\0\x15"
+    "America/Guayaquil\0\x19"
+    "America/Halifax\0\x13"
+    "America/Havana\0\x18"
+    "America/Hermosillo\0\x0f"
+    "America/Indiana/Indianapolis\0\x0c"
+    "America/Indiana/Knox\0\x0d"
+    "America/Iqaluit\0\x0c"
+    "America/Jamaica\0\x17"
+    "America/Juneau\0\x11"
+    "America/Kentucky/Louisville\0\x0c"
+    "America/La_Paz\0\x1a"
+    "America/Lima\0\x19"
+    "America/Los_Angeles\0\x10"
+    "America/Managua\0\x15"
+    "America/Manaus\0\x1a"
+    "America/Martinique\0\x16"
+    "America/Matamoros\0\x0d"
+    "America/Menominee\0\x0d"
+    "America/Merida\0\x15"
+    "America/Mexico_City\0\x15"
+    "America/Moncton\0\x13"
+    "America/Monterrey\0\x15"
+    "America/Montevideo\0\x1b"
+    "America/Nassau\0\x0c"
+    "America/New_York\0\x0c"
+    "America/Nome\0\x11"
+    "America/North_Dakota/Center\0\x0d"
+    "America/Nuuk\0\x1d"
+    "America/Ojinaga\0\x0d"
+    "America/Panama\0\x17"
+    "America/Phoenix\0\x0f"
+    "America/Puerto_Rico\0\x16"
+    "America/Recife\0\x1b"
+    "America/Regina\0\x15"
+    "America/Santiago\0\x1c"
+    "America/Santo_Domingo\0\x16"
+    "America/Sao_Paulo\0\x1b"
+    "America/Sitka\0\x11"
+    "America/St_Johns\0\x14"
+    "America/Tegucigalpa\0\x15"
+    "America/Tijuana\0\x10"
+    "America/Toronto\0\x0c"
+    "America/Vancouver\0\x10"
+    "America/Winnipeg\0\x0d"
+    "Arctic/Longyearbyen\0\x00"
+    "Asia/Aden\0\x08"
+    "Asia/Almaty\0\x2d"
+    "Asia/Amman\0\x08"
+    "Asia/Baghdad\0\x08"
+    "Asia/Bahrain\0\x08"
+    "Asia/Baku\0\x09"
+    "Asia/Bangkok\0\x24"
+    "Asia/Beirut\0\x31"
+    "Asia/Bishkek\0\x2a"
+    "Asia/Brunei\0\x22"
+    "Asia/Calcutta\0\x27"
+    "Asia/Colombo\0\x28"
+    "Asia/Damascus\0\x08"
+    "Asia/Dhaka\0\x2a"
+    "Asia/Dubai\0\x09"
+    "Asia/Ho_Chi_Minh\0\x24"
+    "Asia/Hong_Kong\0\x21"
+    "Asia/Irkutsk\0\x22"
+    "Asia/Jakarta\0\x25"
+    "Asia/Jerusalem\0\x30"
+    "Asia/Kabul\0\x2e"
+    "Asia/Kamchatka\0\x3e"
+    "Asia/Karachi\0\x2c"
+    "Asia/Kathmandu\0\x29"
+    "Asia/Kolkata\0\x27"
+    "Asia/Krasnoyarsk\0\x24"
+    "Asia/Kuala_Lumpur\0\x22"
+    "Asia/Kuwait\0\x08"
+    "Asia/Macau\0\x20"
+    "Asia/Makassar\0\x26"
+    "Asia/Manila\0\x23"
+    "Asia/Muscat\0\x09"
+    "Asia/Nicosia\0\x04"
+    "Asia/Novosibirsk\0\x24"
+    "Asia/Omsk\0\x2a"
+    "Asia/Phnom_Penh\0\x24"
+    "Asia/Qatar\0\x08"
+    "Asia/Riyadh\0\x08"
+    "Asia/Saigon\0\x24"
+    "Asia/Seoul\0\x1f"
+    "Asia/Shanghai\0\x20"
+    "Asia/Singapore\0\x22"
+    "Asia/Taipei\0\x20"
+    "Asia/Tashkent\0\x2d"
+    "Asia/Tbilisi\0\x09"
+    "Asia/Tehran\0\x2f"
+    "Asia/Tel_Aviv\0\x30"
+    "Asia/Tokyo\0\x1e"
+    "Asia/Vientiane\0\x24"
+    "Asia/Yangon\0\x2b"
+    "Asia/Yekaterinburg\0\x2d"
+    "Asia/Yerevan\0\x09"
+    "Atlantic/Bermuda\0\x13"
+    "Atlantic/Canary\0\x03"
+    "Atlantic/Faroe\0\x03"
+    "Atlantic/Madeira\0\x03"
+    "Atlantic/Reykjavik\0\x0a"
+    "Australia/Adelaide\0\x3a"
+    "Australia/Brisbane\0\x39"
+    "Australia/Broken_Hill\0\x3a"
+    "Australia/Canberra\0\x38"
+    "Australia/Darwin\0\x3b"
+    "Australia/Hobart\0\x38"
+    "Australia/Melbourne\0\x38"
+    "Australia/Perth\0\x3c"
+    "Australia/Sydney\0\x38"
+    "Etc/GMT\0\x0a"
+    "Etc/UTC\0\x0b"
+    "Europe/Amsterdam\0\x00"
+    "Europe/Andorra\0\x00"
+    "Europe/Astrakhan\0\x09"
+    "Europe/Athens\0\x04"
+    "Europe/Belgrade\0\x00"
+    "Europe/Berlin\0\x00"
+    "Europe/Bratislava\0\x00"
+    "Europe/Brussels\0\x00"
+    "Europe/Bucharest\0\x04"
+    "Europe/Budapest\0\x00"
+    "Europe/Busingen\0\x00"
+    "Europe/Chisinau\0\x05"
+    "Europe/Copenhagen\0\x00"
+    "Europe/Dublin\0\x02"
+    "Europe/Gibraltar\0\x00"
+    "Europe/Guernsey\0\x01"
+    "Europe/Helsinki\0\x04"
+    "Europe/Isle_of_Man\0\x01"
+    "Europe/Istanbul\0\x08"
+    "Europe/Jersey\0\x01"
+    "Europe/Kaliningrad\0\x06"
+    "Europe/Kiev\0\x04"
+    "Europe/Kirov\0\x07"
+    "Europe/Kyiv\0\x04"
+    "Europe/Lisbon\0\x03"
+    "Europe/Ljubljana\0\x00"
+    "Europe/London\0\x01"
+    "Europe/Luxembourg\0\x00"
+    "Europe/Madrid\0\x00"
+    "Europe/Malta\0\x00"
+    "Europe/Mariehamn\0\x04"
+    "Europe/Minsk\0\x08"
+    "Europe/Monaco\0\x00"
+    "Europe/Moscow\0\x07"
+    "Europe/Nicosia\0\x04"
+    "Europe/Oslo\0\x00"
+    "Europe/Paris\0\x00"
+    "Europe/Podgorica\0\x00"
+    "Europe/Prague\0\x00"
+    "Europe/Riga\0\x04"
+    "Europe/Rome\0\x00"
+    "Europe/Samara\0\x09"
+    "Europe/San_Marino\0\x00"
+    "Europe/Sarajevo\0\x00"
+    "Europe/Saratov\0\x09"
+    "Europe/Simferopol\0\x07"
+    "Europe/Skopje\0\x00"
+    "Europe/Sofia\0\x04"
+    "Europe/Stockholm\0\x00"
+    "Europe/Tallinn\0\x04"
+    "Europe/Tirane\0\x00"
+    "Europe/Ulyanovsk\0\x09"
+    "Europe/Vaduz\0\x00"
+    "Europe/Vatican\0\x00"
+    "Europe/Vienna\0\x00"
+    "Europe/Vilnius\0\x04"
+    "Europe/Volgograd\0\x07"
+    "Europe/Warsaw\0\x00"
+    "Europe/Zagreb\0\x00"
+    "Europe/Zurich\0\x00"
+    "GMT\0\x0a"
+    "Indian/Maldives\0\x2d"
+    "Indian/Mauritius\0\x09"
+    "Pacific/Auckland\0\x3d"
+    "Pacific/Fiji\0\x3e"
+    "Pacific/Guam\0\x3f"
+    "Pacific/Honolulu\0\x12"
+    "UTC\0\x0b";
+
+/**
+ * @brief Get the POSIX TZ string of an IANA timezone
+ *
+ * @param iana name, e.g. "Europe/Berlin"
+ * @param posix buffer for the POSIX string (TZ_POSIX_SIZE), empty if not found
+ * @param size size of the buffer
+ * @return true if the zone is in the table
+ */
+bool TimezoneTable::lookup(const char *iana, char *posix, size_t size){
+    if(size == 0) return false;
+    posix[0] = '\0';
+    const char *entry = timezoneNames;
+    while(pgm_read_byte(entry) != 0){
+        // compare the name (the table is sorted, stop as soon as the name is greater)
+        uint16_t i = 0;
+        char c;
+        while((c = (char)pgm_read_byte(entry + i)) != 0 && c == iana[i]) i++;
+        int diff = (uint8_t)c - (uint8_t)iana[i];
+        if(diff > 0) return false;
+        while(pgm_read_byte(entry + i) != 0) i++;
+        if(diff == 0){
+            // find the indexed POSIX string
+            uint8_t index = pgm_read_byte(entry + i + 1);
+            const char *rule = timezonePosix;
+            while(index-- > 0){
+                while(pgm_read_byte(rule) != 0) rule++;
+                rule++;
+            }
+            size_t length = 0;
+            while(length < size - 1 && (c = (char)pgm_read_byte(rule + length)) != 0) posix[length++] = c;
+            posix[length] = '\0';
+            return true;
+        }
+        entry += i + 2;
+    }
+    return false;
+}
+
+/**
+ * @brief Get a POSIX TZ string for a fixed UTC offset
+ *
+ * @param offsetSeconds offset to UTC (positive east of Greenwich), e.g. 19800 for UTC+5:30
+ * @param posix buffer for the POSIX string (TZ_POSIX_SIZE), e.g. "<+0530>-5:30"
+ * @param size size of the buffer
+ */
+void TimezoneTable::fixedOffset(long offsetSeconds, char *posix, size_t size){
+    if(offsetSeconds == 0){
+        snprintf(posix, size, "UTC0");
+        return;
+    }
+    // POSIX counts the offset westwards, the name in <> is shown as abbreviation
+    char sign = offsetSeconds < 0 ? '-' : '+';
+    long minutes = labs(offsetSeconds) / 60;
+    int hours = (int)(minutes / 60);
+    int mins = (int)(minutes % 60);
+    if(mins == 0) snprintf(posix, size, "<%c%02d>%s%d", sign, hours, sign == '+' ? "-" : "", hours);
+    else snprintf(posix, size, "<%c%02d%02d>%s%d:%02d", sign, hours, mins, sign == '+' ? "-" : "", hours, mins);
+}
+
+/**
+ * @brief Get the number of IANA names in the table
+ *
+ * @return uint16_t
+ */
+uint16_t TimezoneTable::getZoneCount(){
+    uint16_t count = 0;
+    const char *entry = timezoneNames;
+    while(pgm_read_byte(entry) != 0){
+        while(pgm_read_byte(entry) != 0) entry++;
+        entry += 2;
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file timezone_table.h
+ * @brief Maps IANA timezone names (as sent by ip-api.com) to POSIX TZ strings for configTime()
+ *
+ * The table is stored in flash (PROGMEM). Zones with identical rules share one POSIX string,
+ * each name only stores a one byte index. Names which are not in the table can still be used
+ * with a fixed UTC offset (without daylight saving time).
+ *
+ */
+
+#ifndef timezone_table_h
+#define timezone_table_h
+
+#include <Arduino.h>
+
+#define TZ_POSIX_SIZE 48    // longest POSIX string in the table + 0
+
+class TimezoneTable{
+
+    public:
+        static bool lookup(const char *iana, char *posix, size_t size);
+        static void fixedOffset(long offsetSeconds, char *posix, size_t size);
+        static uint16_t getZoneCount();
+};
+
+#endif
@@ -1,10 +1,44 @@
 #include <ESP8266HTTPClient.h>
 #include "udplogger.h"
+#include "ip_api_parser.h"
+#include "timezone_cache.h"
+
+#define IPAPI_READ_TIMEOUT 5000   // ms without data before the response is abandoned
 
 int api_offset = 0;
 String api_timezone = "";
 float api_lat = 0.0;
 float api_lon = 0.0;
+const char* tzSource = "default";   // where TZ_INFO comes from: default, cache or api
+
+/**
+ * @brief Parse the response body while it is received, without buffering it in a String
+ * 
+ * @param http HTTPClient after a successful GET
+ * @param parser parser for the body (finished here)
+ */
+void readAPIResponse(HTTPClient &http, IpApiParser &parser) {
+  WiFiClient *stream = http.getStreamPtr();
+  int remaining = http.getSize();   // -1 if the server did not send a Content-Length
+  char buffer[IPAPI_CHUNK_SIZE];
+  unsigned long lastData = millis();
+  while (stream != nullptr && remaining != 0 && !parser.isDone() && !parser.hasError()) {
+    int available = stream->available();
+    if (available <= 0) {
+      if (!stream->connected() || millis() - lastData > IPAPI_READ_TIMEOUT) break;
+      delay(1);
+      continue;
+    }
+    size_t wanted = available < IPAPI_CHUNK_SIZE ? available : IPAPI_CHUNK_SIZE;
+    if (remaining > 0 && (size_t)remaining < wanted) wanted = remaining;
+    int length = stream->read((uint8_t*)buffer, wanted);
+    if (length <= 0) continue;
+    lastData = millis();
+    if (remaining > 0) remaining -= length;
+    parser.feed(buffer, length);
+  }
+  parser.finish();
+}
 
 /**
  * @brief Request the timezone and other data from the IP-API
@@ -16,81 +50,163 @@ bool requestAPIData(UDPLogger &logger) {
   WiFiClient client;
   HTTPClient http;
   bool res = false;
-  logger.logString("[HTTP] Requesting timezone from IP-API");
+  if (!network.mayAttempt(ne_ipapi, millis())) {
+    LOG_INFO(logger, "[HTTP] IP-API request postponed (backoff)");
+    return false;
+  }
+  unsigned long requestStart = millis();
+  LOG_INFO(logger, "[HTTP] Requesting timezone from IP-API");
   // see API documentation on https://ip-api.com/docs/api:json to see which fields are available
   if (http.begin(client, "http://ip-api.com/json/?fields=status,message,country,countryCode,region,regionName,city,zip,lat,lon,timezone,offset,query")) { 
+    http.useHTTP10(true); // no chunked transfer encoding, the body is read from the stream
     int httpCode = http.GET();
 
     if (httpCode > 0) { 
       if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY) {
-        String payload = http.getString();
-
-        api_timezone = getJsonParameterValue(payload, "timezone", true);
-        logger.logString("[HTTP] Received timezone: " + api_timezone);
-
-        String offsetString = getJsonParameterValue(payload, "offset", false);
-        api_offset = offsetString.toInt() / 60;
-        logger.logString("[HTTP] Received offset (min): " + String(api_offset));
-
-        String latString = getJsonParameterValue(payload, "lat", false);
-        api_lat = latString.toFloat();
-        logger.logString("[HTTP] Received latitude: " + String(api_lat));
+        IpApiParser parser;
+        readAPIResponse(http, parser);
+        if (parser.isSuccess()) {
+          api_timezone = parser.getTimezone();
+          LOG_INFO(logger, "[HTTP] Received timezone: " + api_timezone);
 
-        String lonString = getJsonParameterValue(payload, "lon", false);
-        api_lon = lonString.toFloat();
-        logger.logString("[HTTP] Received longitude: " + String(api_lon));
+          api_offset = parser.getOffset() / 60;
+          LOG_INFO(logger, "[HTTP] Received offset (min): " + String(api_offset));
 
-        res = true; // Successfully parsed API response
+          if (parser.hasLocation()) {
+            api_lat = parser.getLatitude();
+            api_lon = parser.getLongitude();
+            LOG_INFO(logger, "[HTTP] Received location: " + String(api_lat) + ", " + String(api_lon));
+          }
 
+          res = true; // Successfully parsed API response
+        }
+        else {
+          LOG_WARN(logger, "[HTTP] Invalid IP-API response");
+        }
       }
     } 
     else {
-      Serial.printf("[HTTP] GET... failed, error: %s\n", http.errorToString(httpCode).c_str());
+      LOG_WARN(logger, "[HTTP] GET... failed, error: %s", http.errorToString(httpCode).c_str());
       res = false;
     }
     http.end(); // Close connection
   }
   else {
-    logger.logString("[HTTP] Unable to connect");
+    LOG_WARN(logger, "[HTTP] Unable to connect");
     res = false;
   }
+  // the request blocks the loop until the response is received
+  network.recordBlocking(millis() - requestStart);
+  if (res) network.reportSuccess(ne_ipapi, millis());
+  else network.reportFailure(ne_ipapi, millis());
   return res;
 }
 
 /**
- * @brief Get the Json Parameter Value object
+ * @brief Get the fingerprint of the connected WiFi network
  * 
- * @param json 
- * @param parameter 
- * @return String 
+ * @return uint32_t fingerprint, 0 if not connected
  */
-String getJsonParameterValue(String json, String parameter, bool isString) {
-  String value = "";
-  if(isString) {
-    int index = json.indexOf("\"" + parameter + "\":\"");
-    if (index != -1) {
-      int start = index + parameter.length() + 4; 
-      int end = json.indexOf("\"", start);
-      value = json.substring(start, end);
-    }
+uint32_t getNetworkFingerprint() {
+  if (WiFi.status() != WL_CONNECTED) {
+    return 0;
   }
-  else {
-    int index = json.indexOf("\"" + parameter + "\":");
-    if (index != -1) {
-      int start = index + parameter.length() + 3; 
-      int end = json.indexOf(",", start);
-      value = json.substring(start, end);
-    }
+  return TimezoneCache::fingerprint(WiFi.SSID().c_str(), (uint32_t)WiFi.gatewayIP(), (uint32_t)WiFi.subnetMask());
+}
+
+/**
+ * @brief Set TZ_INFO and the location from the timezone record in LittleFS
+ * 
+ * @param fingerprint fingerprint of the current network (0 if not connected)
+ * @return bool true if the record was valid and usable
+ */
+bool loadTimezoneFromCache(uint32_t fingerprint) {
+  if (!LittleFS.exists(TZ_CACHE_FILE)) {
+    return false;
+  }
+  File file = LittleFS.open(TZ_CACHE_FILE, "r");
+  if (!file) {
+    return false;
+  }
+  TimezoneRecord record;
+  bool complete = file.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+  file.close();
+  if (!complete || !TimezoneCache::decode(&record) || !TimezoneCache::isUsable(&record, fingerprint, time(nullptr))) {
+    return false;
+  }
+  strcpy(TZ_INFO, record.posix);
+  api_timezone = record.name;
+  if (record.latE4 != 0 || record.lonE4 != 0) {
+    api_lat = record.latE4 / 10000.0;
+    api_lon = record.lonE4 / 10000.0;
   }
-  return value;
+  return true;
 }
 
 /**
- * @brief Update the UTC offset from the timezone string obtained from the IP-API
+ * @brief Resolve the timezone: from LittleFS if it was resolved in this network before,
+ *        otherwise from the IP-API (stored for the next boots). Sets TZ_INFO and applies it.
  * 
  * @param logger UDPLogger object to log messages
  */
-void updateUTCOffsetFromTimezoneAPI(UDPLogger &logger) {
-  requestAPIData(logger);
-  // This function is currently retired in favor of configTime(TZ_INFO)
+void resolveTimezone(UDPLogger &logger) {
+  uint32_t fingerprint = getNetworkFingerprint();
+  if (loadTimezoneFromCache(fingerprint)) {
+    tzSource = "cache";
+  }
+  else if (fingerprint != 0 && requestAPIData(logger)) {
+    bool fixedOffset = !TimezoneTable::lookup(api_timezone.c_str(), TZ_INFO, TZ_POSIX_SIZE);
+    if (fixedOffset) {
+      // unknown zone: at least the current offset is right
+      TimezoneTable::fixedOffset((long)api_offset * 60, TZ_INFO, TZ_POSIX_SIZE);
+    }
+    TimezoneRecord record;
+    TimezoneCache::encode(&record, fingerprint, (uint32_t)time(nullptr), api_timezone.c_str(), TZ_INFO, fixedOffset,
+                          (int32_t)lroundf(api_lat * 10000), (int32_t)lroundf(api_lon * 10000));
+    File file = LittleFS.open(TZ_CACHE_FILE, "w");
+    if (file) {
+      file.write((const uint8_t*)&record, sizeof(record));
+      file.close();
+    }
+    tzSource = "api";
+  }
+  setenv("TZ", TZ_INFO, 1);
+  tzset();
+  LOG_INFO(logger, "Timezone (" + String(tzSource) + "): " + api_timezone + " -> " + String(TZ_INFO));
+}
+
+/**
+ * @brief Get the source of the timezone for the webserver
+ * 
+ * @return const char* default, cache or api
+ */
+const char* getTimezoneSource() {
+  return tzSource;
+}
+
+/**
+ * @brief Get the IANA name of the timezone (empty if the default is used)
+ * 
+ * @return String
+ */
+String getTimezoneName() {
+  return api_timezone;
+}
+
+/**
+ * @brief Get the location for sunrise/sunset calculations.
+ *        Uses the coordinates from the IP-API if available, otherwise the default location.
+ * 
+ * @param latE4 latitude in 1/10000 degree
+ * @param lonE4 longitude in 1/10000 degree
+ */
+void getLocationE4(int32_t* latE4, int32_t* lonE4) {
+  if (api_lat != 0.0 || api_lon != 0.0) {
+    *latE4 = (int32_t)lroundf(api_lat * 10000);
+    *lonE4 = (int32_t)lroundf(api_lon * 10000);
+  }
+  else {
+    *latE4 = LOCATION_LATITUDE_E4;
+    *lonE4 = LOCATION_LONGITUDE_E4;
+  }
 }
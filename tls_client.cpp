@@ -0,0 +1,63 @@
+#include "tls_client.h"
+
+/**
+ * @brief Construct a new TlsSessionClient object (no session, MFLN support unknown)
+ *
+ */
+TlsSessionClient::TlsSessionClient(){
+}
+
+/**
+ * @brief Connect to the server, resuming the stored session if possible
+ *
+ * @param host hostname (also used for SNI)
+ * @param port server port
+ * @return int 1 on success, 0 on failure
+ */
+int TlsSessionClient::connect(const char *host, uint16_t port){
+    if(_policy.needsMflnProbe()){
+        _policy.setMflnSupported(BearSSL::WiFiClientSecure::probeMaxFragmentLength(host, port, TLS_CLIENT_RX_BUFFER));
+        Serial.printf("TLS: %s MFLN %d: %s\n", host, TLS_CLIENT_RX_BUFFER, _policy.useSmallBuffers() ? "supported" : "not supported");
+    }
+    if(_policy.useSmallBuffers()){
+        setBufferSizes(TLS_CLIENT_RX_BUFFER, TLS_CLIENT_TX_BUFFER);
+    }
+    setSession(&_session);
+
+    br_ssl_session_parameters *params = _session.getSession();
+    _policy.beginConnect(params->session_id, params->session_id_len, ESP.getFreeHeap());
+    int result = BearSSL::WiFiClientSecure::connect(host, port);
+    if(!_policy.endConnect(result, params->session_id, params->session_id_len, ESP.getFreeHeap())){
+        char error[64] = "";
+        int code = getLastSSLError(error, sizeof(error));
+        Serial.printf("TLS: connect to %s failed after %u ms (%d: %s)\n", host, _policy.getLastConnectMillis(), code, error);
+        invalidateSession();
+    }
+    return result;
+}
+
+/**
+ * @brief Forget the stored session, the next connect does a full handshake
+ *
+ */
+void TlsSessionClient::invalidateSession(){
+    _session = BearSSL::Session();
+}
+
+/**
+ * @brief Get the result of the MFLN probe
+ *
+ * @return int8_t 1 supported, 0 not supported, -1 not probed yet
+ */
+int8_t TlsSessionClient::getMflnStatus() const{
+    return _policy.getMflnStatus();
+}
+
+/**
+ * @brief Get the connect statistics
+ *
+ * @return ConnectionStats&
+ */
+ConnectionStats& TlsSessionClient::getStats(){
+    return _policy.getStats();
+}
@@ -0,0 +1,37 @@
+/**
+ * @file tls_client.h
+ * @brief WiFiClientSecure which keeps its TLS session and negotiates small buffers
+ *
+ * The BearSSL session of the last connection is kept, so the next connect to the same server
+ * can resume it with an abbreviated handshake (no key exchange). On the first connect the
+ * server is probed once for Maximum Fragment Length Negotiation; if it is supported the
+ * receive/transmit buffers are reduced from 16 KB to TLS_CLIENT_RX_BUFFER/TLS_CLIENT_TX_BUFFER.
+ * The decisions and the ConnectionStats are in TlsSessionPolicy (tested on the host), this
+ * class only connects them to BearSSL.
+ *
+ */
+
+#ifndef tls_client_h
+#define tls_client_h
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <WiFiClientSecure.h>
+#include "tls_session_policy.h"
+
+class TlsSessionClient : public BearSSL::WiFiClientSecure{
+
+    public:
+        TlsSessionClient();
+        int connect(const char *host, uint16_t port) override;
+        using BearSSL::WiFiClientSecure::connect;
+        void invalidateSession();
+        int8_t getMflnStatus() const;
+        ConnectionStats& getStats();
+
+    private:
+        BearSSL::Session _session;
+        TlsSessionPolicy _policy;
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include "tls_session_policy.h"
+#include <string.h>
+
+/**
+ * @brief Construct a new TlsSessionPolicy object (no session, MFLN support unknown)
+ *
+ */
+TlsSessionPolicy::TlsSessionPolicy(){
+    _mflnStatus = -1;
+    _sessionIdLength = 0;
+    _connectStart = 0;
+    _heapBefore = 0;
+    _lastConnectMillis = 0;
+}
+
+/**
+ * @brief Check if the server has to be probed for MFLN before the connect
+ *
+ * @return true if it was not probed yet
+ */
+bool TlsSessionPolicy::needsMflnProbe() const{
+    return _mflnStatus < 0;
+}
+
+/**
+ * @brief Store the result of the MFLN probe
+ *
+ * @param supported true if the server accepted TLS_CLIENT_RX_BUFFER as max fragment length
+ */
+void TlsSessionPolicy::setMflnSupported(bool supported){
+    _mflnStatus = supported ? 1 : 0;
+}
+
+/**
+ * @brief Get the result of the MFLN probe
+ *
+ * @return int8_t 1 supported, 0 not supported, -1 not probed yet
+ */
+int8_t TlsSessionPolicy::getMflnStatus() const{
+    return _mflnStatus;
+}
+
+/**
+ * @brief Check if the buffers can be reduced to TLS_CLIENT_RX_BUFFER/TLS_CLIENT_TX_BUFFER
+ *
+ * @return true if the server supports MFLN
+ */
+bool TlsSessionPolicy::useSmallBuffers() const{
+    return _mflnStatus == 1;
+}
+
+/**
+ * @brief Remember the stored session and the heap right before the handshake
+ *
+ * @param sessionId id of the stored session
+ * @param sessionIdLength length of the id, 0 without session
+ * @param freeHeap free heap before the connect
+ */
+void TlsSessionPolicy::beginConnect(const uint8_t *sessionId, uint8_t sessionIdLength, uint32_t freeHeap){
+    _sessionIdLength = sessionIdLength <= TLS_SESSION_ID_SIZE ? sessionIdLength : 0;
+    memcpy(_sessionId, sessionId, _sessionIdLength);
+    _heapBefore = freeHeap;
+    _connectStart = millis();
+}
+
+/**
+ * @brief Record the connect and decide about the stored session
+ *
+ * @param success true if the connection (incl. handshake) was established
+ * @param sessionId id of the session after the handshake
+ * @param sessionIdLength length of the id
+ * @param freeHeap free heap after the connect
+ * @return true if the session is kept, false if the caller has to drop it (failed connect)
+ */
+bool TlsSessionPolicy::endConnect(bool success, const uint8_t *sessionId, uint8_t sessionIdLength, uint32_t freeHeap){
+    _lastConnectMillis = millis() - _connectStart;
+    // the server accepted the resumption if the session id is unchanged after the handshake
+    bool resumed = success && _sessionIdLength > 0 && sessionIdLength == _sessionIdLength
+                   && memcmp(_sessionId, sessionId, _sessionIdLength) == 0;
+    _stats.recordConnect(success, resumed, _lastConnectMillis, _heapBefore, freeHeap);
+    return success;
+}
+
+/**
+ * @brief Get the duration of the last connect (also of a failed one)
+ *
+ * @return uint32_t ms
+ */
+uint32_t TlsSessionPolicy::getLastConnectMillis() const{
+    return _lastConnectMillis;
+}
+
+/**
+ * @brief Get the connect statistics
+ *
+ * @return ConnectionStats&
+ */
+ConnectionStats& TlsSessionPolicy::getStats(){
+    return _stats;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file tls_session_policy.h
+ * @brief Session and buffer policy of TlsSessionClient, independent of BearSSL
+ *
+ * Decides when the server is probed for Maximum Fragment Length Negotiation (once, the answer
+ * of the server does not change) and whether the small buffers are used. Around every connect
+ * it compares the session id before and after the handshake: the server accepted the
+ * resumption if the id is unchanged. A failed connect drops the stored session. Duration and
+ * heap of every connect are recorded in ConnectionStats.
+ *
+ * The TLS library only passes the session id and the free heap, so the policy runs on the host.
+ *
+ */
+
+#ifndef tls_session_policy_h
+#define tls_session_policy_h
+
+#include <Arduino.h>
+#include "connection_stats.h"
+
+#define TLS_CLIENT_RX_BUFFER 1024   // max fragment length requested from the server
+#define TLS_CLIENT_TX_BUFFER 512    // requests are short
+#define TLS_SESSION_ID_SIZE 32      // longest TLS session id
+
+class TlsSessionPolicy{
+
+    public:
+        TlsSessionPolicy();
+        bool needsMflnProbe() const;
+        void setMflnSupported(bool supported);
+        int8_t getMflnStatus() const;
+        bool useSmallBuffers() const;
+        void beginConnect(const uint8_t *sessionId, uint8_t sessionIdLength, uint32_t freeHeap);
+        bool endConnect(bool success, const uint8_t *sessionId, uint8_t sessionIdLength, uint32_t freeHeap);
+        uint32_t getLastConnectMillis() const;
+        ConnectionStats& getStats();
+
+    private:
+        int8_t _mflnStatus;
+        uint8_t _sessionId[TLS_SESSION_ID_SIZE];
+        uint8_t _sessionIdLength;
+        unsigned long _connectStart;
+        uint32_t _heapBefore;
+        uint32_t _lastConnectMillis;
+        ConnectionStats _stats;
+};
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file ddp_sender.cpp
+ * @brief Stream an animation to a clock via DDP and measure the frame rate it shows
+ *
+ * Usage: ddp_sender <clock ip> [fps] [seconds] [width] [height]
+ *
+ * Sends a moving rainbow with a constant frame rate (one packet with push flag per frame), then
+ * compares the frames counted by the clock (/data?key=stream) with the frames sent.
+ *
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ddp_receiver.h"
+
+/**
+ * @brief Read a value of the flat JSON object of /data?key=stream
+ *
+ * @param json response
+ * @param key name of the value
+ * @return long value, -1 if missing
+ */
+static long jsonValue(const std::string &json, const char *key){
+    std::string pattern = std::string("\"") + key + "\":\"";
+    size_t pos = json.find(pattern);
+    if(pos == std::string::npos) return -1;
+    return atol(json.c_str() + pos + pattern.size());
+}
+
+/**
+ * @brief Get the stream statistics of the clock
+ *
+ * @param ip address of the clock
+ * @return std::string JSON, empty on error
+ */
+static std::string fetchStats(const char *ip){
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    if(sock < 0) return "";
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(80);
+    inet_pton(AF_INET, ip, &addr.sin_addr);
+    timeval timeout = {3, 0};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    std::string response;
+    if(connect(sock, (sockaddr*)&addr, sizeof(addr)) == 0){
+        std::string request = std::string("GET /data?key=stream HTTP/1.0\r\nHost: ") + ip + "\r\n\r\n";
+        send(sock, request.data(), request.size(), 0);
+        char buffer[512];
+        ssize_t length;
+        while((length = recv(sock, buffer, sizeof(buffer), 0)) > 0) response.append(buffer, length);
+    }
+    close(sock);
+    size_t body = response.find("\r\n\r\n");
+    return body == std::string::npos ? "" : response.substr(body + 4);
+}
+
+/**
+ * @brief Convert a position on the color wheel to a color
+ *
+ * @param position 0..1
+ * @param rgb 3 bytes
+ */
+static void wheel(double position, uint8_t *rgb){
+    for(int i = 0; i < 3; i++){
+        double value = std::cos((position - i / 3.0) * 2 * M_PI);
+        rgb[i] = value > 0 ? (uint8_t)(value * 255) : 0;
+    }
+}
+
+int main(int argc, char **argv){
+    if(argc < 2){
+        fprintf(stderr, "usage: %s <clock ip> [fps] [seconds] [width] [height]\n", argv[0]);
+        return 2;
+    }
+    const char *ip = argv[1];
+    double fps = argc > 2 ? atof(argv[2]) : 40;
+    double seconds = argc > 3 ? atof(argv[3]) : 10;
+    int width = argc > 4 ? atoi(argv[4]) : 11;
+    int height = argc > 5 ? atoi(argv[5]) : 11;
+    if(fps <= 0 || seconds <= 0 || width <= 0 || height <= 0 || width * height * 3 > 1440){
+        fprintf(stderr, "invalid arguments\n");
+        return 2;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if(sock < 0){
+        perror("socket");
+        return 1;
+    }
+    sockaddr_in clock = {};
+    clock.sin_family = AF_INET;
+    clock.sin_port = htons(DDP_PORT);
+    if(inet_pton(AF_INET, ip, &clock.sin_addr) != 1){
+        fprintf(stderr, "invalid ip address %s\n", ip);
+        return 2;
+    }
+
+    std::string before = fetchStats(ip);
+    if(before.empty()) fprintf(stderr, "no statistics from http://%s/data?key=stream, sending anyway\n", ip);
+
+    uint16_t dataLength = width * height * 3;
+    std::vector<uint8_t> packet(DDP_HEADER_SIZE + dataLength);
+    long frames = lround(fps * seconds);
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / fps));
+    auto start = std::chrono::steady_clock::now();
+    auto next = start;
+    uint8_t sequence = 0;
+    for(long frame = 0; frame < frames; frame++){
+        sequence = sequence % 15 + 1;
+        DdpReceiver::writeHeader(packet.data(), DDP_FLAG_PUSH, sequence, 0, dataLength);
+        for(int i = 0; i < width * height; i++){
+            int x = i % width, y = i / width;
+            wheel((double)(x + y) / (width + height) + frame / (fps * 4), packet.data() + DDP_HEADER_SIZE + i * 3);
+        }
+        sendto(sock, packet.data(), packet.size(), 0, (sockaddr*)&clock, sizeof(clock));
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    close(sock);
+    printf("sent %ld frames in %.2f s: %.1f fps\n", frames, elapsed, frames / elapsed);
+
+    // the clock shows the frame rate of the last second while the stream is running, so only the counters are compared
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::string after = fetchStats(ip);
+    if(before.empty() || after.empty()) return 0;
+    long shown = jsonValue(after, "ddpFrames") - jsonValue(before, "ddpFrames");
+    long lost = jsonValue(after, "ddpLost") - jsonValue(before, "ddpLost");
+    long late = jsonValue(after, "ddpLate") - jsonValue(before, "ddpLate");
+    long invalid = jsonValue(after, "ddpInvalid") - jsonValue(before, "ddpInvalid");
+    printf("clock: %ld frames shown (%.1f%%), %.1f fps, %ld lost, %ld late, %ld invalid\n",
+           shown, 100.0 * shown / frames, shown / elapsed, lost, late, invalid);
+    return shown >= frames * 95 / 100 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+#include "telemetry_aggregator.h"
+
+/**
+ * @brief Construct a new empty TelemetryAggregator object
+ *
+ */
+TelemetryAggregator::TelemetryAggregator(){
+    _invalid = 0;
+}
+
+/**
+ * @brief Decode a datagram and update the entry of its clock
+ *
+ * @param data datagram
+ * @param length length of the datagram
+ * @param address IPv4 of the sender
+ * @param now host time (s)
+ * @return true if the datagram was a valid telemetry frame (text log lines return false)
+ */
+bool TelemetryAggregator::add(const uint8_t *data, size_t length, uint32_t address, uint64_t now){
+    TelemetryFrame frame;
+    if(!Telemetry::decode(data, length, &frame)){
+        if(length >= 4 && data[0] == 'W' && data[1] == 'C' && data[2] == 'T' && data[3] == 'M') _invalid++;
+        return false;
+    }
+    TelemetryDevice *device = nullptr;
+    for(TelemetryDevice &entry : _devices){
+        if(entry.chipId == frame.chipId) device = &entry;
+    }
+    if(device == nullptr){
+        TelemetryDevice entry = {};
+        entry.chipId = frame.chipId;
+        entry.minFreeHeap = frame.freeHeap;
+        _devices.push_back(entry);
+        device = &_devices.back();
+    }
+    else if(frame.sequence <= device->last.sequence || frame.uptimeSeconds < device->last.uptimeSeconds){
+        // sequence restarted: the clock rebooted
+        device->restarts++;
+    }
+    else{
+        device->lost += frame.sequence - device->last.sequence - 1;
+    }
+    device->address = address;
+    device->last = frame;
+    device->received++;
+    device->lastSeen = now;
+    if(frame.freeHeap < device->minFreeHeap) device->minFreeHeap = frame.freeHeap;
+    if(frame.loopP99 > device->maxLoopP99) device->maxLoopP99 = frame.loopP99;
+    if(frame.loopMax > device->maxLoopMax) device->maxLoopMax = frame.loopMax;
+    return true;
+}
+
+/**
+ * @brief Get the number of clocks seen
+ *
+ * @return size_t
+ */
+size_t TelemetryAggregator::getDeviceCount() const{
+    return _devices.size();
+}
+
+/**
+ * @brief Get the entry of a clock
+ *
+ * @param index 0 ... getDeviceCount() - 1
+ * @return const TelemetryDevice*
+ */
+const TelemetryDevice* TelemetryAggregator::getDevice(size_t index) const{
+    return index < _devices.size() ? &_devices[index] : nullptr;
+}
+
+/**
+ * @brief Find the entry of a clock by its chip id
+ *
+ * @param chipId
+ * @return const TelemetryDevice* nullptr if not seen
+ */
+const TelemetryDevice* TelemetryAggregator::findDevice(uint32_t chipId) const{
+    for(const TelemetryDevice &entry : _devices){
+        if(entry.chipId == chipId) return &entry;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Get the number of datagrams with the telemetry magic which failed the checks
+ *
+ * @return uint32_t
+ */
+uint32_t TelemetryAggregator::getInvalidCount() const{
+    return _invalid;
+}
+
+/**
+ * @brief Print one line per clock
+ *
+ * @param out e.g. stdout
+ * @param now host time (s)
+ */
+void TelemetryAggregator::print(FILE *out, uint64_t now) const{
+    fprintf(out, "%-8s %-15s %8s %5s %5s %4s %4s %7s %7s %4s %6s %6s %8s %5s %4s %6s\n",
+            "chip", "address", "uptime", "lost", "rest", "rssi", "st", "heap", "minheap", "frag",
+            "p50us", "p99us", "maxus", "fps", "reco", "age");
+    for(const TelemetryDevice &entry : _devices){
+        const TelemetryFrame &f = entry.last;
+        char address[16];
+        snprintf(address, sizeof(address), "%u.%u.%u.%u", (unsigned)(entry.address & 0xFF), (unsigned)((entry.address >> 8) & 0xFF),
+                 (unsigned)((entry.address >> 16) & 0xFF), (unsigned)(entry.address >> 24));
+        fprintf(out, "%08X %-15s %8u %5u %5u %4d %4u %7u %7u %4u %6u %6u %8u %3u.%u %4u %6llu\n",
+                (unsigned)entry.chipId, address, (unsigned)f.uptimeSeconds, (unsigned)entry.lost, (unsigned)entry.restarts,
+                f.rssi, (unsigned)f.state, (unsigned)f.freeHeap, (unsigned)entry.minFreeHeap, (unsigned)f.heapFragmentation,
+                (unsigned)f.loopP50, (unsigned)f.loopP99, (unsigned)entry.maxLoopMax, f.fpsX10 / 10, f.fpsX10 % 10,
+                (unsigned)f.reconnects, (unsigned long long)(now - entry.lastSeen));
+    }
+}
@@ -0,0 +1,47 @@
+/**
+ * @file telemetry_aggregator.h
+ * @brief Host side: collect the telemetry frames of all clocks on the multicast group
+ *
+ * One entry per clock (chip id) with the last frame, the number of received and lost frames
+ * (gaps in the sequence), restarts (sequence started again) and the worst values seen.
+ *
+ */
+
+#ifndef telemetry_aggregator_h
+#define telemetry_aggregator_h
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "telemetry.h"
+
+struct TelemetryDevice {
+    uint32_t chipId;
+    uint32_t address;           // IPv4 of the sender (network byte order)
+    TelemetryFrame last;
+    uint32_t received;
+    uint32_t lost;
+    uint32_t restarts;
+    uint32_t minFreeHeap;
+    uint32_t maxLoopP99;
+    uint32_t maxLoopMax;
+    uint64_t lastSeen;          // host time of the last frame (s)
+};
+
+class TelemetryAggregator{
+
+    public:
+        TelemetryAggregator();
+        bool add(const uint8_t *data, size_t length, uint32_t address, uint64_t now);
+        size_t getDeviceCount() const;
+        const TelemetryDevice* getDevice(size_t index) const;
+        const TelemetryDevice* findDevice(uint32_t chipId) const;
+        uint32_t getInvalidCount() const;
+        void print(FILE *out, uint64_t now) const;
+
+    private:
+        std::vector<TelemetryDevice> _devices;
+        uint32_t _invalid;
+};
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file telemetry_tool.cpp
+ * @brief Receive the telemetry frames of all clocks on the multicast group and print a summary
+ *
+ * Usage: telemetry_tool <interface ip> [interval s] [group] [port]
+ * Text log lines on the same group are ignored (see multicastUDP_receiver.py for those).
+ *
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include "telemetry_aggregator.h"
+
+int main(int argc, char **argv){
+    if(argc < 2){
+        fprintf(stderr, "usage: %s <interface ip> [interval s] [group] [port]\n", argv[0]);
+        return 2;
+    }
+    const char *interfaceIp = argv[1];
+    int interval = argc > 2 ? atoi(argv[2]) : 10;
+    const char *group = argc > 3 ? argv[3] : "230.120.10.2";
+    int port = argc > 4 ? atoi(argv[4]) : 8123;
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if(sock < 0){
+        perror("socket");
+        return 1;
+    }
+    int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if(bind(sock, (sockaddr*)&local, sizeof(local)) < 0){
+        perror("bind");
+        return 1;
+    }
+    ip_mreq membership = {};
+    membership.imr_multiaddr.s_addr = inet_addr(group);
+    membership.imr_interface.s_addr = inet_addr(interfaceIp);
+    if(setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0){
+        perror("IP_ADD_MEMBERSHIP");
+        return 1;
+    }
+    // wake up for the summary even if no clock sends
+    timeval timeout = {1, 0};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    TelemetryAggregator aggregator;
+    uint8_t buffer[2048];
+    time_t lastPrint = time(nullptr);
+    while(true){
+        sockaddr_in sender = {};
+        socklen_t senderLength = sizeof(sender);
+        ssize_t length = recvfrom(sock, buffer, sizeof(buffer), 0, (sockaddr*)&sender, &senderLength);
+        time_t now = time(nullptr);
+        if(length > 0){
+            aggregator.add(buffer, length, sender.sin_addr.s_addr, now);
+        }
+        if(now - lastPrint >= interval){
+            aggregator.print(stdout, now);
+            fprintf(stdout, "\n");
+            fflush(stdout);
+            lastPrint = now;
+        }
+    }
+}
@@ -1,54 +1,151 @@
 #include "udplogger.h"
 #include <ESP8266WiFi.h>
+#include <strings.h>
 
 UDPLogger::UDPLogger(){
-
+    _port = 0;
+    _lastFlush = 0;
+    _level = LOG_LEVEL_DEFAULT;
+    _mirror = nullptr;
+    setName("Log");
 }
 
 UDPLogger::UDPLogger(IPAddress interfaceAddr, IPAddress multicastAddr, int port){
+    _lastFlush = 0;
+    _level = LOG_LEVEL_DEFAULT;
+    _mirror = nullptr;
+    setName("Log");
+    begin(interfaceAddr, multicastAddr, port);
+}
+
+void UDPLogger::begin(IPAddress interfaceAddr, IPAddress multicastAddr, int port){
     _multicastAddr = multicastAddr;
     _port = port;
     _interfaceAddr = interfaceAddr;
-    _name = "Log";
     _Udp.beginMulticast(_interfaceAddr, _multicastAddr, _port);
 }
 
 void UDPLogger::setName(String name){
-    _name = name;
+    snprintf(_prefix, sizeof(_prefix), "%s: ", name.c_str());
+}
+
+void UDPLogger::logString(const String &logmessage){
+    logBuffer(logmessage.c_str(), logmessage.length());
+}
+
+void UDPLogger::logString(const char *logmessage){
+    logBuffer(logmessage, strlen(logmessage));
+}
+
+void UDPLogger::logLevel(uint8_t level, const String &logmessage){
+    (void)level;
+    logBuffer(logmessage.c_str(), logmessage.length());
+}
+
+void UDPLogger::logLevel(uint8_t level, const char *format, ...){
+    (void)level;
+    va_list arg;
+    va_start(arg, format);
+    logVprintf(format, arg);
+    va_end(arg);
 }
 
-void UDPLogger::logString(String logmessage){
-    // wait 5 milliseconds if last send was less than 5 milliseconds before 
-    if(millis() < (_lastSend + 5)){
-        delay(5);
+void UDPLogger::setLevel(uint8_t level){
+    // levels above LOG_LEVEL are not compiled in
+    _level = level < LOG_LEVEL ? level : LOG_LEVEL;
+}
+
+uint8_t UDPLogger::getLevel() const{
+    return _level;
+}
+
+const char* UDPLogger::getLevelName(uint8_t level){
+    switch(level){
+        case LOG_LEVEL_NONE: return "none";
+        case LOG_LEVEL_ERROR: return "error";
+        case LOG_LEVEL_WARN: return "warn";
+        case LOG_LEVEL_INFO: return "info";
+        case LOG_LEVEL_DEBUG: return "debug";
+        case LOG_LEVEL_TRACE: return "trace";
     }
-    logmessage = _name + ": " + logmessage;
-    Serial.println(logmessage);
+    return "unknown";
+}
 
-    // If WiFi is not connected, skip UDP multicast to avoid blocking/failures
-    if (WiFi.status() != WL_CONNECTED) {
-        _lastSend = millis();
-        return;
+bool UDPLogger::parseLevel(const char *text, uint8_t *level){
+    // a single digit 0 (none) ... 5 (trace) or the name of a level, anything else is rejected
+    if(text[0] >= '0' && text[0] <= '0' + LOG_LEVEL_TRACE && text[1] == '\0'){
+        *level = text[0] - '0';
+        return true;
+    }
+    for(uint8_t i = LOG_LEVEL_NONE; i <= LOG_LEVEL_TRACE; i++){
+        if(strcasecmp(text, getLevelName(i)) == 0){
+            *level = i;
+            return true;
+        }
     }
+    return false;
+}
 
-    // If interface address is 0.0.0.0, skip
-    if (_interfaceAddr == IPAddress(0,0,0,0)) {
-        _lastSend = millis();
-        return;
+void UDPLogger::logBuffer(const char *message, size_t length){
+    // only a copy into the ring, sending is done by loop()
+    _ring.push(_prefix, message, length);
+    if(_mirror != nullptr) _mirror(message, length);
+}
+
+void UDPLogger::loop(){
+    if(_ring.isEmpty()) return;
+    // send early if the ring fills up, otherwise collect lines for a while
+    if(millis() - _lastFlush >= UDP_LOG_FLUSH_INTERVAL || _ring.getUsed() >= LOG_RING_SIZE / 2){
+        flush();
     }
+}
+
+void UDPLogger::flush(){
+    // If WiFi is not connected or the interface address is 0.0.0.0, skip UDP multicast to avoid blocking/failures
+    bool sendUdp = WiFi.status() == WL_CONNECTED && _interfaceAddr != IPAddress(0,0,0,0);
+    while(!_ring.isEmpty()){
+        size_t batch = _ring.nextBatch(UDP_LOG_DATAGRAM_SIZE);
+        if(sendUdp) _Udp.beginPacketMulticast(_multicastAddr, _port, _interfaceAddr);
+        size_t offset = 0;
+        while(offset < batch){
+            const char *data;
+            size_t length = _ring.peek(offset, &data);
+            if(length > batch - offset) length = batch - offset;
+            Serial.write(data, length);
+            if(sendUdp) _Udp.write((const uint8_t*)data, length);
+            offset += length;
+        }
+        if(sendUdp) _Udp.endPacket();
+        _ring.consume(batch);
+    }
+    _lastFlush = millis();
+}
+
+bool UDPLogger::sendBinary(const uint8_t *data, size_t length){
+    // one datagram on the log group (e.g. telemetry), not queued
+    if(WiFi.status() != WL_CONNECTED || _interfaceAddr == IPAddress(0,0,0,0)) return false;
     _Udp.beginPacketMulticast(_multicastAddr, _port, _interfaceAddr);
-    // Truncate message if too long, using the defined buffer size
-    logmessage.toCharArray(_packetBuffer, UDP_LOG_BUFFER_SIZE);
-    _Udp.print(_packetBuffer);
-    _Udp.endPacket();
-    _lastSend=millis();
+    _Udp.write(data, length);
+    return _Udp.endPacket();
+}
+
+void UDPLogger::setMirror(LogMirror mirror){
+    _mirror = mirror;
+}
+
+uint32_t UDPLogger::getDropped() const{
+    return _ring.getDropped();
+}
+
+size_t UDPLogger::getHighWater() const{
+    return _ring.getHighWater();
 }
 
 void UDPLogger::logColor24bit(uint32_t color){
   uint8_t resultRed = color >> 16 & 0xff;
   uint8_t resultGreen = color >> 8 & 0xff;
   uint8_t resultBlue = color & 0xff;
-  logString(String(resultRed) + ", " + String(resultGreen) + ", " + String(resultBlue));
+  logPrintf("%u, %u, %u", resultRed, resultGreen, resultBlue);
 }
 
 void UDPLogger::refreshInterface(IPAddress interfaceAddr){
@@ -61,31 +158,23 @@ void UDPLogger::refreshInterface(IPAddress interfaceAddr){
 }
 
 void UDPLogger::logPrintf(const char *format, ...) {
-    char loc_buf[64];
-    char * temp = loc_buf;
     va_list arg;
-    va_list copy;
     va_start(arg, format);
-    va_copy(copy, arg);
-    int len = vsnprintf(temp, sizeof(loc_buf), format, copy);
-    va_end(copy);
-    if (len < 0) {
-        va_end(arg);
+    logVprintf(format, arg);
+    va_end(arg);
+}
+
+void UDPLogger::logVprintf(const char *format, va_list arg) {
+    // formatted behind the prefix directly, no String and no heap
+    char line[LOG_RING_LINE_MAX];
+    int length = LogRing::formatLine(line, _prefix, format, arg);
+    if (length < 0) {
+        _ring.drop();
         return;
-    };
-    if (len >= sizeof(loc_buf)) {
-        temp = (char*) malloc(len+1);
-        if (temp == NULL) {
-            va_end(arg);
-            return;
-        }
-        len = vsnprintf(temp, len+1, format, arg);
     }
-    va_end(arg);
-    
-    logString(String(temp));
-    
-    if (temp != loc_buf) {
-        free(temp);
+    _ring.push("", line, length);
+    if (_mirror != nullptr) {
+        size_t prefixLength = strlen(_prefix);
+        _mirror(line + prefixLength, length - prefixLength);
     }
-}
\ No newline at end of file
+}
@@ -2,9 +2,13 @@
  * @file udplogger.h
  * @author techniccontroller (mail[at]techniccontroller.com)
  * @brief Class for sending logging Strings as multicast messages 
- * @version 0.1
+ * @version 0.2
  * @date 2022-03-21
  * 
+ * Log calls only copy the message into a preallocated ring buffer and return immediately.
+ * loop() (called from the main loop) flushes the ring regularly: the queued lines are written
+ * to Serial and packed into as few multicast datagrams as possible.
+ * 
  * @copyright Copyright (c) 2022
  * 
  */
@@ -14,29 +18,84 @@
 
 #include <Arduino.h>
 #include <WiFiUdp.h>
+#include "log_ring.h"
+
+
+// Payload of one multicast datagram (below the MTU of 1500 bytes minus IP/UDP headers)
+#define UDP_LOG_DATAGRAM_SIZE 1400
+// Maximum time a line waits in the ring before it is sent
+#define UDP_LOG_FLUSH_INTERVAL 100
+// Name prefix ("name: ")
+#define UDP_LOG_PREFIX_SIZE 32
+
+// Log levels, a message is logged if its level is <= the active level
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL_TRACE 5
+
+// Highest level compiled into the firmware, calls above it are removed completely
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_DEBUG
+#endif
+// Level after boot, can be changed at runtime up to LOG_LEVEL (/cmd?loglevel=)
+#ifndef LOG_LEVEL_DEFAULT
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_INFO
+#endif
 
+// The arguments are only evaluated if the level is enabled (at compile time and at runtime).
+// Usage: LOG_INFO(logger, "text"), LOG_INFO(logger, "value: " + String(x)) or LOG_INFO(logger, "value: %d", x)
+// (a char* message is a printf format)
+#define LOG_AT(logger, level, ...) \
+    do { if ((level) <= LOG_LEVEL && (logger).isEnabled(level)) (logger).logLevel((level), __VA_ARGS__); } while (0)
+#define LOG_ERROR(logger, ...) LOG_AT(logger, LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(logger, ...) LOG_AT(logger, LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(logger, ...) LOG_AT(logger, LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(logger, ...) LOG_AT(logger, LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_TRACE(logger, ...) LOG_AT(logger, LOG_LEVEL_TRACE, __VA_ARGS__)
 
-// Buffer size for UDP log packets - increased from 100 to prevent truncation
-#define UDP_LOG_BUFFER_SIZE 256
+// Receives every log line without prefix and '\n' (e.g. to keep a copy in RTC memory)
+typedef void (*LogMirror)(const char *line, size_t length);
 
 class UDPLogger{
 
     public:
         UDPLogger();
         UDPLogger(IPAddress interfaceAddr, IPAddress multicastAddr, int port);
+        void begin(IPAddress interfaceAddr, IPAddress multicastAddr, int port);
         void setName(String name);
-        void logString(String logmessage);
+        void logString(const String &logmessage);
+        void logString(const char *logmessage);
         void logPrintf(const char* format, ...);
+        void logLevel(uint8_t level, const String &logmessage);
+        void logLevel(uint8_t level, const char *format, ...) __attribute__((format(printf, 3, 4)));
+        bool isEnabled(uint8_t level) const { return level <= _level; }
+        void setLevel(uint8_t level);
+        uint8_t getLevel() const;
+        static const char* getLevelName(uint8_t level);
+        static bool parseLevel(const char *text, uint8_t *level);
         void logColor24bit(uint32_t color);
         void refreshInterface(IPAddress interfaceAddr);
+        void loop();
+        void flush();
+        bool sendBinary(const uint8_t *data, size_t length);
+        void setMirror(LogMirror mirror);
+        uint32_t getDropped() const;
+        size_t getHighWater() const;
     private:
-        String _name;
+        char _prefix[UDP_LOG_PREFIX_SIZE];
         IPAddress _multicastAddr;
         IPAddress _interfaceAddr;
         int _port;
         WiFiUDP _Udp;
-        char _packetBuffer[UDP_LOG_BUFFER_SIZE];
-        unsigned long _lastSend;
+        LogRing _ring;
+        unsigned long _lastFlush;
+        uint8_t _level;
+        LogMirror _mirror;
+        void logBuffer(const char *message, size_t length);
+        void logVprintf(const char *format, va_list arg);
 };
 
-#endif
\ No newline at end of file
+#endif
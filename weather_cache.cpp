@@ -0,0 +1,93 @@
+#include "weather_cache.h"
+#include "rtc_time.h"
+#include "weather_parser.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Get a compact key of a local date
+ *
+ * @param local local time (from localtime)
+ * @return uint16_t key, different for each day until 2127
+ */
+uint16_t WeatherCache::dayKey(const struct tm *local){
+    return (uint16_t)((local->tm_year - 100) * 512 + local->tm_yday);
+}
+
+/**
+ * @brief Fill a record (incl. CRC)
+ *
+ * @param record
+ * @param data values of the forecast
+ * @param fetchedEpoch UTC time of the fetch
+ * @param dayKey local date the forecast belongs to
+ */
+void WeatherCache::encode(WeatherRecord *record, const WeatherData *data, uint32_t fetchedEpoch, uint16_t dayKey){
+    memset(record, 0, sizeof(WeatherRecord));
+    record->magic = WEATHER_CACHE_MAGIC;
+    record->version = WEATHER_CACHE_VERSION;
+    record->dayKey = dayKey;
+    record->fetchedEpoch = fetchedEpoch;
+    for(uint8_t i = 0; i < 2; i++){
+        record->temperature[i] = (int16_t)lroundf(data->temperature[i] * 10);
+        bool codeValid = data->weatherCode[i] >= 0 && data->weatherCode[i] < WEATHER_CACHE_CODE_MISSING;
+        record->weatherCode[i] = codeValid ? (uint8_t)data->weatherCode[i] : WEATHER_CACHE_CODE_MISSING;
+        record->sunshine[i] = (int32_t)lroundf(data->sunshine[i]);
+    }
+    data->forecast.pack(&record->forecast);
+    record->crc = RtcTime::crc32((const uint8_t*)record, offsetof(WeatherRecord, crc));
+}
+
+/**
+ * @brief Check a record and get its values
+ *
+ * @param record
+ * @param data values of the forecast (only written if the record is valid)
+ * @return true if magic, version, CRC and forecast are valid
+ */
+bool WeatherCache::decode(const WeatherRecord *record, WeatherData *data){
+    if(record->magic != WEATHER_CACHE_MAGIC || record->version != WEATHER_CACHE_VERSION) return false;
+    if(record->crc != RtcTime::crc32((const uint8_t*)record, offsetof(WeatherRecord, crc))) return false;
+    if(!data->forecast.unpack(&record->forecast)) return false;
+    for(uint8_t i = 0; i < 2; i++){
+        data->temperature[i] = record->temperature[i] / 10.0f;
+        data->weatherCode[i] = record->weatherCode[i] == WEATHER_CACHE_CODE_MISSING ? WEATHER_MISSING : record->weatherCode[i];
+        data->sunshine[i] = (float)record->sunshine[i];
+    }
+    return true;
+}
+
+/**
+ * @brief Check if a (valid) record can be shown
+ *
+ * Without system time (not synced yet) the record is always used, it is replaced by the
+ * refresh after boot anyway.
+ *
+ * @param record
+ * @param nowEpoch current UTC time
+ * @param dayKeyNow key of the current local date
+ * @return true if the record belongs to today and is not too old
+ */
+bool WeatherCache::isUsable(const WeatherRecord *record, uint32_t nowEpoch, uint16_t dayKeyNow){
+    if(nowEpoch < WEATHER_CACHE_MIN_EPOCH) return true;
+    if(record->dayKey != dayKeyNow || nowEpoch < record->fetchedEpoch) return false;
+    return nowEpoch - record->fetchedEpoch <= WEATHER_CACHE_MAX_AGE;
+}
+
+/**
+ * @brief Decide if a new record has to be written (write throttling)
+ *
+ * @param stored record in the file system (nullptr if there is none or it is invalid)
+ * @param fresh new record
+ * @return true if the new record should be written
+ */
+bool WeatherCache::shouldWrite(const WeatherRecord *stored, const WeatherRecord *fresh){
+    if(stored == nullptr || stored->dayKey != fresh->dayKey) return true;
+    if(fresh->fetchedEpoch < stored->fetchedEpoch) return true;
+    uint32_t age = fresh->fetchedEpoch - stored->fetchedEpoch;
+    // keep the stored record usable after boot even if the values do not change
+    if(age >= WEATHER_CACHE_MAX_AGE / 2) return true;
+    if(age < WEATHER_CACHE_WRITE_INTERVAL) return false;
+    return memcmp(stored->temperature, fresh->temperature, offsetof(WeatherRecord, crc) - offsetof(WeatherRecord, temperature)) != 0;
+}
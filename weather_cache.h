@@ -0,0 +1,58 @@
+/**
+ * @file weather_cache.h
+ * @brief Binary record of the last weather forecast, stored in LittleFS to show it directly after boot
+ *
+ * The record holds the values shown by the clock, the packed hourly forecast, the time of the
+ * fetch and the local date the forecast belongs to ("today" of the forecast). After boot the record is only used for the
+ * same local date and up to WEATHER_CACHE_MAX_AGE. To save flash erase cycles a new record is
+ * only written if the date changed, or if the values changed and the stored record is at least
+ * WEATHER_CACHE_WRITE_INTERVAL old (about 8 writes per day instead of 48 refreshes).
+ *
+ */
+
+#ifndef weather_cache_h
+#define weather_cache_h
+
+#include <Arduino.h>
+#include <time.h>
+#include "hourly_forecast.h"
+
+#define WEATHER_CACHE_FILE "/weather.bin"
+#define WEATHER_CACHE_MAGIC 0x58575357UL        // "WSWX"
+#define WEATHER_CACHE_VERSION 2                 // 2: hourly forecast added
+#define WEATHER_CACHE_MAX_AGE 43200UL           // s, older records are not shown after boot
+#define WEATHER_CACHE_WRITE_INTERVAL 10800UL    // s, minimum age of the stored record before changed values are written
+#define WEATHER_CACHE_MIN_EPOCH 1577836800UL    // 2020-01-01, earlier system time means the time is not set yet
+#define WEATHER_CACHE_CODE_MISSING 0xFF
+
+struct WeatherData {
+    float temperature[2];   // degree celsius at noon, today/tomorrow
+    int weatherCode[2];     // WMO code at noon, today/tomorrow
+    float sunshine[2];      // seconds of sunshine, today/tomorrow
+    HourlyForecast forecast;  // all hourly values
+};
+
+struct WeatherRecord {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t dayKey;        // local date of the forecast (see WeatherCache::dayKey)
+    uint32_t fetchedEpoch;  // UTC time of the fetch
+    int16_t temperature[2]; // 1/10 degree celsius
+    uint8_t weatherCode[2]; // WEATHER_CACHE_CODE_MISSING if missing
+    uint16_t reserved;
+    int32_t sunshine[2];    // seconds
+    HourlyForecastRecord forecast;
+    uint32_t crc;           // CRC32 of all fields above
+};
+
+class WeatherCache{
+
+    public:
+        static uint16_t dayKey(const struct tm *local);
+        static void encode(WeatherRecord *record, const WeatherData *data, uint32_t fetchedEpoch, uint16_t dayKey);
+        static bool decode(const WeatherRecord *record, WeatherData *data);
+        static bool isUsable(const WeatherRecord *record, uint32_t nowEpoch, uint16_t dayKeyNow);
+        static bool shouldWrite(const WeatherRecord *stored, const WeatherRecord *fresh);
+};
+
+#endif
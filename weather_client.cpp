@@ -1,198 +1,207 @@
 #include "weather_client.h"
+#include <LittleFS.h>
+#include <lwip/dns.h>
 
 WeatherClient::WeatherClient() {
   tempTodayNoon = 0;
   tempTomorrowNoon = 0;
   sunshineToday = 0;
   sunshineTomorrow = 0;
+  codeTodayNoon = 0;
+  codeTomorrowNoon = 0;
   lastUpdate = 0;
   lastAttempt = 0;
   consecutiveFailures = 0;
   dataValid = false;
+  refreshPending = false;
+  attempted = false;
+  cacheRecordValid = false;
+  health = nullptr;
+  setLocation(WEATHER_DEFAULT_TIMEZONE, WEATHER_DEFAULT_LATITUDE_E4, WEATHER_DEFAULT_LONGITUDE_E4);
+}
+
+// State of the running host lookup, set by the lwIP callback
+static volatile WeatherResolveState dnsState = wr_failed;
+
+static void dnsFound(const char *name, const ip_addr_t *ipaddr, void *arg) {
+  (void)name;
+  (void)arg;
+  dnsState = ipaddr != nullptr ? wr_resolved : wr_failed;
+}
+
+// Asynchronous host lookup for the DNS phase (polled by WeatherFetch), afterwards connect()
+// finds the address in the DNS cache
+static WeatherResolveState resolveHost(const char *host, bool start) {
+  if (start) {
+    ip_addr_t addr;
+    dnsState = wr_pending;
+    err_t err = dns_gethostbyname(host, &addr, dnsFound, nullptr);
+    if (err == ERR_OK) {
+      dnsState = wr_resolved;  // already in the DNS cache
+    } else if (err != ERR_INPROGRESS) {
+      dnsState = wr_failed;
+    }
+  }
+  return dnsState;
 }
 
 void WeatherClient::update() {
+  // Continue a running fetch with a bounded slice of work
+  if (fetch.isBusy()) {
+    if (WiFi.status() != WL_CONNECTED) {
+      fetch.abort(client);
+      consecutiveFailures++;
+      return;
+    }
+    unsigned long sliceStart = millis();
+    WeatherFetchPhase phase = fetch.poll(client, WEATHER_SLICE_BUDGET);
+    client.getStats().sampleFreeHeap(ESP.getFreeHeap());
+    if (health != nullptr) {
+      // the connect (TCP + TLS handshake) can not be split and blocks the loop
+      health->recordBlocking(millis() - sliceStart);
+    }
+    if (phase == wf_done) {
+      bool accepted = applyParsedValues();
+      if (accepted) {
+        lastUpdate = millis();
+        consecutiveFailures = 0;
+        refreshPending = false;
+        saveCache();
+      } else {
+        // the previous values stay, retry like after a failed fetch
+        consecutiveFailures++;
+        refreshPending = true;
+      }
+      if (health != nullptr) {
+        if (accepted) health->reportSuccess(ne_weather, millis());
+        else health->reportFailure(ne_weather, millis());
+      }
+      Serial.printf("WeatherClient: Handshake %u ms (%s), connection heap %u B, min free heap %u B\n",
+                    client.getStats().getLastHandshakeMillis(),
+                    client.getStats().isLastResumed() ? "resumed" : "full",
+                    client.getStats().getLastConnectionHeap(), client.getStats().getMinFreeHeap());
+    } else if (phase == wf_failed) {
+      Serial.printf("WeatherClient: Fetch failed in phase %s (HTTP %d)\n",
+                    WeatherFetch::getPhaseName(fetch.getFailedPhase()), fetch.getStatusCode());
+      consecutiveFailures++;
+      if (health != nullptr) {
+        health->reportFailure(ne_weather, millis());
+      }
+    }
+    return;
+  }
+
   // Skip if WiFi is not connected - avoids blocking connection attempts
   if (WiFi.status() != WL_CONNECTED) {
     return;
   }
 
-  // Use cached data if still valid (30 minutes)
-  if (dataValid && (millis() - lastUpdate < 1800000)) {
+  // Use cached data if still valid (30 minutes), data loaded from LittleFS is refreshed right away
+  if (dataValid && !refreshPending && (millis() - lastUpdate < 1800000)) {
     return;
   }
 
-  // Rate-limit connection attempts: at most once every 60 seconds when failing
-  if (!dataValid && (millis() - lastAttempt < 60000)) {
+  // Rate-limit connection attempts: backoff and breaker of the shared NetworkHealth,
+  // without it at most once every 60 seconds when failing
+  if (health != nullptr) {
+    if (!health->mayAttempt(ne_weather, millis())) {
+      return;
+    }
+  } else if (attempted && (!dataValid || refreshPending) && (millis() - lastAttempt < 60000)) {
     return;
   }
+  attempted = true;
   lastAttempt = millis();
 
-  WiFiClientSecure client;
   client.setInsecure(); // Skip certificate validation for simplicity/speed on ESP8266
-  client.setTimeout(5000);  // 5 second timeout (default is ~30s)
+  client.setTimeout(WEATHER_CONNECT_TIMEOUT);
+  fetch.setResolver(resolveHost);
+  fetch.start(host, 443, path);
+}
 
-  if (!client.connect(host, 443)) {
-    Serial.println("WeatherClient: Connection failed");
-    consecutiveFailures++;
-    return;
+bool WeatherClient::applyParsedValues() {
+  // a truncated, malformed or implausible response keeps the previous values (from the last fetch or the cache)
+  WeatherData data;
+  if (!fetch.getValues(&data)) {
+    const WeatherParser &parser = fetch.getParser();
+    Serial.printf("WeatherClient: Response rejected (%s, Today Noon: %.1f C)\n",
+                  parser.hasError() ? "malformed" : (parser.isComplete() ? "implausible" : "incomplete"),
+                  parser.getTemperature(false));
+    return false;
   }
+  tempTodayNoon = data.temperature[0];
+  tempTomorrowNoon = data.temperature[1];
+  codeTodayNoon = data.weatherCode[0];
+  codeTomorrowNoon = data.weatherCode[1];
+  sunshineToday = data.sunshine[0];
+  sunshineTomorrow = data.sunshine[1];
+  forecast = data.forecast;
+  dataValid = true;
+  Serial.printf("Weather Update: Today Noon: %.1f C, Sun: %.1f h | Tomorrow Noon: %.1f C, Sun: %.1f h\n", 
+                tempTodayNoon, sunshineToday/3600.0, tempTomorrowNoon, sunshineTomorrow/3600.0);
+  return true;
+}
 
-  // Send HTTP request
-  client.print(String("GET ") + url + " HTTP/1.1\r\n" +
-               "Host: " + host + "\r\n" +
-               "User-Agent: ESP8266WordClock\r\n" +
-               "Connection: close\r\n\r\n");
-
-  while (client.connected()) {
-    String line = client.readStringUntil('\n');
-    if (line == "\r") {
-      break;
-    }
+bool WeatherClient::loadCache() {
+  if (!LittleFS.exists(WEATHER_CACHE_FILE)) {
+    return false;
   }
-
-  // Read response
-  String payload = client.readString();
-  if (payload.length() == 0) {
-    consecutiveFailures++;
-    return;
+  File file = LittleFS.open(WEATHER_CACHE_FILE, "r");
+  if (!file) {
+    return false;
   }
-  parseJson(payload);
-  lastUpdate = millis();
-  consecutiveFailures = 0; 
-}
-
-void WeatherClient::parseJson(String payload) {
-  // "hourly": { "time": [...], "temperature_2m": [ ... ] }
-  // We need index 12 (12:00 Today) and index 36 (12:00 Tomorrow)
-  // Indices are 0-based from 00:00 today.
-  
-  // NOTE: This manual parser is fragile but sufficient for this specific structure if Open-Meteo doesn't change format drastically.
-  // It looks for "temperature_2m" and then parses the array.
-
-  // Use simple keys and rely on robust parsing to find the array
-  // Use "\"temperature_2m\"" (etc) to match the key regardless of following spaces or structure
-  tempTodayNoon = extractValueAtIndex(payload, "\"temperature_2m\"", 12);
-  tempTomorrowNoon = extractValueAtIndex(payload, "\"temperature_2m\"", 36);
-  
-  // Extract weather codes
-  codeTodayNoon = (int)extractValueAtIndex(payload, "\"weathercode\"", 12);
-  codeTomorrowNoon = (int)extractValueAtIndex(payload, "\"weathercode\"", 36);
-  
-  // Extract sunshine duration (daily array)
-  sunshineToday = extractDailyValueAtIndex(payload, "\"sunshine_duration\"", 0);
-  sunshineTomorrow = extractDailyValueAtIndex(payload, "\"sunshine_duration\"", 1);
-  
-  // Basic validation check (e.g. -50 to +50 is reasonable range)
-  if (tempTodayNoon > -60 && tempTodayNoon < 60) {
-     dataValid = true;
-     Serial.printf("Weather Update: Today Noon: %.1f C, Sun: %.1f h | Tomorrow Noon: %.1f C, Sun: %.1f h\n", 
-                    tempTodayNoon, sunshineToday/3600.0, tempTomorrowNoon, sunshineTomorrow/3600.0);
-  } else {
-     dataValid = false;
-  }
-}
-
-// Extracts the Nth value from a JSON array in the "daily" section
-// This is needed because "sunshine_duration" appears twice in the API response:
-// once in "daily_units" (as a string "s") and once in "daily" (as the data array)
-float WeatherClient::extractDailyValueAtIndex(String payload, String key, int targetIndex) {
-  // First, find the "daily":{ section (not "daily_units")
-  int dailyStart = payload.indexOf("\"daily\":{");
-  if (dailyStart == -1) {
-    // Try alternate format with space
-    dailyStart = payload.indexOf("\"daily\": {");
-  }
-  if (dailyStart == -1) return -999;
-  
-  // Now search for the key starting from within the daily section
-  int keyPos = payload.indexOf(key, dailyStart);
-  if (keyPos == -1) return -999;
-  
-  // Find the array start
-  int cursor = keyPos + key.length();
-  while (cursor < payload.length() && (payload[cursor] == ' ' || payload[cursor] == ':')) {
-    cursor++;
-  }
-  
-  if (cursor >= payload.length() || payload[cursor] != '[') return -999;
-  
-  int arrayStart = cursor;
-  int currentIndex = 0;
-  int searchPos = arrayStart + 1;
-  
-  // Skip to the target index
-  while (currentIndex < targetIndex) {
-    int commaPos = payload.indexOf(',', searchPos);
-    if (commaPos == -1) return -999;
-    searchPos = commaPos + 1;
-    currentIndex++;
-  }
-  
-  // Extract the number
-  int nextComma = payload.indexOf(',', searchPos);
-  int arrayEnd = payload.indexOf(']', searchPos);
-  
-  int endPos;
-  if (nextComma == -1) endPos = arrayEnd;
-  else if (arrayEnd == -1) endPos = nextComma;
-  else endPos = (nextComma < arrayEnd) ? nextComma : arrayEnd;
-  
-  if (endPos == -1) return -999;
-  
-  String valStr = payload.substring(searchPos, endPos);
-  return valStr.toFloat();
-}
-
-float WeatherClient::extractValueAtIndex(String payload, String key, int targetIndex) {
-  int startSearch = 0;
-  int arrayStart = -1;
-  
-  // Loop to find the key followed by a '[' (checking for valid data array vs metadata)
-  while (true) {
-    int keyPos = payload.indexOf(key, startSearch);
-    if (keyPos == -1) return -999;
-    
-    // Check what follows
-    int cursor = keyPos + key.length();
-    // Skip whitespace and colon
-    while (cursor < payload.length() && (payload[cursor] == ' ' || payload[cursor] == '\t' || payload[cursor] == '\r' || payload[cursor] == '\n' || payload[cursor] == ':')) {
-       cursor++;
-    }
+  WeatherRecord record;
+  bool complete = file.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+  file.close();
 
-    if (cursor < payload.length() && payload[cursor] == '[') {
-       // Found it!
-       arrayStart = cursor;
-       break; 
-    } else {
-       // Not the one (e.g. was units), search next
-       startSearch = keyPos + 1;
-    }
+  WeatherData data;
+  if (!complete || !WeatherCache::decode(&record, &data)) {
+    Serial.println("WeatherClient: Cache invalid");
+    return false;
   }
+  cacheRecord = record;
+  cacheRecordValid = true;
 
-  int currentIndex = 0;
-  int searchPos = arrayStart + 1;
-  
-  while (currentIndex < targetIndex) {
-    int commaPos = payload.indexOf(',', searchPos);
-    if (commaPos == -1) return -999; // End of array before index
-    searchPos = commaPos + 1;
-    currentIndex++;
+  time_t now = time(nullptr);
+  if (!WeatherCache::isUsable(&record, now, WeatherCache::dayKey(localtime(&now)))) {
+    Serial.println("WeatherClient: Cache outdated");
+    return false;
   }
+  tempTodayNoon = data.temperature[0];
+  tempTomorrowNoon = data.temperature[1];
+  codeTodayNoon = data.weatherCode[0];
+  codeTomorrowNoon = data.weatherCode[1];
+  sunshineToday = data.sunshine[0];
+  sunshineTomorrow = data.sunshine[1];
+  forecast = data.forecast;
+  dataValid = true;
+  refreshPending = true;
+  Serial.printf("WeatherClient: Loaded cache from %u (Today Noon: %.1f C)\n", record.fetchedEpoch, tempTodayNoon);
+  return true;
+}
 
-  // extract number
-  int nextComma = payload.indexOf(',', searchPos);
-  int arrayEnd = payload.indexOf(']', searchPos);
-  
-  int endPos;
-  if (nextComma == -1) endPos = arrayEnd;
-  else if (arrayEnd == -1) endPos = nextComma;
-  else endPos = (nextComma < arrayEnd) ? nextComma : arrayEnd;
-  
-  if (endPos == -1) return -999;
-
-  String valDir = payload.substring(searchPos, endPos);
-  return valDir.toFloat();
+void WeatherClient::saveCache() {
+  // the forecast belongs to a local date, without system time it can not be assigned
+  time_t now = time(nullptr);
+  if (now < (time_t)WEATHER_CACHE_MIN_EPOCH) {
+    return;
+  }
+  WeatherData data = {{tempTodayNoon, tempTomorrowNoon}, {codeTodayNoon, codeTomorrowNoon}, {sunshineToday, sunshineTomorrow}, forecast};
+  WeatherRecord record;
+  WeatherCache::encode(&record, &data, (uint32_t)now, WeatherCache::dayKey(localtime(&now)));
+  if (!WeatherCache::shouldWrite(cacheRecordValid ? &cacheRecord : nullptr, &record)) {
+    return;
+  }
+  File file = LittleFS.open(WEATHER_CACHE_FILE, "w");
+  if (!file) {
+    return;
+  }
+  bool written = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+  file.close();
+  if (written) {
+    cacheRecord = record;
+    cacheRecordValid = true;
+  }
 }
 
 float WeatherClient::getSunshineDuration(bool tomorrow) {
@@ -200,6 +209,10 @@ float WeatherClient::getSunshineDuration(bool tomorrow) {
     return sunshineToday;
 }
 
+const HourlyForecast& WeatherClient::getForecast() {
+    return forecast;
+}
+
 int WeatherClient::getTemperature(bool tomorrow) {
   if (tomorrow) return (int)round(tempTomorrowNoon);
   return (int)round(tempTodayNoon);
@@ -214,8 +227,42 @@ bool WeatherClient::isDataValid() {
     return dataValid;
 }
 
+void WeatherClient::setNetworkHealth(NetworkHealth *health) {
+    this->health = health;
+}
+
+void WeatherClient::setLocation(const char *timezone, int32_t latE4, int32_t lonE4) {
+  // the hourly values are given in local time of the timezone, it has to be the one of TZ_INFO
+  if (fetch.isBusy()) {
+    return;  // the running request uses the path
+  }
+  if (timezone == nullptr || timezone[0] == '\0') {
+    timezone = WEATHER_DEFAULT_TIMEZONE;
+  }
+  if (!WeatherFetch::formatForecastPath(path, sizeof(path), latE4, lonE4, timezone)) {
+    WeatherFetch::formatForecastPath(path, sizeof(path), latE4, lonE4, WEATHER_DEFAULT_TIMEZONE);
+  }
+}
+
 void WeatherClient::invalidateCache() {
-    dataValid = false;
+    // keep showing the current values until the refresh is done
+    refreshPending = true;
+}
+
+WeatherFetchPhase WeatherClient::getFetchPhase() {
+    return fetch.getPhase();
+}
+
+uint8_t WeatherClient::getFetchProgress() {
+    return fetch.getProgress();
+}
+
+const ConnectionStats& WeatherClient::getConnectionStats() {
+    return client.getStats();
+}
+
+int8_t WeatherClient::getMflnStatus() {
+    return client.getMflnStatus();
 }
 
 int WeatherClient::getConsecutiveFailures() {
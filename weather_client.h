@@ -5,17 +5,35 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266HTTPClient.h>
 #include <WiFiClientSecure.h>
+#include "weather_fetch.h"
+#include "tls_client.h"
+#include "weather_cache.h"
+#include "network_health.h"
+
+#define WEATHER_SLICE_BUDGET 10     // ms of work per update() call while a fetch is running
+#define WEATHER_CONNECT_TIMEOUT 5000  // ms, bounds the blocking TCP connect + TLS handshake (default is ~30s)
+#define WEATHER_DEFAULT_TIMEZONE "Europe/Berlin"   // zone of the default TZ_INFO
+#define WEATHER_DEFAULT_LATITUDE_E4 492394
+#define WEATHER_DEFAULT_LONGITUDE_E4 92553
 
 class WeatherClient {
   public:
     WeatherClient();
     void update();
+    bool loadCache();  // Restore the last forecast from LittleFS (call after LittleFS.begin)
+    void setNetworkHealth(NetworkHealth *health);  // Retry policy shared with the other network users
+    void setLocation(const char *timezone, int32_t latE4, int32_t lonE4);  // Location and timezone of the clock
     int getTemperature(bool tomorrow);
     int getWeatherCode(bool tomorrow);
     float getSunshineDuration(bool tomorrow);
+    const HourlyForecast& getForecast();
     bool isDataValid();
     int getConsecutiveFailures();
-    void invalidateCache();  // Force refresh on next update
+    void invalidateCache();  // Refresh on next update, the current values stay valid until then
+    WeatherFetchPhase getFetchPhase();
+    uint8_t getFetchProgress();
+    const ConnectionStats& getConnectionStats();
+    int8_t getMflnStatus();
 
   private:
     float tempTodayNoon;
@@ -24,19 +42,25 @@ class WeatherClient {
     int codeTomorrowNoon;
     float sunshineToday;
     float sunshineTomorrow;
+    HourlyForecast forecast;  // all hourly values of the last valid response
     unsigned long lastUpdate;
     unsigned long lastAttempt;  // Rate-limit failed connection attempts
     int consecutiveFailures;
     bool dataValid;
+    bool refreshPending;  // refresh as soon as possible (cached data, reconnect, rejected response)
+    bool attempted;
+    WeatherRecord cacheRecord;  // content of the cache file (for the write throttling)
+    bool cacheRecordValid;
+    NetworkHealth *health;  // backoff and breaker, nullptr: retry every 60 seconds
+    TlsSessionClient client;  // keeps the TLS session across refreshes
+    WeatherFetch fetch;
     
-    // Coordinates for Oedheim, Germany
-    // 49.2394° N, 9.2553° E
+    // Oedheim, Germany (49.2394° N, 9.2553° E) until setLocation() is called
     const char* host = "api.open-meteo.com";
-    const String url = "/v1/forecast?latitude=49.2394&longitude=9.2553&hourly=temperature_2m,weathercode&daily=sunshine_duration&forecast_days=2&timezone=Europe%2FBerlin";
+    char path[WEATHER_PATH_SIZE];
 
-    void parseJson(String payload);
-    float extractValueAtIndex(String payload, String key, int index);
-    float extractDailyValueAtIndex(String payload, String key, int index);
+    bool applyParsedValues();
+    void saveCache();
 };
 
 #endif
@@ -0,0 +1,485 @@
+#include "weather_fetch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/**
+ * @brief Construct a new WeatherFetch object (idle)
+ *
+ */
+WeatherFetch::WeatherFetch(){
+    _resolver = nullptr;
+    _host = "";
+    _path = "/";
+    _port = 80;
+    _phase = wf_idle;
+    _failedPhase = wf_idle;
+    _lastProgress = 0;
+    _sliceStart = 0;
+    _sliceBudget = 0;
+    _longestSlice = 0;
+    _statusCode = 0;
+    _contentLength = -1;
+    _bytesReceived = 0;
+    _lineLength = 0;
+    _firstLine = true;
+    _dnsStarted = false;
+}
+
+/**
+ * @brief Set the function for the DNS phase (without resolver the phase is skipped)
+ *
+ * The resolver only has to warm up the DNS cache, connect() is called with the hostname
+ * (required for TLS server name indication). It must not block: the first call starts the
+ * lookup, the following calls return wr_pending until the result is there.
+ *
+ * @param resolver
+ */
+void WeatherFetch::setResolver(WeatherResolver resolver){
+    _resolver = resolver;
+}
+
+/**
+ * @brief Start a new request, the work is done by the following poll() calls
+ *
+ * @param host hostname (must stay valid until the fetch is finished)
+ * @param port server port
+ * @param path request path with query (must stay valid until the fetch is finished)
+ */
+void WeatherFetch::start(const char *host, uint16_t port, const char *path){
+    _host = host;
+    _port = port;
+    _path = path;
+    _failedPhase = wf_idle;
+    _longestSlice = 0;
+    _statusCode = 0;
+    _contentLength = -1;
+    _bytesReceived = 0;
+    _lineLength = 0;
+    _firstLine = true;
+    _dnsStarted = false;
+    _parser.reset();
+    setPhase(wf_dns);
+}
+
+/**
+ * @brief Do the next slice of work
+ *
+ * The slice ends when the budget is used up, no data is available, the DNS lookup is pending
+ * or after the connect. The connect blocks and can exceed the budget.
+ *
+ * @param client network client used for the request (e.g. WiFiClientSecure)
+ * @param budgetMs time budget of this slice in milliseconds
+ * @return WeatherFetchPhase phase after the slice (wf_done or wf_failed when finished)
+ */
+WeatherFetchPhase WeatherFetch::poll(Client &client, uint32_t budgetMs){
+    _sliceStart = millis();
+    _sliceBudget = budgetMs;
+    bool more = true;
+    while(more && isBusy()){
+        switch(_phase){
+            case wf_dns: more = stepDns(client); break;
+            case wf_connect: more = stepConnect(client); break;
+            case wf_send: more = stepSend(client); break;
+            case wf_headers: more = stepHeaders(client); break;
+            case wf_body: more = stepBody(client); break;
+            case wf_parse: more = stepParse(client); break;
+            default: more = false; break;
+        }
+        if(!hasSliceTime()) more = false;
+    }
+    uint32_t slice = millis() - _sliceStart;
+    if(slice > _longestSlice) _longestSlice = slice;
+    return _phase;
+}
+
+/**
+ * @brief Cancel a running fetch (it is reported as failed in the current phase)
+ *
+ * @param client network client used for the request
+ */
+void WeatherFetch::abort(Client &client){
+    if(isBusy()) fail(client);
+}
+
+/**
+ * @brief Check if a fetch is in progress
+ *
+ * @return true if poll() has to be called
+ */
+bool WeatherFetch::isBusy() const{
+    return _phase != wf_idle && _phase != wf_done && _phase != wf_failed;
+}
+
+/**
+ * @brief Get the current phase
+ *
+ * @return WeatherFetchPhase
+ */
+WeatherFetchPhase WeatherFetch::getPhase() const{
+    return _phase;
+}
+
+/**
+ * @brief Get the phase in which the last fetch failed
+ *
+ * @return WeatherFetchPhase (wf_idle if the last fetch did not fail)
+ */
+WeatherFetchPhase WeatherFetch::getFailedPhase() const{
+    return _failedPhase;
+}
+
+/**
+ * @brief Get the HTTP status code of the response
+ *
+ * @return int (0 if not received yet)
+ */
+int WeatherFetch::getStatusCode() const{
+    return _statusCode;
+}
+
+/**
+ * @brief Get the number of body bytes received so far
+ *
+ * @return uint32_t
+ */
+uint32_t WeatherFetch::getBytesReceived() const{
+    return _bytesReceived;
+}
+
+/**
+ * @brief Get the length of the body announced in the headers
+ *
+ * @return int32_t bytes (-1 if unknown)
+ */
+int32_t WeatherFetch::getContentLength() const{
+    return _contentLength;
+}
+
+/**
+ * @brief Get the progress of the current fetch
+ *
+ * The phases before the body count 10% each, the body counts from 50% to 100% (by Content-Length if known).
+ *
+ * @return uint8_t percent
+ */
+uint8_t WeatherFetch::getProgress() const{
+    switch(_phase){
+        case wf_idle: return 0;
+        case wf_dns: return 0;
+        case wf_connect: return 10;
+        case wf_send: return 20;
+        case wf_headers: return 30;
+        case wf_body:
+            if(_contentLength > 0 && _bytesReceived < (uint32_t)_contentLength){
+                return 50 + (uint8_t)((uint64_t)_bytesReceived * 50 / _contentLength);
+            }
+            return 50;
+        case wf_parse: return 100;
+        case wf_done: return 100;
+        case wf_failed: return 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief Get the duration of the longest poll() call of the last fetch
+ *
+ * @return uint32_t milliseconds
+ */
+uint32_t WeatherFetch::getLongestSliceMillis() const{
+    return _longestSlice;
+}
+
+/**
+ * @brief Get the parser with the values of the last fetch
+ *
+ * @return const WeatherParser&
+ */
+const WeatherParser& WeatherFetch::getParser() const{
+    return _parser;
+}
+
+/**
+ * @brief Get the values of the last fetch if the response can be shown
+ *
+ * The response is accepted if the fetch is done, the document was parsed without error, all
+ * values were found and the temperature today is plausible. A truncated or malformed response
+ * leaves data unchanged, so the caller keeps the previous values.
+ *
+ * @param data values at noon, sunshine of today/tomorrow and all hourly values
+ * @return true if the values were taken over
+ */
+bool WeatherFetch::getValues(WeatherData *data) const{
+    if(_phase != wf_done || !_parser.isComplete() || _parser.hasError()) return false;
+    float tempToday = _parser.getTemperature(false);
+    if(!(tempToday > -WEATHER_PLAUSIBLE_TEMPERATURE && tempToday < WEATHER_PLAUSIBLE_TEMPERATURE)) return false;
+    for(uint8_t day = 0; day < 2; day++){
+        data->temperature[day] = _parser.getTemperature(day == 1);
+        data->weatherCode[day] = _parser.getWeatherCode(day == 1);
+        data->sunshine[day] = _parser.getSunshineDuration(day == 1);
+    }
+    data->forecast = _parser.getForecast();
+    return true;
+}
+
+/**
+ * @brief Get a readable name of a phase (for logging)
+ *
+ * @param phase
+ * @return const char*
+ */
+const char* WeatherFetch::getPhaseName(WeatherFetchPhase phase){
+    switch(phase){
+        case wf_idle: return "idle";
+        case wf_dns: return "dns";
+        case wf_connect: return "connect";
+        case wf_send: return "send";
+        case wf_headers: return "headers";
+        case wf_body: return "body";
+        case wf_parse: return "parse";
+        case wf_done: return "done";
+        case wf_failed: return "failed";
+    }
+    return "";
+}
+
+/**
+ * @brief Format the request path of the Open-Meteo forecast. The API returns the hourly values
+ *        in local time of the given timezone, it has to be the timezone of the clock.
+ *
+ * @param path buffer for the path
+ * @param size size of the buffer (WEATHER_PATH_SIZE)
+ * @param latE4 latitude in 1/10000 degree
+ * @param lonE4 longitude in 1/10000 degree
+ * @param timezone IANA name of the timezone, e.g. Europe/Berlin (percent-encoded here)
+ * @return true if the path fits into the buffer
+ */
+bool WeatherFetch::formatForecastPath(char *path, size_t size, int32_t latE4, int32_t lonE4, const char *timezone){
+    int length = snprintf(path, size, "/v1/forecast?latitude=%s%ld.%04ld&longitude=%s%ld.%04ld"
+                          "&hourly=temperature_2m,weathercode&daily=sunshine_duration&forecast_days=2&timezone=",
+                          latE4 < 0 ? "-" : "", labs(latE4) / 10000, labs(latE4) % 10000,
+                          lonE4 < 0 ? "-" : "", labs(lonE4) / 10000, labs(lonE4) % 10000);
+    if(length < 0 || (size_t)length >= size) return false;
+    size_t end = length;
+    for(; *timezone != '\0'; timezone++){
+        char c = *timezone;
+        bool unreserved = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                          c == '-' || c == '_' || c == '.' || c == '~';
+        if(end + (unreserved ? 1 : 3) >= size){
+            path[end] = '\0';
+            return false;
+        }
+        if(unreserved){
+            path[end++] = c;
+        }
+        else{
+            end += snprintf(path + end, size - end, "%%%02X", (uint8_t)c);
+        }
+    }
+    path[end] = '\0';
+    return true;
+}
+
+/**
+ * @brief Enter a new phase and restart the progress timeout
+ *
+ * @param phase
+ */
+void WeatherFetch::setPhase(WeatherFetchPhase phase){
+    _phase = phase;
+    _lastProgress = millis();
+}
+
+/**
+ * @brief Check if the budget of the current slice is not used up
+ *
+ * @return true if there is time left
+ */
+bool WeatherFetch::hasSliceTime() const{
+    return millis() - _sliceStart < _sliceBudget;
+}
+
+/**
+ * @brief End the fetch with an error
+ *
+ * @param client
+ */
+void WeatherFetch::fail(Client &client){
+    client.stop();
+    _failedPhase = _phase;
+    _phase = wf_failed;
+}
+
+/**
+ * @brief Fail the fetch if there was no progress for WEATHER_FETCH_TIMEOUT
+ *
+ * @param client
+ * @return true if the fetch failed
+ */
+bool WeatherFetch::checkTimeout(Client &client){
+    if(millis() - _lastProgress > WEATHER_FETCH_TIMEOUT){
+        fail(client);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Start the lookup of the hostname or check the running one (ends the slice)
+ *
+ * @param client
+ * @return false (slice ends)
+ */
+bool WeatherFetch::stepDns(Client &client){
+    WeatherResolveState state = wr_resolved;
+    if(_resolver != nullptr){
+        state = _resolver(_host, !_dnsStarted);
+        _dnsStarted = true;
+    }
+    if(state == wr_failed){
+        fail(client);
+    }
+    else if(state == wr_resolved){
+        setPhase(wf_connect);
+    }
+    else{
+        checkTimeout(client);
+    }
+    return false;
+}
+
+/**
+ * @brief Connect to the server, including the TLS handshake for secure clients (blocking, ends the slice)
+ *
+ * @param client
+ * @return false (slice ends)
+ */
+bool WeatherFetch::stepConnect(Client &client){
+    if(!client.connect(_host, _port)){
+        fail(client);
+        return false;
+    }
+    setPhase(wf_send);
+    return false;
+}
+
+/**
+ * @brief Send the request (HTTP/1.0, so the body is not sent with chunked transfer encoding)
+ *
+ * @param client
+ * @return true if the next phase can start in this slice
+ */
+bool WeatherFetch::stepSend(Client &client){
+    char request[320];
+    int length = snprintf(request, sizeof(request),
+                          "GET %s HTTP/1.0\r\nHost: %s\r\nUser-Agent: ESP8266WordClock\r\nConnection: close\r\n\r\n",
+                          _path, _host);
+    if(length <= 0 || length >= (int)sizeof(request) || client.write((const uint8_t*)request, length) != (size_t)length){
+        fail(client);
+        return false;
+    }
+    setPhase(wf_headers);
+    return true;
+}
+
+/**
+ * @brief Read the available header lines
+ *
+ * @param client
+ * @return true if the body starts and can be read in this slice
+ */
+bool WeatherFetch::stepHeaders(Client &client){
+    if(client.available() <= 0){
+        if(!client.connected()) fail(client);
+        else checkTimeout(client);
+        return false;
+    }
+    while(client.available() > 0 && hasSliceTime()){
+        int c = client.read();
+        if(c < 0) break;
+        _lastProgress = millis();
+        if(c == '\r') continue;
+        if(c != '\n'){
+            if(_lineLength < WEATHER_FETCH_LINE_SIZE - 1) _line[_lineLength++] = (char)c;
+            continue;
+        }
+        _line[_lineLength] = '\0';
+        if(_lineLength == 0){
+            // empty line: end of headers
+            if(_statusCode != 200){
+                fail(client);
+                return false;
+            }
+            setPhase(wf_body);
+            return true;
+        }
+        processHeaderLine();
+        _lineLength = 0;
+    }
+    return false;
+}
+
+/**
+ * @brief Evaluate the status line and the Content-Length header
+ *
+ */
+void WeatherFetch::processHeaderLine(){
+    if(_firstLine){
+        // "HTTP/1.1 200 OK"
+        const char *space = strchr(_line, ' ');
+        if(strncmp(_line, "HTTP/", 5) == 0 && space != nullptr){
+            _statusCode = atoi(space + 1);
+        }
+        _firstLine = false;
+    }
+    else if(strncasecmp(_line, "Content-Length:", 15) == 0){
+        _contentLength = atol(_line + 15);
+    }
+}
+
+/**
+ * @brief Read and parse the available body data
+ *
+ * @param client
+ * @return true if more data can be read in this slice
+ */
+bool WeatherFetch::stepBody(Client &client){
+    int available = client.available();
+    if(available <= 0){
+        if(!client.connected()) setPhase(wf_parse);
+        else checkTimeout(client);
+        return _phase == wf_parse;
+    }
+    char buffer[WEATHER_CHUNK_SIZE];
+    int length = client.read((uint8_t*)buffer, available < WEATHER_CHUNK_SIZE ? available : WEATHER_CHUNK_SIZE);
+    if(length <= 0) return false;
+    _lastProgress = millis();
+    _bytesReceived += length;
+    _parser.feed(buffer, length);
+
+    // read up to the end of the document: the hourly forecast may follow the noon values
+    bool allReceived = _contentLength >= 0 && _bytesReceived >= (uint32_t)_contentLength;
+    if(_parser.isDone() || _parser.hasError() || allReceived){
+        setPhase(wf_parse);
+    }
+    return true;
+}
+
+/**
+ * @brief Close the connection and complete the parser
+ *
+ * @param client
+ * @return false (fetch finished)
+ */
+bool WeatherFetch::stepParse(Client &client){
+    if(_bytesReceived == 0){
+        fail(client);
+        return false;
+    }
+    client.stop();
+    _parser.finish();
+    _phase = wf_done;
+    return false;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file weather_fetch.h
+ * @brief Non-blocking HTTP GET of the weather forecast, split into resumable phases
+ *
+ * Every call of poll() does a bounded slice of work and returns, so the main loop (animations,
+ * games, webserver) keeps running while the forecast is downloaded. Headers and body are read
+ * only as far as data is available, the body is parsed while it is received (WeatherParser).
+ * The DNS lookup is started in the first slice and polled in the following ones until the
+ * resolver reports the result or WEATHER_FETCH_TIMEOUT passes.
+ *
+ * Connect still blocks: WiFiClientSecure::connect does the TCP connect and the TLS handshake
+ * in one call and the ESP8266 core has no API to continue a handshake later. The connect gets a
+ * slice of its own, its duration is bounded by the timeout of the client (WEATHER_CONNECT_TIMEOUT
+ * of WeatherClient) and reported in ConnectionStats and NetworkHealth.
+ *
+ */
+
+#ifndef weather_fetch_h
+#define weather_fetch_h
+
+#include <Arduino.h>
+#include <Client.h>
+#include "weather_parser.h"
+#include "weather_cache.h"
+
+#define WEATHER_CHUNK_SIZE 256          // bytes read from the stream per parser call
+#define WEATHER_FETCH_TIMEOUT 5000      // ms without progress before the fetch is abandoned
+#define WEATHER_FETCH_LINE_SIZE 48      // longer header lines are truncated (only the start is evaluated)
+#define WEATHER_PATH_SIZE 200           // request path of the Open-Meteo forecast incl. location and timezone
+#define WEATHER_PLAUSIBLE_TEMPERATURE 60 // responses with a noon temperature outside of +-60 C are rejected
+
+enum WeatherFetchPhase {wf_idle, wf_dns, wf_connect, wf_send, wf_headers, wf_body, wf_parse, wf_done, wf_failed};
+enum WeatherResolveState {wr_pending, wr_resolved, wr_failed};
+
+// starts the lookup of host if start is true, otherwise returns the state of the running lookup
+typedef WeatherResolveState (*WeatherResolver)(const char *host, bool start);
+
+class WeatherFetch{
+
+    public:
+        WeatherFetch();
+        void setResolver(WeatherResolver resolver);
+        void start(const char *host, uint16_t port, const char *path);
+        WeatherFetchPhase poll(Client &client, uint32_t budgetMs);
+        void abort(Client &client);
+        bool isBusy() const;
+        WeatherFetchPhase getPhase() const;
+        WeatherFetchPhase getFailedPhase() const;
+        int getStatusCode() const;
+        uint32_t getBytesReceived() const;
+        int32_t getContentLength() const;
+        uint8_t getProgress() const;
+        uint32_t getLongestSliceMillis() const;
+        const WeatherParser& getParser() const;
+        bool getValues(WeatherData *data) const;
+        static const char* getPhaseName(WeatherFetchPhase phase);
+        static bool formatForecastPath(char *path, size_t size, int32_t latE4, int32_t lonE4, const char *timezone);
+
+    private:
+        WeatherResolver _resolver;
+        const char *_host;
+        const char *_path;
+        uint16_t _port;
+        WeatherFetchPhase _phase;
+        WeatherFetchPhase _failedPhase;
+        unsigned long _lastProgress;
+        unsigned long _sliceStart;
+        uint32_t _sliceBudget;
+        uint32_t _longestSlice;
+        int _statusCode;
+        int32_t _contentLength;
+        uint32_t _bytesReceived;
+        char _line[WEATHER_FETCH_LINE_SIZE];
+        uint8_t _lineLength;
+        bool _firstLine;
+        bool _dnsStarted;
+        WeatherParser _parser;
+
+        void setPhase(WeatherFetchPhase phase);
+        bool hasSliceTime() const;
+        void fail(Client &client);
+        bool checkTimeout(Client &client);
+        bool stepDns(Client &client);
+        bool stepConnect(Client &client);
+        bool stepSend(Client &client);
+        bool stepHeaders(Client &client);
+        bool stepBody(Client &client);
+        bool stepParse(Client &client);
+        void processHeaderLine();
+};
+
+#endif
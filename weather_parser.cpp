@@ -0,0 +1,162 @@
+#include "weather_parser.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define WEATHER_FOUND_ALL 0x3F
+
+/**
+ * @brief Construct a new WeatherParser object
+ *
+ */
+WeatherParser::WeatherParser() : _json(this){
+    reset();
+}
+
+/**
+ * @brief Prepare for a new response, all values are set to WEATHER_MISSING
+ *
+ */
+void WeatherParser::reset(){
+    _json.reset();
+    for(uint8_t i = 0; i < 2; i++){
+        _temperature[i] = WEATHER_MISSING;
+        _weatherCode[i] = WEATHER_MISSING;
+        _sunshine[i] = WEATHER_MISSING;
+    }
+    _found = 0;
+    _forecast.clear();
+}
+
+/**
+ * @brief Parse the next chunk of the response body
+ *
+ * @param data chunk (does not need to be null terminated)
+ * @param length number of bytes in the chunk
+ * @return true if the response is still valid JSON
+ */
+bool WeatherParser::feed(const char *data, size_t length){
+    return _json.feed(data, length);
+}
+
+/**
+ * @brief Signal the end of the response body
+ *
+ * @return true if the response was complete and valid JSON
+ */
+bool WeatherParser::finish(){
+    return _json.finish();
+}
+
+/**
+ * @brief Check if the response is malformed
+ *
+ * @return true on error
+ */
+bool WeatherParser::hasError() const{
+    return _json.hasError();
+}
+
+/**
+ * @brief Check if the end of the JSON document was reached
+ *
+ * @return true if done
+ */
+bool WeatherParser::isDone() const{
+    return _json.isDone();
+}
+
+/**
+ * @brief Check if all six values were found
+ *
+ * @return true if complete
+ */
+bool WeatherParser::isComplete() const{
+    return _found == WEATHER_FOUND_ALL;
+}
+
+/**
+ * @brief Get the temperature at noon
+ *
+ * @param tomorrow false for today
+ * @return float degree celsius (WEATHER_MISSING if not found)
+ */
+float WeatherParser::getTemperature(bool tomorrow) const{
+    return _temperature[tomorrow ? 1 : 0];
+}
+
+/**
+ * @brief Get the WMO weather code at noon
+ *
+ * @param tomorrow false for today
+ * @return int code (WEATHER_MISSING if not found)
+ */
+int WeatherParser::getWeatherCode(bool tomorrow) const{
+    return _weatherCode[tomorrow ? 1 : 0];
+}
+
+/**
+ * @brief Get the sunshine duration of the day
+ *
+ * @param tomorrow false for today
+ * @return float seconds (WEATHER_MISSING if not found)
+ */
+float WeatherParser::getSunshineDuration(bool tomorrow) const{
+    return _sunshine[tomorrow ? 1 : 0];
+}
+
+/**
+ * @brief Get all hourly values of the response
+ *
+ * @return const HourlyForecast&
+ */
+const HourlyForecast& WeatherParser::getForecast() const{
+    return _forecast;
+}
+
+/**
+ * @brief Store the value if it is one of the wanted array elements
+ *
+ * @param json tokenizer with the path of the value
+ * @param type type of the value
+ * @param value text of the value
+ */
+void WeatherParser::onValue(const JsonStream &json, JsonValueType type, const char *value){
+    // wanted values are at {"hourly"|"daily": {"<key>": [<index>]}}
+    if(json.getDepth() != 3 || json.isArray(1) || !json.isArray(2)) return;
+
+    const char *section = json.getKey(0);
+    const char *key = json.getKey(1);
+    uint16_t index = json.getIndex(2);
+
+    if(type == json_string){
+        // local time of the first hour
+        if(index == 0 && strcmp(section, "hourly") == 0 && strcmp(key, "time") == 0) _forecast.setStart(value);
+        return;
+    }
+    if(type != json_number) return;
+
+    if(strcmp(section, "hourly") == 0){
+        if(index < FORECAST_HOURS){
+            if(strcmp(key, "temperature_2m") == 0) _forecast.setTemperature(index, atof(value));
+            else if(strcmp(key, "weathercode") == 0) _forecast.setWeatherCode(index, atoi(value));
+        }
+
+        uint8_t day;
+        if(index == WEATHER_INDEX_TODAY_NOON) day = 0;
+        else if(index == WEATHER_INDEX_TOMORROW_NOON) day = 1;
+        else return;
+
+        if(strcmp(key, "temperature_2m") == 0){
+            _temperature[day] = atof(value);
+            _found |= 0x01 << day;
+        }
+        else if(strcmp(key, "weathercode") == 0){
+            _weatherCode[day] = atoi(value);
+            _found |= 0x04 << day;
+        }
+    }
+    else if(strcmp(section, "daily") == 0 && index < 2 && strcmp(key, "sunshine_duration") == 0){
+        _sunshine[index] = atof(value);
+        _found |= 0x10 << index;
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file weather_parser.h
+ * @brief Extracts the values shown by the clock from an Open-Meteo forecast response
+ *
+ * The response is passed through a JsonStream, so it can be parsed chunk by chunk while it is
+ * received. The hourly temperature_2m/weathercode at noon of today and tomorrow and the daily
+ * sunshine_duration of today and tomorrow are kept, all hourly values go to a HourlyForecast. The *_units sections contain the same keys
+ * with string values, they are ignored because only numbers inside the data arrays are matched.
+ *
+ */
+
+#ifndef weather_parser_h
+#define weather_parser_h
+
+#include <Arduino.h>
+#include "json_stream.h"
+#include "hourly_forecast.h"
+
+#define WEATHER_INDEX_TODAY_NOON 12     // hourly arrays start at 00:00 today (local time)
+#define WEATHER_INDEX_TOMORROW_NOON 36
+#define WEATHER_MISSING -999
+
+class WeatherParser : public JsonHandler{
+
+    public:
+        WeatherParser();
+        void reset();
+        bool feed(const char *data, size_t length);
+        bool finish();
+        bool hasError() const;
+        bool isDone() const;
+        bool isComplete() const;
+        float getTemperature(bool tomorrow) const;
+        int getWeatherCode(bool tomorrow) const;
+        float getSunshineDuration(bool tomorrow) const;
+        const HourlyForecast& getForecast() const;
+        void onValue(const JsonStream &json, JsonValueType type, const char *value) override;
+
+    private:
+        JsonStream _json;
+        float _temperature[2];
+        int _weatherCode[2];
+        float _sunshine[2];
+        uint8_t _found;
+        HourlyForecast _forecast;
+};
+
+#endif
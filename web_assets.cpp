@@ -0,0 +1,253 @@
+#include "web_assets.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define WEB_STRINGIFY(x) #x
+#define WEB_TO_STRING(x) WEB_STRINGIFY(x)
+
+/**
+ * @brief Construct a new AssetManifest object without entries
+ *
+ */
+AssetManifest::AssetManifest(){
+    clear();
+}
+
+/**
+ * @brief Remove all entries (before loading the manifest again)
+ *
+ */
+void AssetManifest::clear(){
+    _count = 0;
+}
+
+/**
+ * @brief Add the entry of one manifest line "<path> <size> <hash>"
+ *
+ * @param line text of the line (without line break), empty lines and lines starting with # are ignored
+ * @return true if an entry was added
+ */
+bool AssetManifest::parseLine(const char *line){
+    if(_count >= WEB_ASSET_MAX || line[0] != '/') return false;
+    const char *end = strchr(line, ' ');
+    if(end == nullptr) return false;
+    char *next;
+    unsigned long size = strtoul(end + 1, &next, 10);
+    if(next == end + 1 || *next != ' ') return false;
+    const char *hashStart = next + 1;
+    unsigned long hash = strtoul(hashStart, &next, 16);
+    if(next == hashStart || (*next != '\0' && *next != '\r')) return false;
+    char path[WEB_ASSET_LINE];
+    size_t length = end - line;
+    if(length >= sizeof(path)) return false;
+    memcpy(path, line, length);
+    path[length] = '\0';
+    Entry &entry = _entries[_count++];
+    entry.pathHash = hashPath(path);
+    entry.size = size;
+    entry.hash = hash;
+    return true;
+}
+
+/**
+ * @brief Get the number of entries
+ *
+ * @return uint8_t
+ */
+uint8_t AssetManifest::getCount() const{
+    return _count;
+}
+
+/**
+ * @brief Get the strong ETag of a file
+ *
+ * @param path path of the uncompressed file, e.g. /index.html
+ * @param size size of the uncompressed file in LittleFS, WEB_SIZE_UNKNOWN if only the gzip variant exists
+ * @param gzip the gzip variant is sent (gets an own ETag)
+ * @param etag ETag with quotes, terminated
+ * @return true if the manifest has a matching entry
+ */
+bool AssetManifest::getETag(const char *path, uint32_t size, bool gzip, char etag[WEB_ETAG_SIZE]) const{
+    uint32_t pathHash = hashPath(path);
+    for(uint8_t i = 0; i < _count; i++){
+        const Entry &entry = _entries[i];
+        if(entry.pathHash != pathHash) continue;
+        if(size != WEB_SIZE_UNKNOWN && size != entry.size) return false;
+        formatETag(entry.hash, gzip, etag);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Format the strong ETag of a file
+ *
+ * @param hash hash of the uncompressed file
+ * @param gzip ETag of the gzip variant
+ * @param etag ETag with quotes, terminated
+ */
+void AssetManifest::formatETag(uint32_t hash, bool gzip, char etag[WEB_ETAG_SIZE]){
+    snprintf(etag, WEB_ETAG_SIZE, gzip ? "\"%08lx-gz\"" : "\"%08lx\"", (unsigned long)hash);
+}
+
+/**
+ * @brief FNV-1a hash of a path (the manifest keeps only the hash of the paths)
+ *
+ * @param path path
+ * @return uint32_t
+ */
+uint32_t AssetManifest::hashPath(const char *path){
+    uint32_t hash = 2166136261UL;
+    for(; *path != '\0'; path++){
+        hash ^= (uint8_t)*path;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Check if the If-None-Match header of a request contains the ETag
+ *
+ * @param ifNoneMatch value of the header (list of ETags, weak ones with W/, or *)
+ * @param etag ETag of the file with quotes
+ * @return true if the cached copy of the client is up to date (answer 304)
+ */
+bool AssetManifest::matches(const char *ifNoneMatch, const char *etag){
+    size_t etagLength = strlen(etag);
+    const char *token = ifNoneMatch;
+    while(*token != '\0'){
+        while(*token == ' ' || *token == ',') token++;
+        size_t length = strcspn(token, ",");
+        while(length > 0 && token[length - 1] == ' ') length--;
+        if(length == 1 && token[0] == '*') return true;
+        // If-None-Match uses the weak comparison
+        if(length > 2 && strncmp(token, "W/", 2) == 0){
+            token += 2;
+            length -= 2;
+        }
+        if(length == etagLength && strncmp(token, etag, length) == 0) return true;
+        token += strcspn(token, ",");
+    }
+    return false;
+}
+
+/**
+ * @brief Check if a client takes gzip encoded responses
+ *
+ * @param acceptEncoding value of the Accept-Encoding header
+ * @return true if gzip is listed and not excluded with q=0
+ */
+bool AssetManifest::acceptsGzip(const char *acceptEncoding){
+    const char *token = acceptEncoding;
+    while(*token != '\0'){
+        while(*token == ' ' || *token == ',') token++;
+        size_t length = strcspn(token, ",");
+        size_t nameLength = strcspn(token, ",; ");
+        if(nameLength == 4 && strncasecmp(token, "gzip", 4) == 0){
+            const char *quality = strstr(token, "q=");
+            if(quality == nullptr || quality > token + length) return true;
+            return atof(quality + 2) > 0;
+        }
+        token += length;
+    }
+    return false;
+}
+
+/**
+ * @brief Get the Cache-Control value for a file with ETag
+ *
+ * @param path path of the file
+ * @return const char* html pages are revalidated on every load (they reference the other files
+ *         and show changes of the UI at once), all other files are kept WEB_CACHE_MAX_AGE seconds
+ */
+const char* AssetManifest::getCacheControl(const char *path){
+    size_t length = strlen(path);
+    if(length >= 5 && strcmp(path + length - 5, ".html") == 0) return "no-cache";
+    return "max-age=" WEB_TO_STRING(WEB_CACHE_MAX_AGE);
+}
+
+/**
+ * @brief Construct a new AssetStats object
+ *
+ */
+AssetStats::AssetStats(){
+    _requests = 0;
+    _notModified = 0;
+    _gzip = 0;
+    _bytes = 0;
+    _millis = 0;
+    _maxMillis = 0;
+}
+
+/**
+ * @brief Record one static file response
+ *
+ * @param bytes bytes of the body sent
+ * @param durationMs time from the request to the last byte written
+ * @param notModified answered with 304
+ * @param gzip the gzip variant was sent
+ */
+void AssetStats::record(uint32_t bytes, uint32_t durationMs, bool notModified, bool gzip){
+    _requests++;
+    if(notModified) _notModified++;
+    if(gzip) _gzip++;
+    _bytes += bytes;
+    _millis += durationMs;
+    if(durationMs > _maxMillis) _maxMillis = durationMs;
+}
+
+/**
+ * @brief Get the number of static file responses
+ *
+ * @return uint32_t
+ */
+uint32_t AssetStats::getRequestCount() const{
+    return _requests;
+}
+
+/**
+ * @brief Get the number of 304 responses
+ *
+ * @return uint32_t
+ */
+uint32_t AssetStats::getNotModifiedCount() const{
+    return _notModified;
+}
+
+/**
+ * @brief Get the number of responses with the gzip variant
+ *
+ * @return uint32_t
+ */
+uint32_t AssetStats::getGzipCount() const{
+    return _gzip;
+}
+
+/**
+ * @brief Get the sum of the body bytes sent
+ *
+ * @return uint32_t
+ */
+uint32_t AssetStats::getBytes() const{
+    return _bytes;
+}
+
+/**
+ * @brief Get the sum of the response times
+ *
+ * @return uint32_t ms
+ */
+uint32_t AssetStats::getMillis() const{
+    return _millis;
+}
+
+/**
+ * @brief Get the longest response time
+ *
+ * @return uint32_t ms
+ */
+uint32_t AssetStats::getMaxMillis() const{
+    return _maxMillis;
+}
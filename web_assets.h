@@ -0,0 +1,71 @@
+/**
+ * @file web_assets.h
+ * @brief Cache validators of the web UI files and statistics of the static file responses
+ *
+ * scripts/build_web_assets.py writes a gzip variant of every file in data/ and the manifest
+ * data/assets.txt with one line per file: "<path> <size> <hash>" (size of the uncompressed file,
+ * first 8 hex digits of its SHA-256). The manifest is loaded once, a lookup gives the strong ETag
+ * of a file. An entry whose size differs from the file in LittleFS is stale (file changed without
+ * running the script again): the file is then served without ETag and without its gzip variant.
+ *
+ */
+
+#ifndef web_assets_h
+#define web_assets_h
+
+#include <Arduino.h>
+
+#define WEB_ASSET_MANIFEST "/assets.txt"
+#define WEB_ASSET_MAX 32
+#define WEB_ASSET_LINE 64           // longest manifest line + terminating zero
+#define WEB_ETAG_SIZE 14            // "xxxxxxxx-gz" with quotes + terminating zero
+#define WEB_SIZE_UNKNOWN 0xFFFFFFFF // only the gzip variant is stored
+#define WEB_CACHE_MAX_AGE 604800    // one week for icons and styles, html is revalidated on every load
+#define WEB_SEND_BUFFER 1460        // one TCP segment per write
+
+class AssetManifest{
+
+    public:
+        AssetManifest();
+        void clear();
+        bool parseLine(const char *line);
+        uint8_t getCount() const;
+        bool getETag(const char *path, uint32_t size, bool gzip, char etag[WEB_ETAG_SIZE]) const;
+        static void formatETag(uint32_t hash, bool gzip, char etag[WEB_ETAG_SIZE]);
+        static uint32_t hashPath(const char *path);
+        static bool matches(const char *ifNoneMatch, const char *etag);
+        static bool acceptsGzip(const char *acceptEncoding);
+        static const char* getCacheControl(const char *path);
+
+    private:
+        struct Entry {
+            uint32_t pathHash;
+            uint32_t size;
+            uint32_t hash;
+        };
+        Entry _entries[WEB_ASSET_MAX];
+        uint8_t _count;
+};
+
+class AssetStats{
+
+    public:
+        AssetStats();
+        void record(uint32_t bytes, uint32_t durationMs, bool notModified, bool gzip);
+        uint32_t getRequestCount() const;
+        uint32_t getNotModifiedCount() const;
+        uint32_t getGzipCount() const;
+        uint32_t getBytes() const;
+        uint32_t getMillis() const;
+        uint32_t getMaxMillis() const;
+
+    private:
+        uint32_t _requests;
+        uint32_t _notModified;
+        uint32_t _gzip;
+        uint32_t _bytes;
+        uint32_t _millis;
+        uint32_t _maxMillis;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "web_bundle.h"
+#include "web_bundle_data.h"
+#include <string.h>
+
+/**
+ * @brief Get the number of files in the bundle
+ *
+ * @return uint8_t
+ */
+uint8_t WebBundle::getCount(){
+    return WEB_BUNDLE_COUNT;
+}
+
+/**
+ * @brief Find a file in the bundle
+ *
+ * @param path path of the uncompressed file, e.g. /index.html
+ * @return int8_t index of the file, -1 if it is not in the bundle
+ */
+int8_t WebBundle::find(const char *path){
+    for(uint8_t i = 0; i < WEB_BUNDLE_COUNT; i++){
+        WebBundleEntry entry;
+        getEntry(i, &entry);
+        if(strcmp_P(path, entry.path) == 0) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Copy an entry of the index from flash
+ *
+ * @param index index of the file (below getCount())
+ * @param entry copy of the entry
+ */
+void WebBundle::getEntry(uint8_t index, WebBundleEntry *entry){
+    memcpy_P(entry, &WEB_BUNDLE_INDEX[index], sizeof(WebBundleEntry));
+}
+
+/**
+ * @brief Copy the path of a file from flash
+ *
+ * @param index index of the file (below getCount())
+ * @param path buffer for the path
+ * @param size size of the buffer
+ * @return true if the path fits into the buffer
+ */
+bool WebBundle::getPath(uint8_t index, char *path, size_t size){
+    WebBundleEntry entry;
+    getEntry(index, &entry);
+    for(size_t i = 0; i < size; i++){
+        path[i] = pgm_read_byte(entry.path + i);
+        if(path[i] == '\0') return true;
+    }
+    path[size - 1] = '\0';
+    return false;
+}
+
+/**
+ * @brief Get the gzip data of a file (in flash, send with sendContent_P())
+ *
+ * @param entry entry of the file
+ * @return PGM_P
+ */
+PGM_P WebBundle::getData(const WebBundleEntry &entry){
+    return (PGM_P)WEB_BUNDLE_DATA + entry.offset;
+}
+
+/**
+ * @brief Get the ETag of a file, the same as for its gzip variant in LittleFS
+ *
+ * @param entry entry of the file
+ * @param etag ETag with quotes, terminated
+ */
+void WebBundle::getETag(const WebBundleEntry &entry, char etag[WEB_ETAG_SIZE]){
+    AssetManifest::formatETag(entry.hash, true, etag);
+}
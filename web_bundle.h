@@ -0,0 +1,38 @@
+/**
+ * @file web_bundle.h
+ * @brief Web UI files compiled into the sketch (gzip compressed, in flash)
+ *
+ * scripts/build_web_assets.py --bundle packs all files of data/ into web_bundle_data.h: one
+ * PROGMEM array with the gzip variants of all files one after another and an index with path,
+ * position and the hash of each file (same hash as in the asset manifest, so a file has the same
+ * ETag from the bundle and from LittleFS). The files are sent directly from flash, a file with
+ * the same path in LittleFS takes precedence (user override).
+ *
+ */
+
+#ifndef web_bundle_h
+#define web_bundle_h
+
+#include <Arduino.h>
+#include "web_assets.h"
+
+struct WebBundleEntry {
+    PGM_P path;
+    uint32_t offset;                // position of the gzip data in the bundle
+    uint32_t length;                // length of the gzip data
+    uint32_t size;                  // size of the uncompressed file
+    uint32_t hash;                  // first 32 bit of the SHA-256 of the uncompressed file
+};
+
+class WebBundle{
+
+    public:
+        static uint8_t getCount();
+        static int8_t find(const char *path);
+        static void getEntry(uint8_t index, WebBundleEntry *entry);
+        static bool getPath(uint8_t index, char *path, size_t size);
+        static PGM_P getData(const WebBundleEntry &entry);
+        static void getETag(const WebBundleEntry &entry, char etag[WEB_ETAG_SIZE]);
+};
+
+#endif
@@ -0,0 +1,1116 @@
+// Generated by scripts/build_web_assets.py --bundle from data/, do not edit.
+// Included only by web_bundle.cpp.
+
+#define WEB_BUNDLE_COUNT 17
+
+static const char WEB_BUNDLE_PATH_0[] PROGMEM = "/fs.html";
+static const char WEB_BUNDLE_PATH_1[] PROGMEM = "/icons/all_icons.svg";
+static const char WEB_BUNDLE_PATH_2[] PROGMEM = "/icons/arrow_left.svg";
+static const char WEB_BUNDLE_PATH_3[] PROGMEM = "/icons/arrow_right.svg";
+static const char WEB_BUNDLE_PATH_4[] PROGMEM = "/icons/clock.svg";
+static const char WEB_BUNDLE_PATH_5[] PROGMEM = "/icons/diclock.svg";
+static const char WEB_BUNDLE_PATH_6[] PROGMEM = "/icons/pause.svg";
+static const char WEB_BUNDLE_PATH_7[] PROGMEM = "/icons/pingpong.svg";
+static const char WEB_BUNDLE_PATH_8[] PROGMEM = "/icons/play.svg";
+static const char WEB_BUNDLE_PATH_9[] PROGMEM = "/icons/playpause.svg";
+static const char WEB_BUNDLE_PATH_10[] PROGMEM = "/icons/refresh.svg";
+static const char WEB_BUNDLE_PATH_11[] PROGMEM = "/icons/settings.svg";
+static const char WEB_BUNDLE_PATH_12[] PROGMEM = "/icons/snake.svg";
+static const char WEB_BUNDLE_PATH_13[] PROGMEM = "/icons/spiral.svg";
+static const char WEB_BUNDLE_PATH_14[] PROGMEM = "/icons/tetris.svg";
+static const char WEB_BUNDLE_PATH_15[] PROGMEM = "/index.html";
+static const char WEB_BUNDLE_PATH_16[] PROGMEM = "/style.css";
+
+static const uint8_t WEB_BUNDLE_DATA[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0xdd, 0x52, 0xdb, 0x48,
+    0x16, 0xbe, 0x86, 0xa7, 0x38, 0x28, 0x09, 0x92, 0x0a, 0x23, 0x83, 0x67, 0x27, 0x95, 0xc1, 0xb6,
+    0xa8, 0x10, 0x60, 0x77, 0x76, 0x93, 0x21, 0x55, 0x24, 0xb5, 0xb5, 0x0b, 0x4c, 0xd1, 0x96, 0x8e,
+    0xec, 0x1e, 0xe4, 0x96, 0xa6, 0xbb, 0x65, 0xe2, 0x65, 0xfc, 0x2c, 0xfb, 0x16, 0x7b, 0xb5, 0x77,
+    0x79, 0xb1, 0x3d, 0xa7, 0x5b, 0x06, 0x9b, 0x90, 0x54, 0x2e, 0x96, 0x0b, 0xab, 0xe9, 0x3e, 0x7d,
+    0x7e, 0xbf, 0xf3, 0xd3, 0x9b, 0x83, 0xad, 0xe3, 0xb3, 0x37, 0x1f, 0xfe, 0xf1, 0xfe, 0x04, 0xfe,
+    0xf2, 0xe1, 0xdd, 0xdb, 0x14, 0x06, 0x5b, 0xbb, 0xbb, 0x70, 0x5a, 0x69, 0x98, 0x56, 0x1a, 0x41,
+    0xaa, 0xa2, 0xd2, 0x53, 0x61, 0x65, 0xa5, 0x60, 0x26, 0x8d, 0xb4, 0x07, 0x30, 0xb1, 0xb6, 0x36,
+    0x07, 0xdd, 0x6e, 0x21, 0x6b, 0x53, 0xdd, 0x24, 0x39, 0xc2, 0xee, 0x6e, 0xba, 0x39, 0x98, 0xd8,
+    0x69, 0x09, 0xa5, 0x50, 0xe3, 0x61, 0x90, 0x63, 0x90, 0x6e, 0x02, 0x0c, 0x26, 0x28, 0xf2, 0x74,
+    0x73, 0x63, 0x30, 0x45, 0x2b, 0x20, 0x9b, 0x08, 0x6d, 0xd0, 0x0e, 0x83, 0x8f, 0x1f, 0x4e, 0x77,
+    0x5f, 0x05, 0xf7, 0xfb, 0x4a, 0x4c, 0x71, 0x18, 0xcc, 0x24, 0xde, 0xd6, 0x95, 0xb6, 0x01, 0x64,
+    0x95, 0xb2, 0xa8, 0x88, 0xee, 0x56, 0xe6, 0x76, 0x32, 0xcc, 0x71, 0x26, 0x33, 0xdc, 0x75, 0xff,
+    0x74, 0x48, 0x1d, 0x69, 0xa5, 0x28, 0x77, 0x4d, 0x26, 0x4a, 0x1c, 0xee, 0x3b, 0x2e, 0xa5, 0x54,
+    0x37, 0xa0, 0xb1, 0x1c, 0x06, 0xc6, 0xce, 0x4b, 0x34, 0x13, 0x44, 0x62, 0x33, 0xd1, 0x58, 0xb4,
+    0x3b, 0x49, 0x66, 0x8c, 0xa3, 0xb4, 0xd2, 0x96, 0x98, 0x9e, 0x4a, 0x22, 0x9a, 0x1b, 0x8b, 0x53,
+    0x78, 0x27, 0x94, 0x18, 0xa3, 0x1e, 0x74, 0xfd, 0x09, 0x91, 0x98, 0x4c, 0xcb, 0xda, 0xd2, 0x0a,
+    0x20, 0xaf, 0xb2, 0x66, 0x4a, 0x9a, 0x24, 0x22, 0xcf, 0x4f, 0x66, 0xb4, 0x78, 0x2b, 0xe9, 0x92,
+    0x42, 0x1d, 0x85, 0xc7, 0x67, 0xef, 0xde, 0x78, 0x35, 0xdf, 0x56, 0x22, 0xc7, 0x3c, 0xec, 0x40,
+    0x14, 0xc3, 0x30, 0x85, 0xbb, 0xcd, 0x8d, 0x8d, 0x92, 0xc8, 0xa2, 0xbf, 0x9e, 0x9f, 0xfd, 0x92,
+    0xd4, 0x6c, 0x71, 0x54, 0x56, 0xa4, 0xec, 0xb9, 0xad, 0x34, 0x89, 0x4a, 0xc6, 0x68, 0x7f, 0x26,
+    0xc9, 0x51, 0x68, 0xc8, 0xd8, 0xa3, 0x79, 0x18, 0xc7, 0x71, 0x9f, 0xee, 0x8c, 0xac, 0x7a, 0x42,
+    0x4c, 0x56, 0xca, 0xec, 0x66, 0x8d, 0x37, 0x80, 0x2c, 0x20, 0xda, 0x22, 0x1f, 0x15, 0x52, 0x4f,
+    0xa3, 0xeb, 0xbf, 0x4b, 0x7d, 0x43, 0x44, 0x13, 0x68, 0xa3, 0x84, 0x1a, 0xd5, 0x21, 0xbc, 0x2e,
+    0x4b, 0x84, 0x63, 0x41, 0x5c, 0x60, 0x8c, 0x13, 0xfa, 0x9d, 0xa1, 0x2e, 0x29, 0x9a, 0x2a, 0xb9,
+    0x54, 0xc7, 0x0d, 0x4c, 0x1b, 0x63, 0x2c, 0x08, 0x65, 0xb2, 0x49, 0x29, 0xf1, 0xf3, 0xbf, 0x51,
+    0xe5, 0x50, 0x98, 0xc4, 0x05, 0xf0, 0x56, 0x62, 0x8e, 0x9a, 0xe2, 0x98, 0x13, 0xf5, 0x75, 0x1c,
+    0x03, 0xb2, 0x4a, 0x49, 0xad, 0xdd, 0xf7, 0x18, 0x0b, 0xd1, 0x94, 0x36, 0x72, 0x3a, 0x2f, 0xf8,
+    0x17, 0xa0, 0xfd, 0x14, 0x8d, 0xca, 0x1c, 0x4a, 0x9c, 0xf9, 0xb6, 0x8a, 0x9d, 0x2b, 0xd0, 0xc2,
+    0x74, 0xce, 0x06, 0xc1, 0xf0, 0xc1, 0x9f, 0xbf, 0x37, 0xa8, 0xe7, 0xe7, 0x58, 0x62, 0x46, 0x4e,
+    0x89, 0xc2, 0xa9, 0x90, 0x2a, 0x8c, 0x3b, 0xa0, 0x2a, 0x8b, 0x39, 0xd1, 0x85, 0x21, 0x73, 0x2f,
+    0xd0, 0x66, 0x93, 0xe8, 0xfa, 0x90, 0xfd, 0x34, 0x7c, 0x7e, 0x67, 0xab, 0xc5, 0x75, 0x9c, 0x58,
+    0x32, 0x26, 0x82, 0x48, 0xa3, 0xa9, 0x2b, 0x65, 0xb0, 0x75, 0x0b, 0xdc, 0xff, 0x69, 0xb4, 0x8d,
+    0x56, 0xb0, 0x3c, 0x4f, 0x7e, 0x33, 0x95, 0x62, 0x65, 0x97, 0xe7, 0x8b, 0x96, 0x45, 0xc4, 0x07,
+    0x2b, 0x4e, 0x65, 0x3d, 0x19, 0xe9, 0x24, 0x9d, 0x4f, 0x92, 0xba, 0xaa, 0x23, 0xd6, 0x88, 0xa0,
+    0x49, 0x5b, 0x91, 0xe8, 0xc0, 0xc8, 0x51, 0x8b, 0xc4, 0x05, 0x13, 0xdf, 0x54, 0x53, 0x8a, 0x2d,
+    0x46, 0xa3, 0x0e, 0x34, 0x2a, 0xc7, 0x42, 0x2a, 0xcc, 0x3b, 0x70, 0x67, 0x50, 0x51, 0x86, 0xc8,
+    0x99, 0xb4, 0xf3, 0x03, 0x08, 0x47, 0xc2, 0x60, 0xe8, 0xbc, 0x43, 0x12, 0x1c, 0x5b, 0xb6, 0x25,
+    0x7a, 0xe0, 0xc6, 0xec, 0x23, 0x91, 0x14, 0x55, 0x49, 0x2e, 0xa7, 0xcd, 0x76, 0x15, 0xc3, 0x1f,
+    0x7f, 0x00, 0x79, 0x10, 0x0e, 0x69, 0x6b, 0x34, 0xb7, 0x68, 0x60, 0x97, 0x24, 0xfb, 0xd5, 0xc1,
+    0xf2, 0x16, 0x7f, 0xf8, 0x0e, 0x7f, 0x19, 0x44, 0x64, 0x5d, 0xb7, 0x0b, 0x1c, 0xbb, 0x93, 0xf3,
+    0xf7, 0xaf, 0x7a, 0x2f, 0x5f, 0x02, 0x69, 0x93, 0x93, 0x5d, 0x8d, 0x62, 0xb1, 0x84, 0x0c, 0xeb,
+    0x14, 0xf1, 0xe1, 0x48, 0xa4, 0x22, 0x84, 0x71, 0xc2, 0xb3, 0xc3, 0x07, 0x4a, 0xcc, 0xd2, 0x81,
+    0x54, 0x75, 0x63, 0xc1, 0xce, 0x6b, 0x4a, 0x47, 0x2d, 0x72, 0x59, 0x05, 0x20, 0xf3, 0x61, 0xd0,
+    0x0d, 0xda, 0x14, 0x1d, 0xeb, 0xaa, 0xa9, 0x29, 0x3f, 0x27, 0x98, 0xdd, 0x20, 0x1d, 0xb4, 0x8b,
+    0x20, 0x1d, 0x94, 0x62, 0x84, 0x25, 0x43, 0x90, 0xa9, 0x53, 0xd8, 0x7e, 0xb6, 0xdf, 0x7b, 0xb5,
+    0xff, 0xd3, 0x0f, 0xfd, 0x41, 0xd7, 0x9d, 0xa4, 0x03, 0x53, 0x0b, 0xe5, 0x98, 0x65, 0x3a, 0x48,
+    0x77, 0x56, 0xce, 0x9d, 0xe0, 0x2e, 0x1f, 0xaf, 0x10, 0x19, 0x19, 0x2c, 0x37, 0x43, 0xef, 0xbd,
+    0xaf, 0x41, 0x87, 0x51, 0x1f, 0xc6, 0x09, 0x95, 0x95, 0xd7, 0xd6, 0x6a, 0x39, 0x6a, 0x2c, 0x46,
+    0xa1, 0x70, 0x38, 0xa4, 0xb4, 0x09, 0xbb, 0x4d, 0x5d, 0x52, 0x7e, 0x1e, 0x16, 0xc3, 0x70, 0x05,
+    0x04, 0xc0, 0x9a, 0x42, 0x34, 0x13, 0x1a, 0x24, 0x59, 0xbf, 0xd7, 0xa7, 0xcf, 0xc0, 0x07, 0xa8,
+    0x44, 0x35, 0xb6, 0x13, 0xda, 0xd8, 0xd9, 0x89, 0x5b, 0x68, 0x78, 0x70, 0xe4, 0x52, 0x3b, 0x64,
+    0x76, 0xa0, 0x68, 0x31, 0x72, 0x21, 0xaf, 0xee, 0x23, 0xa7, 0x56, 0xf6, 0xd8, 0x57, 0xfd, 0xf6,
+    0x26, 0xe7, 0x6a, 0x01, 0x5b, 0x43, 0x0f, 0x6d, 0xcf, 0x91, 0x0e, 0x96, 0x40, 0x2f, 0xfa, 0xfe,
+    0x7f, 0xcf, 0xfc, 0xfa, 0x9b, 0x51, 0x78, 0x7e, 0x57, 0x2c, 0xd6, 0x03, 0xb1, 0xe6, 0x76, 0x77,
+    0x9c, 0x2e, 0xfd, 0xfd, 0x10, 0x01, 0xe0, 0x03, 0x18, 0x88, 0xb6, 0x1c, 0x1e, 0xe6, 0xe4, 0x3a,
+    0x8b, 0xc3, 0xae, 0xa7, 0xdf, 0x7e, 0xf6, 0x69, 0xbf, 0xf8, 0x31, 0xdf, 0xef, 0xd3, 0xa2, 0xc0,
+    0xbd, 0x82, 0x02, 0x22, 0x52, 0x1f, 0x94, 0x6b, 0xa7, 0xdb, 0x62, 0xc5, 0x69, 0xde, 0x1c, 0xc5,
+    0xe6, 0x84, 0x61, 0xec, 0x94, 0xde, 0x61, 0xad, 0x4b, 0x99, 0xde, 0xf3, 0x67, 0xb6, 0xc4, 0x5b,
+    0x11, 0x6f, 0xfe, 0x75, 0xec, 0xcc, 0x54, 0x94, 0xa4, 0xd2, 0xf3, 0xbb, 0xa5, 0x87, 0x8c, 0xfc,
+    0x17, 0xd2, 0x91, 0xdf, 0x7f, 0xe2, 0x6a, 0x5e, 0xdd, 0x2a, 0x0e, 0x1b, 0xef, 0x31, 0x27, 0x38,
+    0x6e, 0x37, 0x98, 0x1d, 0x54, 0xfa, 0x0b, 0x6b, 0x56, 0xa4, 0xc2, 0xb1, 0xdb, 0x62, 0xca, 0xeb,
+    0xfe, 0x9a, 0xf2, 0xf7, 0xb8, 0x37, 0x94, 0x09, 0xaf, 0xf3, 0xdf, 0x44, 0x46, 0x78, 0xe2, 0x04,
+    0x88, 0xc2, 0x11, 0x92, 0x0f, 0x91, 0xb2, 0x85, 0xc2, 0x4b, 0x66, 0xad, 0x41, 0x65, 0xd5, 0x03,
+    0xdf, 0xc9, 0xc2, 0xbb, 0x64, 0xe4, 0xa1, 0x5c, 0xb1, 0x27, 0x5c, 0x2e, 0x87, 0xdb, 0xcf, 0x7e,
+    0x7a, 0xf9, 0x72, 0xaf, 0x1f, 0x52, 0x0e, 0xbb, 0xf5, 0x8f, 0xb4, 0x5e, 0xc0, 0x5b, 0x69, 0xa9,
+    0xf5, 0x9c, 0x9e, 0x0f, 0xba, 0xa3, 0x14, 0x28, 0x78, 0x38, 0xb6, 0xe4, 0x2b, 0x2e, 0x46, 0x49,
+    0x63, 0x30, 0x3f, 0xe2, 0xac, 0x4f, 0x34, 0xd6, 0x25, 0x49, 0x8b, 0x82, 0x64, 0x6f, 0x2f, 0xe8,
+    0x40, 0x10, 0xc4, 0x0b, 0x98, 0x51, 0xad, 0x6d, 0x09, 0x6d, 0x65, 0x45, 0xf9, 0x55, 0xca, 0xeb,
+    0x35, 0x83, 0x18, 0xf6, 0x05, 0xa9, 0x4a, 0x88, 0x73, 0x77, 0x79, 0xed, 0xae, 0x7a, 0xd0, 0x66,
+    0xfa, 0xbb, 0xfa, 0xd0, 0xc6, 0x7d, 0x46, 0x52, 0x43, 0x3b, 0x29, 0x91, 0x97, 0x47, 0xf3, 0x9f,
+    0xf3, 0x28, 0x54, 0x15, 0x25, 0x64, 0x56, 0x0a, 0x63, 0x9c, 0xb3, 0x6c, 0x35, 0x1e, 0x97, 0xe8,
+    0xb7, 0xbd, 0x84, 0x65, 0x45, 0x34, 0xd5, 0xf7, 0x49, 0x6a, 0xfb, 0xc9, 0x70, 0x67, 0xc7, 0x56,
+    0x2f, 0x7a, 0xee, 0xf2, 0xc6, 0x5a, 0x4b, 0x35, 0x8f, 0x5a, 0x6a, 0x07, 0x5c, 0xf3, 0x35, 0x54,
+    0x10, 0xd4, 0x58, 0x16, 0x73, 0x6e, 0x46, 0x8f, 0x64, 0x7f, 0xa3, 0xb5, 0xd3, 0x98, 0xa2, 0xc6,
+    0xc8, 0x2a, 0xe0, 0x4a, 0x83, 0xf0, 0xe0, 0xc7, 0xc4, 0x0a, 0x4d, 0x06, 0x27, 0x92, 0xd2, 0x97,
+    0xd2, 0xa0, 0x30, 0xe1, 0xb2, 0x4c, 0x6c, 0xac, 0x54, 0x15, 0x5f, 0xa9, 0xa9, 0xb2, 0x74, 0x56,
+    0x0b, 0x8c, 0x6f, 0xa4, 0x2d, 0x83, 0x82, 0x67, 0x90, 0xf5, 0x72, 0xe3, 0x6f, 0x51, 0x4a, 0x7d,
+    0x49, 0xb8, 0xcc, 0x9a, 0x75, 0x44, 0xaf, 0x48, 0xac, 0x1a, 0xcb, 0x55, 0x83, 0xd2, 0xf1, 0xf9,
+    0x9d, 0xe3, 0xb3, 0x00, 0x8e, 0xe9, 0x75, 0xab, 0x40, 0x07, 0x32, 0xa9, 0x33, 0x41, 0x4b, 0x2f,
+    0xa4, 0x0b, 0xfb, 0x7b, 0xbd, 0x3f, 0xf5, 0xdb, 0xdd, 0x14, 0xf6, 0x97, 0xcb, 0xee, 0xd0, 0x9d,
+    0xc4, 0x0f, 0x0c, 0xdd, 0x3e, 0x45, 0xf1, 0x54, 0x7e, 0xc2, 0x3c, 0xea, 0xc5, 0xb0, 0x03, 0x17,
+    0x21, 0xfc, 0xed, 0x88, 0xcb, 0x2b, 0xbc, 0xf3, 0x9f, 0x3f, 0x1f, 0x85, 0x57, 0x17, 0x64, 0xc3,
+    0xd5, 0x63, 0xfd, 0xd8, 0x67, 0x5e, 0x62, 0xea, 0x30, 0x17, 0xaf, 0x35, 0x6b, 0xff, 0x67, 0xe4,
+    0x5a, 0x2f, 0x6a, 0x93, 0x87, 0xeb, 0x85, 0xd7, 0x61, 0xc1, 0x89, 0x31, 0xa0, 0x60, 0x56, 0x6a,
+    0x9c, 0xc2, 0x47, 0x8a, 0x8d, 0xfa, 0xfc, 0xdf, 0x31, 0x8f, 0x2c, 0xe7, 0x35, 0xd2, 0xe4, 0x83,
+    0x0e, 0xce, 0x92, 0xea, 0x89, 0x27, 0xa1, 0x1a, 0x28, 0x1f, 0xe7, 0x3e, 0xff, 0x35, 0xf5, 0xa3,
+    0x36, 0x91, 0x4b, 0x23, 0x46, 0xa5, 0x9b, 0xdd, 0x1e, 0xd6, 0xf1, 0xe3, 0x8b, 0x0b, 0x78, 0xb4,
+    0x81, 0xa5, 0xc1, 0x65, 0x21, 0xff, 0xaa, 0xf6, 0x3c, 0x7b, 0xc9, 0xb1, 0xfe, 0xfc, 0x1f, 0x1a,
+    0xae, 0x0e, 0x5c, 0x66, 0xaf, 0x98, 0xf3, 0x55, 0xfd, 0x34, 0x4e, 0xab, 0x19, 0x3e, 0xa5, 0xe2,
+    0x97, 0x6a, 0x7d, 0x59, 0x9d, 0x9f, 0xee, 0x91, 0x34, 0x0a, 0x46, 0xd7, 0xae, 0xa7, 0x5c, 0xb8,
+    0x9e, 0xe2, 0x5a, 0xca, 0x15, 0x8d, 0x52, 0x84, 0x9d, 0x13, 0x41, 0x13, 0x16, 0x75, 0x10, 0x46,
+    0xb9, 0xc7, 0x77, 0x99, 0xb4, 0x4d, 0x3d, 0xfe, 0x3f, 0xb4, 0x5c, 0x82, 0x0a, 0x31, 0x94, 0x79,
+    0xbc, 0x58, 0xaf, 0xa8, 0xf1, 0xb7, 0x7a, 0x3a, 0xeb, 0x1b, 0x5e, 0x70, 0x7d, 0xff, 0x75, 0xa5,
+    0x5d, 0x05, 0x57, 0xe1, 0x83, 0xc6, 0xaa, 0xa2, 0x27, 0xc7, 0xa3, 0xc1, 0x8f, 0x9b, 0x6a, 0x8e,
+    0xdf, 0x53, 0x50, 0xd6, 0xd1, 0x79, 0x3f, 0x49, 0x87, 0xe7, 0x0e, 0x4b, 0x5b, 0xe1, 0x37, 0x47,
+    0xde, 0x8d, 0xc5, 0x6a, 0x21, 0x59, 0x5a, 0x73, 0x1f, 0x12, 0x02, 0x61, 0xfb, 0x7c, 0xa0, 0xc7,
+    0x4f, 0xd7, 0xbf, 0x7e, 0x68, 0x35, 0xaa, 0xf2, 0x39, 0xbf, 0x2d, 0x26, 0xbd, 0x74, 0x39, 0x9b,
+    0x3d, 0xf5, 0x06, 0xa1, 0x63, 0x22, 0x62, 0xff, 0x02, 0x3d, 0x8c, 0x26, 0x15, 0xb5, 0x8f, 0xba,
+    0x32, 0xf4, 0x94, 0x41, 0x9a, 0xac, 0xdd, 0x3c, 0x30, 0x25, 0x45, 0x24, 0x0d, 0x9e, 0xb6, 0xcb,
+    0x54, 0xbb, 0xb9, 0xb0, 0x22, 0x70, 0x4f, 0x95, 0x76, 0x6a, 0xe0, 0x8e, 0x53, 0x98, 0xa0, 0x9d,
+    0x1e, 0xb8, 0x74, 0x2c, 0x47, 0x86, 0xa6, 0xbe, 0xb8, 0x0a, 0xc0, 0xdf, 0x77, 0x0f, 0x1d, 0x56,
+    0xab, 0xb1, 0xb6, 0xf2, 0x13, 0x17, 0xcf, 0x75, 0x4b, 0xb0, 0xa5, 0x1f, 0x6b, 0xdf, 0x6c, 0xfd,
+    0x39, 0xeb, 0xe4, 0xc4, 0xdd, 0x2b, 0xc7, 0x17, 0x14, 0x8d, 0x25, 0xae, 0xc8, 0xfb, 0xe5, 0x52,
+    0xdf, 0xf7, 0x67, 0xe7, 0x1f, 0xd6, 0x34, 0xf2, 0xd2, 0x15, 0xde, 0x06, 0xe0, 0xfa, 0xd2, 0xc4,
+    0x4d, 0x4c, 0xc3, 0xe0, 0x4c, 0xe7, 0x14, 0x1e, 0xf8, 0x85, 0x8e, 0xe9, 0x44, 0x58, 0x8b, 0x5a,
+    0x0d, 0x83, 0x8b, 0x5f, 0x2f, 0x3f, 0xf5, 0x7a, 0xdd, 0x17, 0xdb, 0x97, 0x97, 0x07, 0xfd, 0xab,
+    0xbb, 0xfd, 0xce, 0x0f, 0xfb, 0x34, 0xf4, 0xb8, 0xb7, 0xd9, 0x30, 0xf8, 0xa7, 0xcb, 0x76, 0x45,
+    0xb3, 0xcd, 0xab, 0x5e, 0x8f, 0x6a, 0xea, 0x0b, 0xd8, 0xa6, 0x42, 0x76, 0x00, 0x7d, 0xb8, 0xe4,
+    0x3c, 0xa4, 0x82, 0xa0, 0x88, 0xc0, 0x02, 0x3d, 0x75, 0x44, 0x33, 0xb2, 0x49, 0x40, 0xcf, 0x80,
+    0xdf, 0x1b, 0xa9, 0x79, 0x54, 0x0d, 0x56, 0x2d, 0x4e, 0xdf, 0x68, 0x14, 0x3c, 0x23, 0x3c, 0x61,
+    0x20, 0xbf, 0x45, 0xa8, 0x84, 0xb8, 0xcf, 0xd2, 0x5e, 0x0f, 0x6e, 0x1a, 0x6d, 0xfd, 0x1b, 0xeb,
+    0x49, 0x6b, 0x57, 0x7c, 0x49, 0x4f, 0xb9, 0x20, 0x3d, 0x75, 0xa4, 0xab, 0xcd, 0xfd, 0xb1, 0x2c,
+    0x46, 0x88, 0x07, 0x06, 0x45, 0x9e, 0x5e, 0x5e, 0xe9, 0xe6, 0xff, 0x00, 0xc2, 0x77, 0x10, 0xe6,
+    0x8a, 0x0f, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5a,
+    0x59, 0x93, 0xa3, 0xc8, 0x11, 0x7e, 0x9f, 0x5f, 0x41, 0x68, 0xc2, 0x31, 0x3b, 0x61, 0x28, 0xd5,
+    0x7d, 0xa8, 0x8f, 0x8d, 0xb0, 0x67, 0xd7, 0xeb, 0x07, 0xfb, 0xc1, 0x5e, 0xdb, 0xcf, 0x34, 0x94,
+    0xd4, 0x78, 0x10, 0x28, 0x00, 0xf5, 0x31, 0xbf, 0xde, 0x99, 0x08, 0x10, 0x52, 0xa3, 0xed, 0x9e,
+    0xf1, 0xec, 0x9c, 0xad, 0x88, 0x8e, 0x86, 0xcc, 0xac, 0x2a, 0xf2, 0xab, 0x2f, 0xb3, 0xb2, 0x0a,
+    0xce, 0x7f, 0xbc, 0x5b, 0xe7, 0xc1, 0x8d, 0xaf, 0xea, 0xac, 0x2c, 0x2e, 0x66, 0x8c, 0xd0, 0x59,
+    0xe0, 0x8b, 0xa4, 0x4c, 0xb3, 0x62, 0x75, 0x31, 0xfb, 0xd7, 0xaf, 0x3f, 0x47, 0x76, 0x16, 0xd4,
+    0x4d, 0x5c, 0xa4, 0x71, 0x5e, 0x16, 0xfe, 0x62, 0x56, 0x94, 0xb3, 0x1f, 0x2f, 0x5f, 0x9c, 0xd7,
+    0x37, 0xab, 0x17, 0x41, 0x10, 0x40, 0xe3, 0xa2, 0x5e, 0xa4, 0xc9, 0xc5, 0xec, 0xba, 0x69, 0x36,
+    0x8b, 0xf9, 0x7c, 0xb3, 0xad, 0x72, 0x52, 0x56, 0xab, 0x79, 0x9a, 0xcc, 0x7d, 0xee, 0xd7, 0xbe,
+    0x68, 0xea, 0x39, 0x23, 0x6c, 0x3e, 0xdb, 0x9b, 0x27, 0x7b, 0xf3, 0xa4, 0xf2, 0x71, 0x93, 0xdd,
+    0xf8, 0xa4, 0x5c, 0xaf, 0xcb, 0xa2, 0x6e, 0x5b, 0x16, 0xf5, 0xcb, 0x91, 0x71, 0x95, 0x2e, 0x07,
+    0xeb, 0xdb, 0xdb, 0x5b, 0x72, 0x2b, 0x5a, 0x23, 0xe6, 0x9c, 0x9b, 0x53, 0x3e, 0xe7, 0x3c, 0x02,
+    0x8b, 0xa8, 0xbe, 0x2f, 0x9a, 0xf8, 0x2e, 0x3a, 0x6c, 0x0a, 0xcf, 0x38, 0xd5, 0x94, 0x53, 0x4a,
+    0xe7, 0xa0, 0xdb, 0x5b, 0x3e, 0xcd, 0x6a, 0x51, 0x03, 0x2a, 0x1b, 0xf8, 0x1b, 0xcc, 0x7b, 0x01,
+    0xa9, 0xcb, 0x6d, 0x95, 0xf8, 0x25, 0xb4, 0xf3, 0xa4, 0xf0, 0xcd, 0xfc, 0xcd, 0xaf, 0x6f, 0x06,
+    0x65, 0x44, 0x49, 0xda, 0xa4, 0xa3, 0x6e, 0xb2, 0xe2, 0x6d, 0x9d, 0xc4, 0x1b, 0x7f, 0x30, 0x6a,
+    0x2f, 0xdc, 0x21, 0x10, 0xaf, 0x7d, 0xbd, 0x89, 0x13, 0x5f, 0xcf, 0x7b, 0x79, 0xdb, 0xfe, 0x36,
+    0x4b, 0x9b, 0x6b, 0x98, 0x24, 0xcd, 0x88, 0xb5, 0xd4, 0xa9, 0xf5, 0xba, 0x15, 0x5f, 0xfb, 0x6c,
+    0x75, 0xdd, 0x80, 0x9c, 0x6a, 0x62, 0x04, 0x67, 0xbc, 0x93, 0xdf, 0x64, 0xfe, 0xf6, 0x4f, 0xe5,
+    0xdd, 0xc5, 0x8c, 0x06, 0x34, 0x18, 0x1a, 0x05, 0x83, 0xd9, 0xce, 0x68, 0x3f, 0xf5, 0xac, 0x15,
+    0x64, 0xe9, 0xc5, 0x0c, 0xfc, 0xb6, 0xbb, 0x9b, 0x6e, 0xf8, 0xc5, 0x98, 0x21, 0x84, 0x47, 0x3c,
+    0xf8, 0xc1, 0x5b, 0x9d, 0x58, 0x43, 0xad, 0x71, 0x61, 0xc0, 0x29, 0x67, 0x11, 0x65, 0x11, 0x53,
+    0xaf, 0xdb, 0x66, 0xbd, 0xef, 0x8b, 0xb4, 0x4c, 0xd0, 0x99, 0x8b, 0x59, 0x96, 0xe0, 0xf4, 0x22,
+    0x9e, 0x97, 0x60, 0x70, 0x9e, 0xfa, 0x65, 0x8d, 0x86, 0xbb, 0xe1, 0xf0, 0x8e, 0xcf, 0x82, 0x79,
+    0xab, 0x1a, 0xda, 0x62, 0xc3, 0x14, 0x7d, 0xd8, 0x1b, 0x5e, 0xc5, 0xf5, 0x0e, 0x89, 0x20, 0xd8,
+    0xc4, 0x2b, 0x60, 0x4d, 0x5e, 0x56, 0x17, 0xb3, 0x97, 0xcb, 0xf6, 0xd7, 0x29, 0xae, 0xca, 0x2a,
+    0xf5, 0x55, 0xaf, 0xd2, 0xed, 0xef, 0x40, 0x55, 0x02, 0xb2, 0x59, 0x73, 0xbf, 0x23, 0x7b, 0xd7,
+    0x77, 0xef, 0x26, 0xf6, 0x3a, 0xe8, 0xe9, 0xb4, 0xbe, 0xbe, 0x8e, 0xd3, 0xf2, 0xf6, 0x62, 0xc6,
+    0x8f, 0x95, 0xef, 0xca, 0x72, 0x8d, 0xbd, 0xca, 0x63, 0x45, 0x02, 0x73, 0x20, 0x98, 0x21, 0x8e,
+    0x5a, 0xcd, 0x1e, 0x28, 0x61, 0x24, 0x6e, 0x14, 0xd1, 0xc2, 0xa8, 0x07, 0x5d, 0x02, 0x7e, 0x5b,
+    0x8c, 0xa1, 0x68, 0x5b, 0x64, 0x0d, 0xf0, 0xb4, 0x9b, 0xd9, 0x71, 0xf3, 0x6d, 0x55, 0xa1, 0x41,
+    0x1e, 0xdf, 0x7b, 0x70, 0x78, 0xe5, 0x0c, 0x3d, 0xd9, 0x49, 0x55, 0x36, 0x10, 0x6d, 0x38, 0x8b,
+    0xbd, 0x4d, 0x7d, 0x5d, 0xde, 0xae, 0x2a, 0x84, 0x76, 0x19, 0xe7, 0x03, 0xb6, 0xad, 0x74, 0x9b,
+    0xa5, 0x1e, 0x46, 0x6c, 0xaa, 0xad, 0x3f, 0xee, 0xb0, 0xd5, 0x45, 0x57, 0x57, 0xc8, 0xad, 0x29,
+    0xfd, 0x6d, 0x56, 0x00, 0x42, 0x51, 0x47, 0x57, 0x21, 0x9c, 0x3e, 0x61, 0x31, 0x30, 0x57, 0x18,
+    0x73, 0xc2, 0x04, 0x86, 0x60, 0x8e, 0xf1, 0x13, 0xda, 0x7b, 0xec, 0xfe, 0x94, 0x72, 0x1d, 0xdf,
+    0x65, 0xeb, 0xec, 0x9d, 0x07, 0xef, 0x7a, 0xd4, 0x97, 0x59, 0x03, 0xe2, 0x6a, 0x95, 0x15, 0x51,
+    0x53, 0x6e, 0xf6, 0x38, 0x8c, 0xe4, 0xb9, 0x5f, 0x36, 0x93, 0x8a, 0x6a, 0xf7, 0xac, 0x13, 0x9a,
+    0xab, 0xb2, 0x69, 0x70, 0xea, 0x69, 0xcf, 0xe1, 0xb5, 0x6f, 0xe2, 0x34, 0x6e, 0xe2, 0x3d, 0x73,
+    0x7b, 0x89, 0x6a, 0xf9, 0x0f, 0x26, 0x90, 0xb5, 0x16, 0xff, 0x78, 0xf3, 0xf3, 0xee, 0x0e, 0xee,
+    0x93, 0x64, 0xf1, 0x9f, 0xb2, 0x7a, 0xdb, 0xdd, 0xc2, 0x0f, 0x0d, 0xe2, 0xab, 0x72, 0x0b, 0x43,
+    0xce, 0x2e, 0x07, 0xf1, 0x79, 0x9a, 0x2c, 0x20, 0xcf, 0xac, 0xe3, 0xe6, 0x32, 0x5b, 0x03, 0x19,
+    0x31, 0x45, 0xfd, 0x11, 0xf2, 0xca, 0xf9, 0x7c, 0xaf, 0x38, 0x30, 0x6e, 0xee, 0x37, 0x7e, 0xdf,
+    0xe9, 0xae, 0xdb, 0xca, 0xef, 0x12, 0xd6, 0x64, 0xd6, 0x4e, 0x93, 0x75, 0x86, 0x8d, 0xe6, 0xff,
+    0x6c, 0xb2, 0x3c, 0xff, 0x2b, 0x0e, 0xd2, 0xb9, 0x35, 0xea, 0x34, 0x6b, 0x72, 0x7f, 0xd9, 0x8e,
+    0xb9, 0xbb, 0xec, 0xbd, 0x98, 0x77, 0x6e, 0x74, 0x4e, 0xce, 0x47, 0x5e, 0x9e, 0xcf, 0x7b, 0x0c,
+    0xda, 0xbb, 0xd5, 0x31, 0xa7, 0xaa, 0x72, 0xbb, 0x59, 0x97, 0x29, 0x3c, 0x54, 0x4b, 0xe5, 0xd9,
+    0x1e, 0xbb, 0xf6, 0xfe, 0xc1, 0x24, 0xe7, 0xf1, 0x95, 0xcf, 0x31, 0x25, 0x24, 0x6f, 0xb1, 0x6d,
+    0x91, 0xf6, 0xe4, 0xed, 0xf3, 0x47, 0x56, 0xd4, 0xbe, 0xa8, 0x33, 0x5c, 0x5e, 0x0e, 0x68, 0x5a,
+    0x37, 0xf7, 0x39, 0x48, 0xd2, 0xac, 0xde, 0x40, 0xcf, 0x60, 0x96, 0x67, 0x45, 0xaf, 0x6b, 0xaa,
+    0xb8, 0xa8, 0x11, 0x46, 0x6c, 0x01, 0x97, 0x79, 0xdc, 0xf8, 0x1f, 0x22, 0x41, 0x0c, 0xd7, 0xcc,
+    0x19, 0x1b, 0xc2, 0x25, 0x53, 0x8e, 0x73, 0xfd, 0x7a, 0x98, 0x47, 0x9f, 0x34, 0x3d, 0x36, 0x5d,
+    0xcf, 0x5d, 0x02, 0x59, 0x50, 0xe2, 0x9c, 0x3d, 0x5b, 0x02, 0x8a, 0x8b, 0x97, 0xec, 0x8a, 0x33,
+    0xc1, 0xda, 0x9b, 0xa8, 0xd7, 0x77, 0xb7, 0xd5, 0x36, 0xf7, 0x0b, 0x7f, 0xe3, 0x8b, 0x32, 0x4d,
+    0xcf, 0xea, 0xa6, 0x2a, 0xdf, 0xfa, 0x45, 0x01, 0x6b, 0x6d, 0x77, 0xbd, 0x0b, 0xa3, 0x05, 0xef,
+    0x6f, 0xf1, 0x69, 0x01, 0x80, 0x45, 0xeb, 0xf3, 0x58, 0xf8, 0xdf, 0x32, 0x2b, 0x0e, 0xa5, 0x30,
+    0x91, 0xbe, 0xca, 0x21, 0x06, 0x9a, 0x85, 0xec, 0x65, 0x69, 0x0c, 0xf9, 0xab, 0xaa, 0xc0, 0xf1,
+    0xf1, 0x18, 0x28, 0x2d, 0x97, 0xcb, 0xda, 0x37, 0x0b, 0x61, 0x88, 0x71, 0x4a, 0xf4, 0x9a, 0xe1,
+    0x61, 0x67, 0xbd, 0x97, 0x38, 0x25, 0xe8, 0x35, 0xe3, 0x43, 0xd0, 0x0e, 0x4b, 0x13, 0xd7, 0x0a,
+    0x00, 0xa2, 0x62, 0x90, 0x0f, 0x11, 0x2e, 0x35, 0xe1, 0x46, 0x1b, 0x3b, 0x68, 0x20, 0xb0, 0x23,
+    0x01, 0x6b, 0x89, 0x80, 0x45, 0x49, 0x0e, 0x52, 0x08, 0xe8, 0x88, 0x13, 0x6a, 0xac, 0xd5, 0x8e,
+    0xf5, 0xe1, 0x34, 0x5f, 0x4d, 0x52, 0xa6, 0x63, 0xc0, 0x4f, 0x57, 0xbe, 0xf0, 0xc1, 0x83, 0xbc,
+    0xfa, 0x18, 0xa1, 0xd8, 0xef, 0x42, 0x87, 0xd5, 0x18, 0xa5, 0x51, 0x32, 0x3e, 0xd5, 0x97, 0x64,
+    0x80, 0x00, 0xb3, 0xd6, 0x84, 0x50, 0x27, 0x30, 0xca, 0x38, 0xac, 0xd0, 0xaf, 0x67, 0x47, 0x84,
+    0xea, 0x48, 0xd1, 0xad, 0x73, 0x0f, 0x67, 0x66, 0x08, 0xbf, 0x4d, 0xdc, 0x5c, 0xef, 0x83, 0xbd,
+    0x6b, 0xdd, 0x12, 0xb0, 0x9d, 0xec, 0x93, 0x74, 0x3b, 0xea, 0xf9, 0xbd, 0x18, 0xd7, 0x92, 0xec,
+    0xfd, 0x19, 0xf7, 0x90, 0x57, 0x41, 0x80, 0x79, 0x12, 0x0a, 0x15, 0x4b, 0xa0, 0xba, 0x93, 0x21,
+    0x07, 0x40, 0x80, 0x07, 0x92, 0x05, 0xd7, 0x01, 0x93, 0x04, 0x0a, 0x16, 0xaa, 0x82, 0x9b, 0x00,
+    0xd6, 0x51, 0x46, 0x15, 0x57, 0x20, 0x75, 0x44, 0x0a, 0x21, 0xc7, 0x3d, 0x20, 0xea, 0x08, 0x82,
+    0x53, 0x76, 0x24, 0xdd, 0x97, 0x14, 0x40, 0x07, 0xcc, 0x6d, 0xb0, 0xae, 0x25, 0xf0, 0x1b, 0xe5,
+    0xb5, 0x73, 0x9f, 0xe7, 0xd9, 0xa6, 0xf6, 0x0f, 0xd0, 0x9b, 0x0a, 0xe6, 0x0e, 0xad, 0xff, 0x23,
+    0x98, 0x09, 0x03, 0xda, 0xdb, 0x2f, 0x26, 0xa4, 0x47, 0xc0, 0x0d, 0xc5, 0x12, 0xfe, 0x92, 0xdd,
+    0xea, 0x4b, 0x94, 0x61, 0x6a, 0x2c, 0xc6, 0x65, 0xd7, 0x10, 0xae, 0x9d, 0x19, 0x5b, 0x57, 0x60,
+    0xcd, 0x61, 0x4a, 0xa0, 0x9a, 0xd1, 0x72, 0x2c, 0x6f, 0x6b, 0x2d, 0x6b, 0x9d, 0xd3, 0x4e, 0x0c,
+    0x98, 0x77, 0x51, 0x7d, 0xc4, 0xda, 0x69, 0xce, 0x3e, 0x01, 0xe4, 0x2f, 0x82, 0xc2, 0x00, 0xe2,
+    0xdf, 0x80, 0x95, 0x8c, 0x19, 0x6e, 0x79, 0xc8, 0x20, 0xbb, 0x31, 0x24, 0x68, 0xf0, 0x4b, 0xc0,
+    0x40, 0x6a, 0x1d, 0xa5, 0xfa, 0x20, 0x8d, 0xa2, 0xe7, 0x10, 0xf4, 0x7b, 0xae, 0x4e, 0x33, 0x75,
+    0x8f, 0xd9, 0x37, 0x05, 0xd5, 0x3a, 0x10, 0x8a, 0x38, 0x89, 0x18, 0x8d, 0xb0, 0xba, 0x0e, 0x2c,
+    0xd1, 0x16, 0x28, 0x34, 0x81, 0x14, 0xa7, 0xdf, 0x2b, 0x52, 0x4c, 0xc1, 0xa2, 0xa8, 0xa4, 0x53,
+    0x21, 0xb3, 0x04, 0x23, 0x89, 0x22, 0x52, 0x9a, 0x08, 0xc5, 0xad, 0x99, 0x84, 0x8a, 0x7f, 0xaf,
+    0x50, 0x71, 0x43, 0xb4, 0xb6, 0x5c, 0x8a, 0x90, 0x3b, 0x48, 0xda, 0x8c, 0x5b, 0x5c, 0x40, 0x28,
+    0x31, 0x1a, 0xb6, 0x5f, 0x53, 0x48, 0xc9, 0xef, 0x13, 0x29, 0xcc, 0x54, 0x9c, 0x69, 0xc5, 0x75,
+    0x28, 0x15, 0x10, 0xc9, 0x01, 0x50, 0xbf, 0x04, 0x1c, 0x32, 0x38, 0x13, 0x5c, 0x9b, 0x29, 0xa4,
+    0xf4, 0xf7, 0xca, 0x29, 0x09, 0xb5, 0x88, 0x52, 0x1c, 0x12, 0xd5, 0x00, 0x15, 0xe6, 0x29, 0x0e,
+    0x61, 0xc8, 0xa6, 0x80, 0x7a, 0x7a, 0x46, 0x6f, 0xfc, 0xdd, 0xb0, 0x7f, 0x80, 0x7d, 0xdc, 0xa2,
+    0x3d, 0xf7, 0x81, 0x7e, 0x60, 0x8f, 0xe6, 0xab, 0x1b, 0x7f, 0x5c, 0x0a, 0x2e, 0x4b, 0xd8, 0xc7,
+    0xd7, 0xb0, 0xa9, 0x5d, 0xc0, 0x44, 0x71, 0xad, 0xd9, 0xe6, 0xee, 0x0c, 0x7d, 0xee, 0xb6, 0xd2,
+    0x0b, 0xc6, 0xd5, 0x1f, 0xce, 0x5a, 0xa3, 0x65, 0xbc, 0xce, 0xf2, 0xfb, 0xc5, 0x1b, 0x9f, 0x67,
+    0x49, 0x56, 0x6e, 0xeb, 0xb3, 0xa8, 0x2f, 0x8d, 0xa3, 0x5d, 0x27, 0x1b, 0x9f, 0x64, 0xcb, 0x2c,
+    0x69, 0x4f, 0x04, 0x16, 0xaf, 0x06, 0xbb, 0x30, 0xf8, 0x3b, 0x6e, 0x23, 0xf3, 0x57, 0x67, 0xb9,
+    0x6f, 0x00, 0xb6, 0x08, 0x9f, 0x28, 0x2b, 0x56, 0x0b, 0x0a, 0x43, 0xdd, 0x96, 0x55, 0x7a, 0x20,
+    0xf8, 0xad, 0x82, 0xe8, 0x64, 0xf9, 0xc3, 0x88, 0x70, 0xbf, 0xef, 0x7e, 0x66, 0x54, 0xb5, 0x09,
+    0xa5, 0x95, 0x19, 0xef, 0x3a, 0x8c, 0x20, 0x96, 0x6b, 0x6e, 0xd8, 0x78, 0xd3, 0x21, 0x0d, 0x11,
+    0x4c, 0x6b, 0x23, 0x0e, 0x66, 0x13, 0x27, 0xc7, 0x4a, 0x11, 0xb1, 0x48, 0xcf, 0x2e, 0xcf, 0x1b,
+    0x70, 0xbc, 0x98, 0xa8, 0x2a, 0xab, 0x12, 0x67, 0x66, 0xb4, 0x6d, 0x38, 0x39, 0xd0, 0x89, 0xa1,
+    0x8e, 0x66, 0x17, 0xaf, 0xc1, 0x1b, 0x9c, 0x84, 0xdd, 0x54, 0xde, 0xc4, 0x55, 0x16, 0x17, 0xcd,
+    0x81, 0xec, 0x76, 0x37, 0xdf, 0x63, 0x11, 0xf8, 0xee, 0x9b, 0xe4, 0xfa, 0x50, 0x76, 0x48, 0x95,
+    0x31, 0x33, 0x5e, 0xfd, 0xd9, 0x17, 0xcd, 0xb6, 0xba, 0x0f, 0xfe, 0x52, 0x36, 0xd7, 0x59, 0xf2,
+    0xea, 0x11, 0x82, 0x1c, 0x5a, 0xef, 0x59, 0x32, 0x7e, 0x42, 0x98, 0xb7, 0x55, 0x0c, 0x56, 0xbe,
+    0x9e, 0x7a, 0xfe, 0x08, 0xfa, 0x9e, 0x56, 0x14, 0xdb, 0xb5, 0xaf, 0xb2, 0x64, 0x52, 0xe7, 0xe3,
+    0xba, 0x89, 0xe2, 0x1a, 0xae, 0x07, 0xf5, 0x57, 0xc6, 0xb9, 0x8e, 0x4b, 0xc8, 0x1e, 0x2b, 0x55,
+    0x24, 0x23, 0x3e, 0xbb, 0x14, 0xf2, 0x7c, 0xde, 0x4a, 0x2e, 0xe1, 0x3f, 0xb0, 0xec, 0x39, 0x1b,
+    0x7c, 0xae, 0x6c, 0x00, 0xc0, 0x59, 0x2b, 0xb4, 0x1d, 0x67, 0x03, 0x0e, 0xd5, 0x16, 0x14, 0xeb,
+    0xea, 0x44, 0x32, 0x60, 0x91, 0xfc, 0x90, 0x74, 0xf0, 0x60, 0xa4, 0xe9, 0xb1, 0x9e, 0xb3, 0xc1,
+    0xf7, 0x95, 0x0d, 0x58, 0x64, 0x67, 0x97, 0x8c, 0x4f, 0xe6, 0x83, 0xe3, 0xe3, 0x24, 0x1d, 0xb1,
+    0x47, 0x0e, 0x94, 0x9c, 0x21, 0x8a, 0x41, 0xf5, 0x2b, 0x43, 0x65, 0x09, 0x33, 0x4e, 0x5b, 0xf7,
+    0xe1, 0xe7, 0x49, 0xe3, 0xc3, 0xcd, 0xdf, 0x3a, 0x11, 0xf9, 0x64, 0x55, 0xdd, 0x27, 0x3b, 0x0b,
+    0x41, 0xcf, 0xad, 0x33, 0xd1, 0xf8, 0x1c, 0xa3, 0x3b, 0xe3, 0x94, 0xe3, 0x00, 0xee, 0xcf, 0x37,
+    0x0f, 0x84, 0x78, 0x6a, 0xa2, 0x1c, 0x51, 0xd4, 0x58, 0x71, 0x14, 0xec, 0x44, 0x5a, 0x3c, 0x35,
+    0x71, 0x47, 0xc7, 0x23, 0x9a, 0x58, 0x2a, 0x94, 0x61, 0xfc, 0x83, 0x8e, 0x47, 0x3e, 0x1c, 0xe5,
+    0xab, 0x6d, 0xd3, 0x7c, 0x6c, 0xc6, 0x1f, 0x95, 0xce, 0x1a, 0xcb, 0x64, 0x2d, 0x1d, 0x0b, 0x2d,
+    0x6e, 0xc7, 0x8c, 0x12, 0xc1, 0x4d, 0x80, 0x57, 0xce, 0x9a, 0xdd, 0xc6, 0x8c, 0x72, 0xa1, 0x79,
+    0xf0, 0xef, 0xc0, 0x4a, 0xd4, 0x4b, 0x2a, 0x41, 0x1c, 0x41, 0x56, 0x04, 0xf6, 0x8a, 0x20, 0x0f,
+    0xa2, 0x9d, 0x45, 0x08, 0x5a, 0x03, 0xfd, 0xe8, 0xe0, 0xdd, 0xc3, 0x8a, 0x9b, 0xb1, 0xc7, 0x36,
+    0x71, 0xc9, 0xc1, 0x81, 0xdf, 0xd7, 0x0e, 0xaa, 0xc5, 0x97, 0x89, 0xc6, 0x59, 0x16, 0x6a, 0x47,
+    0xb4, 0xd3, 0x78, 0x1e, 0x7a, 0x13, 0x20, 0x7e, 0xf8, 0xdb, 0x1d, 0x98, 0x76, 0xd7, 0x37, 0x41,
+    0x34, 0x5c, 0x4f, 0x22, 0xa7, 0x1f, 0x47, 0x6e, 0x8f, 0xdb, 0xd3, 0x5e, 0x77, 0x7c, 0x4b, 0xf9,
+    0x60, 0x78, 0xdd, 0xc1, 0x46, 0x47, 0x2a, 0x5d, 0x2a, 0x50, 0x0f, 0xde, 0x73, 0xa8, 0xa3, 0x9d,
+    0x06, 0x77, 0xb0, 0x43, 0x54, 0xe3, 0xda, 0xa2, 0x9f, 0x30, 0xfd, 0xcd, 0x90, 0x11, 0xf6, 0xbb,
+    0xc8, 0x46, 0x65, 0xda, 0x08, 0xb7, 0x9a, 0x19, 0x60, 0x22, 0xf3, 0x91, 0x0c, 0x91, 0x79, 0xd6,
+    0x2a, 0x2d, 0x82, 0xa8, 0x8b, 0x73, 0xe6, 0xf0, 0xa5, 0x89, 0xe3, 0xa0, 0xc5, 0x18, 0xd7, 0x68,
+    0xd5, 0x73, 0x55, 0x05, 0x5d, 0xd0, 0x87, 0x8c, 0x38, 0x34, 0x68, 0x9b, 0xd8, 0x30, 0xc2, 0x5e,
+    0x8d, 0x65, 0x27, 0x02, 0x3f, 0xa2, 0xef, 0x17, 0xfa, 0x13, 0x6b, 0x6a, 0x64, 0x1f, 0x7b, 0x4d,
+    0x23, 0x20, 0x9b, 0x0b, 0x6d, 0x2c, 0x3c, 0x1a, 0x64, 0x6f, 0x6d, 0x0c, 0x7f, 0xb0, 0xaa, 0x1e,
+    0xbe, 0x41, 0x3a, 0x7b, 0x5e, 0x64, 0x9f, 0xbe, 0xc8, 0x46, 0xe2, 0xdb, 0x5e, 0x66, 0x3f, 0xc5,
+    0x61, 0x1e, 0x06, 0x18, 0x30, 0xd3, 0x99, 0x10, 0x5f, 0xa0, 0x69, 0x65, 0x1d, 0xae, 0xa9, 0xc6,
+    0x11, 0xce, 0x99, 0x1e, 0xbd, 0x61, 0x1d, 0x42, 0x87, 0xd3, 0x8f, 0x79, 0x44, 0xfc, 0x85, 0x9f,
+    0xdf, 0x19, 0x60, 0x84, 0x13, 0xc2, 0x85, 0x8e, 0x12, 0x23, 0xa1, 0xcc, 0xc0, 0x37, 0x89, 0x8c,
+    0x50, 0x35, 0x7a, 0x51, 0x38, 0x42, 0x46, 0x7e, 0x0e, 0x64, 0x18, 0xd1, 0x5a, 0x50, 0xf1, 0x59,
+    0xce, 0xcc, 0x31, 0xcf, 0x08, 0xa9, 0x54, 0x68, 0x0c, 0xd1, 0xd2, 0x08, 0x2b, 0xa0, 0x88, 0xa0,
+    0x44, 0x71, 0xae, 0xa7, 0x5e, 0x2f, 0x70, 0x7a, 0x6a, 0xf9, 0xea, 0xe1, 0x42, 0xa8, 0x60, 0xa7,
+    0xb1, 0xc9, 0xaa, 0x38, 0x9f, 0x7d, 0xa5, 0xd4, 0xd9, 0xbb, 0x6b, 0x26, 0x08, 0xd1, 0xbe, 0x1c,
+    0x15, 0xf6, 0xf0, 0x7b, 0x87, 0xbd, 0x16, 0xd2, 0x0d, 0x14, 0xb4, 0xd2, 0x18, 0x6d, 0x27, 0x1a,
+    0xfb, 0x3b, 0xd8, 0xeb, 0x75, 0x5f, 0xd4, 0x3d, 0xd4, 0x56, 0xfe, 0xa6, 0xcc, 0xb7, 0x4d, 0xf7,
+    0xc1, 0x9d, 0xe1, 0x4e, 0x4f, 0x8c, 0x50, 0xc5, 0x69, 0xb6, 0xad, 0xf1, 0x73, 0x40, 0xa2, 0xb4,
+    0x91, 0x66, 0xa2, 0x8e, 0x8b, 0xab, 0x55, 0xfb, 0xe5, 0xd7, 0xc5, 0x0c, 0xd6, 0x50, 0xab, 0xb9,
+    0x96, 0x72, 0x22, 0xe6, 0x1b, 0xba, 0xff, 0xaa, 0xa9, 0x5f, 0xd2, 0x3b, 0xbf, 0xc2, 0xc1, 0x85,
+    0x20, 0x81, 0x35, 0x9c, 0x08, 0x2a, 0xad, 0x0a, 0x29, 0xd1, 0x8c, 0x5a, 0x67, 0x51, 0x22, 0xb5,
+    0xe1, 0xb0, 0xd0, 0xc3, 0x85, 0x32, 0x8a, 0x31, 0x14, 0x51, 0xa6, 0x84, 0x0a, 0x23, 0x0e, 0x59,
+    0xc8, 0x1a, 0xc9, 0x02, 0x06, 0x29, 0x48, 0x2a, 0x87, 0x46, 0x8e, 0x03, 0xb5, 0xb0, 0x3c, 0xa0,
+    0x82, 0x09, 0x86, 0x12, 0xee, 0x98, 0xc5, 0x85, 0x1f, 0x5f, 0x64, 0x09, 0xe8, 0x19, 0x5f, 0x8c,
+    0x0b, 0x19, 0x70, 0x22, 0x34, 0x44, 0x2b, 0x27, 0x4a, 0xc1, 0x5a, 0x6b, 0xb0, 0x0f, 0x18, 0x50,
+    0x85, 0xe0, 0x2b, 0x64, 0x76, 0xd9, 0x0e, 0x0d, 0x4d, 0x25, 0x0f, 0x2d, 0x51, 0x42, 0x3b, 0xee,
+    0x02, 0xfc, 0x2e, 0xc3, 0x5a, 0xc6, 0xa0, 0x11, 0xd4, 0x20, 0x40, 0xdb, 0x20, 0xc2, 0x97, 0xae,
+    0x9c, 0xb2, 0x10, 0x1f, 0x9c, 0x3a, 0x01, 0x36, 0x0c, 0xe1, 0x84, 0x82, 0x05, 0x1f, 0x4f, 0x4a,
+    0x69, 0x69, 0xdb, 0x4e, 0x58, 0x09, 0xed, 0xda, 0x3a, 0x99, 0x4b, 0x27, 0x5a, 0x4f, 0x19, 0xc8,
+    0xc2, 0xd6, 0xde, 0xa1, 0x1f, 0x01, 0x54, 0x00, 0x50, 0x6f, 0xa3, 0x17, 0x60, 0x46, 0xc1, 0x55,
+    0x1d, 0x68, 0xe8, 0xde, 0x50, 0xd9, 0x56, 0x34, 0x58, 0xb7, 0x70, 0x2c, 0xbb, 0x25, 0xb5, 0xb2,
+    0xf5, 0x15, 0xb2, 0x8d, 0xe0, 0x20, 0xb2, 0x04, 0xb0, 0xe2, 0x0c, 0xf6, 0x2f, 0x00, 0x90, 0x82,
+    0xc0, 0x02, 0xef, 0x81, 0x50, 0x1a, 0x7c, 0x81, 0x7d, 0x91, 0xb6, 0x36, 0x40, 0x5c, 0x18, 0x94,
+    0x16, 0x0a, 0x1a, 0x0b, 0xc5, 0xb0, 0x60, 0x67, 0x1c, 0x0a, 0x22, 0xfc, 0x04, 0x82, 0x82, 0xfb,
+    0x42, 0x3e, 0x52, 0xbd, 0x44, 0xe6, 0x91, 0xfa, 0x85, 0x29, 0x09, 0x08, 0x53, 0x21, 0xf0, 0x54,
+    0x00, 0x76, 0x58, 0xb0, 0xe1, 0x7a, 0xae, 0x5f, 0x3e, 0x66, 0xfd, 0x32, 0x2a, 0x42, 0x3f, 0x5b,
+    0x05, 0x33, 0x4d, 0x0d, 0xf5, 0x58, 0x69, 0x8b, 0xc5, 0x3b, 0xd5, 0x10, 0x7c, 0xca, 0x40, 0xe7,
+    0xcc, 0x50, 0xf7, 0x4c, 0x8d, 0x8f, 0x4a, 0x0d, 0xf3, 0xa5, 0x52, 0xc3, 0xd8, 0x27, 0xa4, 0x0d,
+    0xd8, 0x78, 0x69, 0xdc, 0x91, 0x41, 0x4e, 0x85, 0xfd, 0x9b, 0x78, 0xe6, 0xc6, 0x47, 0xe5, 0x06,
+    0xfb, 0x62, 0xd3, 0x86, 0x7e, 0xec, 0xa0, 0x19, 0x16, 0x12, 0x8d, 0xab, 0x24, 0x70, 0x03, 0x6a,
+    0x00, 0x58, 0x37, 0xd9, 0x33, 0x37, 0x3e, 0x2a, 0x37, 0xd4, 0x67, 0xe6, 0x46, 0xfb, 0xef, 0x1c,
+    0xbf, 0x30, 0xbf, 0x7c, 0xf1, 0x3f, 0xe7, 0xd8, 0x9a, 0x4a, 0x28, 0x34, 0x00, 0x00, 0x1f, 0x8b,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x52, 0xcb, 0x6e, 0xdb, 0x30, 0x10, 0xbc,
+    0xfb, 0x2b, 0x16, 0xcc, 0xa5, 0x41, 0x21, 0x91, 0x7a, 0xd8, 0x8d, 0x04, 0xd2, 0x01, 0x8a, 0x22,
+    0x40, 0xaf, 0x6d, 0x82, 0x9e, 0x59, 0x92, 0x96, 0xd8, 0x88, 0xa4, 0x40, 0xd2, 0x96, 0xf3, 0xf7,
+    0xa1, 0x14, 0x3b, 0x76, 0x8a, 0xdc, 0xf6, 0x31, 0x98, 0x9d, 0xd9, 0x5d, 0x7a, 0x7f, 0x34, 0x03,
+    0x1c, 0x94, 0x0f, 0xda, 0x59, 0x86, 0x8a, 0x9c, 0x20, 0x50, 0x56, 0x38, 0xa9, 0x6d, 0xc7, 0xd0,
+    0xd3, 0xe3, 0x43, 0x76, 0x87, 0xee, 0xb7, 0x2b, 0x1a, 0x0e, 0x1d, 0x4c, 0x5a, 0xc6, 0x9e, 0xa1,
+    0x8a, 0x18, 0x83, 0xa0, 0x57, 0xba, 0xeb, 0x23, 0x43, 0xeb, 0x25, 0xbb, 0x22, 0x28, 0x52, 0xa6,
+    0xd5, 0xf4, 0xdd, 0x1d, 0x19, 0x22, 0x40, 0xa0, 0x22, 0xb0, 0x4e, 0xa4, 0x69, 0x8c, 0x0d, 0x0c,
+    0xf5, 0x31, 0x8e, 0x2d, 0xc6, 0xd3, 0x34, 0xe5, 0x53, 0x95, 0x3b, 0xdf, 0xe1, 0x92, 0x10, 0x82,
+    0x13, 0xfd, 0x09, 0xd2, 0x0a, 0xf1, 0x8e, 0x12, 0x5e, 0xf1, 0xa8, 0x0f, 0x4a, 0x38, 0x63, 0x9c,
+    0x0d, 0x0b, 0xdc, 0x86, 0x9b, 0x33, 0x52, 0x5e, 0x90, 0xe3, 0xde, 0x0f, 0x4b, 0x5b, 0x0a, 0xac,
+    0x06, 0x65, 0x94, 0x8d, 0x01, 0x27, 0x2d, 0xf8, 0x8c, 0xf5, 0x72, 0xf7, 0xd9, 0xf0, 0xa2, 0x69,
+    0x1a, 0x4c, 0x4a, 0x5c, 0x96, 0x59, 0x42, 0x64, 0xe1, 0xc5, 0x46, 0x7e, 0xcc, 0xe6, 0x19, 0xdb,
+    0x15, 0x50, 0xa3, 0x22, 0x97, 0x3c, 0xf2, 0x14, 0x03, 0x4d, 0xfd, 0xf6, 0xd7, 0x8f, 0x87, 0x39,
+    0x06, 0x2a, 0x44, 0xfb, 0xc7, 0xf9, 0x67, 0x98, 0x8b, 0xfc, 0xaf, 0xdb, 0xa7, 0x45, 0xa0, 0xa5,
+    0x03, 0x54, 0x8a, 0x76, 0xe7, 0xbc, 0xe1, 0x71, 0xab, 0x0d, 0xef, 0xd4, 0x6c, 0xed, 0x6b, 0xd2,
+    0x40, 0xf1, 0xa5, 0xf1, 0x0e, 0x8c, 0x2f, 0xa3, 0x5a, 0x38, 0xbc, 0x0a, 0x6e, 0xef, 0x85, 0xfa,
+    0xd4, 0x90, 0x14, 0x46, 0xcf, 0x48, 0xfc, 0x3b, 0xea, 0x61, 0xf8, 0x39, 0xb3, 0x22, 0x7c, 0x45,
+    0xa2, 0xe3, 0xa0, 0xde, 0x72, 0x8a, 0x4f, 0xc2, 0x16, 0xc5, 0xf8, 0x22, 0x99, 0xe2, 0x2b, 0x2f,
+    0xb4, 0x83, 0xe8, 0xb9, 0x0d, 0xb3, 0x1a, 0x86, 0x96, 0x70, 0xe0, 0x51, 0x7d, 0xc9, 0x36, 0xdf,
+    0xf2, 0x75, 0x05, 0x59, 0x5d, 0xe7, 0x4d, 0x5d, 0xdc, 0x2e, 0x86, 0xe8, 0xc8, 0x63, 0x0f, 0x92,
+    0x21, 0xd3, 0xd4, 0x39, 0xa9, 0xa0, 0xbe, 0xcb, 0xeb, 0xba, 0xc8, 0xca, 0x0a, 0xca, 0x22, 0xaf,
+    0x37, 0x1b, 0x78, 0x8b, 0xd6, 0x55, 0x8d, 0x60, 0x97, 0xd4, 0x31, 0x64, 0x9d, 0x55, 0x08, 0x42,
+    0xf4, 0xee, 0x39, 0xd9, 0xb9, 0x49, 0xd7, 0x3d, 0x67, 0xd9, 0xa0, 0xad, 0x12, 0x7c, 0x64, 0xc8,
+    0xbb, 0xbd, 0x95, 0x1f, 0xca, 0xff, 0x9c, 0xb6, 0xff, 0xd7, 0x4f, 0xff, 0xb6, 0xc9, 0xd3, 0x91,
+    0x9a, 0xc5, 0x31, 0xc5, 0x5d, 0xfa, 0xc5, 0x79, 0xa5, 0xdb, 0xd5, 0x2b, 0xcf, 0x25, 0x56, 0xee,
+    0xba, 0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x52,
+    0xcb, 0x6e, 0xdb, 0x30, 0x10, 0xbc, 0xfb, 0x2b, 0x16, 0xcc, 0xa5, 0x41, 0x21, 0x51, 0x2f, 0x3b,
+    0x91, 0x40, 0x3a, 0x40, 0x51, 0x04, 0xc8, 0x35, 0x6d, 0xd1, 0x33, 0x4b, 0xd2, 0x12, 0x1b, 0x91,
+    0x14, 0x48, 0xda, 0x72, 0xfe, 0x3e, 0x14, 0x63, 0xc7, 0x6e, 0x91, 0xdb, 0x3e, 0x06, 0xb3, 0x33,
+    0xbb, 0x4b, 0x1e, 0x8e, 0x7a, 0x84, 0x83, 0x74, 0x5e, 0x59, 0x43, 0x51, 0x99, 0x17, 0x08, 0xa4,
+    0xe1, 0x56, 0x28, 0xd3, 0x53, 0xf4, 0xeb, 0xe7, 0x63, 0x76, 0x8f, 0x1e, 0xb6, 0x2b, 0xe2, 0x0f,
+    0x3d, 0xcc, 0x4a, 0x84, 0x81, 0xa2, 0xba, 0xd0, 0x1a, 0xc1, 0x20, 0x55, 0x3f, 0x04, 0x8a, 0xd6,
+    0x29, 0xbb, 0x22, 0x28, 0x63, 0xa6, 0xe4, 0xfc, 0xcd, 0x1e, 0x29, 0x2a, 0xa0, 0x80, 0xba, 0x80,
+    0x75, 0x24, 0x8d, 0x63, 0x8c, 0xa7, 0x68, 0x08, 0x61, 0xea, 0x30, 0x9e, 0xe7, 0x39, 0x9f, 0xeb,
+    0xdc, 0xba, 0x1e, 0x57, 0x45, 0x51, 0xe0, 0x48, 0x7f, 0x82, 0x74, 0x9c, 0x7f, 0xa0, 0xb8, 0x93,
+    0x2c, 0xa8, 0x83, 0xe4, 0x56, 0x6b, 0x6b, 0x7c, 0x82, 0x1b, 0x7f, 0x73, 0x46, 0x8a, 0x0b, 0x72,
+    0xda, 0xbb, 0x31, 0xb5, 0x05, 0xc7, 0x72, 0x94, 0x5a, 0x9a, 0xe0, 0x71, 0xd4, 0x82, 0xcf, 0x58,
+    0x27, 0x76, 0x9f, 0x0d, 0x2f, 0xdb, 0xb6, 0xc5, 0x45, 0x85, 0xab, 0x2a, 0x8b, 0x88, 0xcc, 0xbf,
+    0x9a, 0xc0, 0x8e, 0xd9, 0x32, 0x63, 0xbb, 0x02, 0xa2, 0x65, 0x60, 0x82, 0x05, 0x16, 0x63, 0x20,
+    0xb1, 0xdf, 0x3d, 0x7f, 0x7f, 0x5c, 0x62, 0x20, 0x9c, 0x77, 0xbf, 0xad, 0x7b, 0x81, 0xa5, 0xc8,
+    0xfe, 0xd8, 0x7d, 0x5c, 0x04, 0x4a, 0x1d, 0x20, 0x82, 0x77, 0x3b, 0xeb, 0x34, 0x0b, 0x5b, 0xa5,
+    0x59, 0x2f, 0x17, 0x6b, 0x5f, 0xa3, 0x06, 0x82, 0x2f, 0x8d, 0x0f, 0x60, 0x78, 0x9d, 0x64, 0xe2,
+    0x70, 0xd2, 0xdb, 0xbd, 0xe3, 0xf2, 0x53, 0x43, 0x82, 0x6b, 0xb5, 0x20, 0xf1, 0x8f, 0xa0, 0xc6,
+    0xf1, 0x69, 0x61, 0x45, 0xf8, 0x8a, 0x44, 0x85, 0x51, 0xbe, 0xe7, 0x04, 0x9f, 0x84, 0x25, 0xc5,
+    0xf8, 0x22, 0x99, 0xe0, 0x2b, 0x2f, 0xa4, 0x87, 0xe0, 0x98, 0xf1, 0x8b, 0x1a, 0x8a, 0x52, 0x38,
+    0xb2, 0x20, 0xbf, 0x64, 0x9b, 0xbb, 0x7c, 0x5d, 0x43, 0xd6, 0x34, 0x79, 0xdb, 0x94, 0xb7, 0xc9,
+    0x10, 0x99, 0x58, 0x18, 0x40, 0x50, 0xa4, 0xef, 0xe2, 0x6f, 0xd4, 0xd0, 0xdc, 0xe7, 0x4d, 0x53,
+    0x42, 0x55, 0x43, 0x55, 0xe6, 0xcd, 0x66, 0x93, 0xbd, 0x47, 0xeb, 0xba, 0x41, 0xb0, 0x8b, 0xea,
+    0x28, 0x32, 0xd6, 0x48, 0x04, 0x3e, 0x38, 0xfb, 0x12, 0xed, 0xdc, 0xc4, 0xeb, 0x9e, 0xb3, 0x6c,
+    0x54, 0x46, 0x72, 0x36, 0x51, 0xe4, 0xec, 0xde, 0x88, 0x7f, 0xca, 0x7f, 0xad, 0x32, 0xff, 0xd7,
+    0x4f, 0xff, 0xb6, 0xc9, 0xe3, 0x91, 0xda, 0xe4, 0x98, 0xe0, 0x3e, 0xfe, 0xe2, 0xb2, 0xd2, 0xed,
+    0xea, 0x0d, 0x79, 0x74, 0xef, 0x08, 0xba, 0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x95, 0x93, 0x5b, 0x6f, 0xdb, 0x20, 0x14, 0x80, 0xdf, 0xfb, 0x2b, 0x10,
+    0x7d, 0xd9, 0xb4, 0x86, 0x9b, 0x8d, 0x0d, 0x91, 0x9d, 0x4a, 0xd3, 0x54, 0x69, 0xaf, 0xbb, 0x68,
+    0xcf, 0x0c, 0xe3, 0xcb, 0x6a, 0x43, 0x84, 0x49, 0xd3, 0xfe, 0xfb, 0x81, 0xd3, 0x24, 0x6d, 0xd4,
+    0x6a, 0x9a, 0x64, 0x99, 0x73, 0xe0, 0xe3, 0x5c, 0x39, 0xd5, 0xed, 0xe3, 0x34, 0x82, 0x07, 0xe3,
+    0xe7, 0xc1, 0xd9, 0x1a, 0x52, 0x44, 0x20, 0x30, 0x56, 0xbb, 0x66, 0xb0, 0x5d, 0x0d, 0x7f, 0xfe,
+    0xb8, 0x5b, 0x09, 0x78, 0xbb, 0xb9, 0xaa, 0xe6, 0x87, 0x0e, 0xec, 0x87, 0x26, 0xf4, 0x35, 0xe4,
+    0x64, 0x9a, 0x20, 0xe8, 0xcd, 0xd0, 0xf5, 0xe1, 0xa8, 0xbd, 0x30, 0x40, 0xa3, 0x36, 0x98, 0xfd,
+    0x67, 0xf7, 0x58, 0x43, 0x02, 0x08, 0xe0, 0xe9, 0x83, 0x20, 0xba, 0xb1, 0x73, 0x0d, 0xfb, 0x10,
+    0xb6, 0x6b, 0x8c, 0xf7, 0xfb, 0x3d, 0xda, 0x67, 0xc8, 0xf9, 0x0e, 0x33, 0x42, 0x08, 0x8e, 0xe6,
+    0x9f, 0x91, 0xb5, 0xd6, 0x27, 0x4a, 0x7b, 0xa3, 0xc2, 0xf0, 0x60, 0xb4, 0x9b, 0x26, 0x67, 0xe7,
+    0x05, 0xb7, 0xf3, 0xf5, 0x91, 0x6c, 0xce, 0xe4, 0x76, 0xe7, 0xc7, 0xe5, 0xb8, 0xd1, 0xd8, 0x8c,
+    0x66, 0x32, 0x36, 0xcc, 0x38, 0xc6, 0x82, 0x8f, 0xac, 0x6f, 0xda, 0xb7, 0x9c, 0x53, 0x29, 0x25,
+    0x26, 0x0c, 0x33, 0xb6, 0x8a, 0xc4, 0x6a, 0x7e, 0xb2, 0x41, 0x3d, 0xae, 0x92, 0x8f, 0xcd, 0x15,
+    0xa8, 0x26, 0x13, 0x54, 0xa3, 0x82, 0x8a, 0x32, 0xa8, 0xe2, 0xf9, 0xfa, 0xdb, 0x97, 0xbb, 0x24,
+    0x83, 0x4a, 0xeb, 0xf5, 0x2f, 0xe7, 0xef, 0x41, 0xda, 0x54, 0xbf, 0xdd, 0x2e, 0x16, 0x02, 0x2e,
+    0x27, 0xa0, 0x6a, 0xf4, 0xba, 0x75, 0x7e, 0x52, 0x61, 0x33, 0x4c, 0xaa, 0x33, 0x29, 0xb5, 0x4f,
+    0x31, 0x86, 0x0a, 0x9f, 0x0f, 0x4e, 0x60, 0x78, 0xda, 0x9a, 0xc5, 0x86, 0x37, 0xb3, 0xdb, 0x79,
+    0x6d, 0xde, 0x4c, 0xa8, 0xd1, 0xd3, 0x90, 0x48, 0xfc, 0x3d, 0x0c, 0xe3, 0xf8, 0x35, 0x59, 0x85,
+    0xf8, 0x85, 0x91, 0x21, 0x8c, 0xe6, 0xa0, 0x57, 0xf8, 0x39, 0xb0, 0x25, 0x62, 0x7c, 0x0e, 0xb9,
+    0xc2, 0x2f, 0x72, 0xa9, 0x3a, 0x10, 0xbc, 0xb2, 0x73, 0x8a, 0xa6, 0x86, 0x8b, 0x38, 0xaa, 0x60,
+    0x3e, 0xac, 0x32, 0x54, 0xb2, 0x82, 0xdd, 0xc4, 0x35, 0xcb, 0x05, 0xfb, 0x08, 0x41, 0x1b, 0xfd,
+    0xd5, 0xd0, 0x3a, 0x6b, 0x20, 0x98, 0x83, 0x77, 0xf7, 0x31, 0xc0, 0xeb, 0xb6, 0x6d, 0x8f, 0xda,
+    0x6a, 0x1c, 0xac, 0xd1, 0x6a, 0x5b, 0x43, 0xef, 0x76, 0xb6, 0x39, 0x6d, 0x3f, 0xbf, 0x14, 0xb6,
+    0xd4, 0xa4, 0xda, 0xaa, 0xd0, 0x83, 0xa6, 0x86, 0x93, 0x44, 0x94, 0x96, 0x19, 0xa0, 0x04, 0x31,
+    0x9a, 0xf5, 0x71, 0x21, 0x25, 0x3b, 0x64, 0x72, 0x66, 0x32, 0x8e, 0x64, 0xce, 0x8e, 0x8c, 0x40,
+    0x85, 0x28, 0x8b, 0x4b, 0x86, 0xf2, 0x78, 0x93, 0x03, 0x2a, 0x90, 0xec, 0x0b, 0x94, 0x71, 0x26,
+    0x2f, 0x09, 0x56, 0xa2, 0xa2, 0x10, 0x80, 0x49, 0x24, 0x25, 0x4d, 0x9e, 0xca, 0x82, 0x5e, 0x32,
+    0x32, 0x7a, 0x28, 0x38, 0xc8, 0x79, 0xb4, 0x20, 0x7b, 0x9a, 0x21, 0x2a, 0xcb, 0x4b, 0x26, 0x27,
+    0x88, 0xf2, 0x13, 0x23, 0x10, 0x2b, 0xc8, 0xc1, 0x4e, 0x85, 0xbb, 0xff, 0xaa, 0xe4, 0xab, 0xea,
+    0x2d, 0x3e, 0xde, 0xbb, 0x4a, 0x79, 0x8e, 0x4a, 0x71, 0x43, 0x91, 0x28, 0x68, 0xbc, 0x79, 0xe8,
+    0xab, 0x37, 0x3a, 0x80, 0x38, 0x50, 0x94, 0x4b, 0xc4, 0xe3, 0x84, 0x3d, 0xc5, 0xe2, 0xa2, 0x5c,
+    0x94, 0xf0, 0x38, 0x94, 0xb9, 0x38, 0x8f, 0x64, 0x92, 0x7d, 0x24, 0x0a, 0x24, 0x48, 0x56, 0xbc,
+    0xee, 0xa2, 0xdb, 0x2a, 0x1d, 0x1f, 0x53, 0x0d, 0x63, 0x61, 0xc4, 0x3b, 0x4d, 0x6d, 0xd4, 0xdc,
+    0xbb, 0xb6, 0x9d, 0x4d, 0xb4, 0x95, 0x95, 0xa8, 0x94, 0xfc, 0x5f, 0xfd, 0x4e, 0xdb, 0x7f, 0xdc,
+    0x60, 0xdf, 0x7d, 0x07, 0x87, 0xb2, 0x1e, 0x6a, 0x96, 0xfe, 0x55, 0x1a, 0x8b, 0xcd, 0xd5, 0x5f,
+    0x23, 0xb1, 0x63, 0x12, 0x7e, 0x04, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0xe5, 0x55, 0xc9, 0x6e, 0xdb, 0x30, 0x10, 0xbd, 0xe7, 0x2b, 0x08, 0x06, 0x45, 0x1a,
+    0x14, 0x12, 0x45, 0x6a, 0xb1, 0xe4, 0x4a, 0x0e, 0xd0, 0x16, 0x29, 0x7a, 0xed, 0x82, 0x9e, 0x19,
+    0x8a, 0xb6, 0xd9, 0x48, 0xa4, 0x41, 0xd2, 0x5b, 0xbf, 0xbe, 0x43, 0x79, 0x8b, 0xb3, 0x5c, 0x02,
+    0xf4, 0x14, 0x43, 0xb0, 0xc8, 0x99, 0xa7, 0x99, 0x79, 0x8f, 0xa3, 0x51, 0x7d, 0xb3, 0xe9, 0x3b,
+    0xb4, 0x92, 0xd6, 0x29, 0xa3, 0x1b, 0x4c, 0xe3, 0x04, 0x23, 0xa9, 0x85, 0x69, 0x95, 0x9e, 0x35,
+    0xf8, 0xd7, 0xcf, 0xdb, 0xa8, 0xc4, 0x37, 0x93, 0x8b, 0xda, 0xad, 0x66, 0x68, 0xad, 0x5a, 0x3f,
+    0x6f, 0x70, 0x9e, 0xf4, 0x3d, 0x46, 0x73, 0xa9, 0x66, 0x73, 0x7f, 0xd8, 0x3d, 0x08, 0x40, 0x61,
+    0xa7, 0xe4, 0xfa, 0x93, 0xd9, 0x34, 0x38, 0x41, 0x09, 0xca, 0xc3, 0x85, 0x11, 0xa4, 0xd1, 0xae,
+    0xc1, 0x73, 0xef, 0x17, 0x63, 0x42, 0xd6, 0xeb, 0x75, 0xbc, 0x4e, 0x63, 0x63, 0x67, 0x84, 0x25,
+    0x49, 0x42, 0x20, 0xfc, 0x1e, 0x32, 0x16, 0xe2, 0x88, 0x12, 0x56, 0x72, 0xaf, 0x56, 0x52, 0x98,
+    0xbe, 0x37, 0xda, 0x0d, 0x70, 0xed, 0x2e, 0x0f, 0xc8, 0xf6, 0x84, 0x5c, 0x2c, 0x6d, 0x37, 0xb8,
+    0x5b, 0x41, 0x64, 0x27, 0x7b, 0xa9, 0xbd, 0x23, 0x50, 0x0b, 0x39, 0x60, 0x6d, 0x3b, 0x7d, 0x2e,
+    0x39, 0xad, 0xaa, 0x8a, 0x24, 0x8c, 0x30, 0x16, 0x01, 0x22, 0x72, 0x5b, 0xed, 0xf9, 0x26, 0x0a,
+    0x39, 0x26, 0x17, 0xa8, 0xee, 0xa5, 0xe7, 0x2d, 0xf7, 0x1c, 0xd6, 0xa8, 0x06, 0xff, 0xf8, 0xfb,
+    0x97, 0xdb, 0xb0, 0x46, 0xb5, 0x10, 0xe3, 0xdf, 0xc6, 0xde, 0xa3, 0x60, 0xe4, 0x77, 0x66, 0x09,
+    0x42, 0xe0, 0xc1, 0x83, 0xea, 0x56, 0x8c, 0xa7, 0xc6, 0xf6, 0xdc, 0x4f, 0x54, 0xcf, 0x67, 0x32,
+    0x50, 0xfb, 0x00, 0x35, 0xd4, 0xe4, 0xe4, 0x38, 0x02, 0xfd, 0x76, 0x21, 0x87, 0x18, 0x56, 0x3a,
+    0xb3, 0xb4, 0x42, 0x3e, 0x4b, 0xa8, 0x15, 0xbd, 0x0a, 0x48, 0xf2, 0xc3, 0xab, 0xae, 0xfb, 0x16,
+    0xa2, 0x62, 0xf2, 0x20, 0x88, 0xf2, 0x9d, 0xdc, 0xed, 0x6b, 0xb2, 0x2f, 0x6c, 0xa8, 0x98, 0x9c,
+    0x4a, 0xae, 0xc9, 0x03, 0x2e, 0xf5, 0x0c, 0x79, 0xcb, 0xb5, 0x0b, 0xd5, 0x34, 0x78, 0x58, 0x76,
+    0xdc, 0xcb, 0xf7, 0x51, 0x91, 0xc4, 0x49, 0x96, 0xa3, 0x28, 0x8d, 0x69, 0x5e, 0xb1, 0x6b, 0x8c,
+    0x5a, 0xe5, 0x16, 0x1d, 0xdf, 0x36, 0x58, 0x1b, 0x2d, 0xf1, 0x4e, 0x06, 0x29, 0x3c, 0x82, 0xa3,
+    0x8d, 0xd2, 0x24, 0x66, 0x69, 0x89, 0x11, 0x78, 0x23, 0x16, 0x27, 0xa3, 0xb2, 0xc2, 0x87, 0x0e,
+    0x61, 0x45, 0x0e, 0x11, 0x4e, 0x3d, 0x42, 0xb3, 0x22, 0x66, 0x00, 0x9d, 0x42, 0xf9, 0x0d, 0xbe,
+    0xa4, 0x77, 0x8c, 0xa6, 0x74, 0xb7, 0x8d, 0xec, 0xb2, 0x03, 0xd6, 0x72, 0x25, 0xb5, 0x69, 0x5b,
+    0x8c, 0xcc, 0x82, 0x0b, 0x20, 0xdb, 0xe0, 0xb8, 0xaa, 0xca, 0x81, 0x65, 0x4d, 0x66, 0xe1, 0xdf,
+    0xcb, 0xcd, 0x90, 0x97, 0xa6, 0xf1, 0xa8, 0xa4, 0x6c, 0x44, 0x87, 0xcc, 0x59, 0x06, 0x89, 0x46,
+    0xd9, 0x28, 0x3f, 0x06, 0x9f, 0x0e, 0x3f, 0xd8, 0x1a, 0xed, 0xa3, 0x29, 0xef, 0x55, 0x07, 0xb0,
+    0x2f, 0xb2, 0x53, 0x42, 0x99, 0xa5, 0xdb, 0xdb, 0x9d, 0xfa, 0x0b, 0x49, 0x19, 0x8b, 0x59, 0x51,
+    0x2c, 0x36, 0x18, 0x75, 0xd2, 0x7b, 0x69, 0x23, 0x17, 0x92, 0x87, 0xbe, 0x4f, 0x82, 0xd1, 0x79,
+    0x6b, 0xee, 0x65, 0xd4, 0x29, 0x2d, 0x05, 0x5f, 0x34, 0xd8, 0x9a, 0xa5, 0x6e, 0xcf, 0xcc, 0x7f,
+    0x8c, 0xd2, 0x8f, 0xed, 0x0f, 0x08, 0xa4, 0x79, 0x51, 0x1c, 0xed, 0x7b, 0x69, 0x68, 0x9c, 0x56,
+    0x0c, 0x84, 0x32, 0xb6, 0x7d, 0x92, 0x6e, 0x1b, 0x94, 0x08, 0x71, 0xa3, 0x9d, 0x70, 0x63, 0xca,
+    0xf2, 0x77, 0x43, 0x03, 0x8f, 0x03, 0x14, 0x9c, 0x0b, 0xe8, 0x13, 0x69, 0x57, 0x70, 0x14, 0xb5,
+    0x07, 0x93, 0x7e, 0xb5, 0x20, 0x57, 0x9f, 0xe1, 0x0d, 0x59, 0xda, 0x2d, 0xfa, 0x6a, 0xfc, 0x5c,
+    0x89, 0xab, 0x17, 0x74, 0xf9, 0x9f, 0x12, 0xec, 0xf9, 0x0e, 0x79, 0x57, 0xdc, 0x2a, 0x0e, 0x77,
+    0x48, 0xe2, 0xc6, 0x3a, 0xbc, 0x24, 0xdd, 0xc7, 0x33, 0x87, 0xe4, 0xce, 0x47, 0xdc, 0xc1, 0xfa,
+    0x59, 0x77, 0xa7, 0x66, 0x1c, 0xe8, 0xc8, 0xe7, 0x1f, 0xd6, 0xcb, 0x5e, 0x5a, 0x25, 0xf6, 0x3e,
+    0x3c, 0x49, 0xb3, 0x9a, 0x0c, 0xf2, 0x4d, 0xe0, 0x0e, 0x6d, 0x75, 0xd6, 0x5e, 0xc0, 0x3d, 0x4b,
+    0xd3, 0x62, 0xd7, 0xd8, 0x8c, 0x02, 0x85, 0xa4, 0xcc, 0xaa, 0x37, 0xdc, 0x5e, 0xaf, 0x11, 0xe4,
+    0x4d, 0xb7, 0x17, 0x65, 0x4f, 0xdb, 0xeb, 0xa5, 0x89, 0x4b, 0xf3, 0x32, 0xce, 0x29, 0x8a, 0x68,
+    0x9c, 0x95, 0xa3, 0xeb, 0x03, 0x95, 0x9d, 0xac, 0xe7, 0xf3, 0x16, 0x26, 0x32, 0x20, 0x77, 0x87,
+    0x10, 0xc0, 0xc7, 0x61, 0x9b, 0x95, 0xa7, 0x41, 0x1b, 0xd6, 0x16, 0x10, 0x45, 0x5c, 0x26, 0x69,
+    0x71, 0x38, 0xa3, 0x61, 0x78, 0x3f, 0x9a, 0xac, 0xe7, 0x99, 0x0e, 0x12, 0xb6, 0xdc, 0xcd, 0xcd,
+    0x74, 0xea, 0x24, 0xc4, 0x4a, 0x47, 0xf1, 0xa8, 0xca, 0x5f, 0x7b, 0x48, 0x87, 0x2f, 0xc1, 0x69,
+    0x84, 0xd7, 0xe1, 0x4b, 0x38, 0xb9, 0xf8, 0x07, 0xb4, 0x80, 0x9c, 0x0e, 0x71, 0x08, 0x00, 0x00,
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x52, 0x4d, 0x6f, 0xe3, 0x20,
+    0x14, 0xbc, 0xe7, 0x57, 0x20, 0x7a, 0x69, 0xb5, 0xb2, 0xc1, 0xc6, 0xd9, 0x34, 0x16, 0xa4, 0xd2,
+    0x6a, 0x55, 0x69, 0xaf, 0xbb, 0xad, 0xf6, 0x4c, 0x81, 0xd8, 0xa8, 0x06, 0x2c, 0x20, 0x71, 0xfa,
+    0xef, 0x0b, 0xce, 0xa7, 0xaa, 0xde, 0xde, 0x63, 0x86, 0x99, 0x79, 0x0f, 0xe8, 0xd3, 0xc1, 0x0c,
+    0x60, 0xaf, 0x7c, 0xd0, 0xce, 0x32, 0x58, 0x95, 0x18, 0x02, 0x65, 0x85, 0x93, 0xda, 0x76, 0x0c,
+    0xbe, 0xbe, 0x3c, 0x17, 0x8f, 0xf0, 0x69, 0xb3, 0xa0, 0x61, 0xdf, 0x81, 0x49, 0xcb, 0xd8, 0x33,
+    0x48, 0x96, 0x25, 0x26, 0xc4, 0x18, 0x08, 0x7a, 0xa5, 0xbb, 0x3e, 0x32, 0xd8, 0xe0, 0xdc, 0xdd,
+    0x88, 0x54, 0xa9, 0xd3, 0x6a, 0xfa, 0xe5, 0x0e, 0x0c, 0x62, 0x80, 0xc1, 0xf1, 0x0a, 0x68, 0x92,
+    0x78, 0xb2, 0xb3, 0x81, 0xc1, 0x3e, 0xc6, 0xb1, 0x45, 0x68, 0x9a, 0xa6, 0x72, 0x22, 0xa5, 0xf3,
+    0x1d, 0xaa, 0x31, 0xc6, 0x28, 0xd9, 0x9c, 0x28, 0xad, 0x10, 0x17, 0x96, 0xf0, 0x8a, 0x47, 0xbd,
+    0x57, 0xc2, 0x19, 0xe3, 0x6c, 0x98, 0xe9, 0x36, 0xdc, 0x9d, 0x99, 0xf2, 0xca, 0x1c, 0x77, 0x7e,
+    0x98, 0x61, 0x29, 0x90, 0x1a, 0x94, 0x51, 0x36, 0x06, 0x94, 0xf2, 0xa0, 0x33, 0xd7, 0xcb, 0xed,
+    0x77, 0xe6, 0xd5, 0x7a, 0xbd, 0x46, 0xb8, 0x46, 0x75, 0x5d, 0x24, 0x46, 0x11, 0x3e, 0x6c, 0xe4,
+    0x87, 0x22, 0x7b, 0x6c, 0x16, 0x80, 0x1a, 0x15, 0xb9, 0xe4, 0x91, 0xa7, 0x1a, 0xd0, 0x84, 0xb7,
+    0x7f, 0x7f, 0x3f, 0xe7, 0x1a, 0x50, 0x21, 0xda, 0xff, 0xce, 0xbf, 0x83, 0x7c, 0xc8, 0xdf, 0xdc,
+    0x2e, 0x2d, 0x03, 0xce, 0x08, 0xa0, 0x52, 0xb4, 0x5b, 0xe7, 0x0d, 0x8f, 0x1b, 0x6d, 0x78, 0xa7,
+    0xf2, 0x68, 0x3f, 0x52, 0x06, 0x8a, 0xae, 0xc0, 0x85, 0x18, 0x3f, 0x46, 0x35, 0x6b, 0x78, 0x15,
+    0xdc, 0xce, 0x0b, 0xf5, 0xed, 0x40, 0x52, 0x18, 0x9d, 0x99, 0xe8, 0x5f, 0xd4, 0xc3, 0xf0, 0x27,
+    0xab, 0x42, 0x74, 0x23, 0xa2, 0xe3, 0xa0, 0x8e, 0x3d, 0x45, 0xa7, 0x60, 0x73, 0x62, 0x74, 0x8d,
+    0x4c, 0xd1, 0xcd, 0x2c, 0xb4, 0x03, 0xd1, 0x73, 0x1b, 0x72, 0x1a, 0x06, 0xe7, 0x72, 0xe0, 0x51,
+    0xdd, 0x17, 0x0d, 0x29, 0x97, 0xeb, 0x15, 0x28, 0x2a, 0xb2, 0x2a, 0xab, 0xe5, 0x03, 0x04, 0xdb,
+    0xe4, 0xc7, 0xa0, 0x75, 0x56, 0x41, 0x10, 0xa2, 0x77, 0xef, 0x29, 0xe0, 0x5d, 0x7a, 0xaf, 0x73,
+    0x57, 0x0c, 0xda, 0x2a, 0xc1, 0x47, 0x06, 0xbd, 0xdb, 0x59, 0x79, 0x39, 0x3e, 0xfd, 0x98, 0x0a,
+    0xcf, 0x4b, 0xa1, 0x23, 0x8f, 0x3d, 0x90, 0x0c, 0x9a, 0xe6, 0x71, 0x36, 0xa8, 0x9a, 0x3a, 0xe9,
+    0xef, 0x09, 0x3e, 0x8e, 0x71, 0xc5, 0x57, 0xa4, 0xfc, 0x49, 0xbe, 0xc0, 0x14, 0x75, 0xe9, 0x1f,
+    0xe6, 0x35, 0x6e, 0x16, 0x9f, 0x4e, 0x1e, 0xba, 0x76, 0xb6, 0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x53, 0x4d, 0x6f, 0xdc, 0x20, 0x10, 0xbd, 0xe7,
+    0x57, 0x20, 0x72, 0x69, 0x54, 0x19, 0x0c, 0x5e, 0xbc, 0xf6, 0xca, 0xde, 0x48, 0x55, 0x15, 0xa9,
+    0xd7, 0x7e, 0xa8, 0x67, 0x02, 0xd8, 0xa6, 0xb1, 0xc1, 0x02, 0x76, 0x37, 0xf9, 0xf7, 0xc5, 0x76,
+    0xf6, 0x2b, 0xda, 0x4a, 0x95, 0x7c, 0x98, 0x61, 0xde, 0x0c, 0xef, 0xbd, 0xc1, 0xd5, 0xe3, 0xeb,
+    0xd0, 0x83, 0xbd, 0x72, 0x5e, 0x5b, 0x53, 0x43, 0x82, 0x52, 0x08, 0x94, 0x11, 0x56, 0x6a, 0xd3,
+    0xd6, 0xf0, 0xd7, 0xcf, 0xa7, 0xa4, 0x80, 0x8f, 0xdb, 0xbb, 0xca, 0xef, 0x5b, 0x70, 0xd0, 0x32,
+    0x74, 0x35, 0x64, 0xe9, 0x30, 0x40, 0xd0, 0x29, 0xdd, 0x76, 0xe1, 0x98, 0x5d, 0x0c, 0x20, 0x31,
+    0xd3, 0xea, 0xf0, 0xc5, 0xbe, 0xd6, 0x30, 0x05, 0x29, 0x60, 0xd3, 0x07, 0x41, 0xbc, 0xc6, 0xf8,
+    0x1a, 0x76, 0x21, 0x8c, 0x1b, 0x8c, 0x0f, 0x87, 0x03, 0x3a, 0x64, 0xc8, 0xba, 0x16, 0xd3, 0x34,
+    0x4d, 0x71, 0x1c, 0xff, 0x0e, 0xd9, 0x08, 0x71, 0x42, 0x09, 0xa7, 0x78, 0xd0, 0x7b, 0x25, 0xec,
+    0x30, 0x58, 0xe3, 0x67, 0xb8, 0xf1, 0xf7, 0x47, 0xa4, 0x3c, 0x23, 0xc7, 0x9d, 0xeb, 0xe7, 0xb2,
+    0x14, 0x58, 0xf5, 0x6a, 0x50, 0x26, 0x78, 0x1c, 0xb9, 0xe0, 0x23, 0xd6, 0xc9, 0xe6, 0xd6, 0xe5,
+    0xa4, 0x2c, 0x4b, 0x9c, 0x52, 0x4c, 0x69, 0x12, 0x11, 0x89, 0x7f, 0x33, 0x81, 0xbf, 0x26, 0xd3,
+    0x1d, 0xdb, 0x3b, 0x50, 0x0d, 0x2a, 0x70, 0xc9, 0x03, 0x8f, 0x31, 0xa8, 0x62, 0x7d, 0xf3, 0xfd,
+    0xeb, 0xd3, 0x14, 0x83, 0x4a, 0x88, 0xcd, 0x6f, 0xeb, 0x5e, 0xc0, 0x74, 0xc8, 0x9f, 0xed, 0x2e,
+    0x1a, 0x01, 0xe7, 0x0a, 0xa8, 0xa4, 0xd8, 0x34, 0xd6, 0x0d, 0x3c, 0x6c, 0xf5, 0xc0, 0x5b, 0x35,
+    0x49, 0xfb, 0x1c, 0x39, 0x54, 0xf8, 0x5c, 0x38, 0x01, 0xc3, 0xdb, 0xa8, 0xe6, 0x19, 0x4e, 0x79,
+    0xbb, 0x73, 0x42, 0xdd, 0x14, 0x24, 0xc5, 0xa0, 0x27, 0x24, 0xfe, 0x11, 0x74, 0xdf, 0x7f, 0x9b,
+    0xa6, 0x42, 0x7c, 0x31, 0x44, 0x87, 0x5e, 0x2d, 0x79, 0x85, 0xdf, 0x89, 0xcd, 0x8c, 0xf1, 0x99,
+    0x72, 0x85, 0x2f, 0xb4, 0x54, 0x2d, 0x08, 0x8e, 0x1b, 0x3f, 0xb1, 0xa9, 0xe1, 0x1c, 0xf6, 0x3c,
+    0xa8, 0x4f, 0xc9, 0x0a, 0x11, 0xb6, 0x66, 0x20, 0x61, 0x25, 0x2a, 0x4a, 0xf2, 0x00, 0x81, 0xd4,
+    0x7e, 0xec, 0xf9, 0x5b, 0x0d, 0x8d, 0x35, 0x0a, 0x2e, 0x36, 0x28, 0x11, 0x40, 0x5c, 0x6d, 0x92,
+    0xa5, 0x88, 0x66, 0x05, 0x04, 0xb1, 0x9a, 0x50, 0x94, 0xae, 0x8b, 0x12, 0x1e, 0x5f, 0x08, 0xcd,
+    0x59, 0x9c, 0x74, 0x7e, 0x23, 0x64, 0x95, 0x23, 0x1a, 0xa1, 0x4d, 0xa4, 0x5f, 0xc3, 0x7b, 0xf2,
+    0x4c, 0x49, 0x46, 0x96, 0x34, 0x71, 0xbb, 0x3e, 0xaa, 0x56, 0x7b, 0x65, 0xac, 0x94, 0x10, 0xd8,
+    0x91, 0x8b, 0x28, 0xb6, 0x86, 0xa8, 0x2c, 0x8b, 0x59, 0x65, 0x85, 0xdb, 0x85, 0xf3, 0xd2, 0x3d,
+    0x33, 0x01, 0x3e, 0x38, 0xfb, 0x12, 0xfb, 0xee, 0x9b, 0xa6, 0x39, 0x66, 0x49, 0xaf, 0x8d, 0x12,
+    0x7c, 0xac, 0xa1, 0xb3, 0x3b, 0x23, 0x17, 0xba, 0x23, 0x0f, 0x1d, 0x90, 0x35, 0x1c, 0x18, 0x2a,
+    0x09, 0x65, 0xa0, 0x40, 0x74, 0xcd, 0xf6, 0x24, 0xbe, 0x73, 0x96, 0x9f, 0x1a, 0x8f, 0xb4, 0x17,
+    0x57, 0xcf, 0x3d, 0xab, 0x0c, 0x65, 0x19, 0x05, 0x51, 0x69, 0xc1, 0xca, 0xff, 0x6d, 0x22, 0x39,
+    0x2a, 0xb2, 0x1c, 0x90, 0x35, 0x5a, 0xb3, 0xbc, 0x4b, 0x11, 0xa3, 0x34, 0x2f, 0x3e, 0x76, 0x11,
+    0x94, 0xe7, 0xd9, 0xb5, 0xbc, 0xdb, 0x2b, 0x21, 0xac, 0x40, 0x8c, 0x80, 0x84, 0xa0, 0x55, 0xb1,
+    0x7e, 0xf8, 0x20, 0xfc, 0x6a, 0x21, 0x24, 0x6e, 0x8d, 0x91, 0x79, 0x1f, 0x74, 0x02, 0x9f, 0xb6,
+    0xb1, 0x2a, 0xce, 0x9b, 0x98, 0x62, 0x17, 0x11, 0x91, 0x63, 0x9a, 0xe5, 0xf0, 0xca, 0xd3, 0x6b,
+    0xeb, 0x6f, 0x5b, 0x2c, 0xb9, 0xef, 0x6c, 0xd3, 0x78, 0x15, 0x67, 0x65, 0x51, 0x61, 0xc9, 0xfe,
+    0xe5, 0xfe, 0xe5, 0xf1, 0x1f, 0xab, 0xcd, 0xc7, 0xf3, 0x2b, 0xfb, 0x66, 0x13, 0xaa, 0xe9, 0x57,
+    0xd9, 0xde, 0xfd, 0x05, 0x1a, 0x82, 0x9b, 0x6d, 0x92, 0x04, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x52, 0xcb, 0x6e, 0xdb, 0x30, 0x10, 0xbc, 0xfb, 0x2b,
+    0x08, 0xe6, 0xd2, 0xa2, 0x10, 0x49, 0xc9, 0x8f, 0x48, 0x02, 0xe5, 0x00, 0x45, 0x11, 0xa0, 0xd7,
+    0x3e, 0xd0, 0x33, 0x43, 0xae, 0x25, 0x26, 0x22, 0x29, 0x90, 0x94, 0xe5, 0xf4, 0xeb, 0x4b, 0xa9,
+    0x76, 0xec, 0x16, 0x01, 0x74, 0xd8, 0xd9, 0x1d, 0xcc, 0xce, 0xac, 0xc8, 0x1f, 0x4e, 0xa6, 0x47,
+    0x47, 0xf0, 0x41, 0x3b, 0xdb, 0xe0, 0x9c, 0x30, 0x8c, 0xc0, 0x4a, 0xa7, 0xb4, 0x6d, 0x1b, 0xfc,
+    0xf3, 0xc7, 0x63, 0x56, 0xe2, 0x87, 0xfd, 0x8a, 0x87, 0x63, 0x8b, 0x26, 0xad, 0x62, 0xd7, 0xe0,
+    0x35, 0x33, 0x06, 0xa3, 0x0e, 0x74, 0xdb, 0xc5, 0x0b, 0xba, 0x11, 0xc8, 0x13, 0xd2, 0x30, 0x7d,
+    0x76, 0xa7, 0x06, 0x33, 0xc4, 0xd0, 0x7a, 0xfe, 0x30, 0x4a, 0x6b, 0x6c, 0x68, 0x70, 0x17, 0xe3,
+    0x50, 0x53, 0x3a, 0x4d, 0x13, 0x99, 0xd6, 0xc4, 0xf9, 0x96, 0x16, 0x8c, 0x31, 0x9a, 0xe4, 0xcf,
+    0x94, 0x5a, 0xca, 0x37, 0x96, 0xf4, 0x20, 0xa2, 0x3e, 0x82, 0x74, 0xc6, 0x38, 0x1b, 0x16, 0xba,
+    0x0d, 0x77, 0x17, 0xa6, 0xba, 0x32, 0x87, 0xd1, 0xf7, 0xcb, 0x58, 0x49, 0x0a, 0x3d, 0x18, 0xb0,
+    0x31, 0xd0, 0xe4, 0x85, 0x5e, 0xb8, 0x5e, 0x1d, 0xde, 0x5b, 0x9e, 0x57, 0x55, 0x45, 0x59, 0x41,
+    0x8b, 0x22, 0x4b, 0x8c, 0x2c, 0xbc, 0xda, 0x28, 0x4e, 0xd9, 0xbc, 0x63, 0xbf, 0x42, 0xdc, 0x40,
+    0x14, 0x4a, 0x44, 0x91, 0x6a, 0xc4, 0xd3, 0xbc, 0xfe, 0xf6, 0xe5, 0x71, 0xae, 0x11, 0x97, 0xb2,
+    0xfe, 0xe5, 0xfc, 0x0b, 0x9a, 0x9b, 0xe2, 0xc9, 0x8d, 0xe9, 0x10, 0x78, 0x99, 0x20, 0xae, 0x64,
+    0x7d, 0x70, 0xde, 0x88, 0xb8, 0xd7, 0x46, 0xb4, 0x30, 0x47, 0xfb, 0x94, 0x3c, 0x70, 0x7a, 0x1d,
+    0xbc, 0x11, 0xe3, 0xeb, 0x00, 0x8b, 0x86, 0x87, 0xe0, 0x46, 0x2f, 0xe1, 0xdd, 0x40, 0x4a, 0x1a,
+    0x3d, 0x33, 0xe9, 0xf7, 0xa8, 0xfb, 0xfe, 0xeb, 0xac, 0x8a, 0xe9, 0x8d, 0x88, 0x8e, 0x3d, 0xfc,
+    0xc5, 0x9c, 0x9e, 0x8d, 0x2d, 0x8e, 0xe9, 0xd5, 0x32, 0xa7, 0x37, 0x59, 0x78, 0x8b, 0xa2, 0x17,
+    0x36, 0xcc, 0x6e, 0x1a, 0xbc, 0x94, 0xbd, 0x88, 0xf0, 0x21, 0xcb, 0xd9, 0x8e, 0xec, 0xee, 0x51,
+    0x96, 0x17, 0x3b, 0xc2, 0x8a, 0x8f, 0x4b, 0x22, 0x3e, 0x88, 0xd8, 0x21, 0xd5, 0x60, 0x93, 0xb3,
+    0x8a, 0x6c, 0x50, 0x5e, 0x94, 0xe4, 0x7e, 0x8b, 0x8a, 0x0d, 0xd9, 0xae, 0xcb, 0x84, 0x48, 0xb1,
+    0xcd, 0x6e, 0x40, 0x59, 0xfd, 0xc6, 0xe8, 0x90, 0x6c, 0x66, 0x7e, 0xec, 0x53, 0x1c, 0x38, 0x82,
+    0x75, 0x4a, 0x61, 0x14, 0xa2, 0x77, 0x2f, 0xa9, 0x71, 0x97, 0x7e, 0xf7, 0x05, 0x65, 0xbd, 0xb6,
+    0x20, 0xc5, 0xd0, 0x60, 0xef, 0x46, 0xab, 0xfe, 0x69, 0x3f, 0x3b, 0x6d, 0xff, 0xef, 0x9f, 0x1f,
+    0xe0, 0x96, 0x6c, 0x76, 0x79, 0xb9, 0x9c, 0x80, 0xd3, 0x36, 0x3d, 0xce, 0xf9, 0xc6, 0xfb, 0xd5,
+    0x1f, 0x23, 0xcc, 0xb6, 0x1c, 0xcb, 0x02, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x7d, 0x52, 0xc9, 0x6e, 0xdb, 0x30, 0x10, 0xbd, 0xe7, 0x2b, 0x06, 0xcc, 0x25,
+    0x41, 0x21, 0x6e, 0xda, 0x0d, 0xca, 0x01, 0x8a, 0x22, 0x40, 0xaf, 0x5d, 0xd0, 0xb3, 0x4a, 0xd1,
+    0x32, 0x1b, 0x89, 0x34, 0x28, 0x7a, 0x49, 0xbf, 0xbe, 0x94, 0x64, 0xc5, 0x76, 0x10, 0xf4, 0xc6,
+    0xe1, 0x3c, 0xbe, 0x65, 0x38, 0xe2, 0xe9, 0xd4, 0x77, 0x70, 0x50, 0x6e, 0xd0, 0xd6, 0x54, 0x88,
+    0x61, 0x8a, 0x40, 0x19, 0x69, 0x1b, 0x6d, 0xda, 0x0a, 0xfd, 0xfc, 0xf1, 0x1c, 0x15, 0xe8, 0x69,
+    0x7d, 0x27, 0x86, 0x43, 0x0b, 0x47, 0xdd, 0xf8, 0x6d, 0x85, 0xd2, 0x12, 0xd3, 0x2c, 0xee, 0x7b,
+    0x04, 0x5b, 0xa5, 0xdb, 0xad, 0xaf, 0x50, 0x92, 0xe3, 0x8c, 0xb3, 0xf1, 0xe6, 0x8a, 0x88, 0x85,
+    0x4a, 0xab, 0xe3, 0x67, 0x7b, 0xaa, 0x10, 0x05, 0x0a, 0xf3, 0x33, 0x98, 0xb1, 0x08, 0x82, 0xac,
+    0x19, 0x2a, 0xb4, 0xf5, 0x7e, 0xb7, 0x22, 0xe4, 0x78, 0x3c, 0xe2, 0x63, 0x8c, 0xad, 0x6b, 0x09,
+    0xa7, 0x94, 0x92, 0x20, 0x77, 0x86, 0xac, 0xa4, 0x7c, 0x43, 0x49, 0xa7, 0x6a, 0xaf, 0x0f, 0x4a,
+    0xda, 0xbe, 0xb7, 0x66, 0x98, 0xe0, 0x66, 0xb8, 0x5f, 0x90, 0xcd, 0x05, 0xb9, 0xdb, 0xbb, 0x6e,
+    0x6a, 0x37, 0x92, 0xa8, 0x4e, 0xf5, 0xca, 0xf8, 0x81, 0x04, 0x4f, 0x64, 0xc1, 0xba, 0x66, 0xf3,
+    0x91, 0x38, 0x2b, 0xcb, 0x92, 0x50, 0x4e, 0x38, 0x8f, 0x02, 0x22, 0x1a, 0x5e, 0x8d, 0xaf, 0x4f,
+    0xd1, 0xa8, 0xb1, 0xbe, 0x03, 0xd1, 0x2b, 0x5f, 0x37, 0xb5, 0xaf, 0xc3, 0x19, 0x44, 0xe8, 0xaf,
+    0xbe, 0x7d, 0x79, 0x1e, 0xcf, 0x20, 0xa4, 0x5c, 0xfd, 0xb2, 0xee, 0x05, 0xc6, 0xcb, 0xfa, 0xb7,
+    0xdd, 0x87, 0xa1, 0xa0, 0xa9, 0x03, 0xa2, 0x91, 0xab, 0x8d, 0x75, 0x7d, 0xed, 0xd7, 0xba, 0xaf,
+    0x5b, 0x35, 0x46, 0xfb, 0x14, 0x3c, 0x08, 0x72, 0x69, 0xbc, 0x01, 0xfd, 0xeb, 0x4e, 0x4d, 0x1c,
+    0x4e, 0x0d, 0x76, 0xef, 0xa4, 0xfa, 0x30, 0x50, 0x23, 0x7b, 0x3d, 0x22, 0xc9, 0x77, 0xaf, 0xbb,
+    0xee, 0xeb, 0xc8, 0x8a, 0xc8, 0x15, 0x89, 0xf6, 0x9d, 0x9a, 0x6b, 0x41, 0xce, 0xc6, 0x26, 0xc7,
+    0xe4, 0x62, 0x59, 0x90, 0xab, 0x2c, 0xa2, 0x05, 0xef, 0x6a, 0x33, 0x8c, 0x6e, 0x2a, 0x34, 0x1d,
+    0xbb, 0xda, 0xab, 0x87, 0x28, 0x4b, 0xc3, 0x5f, 0xc5, 0x10, 0xf1, 0x14, 0xe7, 0x2c, 0x7b, 0x44,
+    0x30, 0x78, 0x67, 0x5f, 0x82, 0xa9, 0xfb, 0xf0, 0x47, 0x4b, 0x15, 0x75, 0xda, 0x28, 0x59, 0xef,
+    0x2a, 0xe4, 0xec, 0xde, 0x34, 0x53, 0x6c, 0xb1, 0xab, 0xfd, 0x16, 0x9a, 0x0a, 0xf5, 0x59, 0x81,
+    0x19, 0x4f, 0x20, 0xce, 0x03, 0x43, 0x0c, 0x9c, 0xe2, 0xb4, 0x48, 0x80, 0x71, 0xcc, 0xd3, 0xe8,
+    0xaa, 0x28, 0xca, 0xbf, 0x08, 0x36, 0x21, 0x4c, 0xe4, 0xf6, 0x5d, 0xe0, 0x57, 0x07, 0x65, 0x6c,
+    0xd3, 0xdc, 0x48, 0xfc, 0xb1, 0xda, 0x2c, 0x1a, 0xcb, 0xfd, 0xb2, 0x91, 0x98, 0x52, 0x9e, 0xcc,
+    0x33, 0xb8, 0x0d, 0x13, 0xa6, 0xeb, 0xf4, 0xe9, 0x01, 0x67, 0x94, 0xa5, 0x29, 0x8c, 0x6b, 0x88,
+    0xf3, 0xac, 0xc8, 0x72, 0xc8, 0x73, 0x5c, 0x16, 0x05, 0x44, 0x39, 0xc5, 0x05, 0x4b, 0x1e, 0x67,
+    0xf5, 0x0a, 0x19, 0x6b, 0xd4, 0x7b, 0xf6, 0x62, 0xfe, 0xc9, 0x4b, 0xa6, 0xa4, 0xc0, 0x69, 0x99,
+    0x03, 0x4b, 0x38, 0x66, 0xe9, 0x21, 0xa6, 0xe7, 0xe1, 0x5f, 0x00, 0x79, 0x8c, 0xc3, 0xa6, 0xbf,
+    0xeb, 0x0b, 0xd2, 0xde, 0x8e, 0xa6, 0x28, 0x71, 0xc6, 0x12, 0xe0, 0x19, 0x2e, 0x72, 0x06, 0x2c,
+    0xc6, 0x29, 0xcd, 0x20, 0x49, 0x71, 0xcc, 0xd8, 0xff, 0xec, 0xf0, 0x00, 0x98, 0x18, 0x27, 0x42,
+    0x31, 0xee, 0xd3, 0xfa, 0xee, 0x1f, 0x50, 0x6d, 0x23, 0xd4, 0xc7, 0x03, 0x00, 0x00, 0x1f, 0x8b,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x54, 0xcb, 0x6e, 0xdb, 0x30, 0x10, 0xbc,
+    0xe7, 0x2b, 0x08, 0xe5, 0x92, 0xa2, 0xe0, 0x5b, 0xa4, 0x48, 0x43, 0x4e, 0x80, 0xa2, 0x08, 0xd0,
+    0x6b, 0x1f, 0xe8, 0x59, 0xa5, 0x18, 0x5b, 0x88, 0x1e, 0x86, 0xc4, 0xc4, 0x4e, 0xbf, 0xbe, 0xbb,
+    0x94, 0x93, 0xb8, 0x40, 0x2e, 0xf6, 0x72, 0x67, 0x38, 0x3b, 0x43, 0x51, 0xaa, 0xef, 0x4e, 0x43,
+    0x4f, 0x9e, 0xe3, 0xbc, 0x74, 0xd3, 0xb8, 0x2d, 0x24, 0x13, 0x05, 0x89, 0x63, 0x98, 0xda, 0x6e,
+    0xdc, 0x6d, 0x8b, 0x5f, 0x3f, 0xef, 0xa9, 0x2b, 0xee, 0x6e, 0xaf, 0xea, 0xe5, 0x79, 0x47, 0x8e,
+    0x5d, 0x9b, 0xf6, 0xc0, 0x51, 0x9e, 0x19, 0x33, 0x0c, 0x05, 0xd9, 0xc7, 0x6e, 0xb7, 0x4f, 0x6b,
+    0x47, 0x3a, 0xec, 0x5c, 0x08, 0x49, 0x58, 0x75, 0xf1, 0xf8, 0x65, 0x3a, 0x6d, 0x0b, 0x41, 0x04,
+    0x59, 0xb7, 0x91, 0x95, 0x5b, 0x10, 0x18, 0x3b, 0x2e, 0xdb, 0x62, 0x9f, 0xd2, 0x61, 0xc3, 0xf9,
+    0xf1, 0x78, 0x64, 0x47, 0xcd, 0xa6, 0x79, 0xc7, 0x95, 0x10, 0x82, 0xc3, 0xb8, 0x33, 0x65, 0x13,
+    0xc2, 0x1b, 0x2b, 0xcc, 0xb1, 0x49, 0xdd, 0x73, 0x0c, 0xd3, 0x30, 0x4c, 0xe3, 0x92, 0xe9, 0xe3,
+    0x72, 0xfd, 0xca, 0x6c, 0xdf, 0x99, 0x87, 0xa7, 0xb9, 0xcf, 0x70, 0x1b, 0x78, 0xec, 0xe3, 0x10,
+    0xc7, 0xb4, 0x70, 0xf0, 0xc4, 0x5f, 0xb9, 0x73, 0xfb, 0xf0, 0xd1, 0x70, 0xe9, 0xbd, 0xe7, 0x42,
+    0x71, 0xa5, 0x28, 0x30, 0xe8, 0xf2, 0x32, 0xa6, 0xe6, 0x44, 0x71, 0xc6, 0xed, 0x15, 0xa9, 0x87,
+    0x98, 0x9a, 0xb6, 0x49, 0x0d, 0xd4, 0xa4, 0x06, 0x7c, 0xf3, 0xfd, 0xeb, 0x3d, 0xd6, 0xa4, 0x0e,
+    0x61, 0xf3, 0x7b, 0x9a, 0x1f, 0x09, 0x36, 0x9b, 0x3f, 0xd3, 0x13, 0x1c, 0x4a, 0x91, 0x11, 0x52,
+    0xb7, 0x61, 0xf3, 0x30, 0xcd, 0x43, 0x93, 0x6e, 0xbb, 0xa1, 0xd9, 0x45, 0x8c, 0xf6, 0x19, 0x3c,
+    0xd4, 0xfc, 0x1d, 0x78, 0x23, 0xa6, 0x97, 0x43, 0xcc, 0x1a, 0x73, 0x5c, 0xa6, 0xa7, 0x39, 0xc4,
+    0x0f, 0x03, 0xb5, 0x61, 0xe8, 0x90, 0xc9, 0x7f, 0xa4, 0xae, 0xef, 0xbf, 0xa1, 0x6a, 0xc1, 0x2f,
+    0x44, 0xba, 0xd4, 0xc7, 0x75, 0x5d, 0xf3, 0xb3, 0xb1, 0xec, 0x98, 0xbf, 0x5b, 0xae, 0xf9, 0x45,
+    0x96, 0x7a, 0x47, 0xd2, 0xdc, 0x8c, 0x0b, 0xba, 0xd9, 0x16, 0xb9, 0xec, 0x9b, 0x14, 0x6f, 0x68,
+    0x69, 0x98, 0xaf, 0x24, 0xa1, 0xda, 0x30, 0x53, 0xa9, 0x4f, 0x39, 0x51, 0x7d, 0x68, 0xd2, 0x9e,
+    0xb4, 0xdb, 0x62, 0x70, 0x9e, 0x29, 0xa1, 0x88, 0xf7, 0x4c, 0xe8, 0x40, 0x05, 0x13, 0x42, 0x4a,
+    0x82, 0x7f, 0x65, 0x99, 0x57, 0xa5, 0x22, 0x2e, 0x52, 0x4d, 0xf2, 0xc2, 0x29, 0x84, 0xa4, 0x10,
+    0xba, 0x20, 0x0f, 0xe0, 0x7a, 0x5b, 0x8c, 0xd3, 0x18, 0x0b, 0xb2, 0xa4, 0x79, 0x7a, 0x84, 0x98,
+    0xd7, 0xf0, 0xd4, 0x5f, 0x57, 0xf4, 0x7c, 0xd1, 0x98, 0xb2, 0xa5, 0x71, 0x87, 0xd3, 0x1a, 0xee,
+    0x7f, 0x97, 0x70, 0x6c, 0x73, 0x77, 0xba, 0x59, 0x29, 0x04, 0xef, 0xd7, 0xb9, 0x3c, 0x7b, 0x06,
+    0xcb, 0xda, 0xb9, 0xd5, 0xf2, 0x85, 0xe7, 0xd2, 0x0a, 0x66, 0x2d, 0x91, 0x5a, 0x31, 0x2f, 0x03,
+    0x35, 0x8e, 0x55, 0x54, 0x2a, 0xc5, 0x24, 0x55, 0x52, 0x31, 0x45, 0xa5, 0xb5, 0xcc, 0x50, 0xad,
+    0x25, 0x73, 0x54, 0x8a, 0x12, 0xfa, 0x9e, 0x95, 0xc4, 0x20, 0xa2, 0x19, 0x5c, 0x5e, 0xcb, 0x2c,
+    0x75, 0x4c, 0x13, 0x55, 0x61, 0x93, 0x20, 0x88, 0x3d, 0x92, 0x51, 0x68, 0x22, 0x06, 0x07, 0xe2,
+    0xa9, 0x51, 0x44, 0xa9, 0x8a, 0x95, 0x54, 0x96, 0xcc, 0x03, 0x62, 0x19, 0x80, 0x16, 0x50, 0x6b,
+    0x70, 0x8f, 0x2e, 0x99, 0xa6, 0x12, 0x00, 0x0d, 0x00, 0x75, 0x40, 0x04, 0x4e, 0x09, 0xe2, 0x5e,
+    0x33, 0x49, 0x8c, 0x84, 0xa6, 0x92, 0x12, 0x26, 0x48, 0xd4, 0x50, 0xb6, 0x02, 0xa8, 0x12, 0xac,
+    0xea, 0xad, 0x07, 0x0d, 0xd0, 0x34, 0x41, 0x0a, 0xdc, 0x04, 0x6c, 0x85, 0x66, 0x4b, 0xe0, 0x2a,
+    0x0d, 0x83, 0xa5, 0x01, 0x3b, 0x18, 0x08, 0x71, 0x6c, 0xd3, 0x8c, 0x63, 0x9b, 0x22, 0xa1, 0xcf,
+    0x79, 0x1d, 0x55, 0x26, 0x50, 0x25, 0xb0, 0x09, 0xe5, 0x1a, 0x0c, 0x61, 0x70, 0x0d, 0x9c, 0x2c,
+    0x22, 0x61, 0xed, 0x82, 0x24, 0x79, 0x50, 0x4e, 0x5a, 0x41, 0x08, 0xe9, 0x99, 0x3b, 0x57, 0x20,
+    0x03, 0xe7, 0x0e, 0x22, 0x20, 0xaf, 0xf0, 0x74, 0x3c, 0xea, 0xe6, 0x19, 0x96, 0x1a, 0x01, 0x1e,
+    0x0d, 0x06, 0x03, 0xdf, 0xb8, 0x43, 0xa0, 0x71, 0x8d, 0x99, 0xb4, 0xc0, 0xb6, 0x75, 0x50, 0xc2,
+    0x03, 0x90, 0x54, 0xc3, 0xc7, 0xc1, 0x4b, 0x38, 0x77, 0x59, 0x66, 0x5d, 0x81, 0x39, 0x34, 0x7c,
+    0x27, 0xec, 0xdf, 0xf3, 0xa3, 0xe7, 0xbb, 0x7c, 0x67, 0xe1, 0xb7, 0xc6, 0xf7, 0xe7, 0xf6, 0xea,
+    0x1f, 0xcd, 0x92, 0xff, 0xe2, 0xb7, 0x04, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0xa5, 0x54, 0x4d, 0x8f, 0xdb, 0x20, 0x10, 0xbd, 0xef, 0xaf, 0x40, 0xec, 0xa5,
+    0x55, 0x65, 0xb0, 0x31, 0xb6, 0x21, 0xc2, 0x59, 0xa9, 0xaa, 0x56, 0xea, 0xb5, 0xdd, 0xaa, 0x67,
+    0x8a, 0xf1, 0x47, 0xd7, 0x06, 0xcb, 0x26, 0xc9, 0xe6, 0xdf, 0x17, 0xdb, 0x71, 0x92, 0xb6, 0xd9,
+    0x56, 0x55, 0x2f, 0xd6, 0xc0, 0x3c, 0xde, 0xbc, 0x99, 0x67, 0x10, 0x0f, 0x2f, 0x5d, 0x0b, 0xf6,
+    0x7a, 0x18, 0x1b, 0x6b, 0x72, 0x18, 0xa1, 0x10, 0x02, 0x6d, 0x94, 0x2d, 0x1a, 0x53, 0xe5, 0xf0,
+    0xcb, 0xd3, 0x63, 0xc0, 0xe0, 0xc3, 0xf6, 0x4e, 0x8c, 0xfb, 0x0a, 0x1c, 0x9a, 0xc2, 0xd5, 0x39,
+    0x4c, 0x28, 0x0a, 0x29, 0xed, 0x3a, 0x08, 0x6a, 0xdd, 0x54, 0xb5, 0xcb, 0x21, 0x4d, 0x50, 0x9a,
+    0x90, 0x69, 0xe7, 0x8a, 0x28, 0xf2, 0xab, 0x46, 0x1f, 0xde, 0xdb, 0x97, 0x1c, 0x86, 0x20, 0x04,
+    0xcb, 0x31, 0xb0, 0x60, 0x21, 0xf0, 0x65, 0xcd, 0x98, 0xc3, 0xda, 0xb9, 0x7e, 0x83, 0xf1, 0xe1,
+    0x70, 0x40, 0x87, 0x18, 0xd9, 0xa1, 0xc2, 0x24, 0x0c, 0x43, 0xec, 0xcb, 0x9d, 0x20, 0x1b, 0xa5,
+    0xce, 0x28, 0x35, 0x68, 0xe9, 0x9a, 0xbd, 0x56, 0xb6, 0xeb, 0xac, 0x19, 0x67, 0xb8, 0x19, 0xef,
+    0x57, 0x64, 0x71, 0x41, 0xf6, 0xbb, 0xa1, 0x9d, 0xd3, 0x85, 0xc2, 0xba, 0xd5, 0x9d, 0x36, 0x6e,
+    0xc4, 0x5e, 0x13, 0x5e, 0xb1, 0x43, 0x51, 0xde, 0x2a, 0x1e, 0x71, 0xce, 0x71, 0x48, 0x30, 0x21,
+    0x81, 0x47, 0x04, 0xe3, 0xd1, 0x38, 0xf9, 0x12, 0x4c, 0x35, 0xb6, 0x77, 0x40, 0x74, 0xda, 0xc9,
+    0x42, 0x3a, 0xe9, 0x63, 0x20, 0x7c, 0x7e, 0xf3, 0xe9, 0xc3, 0xe3, 0x14, 0x03, 0xa1, 0xd4, 0xe6,
+    0xab, 0x1d, 0x9e, 0xc1, 0xb4, 0x29, 0xbf, 0xd9, 0x9d, 0x1f, 0x0a, 0x9c, 0x33, 0x40, 0x14, 0x6a,
+    0x53, 0xda, 0xa1, 0x93, 0x6e, 0xdb, 0x74, 0xb2, 0xd2, 0x53, 0x6b, 0xef, 0xbc, 0x06, 0x81, 0x2f,
+    0x89, 0x33, 0xd0, 0x1d, 0x7b, 0x3d, 0x73, 0x0c, 0x7a, 0xb4, 0xbb, 0x41, 0xe9, 0x9b, 0x0d, 0x15,
+    0xaa, 0x6b, 0x26, 0x24, 0xfe, 0xec, 0x9a, 0xb6, 0xfd, 0x38, 0xb1, 0x42, 0x7c, 0x45, 0xd2, 0xb8,
+    0x56, 0x2f, 0x6b, 0x81, 0x4f, 0xc2, 0x66, 0xc5, 0xf8, 0x22, 0x59, 0xe0, 0xab, 0x5e, 0x44, 0x05,
+    0xdc, 0x20, 0xcd, 0x38, 0xa9, 0xc9, 0xe1, 0x1c, 0xb6, 0xd2, 0xe9, 0x37, 0x01, 0xcd, 0x10, 0x0d,
+    0x23, 0x10, 0xc4, 0x1c, 0xd1, 0x2c, 0x79, 0x0b, 0x41, 0xe9, 0xeb, 0xe5, 0xd0, 0x58, 0xa3, 0x21,
+    0x18, 0xdd, 0x60, 0x9f, 0xbd, 0xc0, 0xfb, 0xb2, 0x2c, 0xd7, 0x55, 0xd0, 0x36, 0x46, 0x2b, 0xd9,
+    0xe7, 0x70, 0xb0, 0x3b, 0x53, 0xcc, 0x23, 0x10, 0xd5, 0x22, 0xa5, 0x97, 0xae, 0x06, 0x45, 0x0e,
+    0xbb, 0x34, 0x43, 0x19, 0x25, 0x80, 0x52, 0x44, 0x79, 0x54, 0xc7, 0x04, 0xa5, 0x2c, 0x3b, 0x13,
+    0x9c, 0xfe, 0x31, 0x82, 0xc2, 0x98, 0x24, 0xa7, 0xae, 0x2e, 0x47, 0x29, 0x9b, 0x05, 0xa5, 0x04,
+    0x11, 0xce, 0x6a, 0xc2, 0x11, 0xb9, 0x71, 0xf4, 0xb5, 0x53, 0x2c, 0x44, 0x11, 0xc9, 0xea, 0x28,
+    0x46, 0x9c, 0x25, 0xaf, 0x9c, 0x12, 0xb8, 0x5a, 0x34, 0xaf, 0xe9, 0x42, 0x8e, 0xb5, 0x2d, 0xcb,
+    0x51, 0x7b, 0x47, 0x63, 0x2f, 0x9c, 0x27, 0x3f, 0xf5, 0xfa, 0xdd, 0x36, 0x66, 0x6d, 0xf6, 0x17,
+    0xc6, 0x08, 0x51, 0x46, 0xe2, 0xe5, 0x2f, 0x10, 0xba, 0x6d, 0x9b, 0x7e, 0xd4, 0x40, 0xf9, 0xcb,
+    0x90, 0xc6, 0x28, 0xe4, 0xfe, 0x06, 0xa8, 0xa3, 0xbf, 0x39, 0x74, 0x9a, 0x2c, 0x04, 0x83, 0xdf,
+    0xa7, 0x88, 0x24, 0x8c, 0xfb, 0xf8, 0x78, 0x89, 0x6d, 0x2f, 0x95, 0xf7, 0x3a, 0x87, 0x88, 0x73,
+    0xb6, 0x36, 0x76, 0x4d, 0xc6, 0x08, 0x8a, 0x29, 0x5d, 0xc8, 0xfc, 0x58, 0xe2, 0x30, 0xfa, 0x0f,
+    0x32, 0xef, 0x4c, 0x14, 0x2d, 0x5c, 0xcb, 0xb0, 0xfe, 0x89, 0xeb, 0x3c, 0xbb, 0xdb, 0xe3, 0x9f,
+    0x5a, 0x4d, 0x59, 0xcd, 0x11, 0xbf, 0xe1, 0x77, 0xe4, 0x3d, 0x49, 0xb3, 0xdf, 0x9c, 0x63, 0xd9,
+    0xfc, 0x66, 0xcc, 0x8d, 0xf1, 0xc9, 0xb9, 0x98, 0xd1, 0xbf, 0xfb, 0x9d, 0x45, 0x88, 0x65, 0xd9,
+    0xea, 0x37, 0x61, 0x28, 0x99, 0x1e, 0x9c, 0x3f, 0xf8, 0x3d, 0x7f, 0xc5, 0x74, 0x33, 0xb7, 0x77,
+    0x3f, 0x00, 0x37, 0xfb, 0x7a, 0xf0, 0x11, 0x05, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0xad, 0x53, 0x5d, 0x6f, 0xdb, 0x20, 0x14, 0x7d, 0xef, 0xaf, 0x40, 0xf4,
+    0x65, 0xd5, 0x64, 0x30, 0x38, 0x8e, 0xed, 0xc8, 0x4e, 0xa5, 0x69, 0xaa, 0xb4, 0xd7, 0x7d, 0x68,
+    0xcf, 0x14, 0xb0, 0xcd, 0x6a, 0x83, 0x05, 0x24, 0x69, 0xfe, 0xfd, 0xc0, 0x89, 0x93, 0x46, 0xaa,
+    0xba, 0x97, 0x49, 0x7e, 0xb8, 0x1f, 0x47, 0xf7, 0x9e, 0x73, 0x2e, 0xae, 0x1f, 0x5f, 0xc7, 0x01,
+    0xec, 0xa5, 0x75, 0xca, 0xe8, 0x06, 0x12, 0x94, 0x42, 0x20, 0x35, 0x37, 0x42, 0xe9, 0xae, 0x81,
+    0xbf, 0x7e, 0x3e, 0x25, 0x25, 0x7c, 0xdc, 0xde, 0xd5, 0x6e, 0xdf, 0x81, 0x83, 0x12, 0xbe, 0x6f,
+    0x60, 0x9e, 0x8e, 0x23, 0x04, 0xbd, 0x54, 0x5d, 0xef, 0x97, 0xec, 0xcd, 0x00, 0x12, 0x32, 0x25,
+    0x0f, 0x5f, 0xcc, 0x6b, 0x03, 0x53, 0x90, 0x82, 0x3c, 0x7e, 0x10, 0x84, 0x35, 0xda, 0x35, 0xb0,
+    0xf7, 0x7e, 0xda, 0x60, 0x7c, 0x38, 0x1c, 0xd0, 0x21, 0x43, 0xc6, 0x76, 0x98, 0xa6, 0x69, 0x8a,
+    0xc3, 0xf8, 0x33, 0x64, 0xc3, 0xf9, 0x05, 0xc5, 0xad, 0x64, 0x5e, 0xed, 0x25, 0x37, 0xe3, 0x68,
+    0xb4, 0x9b, 0xe1, 0xda, 0xdd, 0x2f, 0x48, 0x71, 0x45, 0x4e, 0x3b, 0x3b, 0xcc, 0x6d, 0xc1, 0xb1,
+    0x1c, 0xe4, 0x28, 0xb5, 0x77, 0x38, 0x70, 0xc1, 0x0b, 0xd6, 0x8a, 0xf6, 0xbd, 0xe5, 0xa4, 0xaa,
+    0x2a, 0x9c, 0x52, 0x4c, 0x69, 0x12, 0x10, 0x89, 0x3b, 0x6a, 0xcf, 0x5e, 0x93, 0xb8, 0x63, 0x7b,
+    0x07, 0xea, 0x51, 0x7a, 0x26, 0x98, 0x67, 0x21, 0x06, 0x75, 0xe8, 0x6f, 0xbe, 0x7f, 0x7d, 0x8a,
+    0x31, 0xa8, 0x39, 0xdf, 0xfc, 0x36, 0xf6, 0x05, 0xc4, 0x22, 0x7b, 0x36, 0xbb, 0x60, 0x04, 0x9c,
+    0x3b, 0xa0, 0x16, 0x7c, 0xd3, 0x1a, 0x3b, 0x32, 0xbf, 0x55, 0x23, 0xeb, 0x64, 0x94, 0xf6, 0x39,
+    0x70, 0xa8, 0xf1, 0xb5, 0x71, 0x01, 0xfa, 0xe3, 0x24, 0xe7, 0x19, 0x56, 0x3a, 0xb3, 0xb3, 0x5c,
+    0xbe, 0x2b, 0x48, 0xf0, 0x51, 0x45, 0x24, 0xfe, 0xe1, 0xd5, 0x30, 0x7c, 0x8b, 0x53, 0x21, 0x7e,
+    0x33, 0x44, 0xf9, 0x41, 0x9e, 0xf2, 0x1a, 0x9f, 0x89, 0xcd, 0x8c, 0xf1, 0x95, 0x72, 0x8d, 0xdf,
+    0x68, 0xa9, 0x3b, 0xe0, 0x2d, 0xd3, 0x2e, 0xb2, 0x69, 0xe0, 0x1c, 0x0e, 0xcc, 0xcb, 0x4f, 0x09,
+    0x21, 0x39, 0x48, 0x32, 0x44, 0xf3, 0x75, 0xf1, 0x00, 0x81, 0x50, 0x6e, 0x1a, 0xd8, 0xb1, 0x81,
+    0xda, 0x68, 0x09, 0x4f, 0x1e, 0x48, 0xee, 0x41, 0xb8, 0x6b, 0x92, 0xa5, 0x88, 0x66, 0x25, 0x04,
+    0xa1, 0x9b, 0x50, 0x94, 0x16, 0x65, 0x05, 0x97, 0xe7, 0x41, 0xd7, 0x39, 0x22, 0xf9, 0xf5, 0x81,
+    0x90, 0xd5, 0x1a, 0xd1, 0x00, 0x6d, 0x03, 0xf7, 0x06, 0xde, 0x93, 0x67, 0x4a, 0x32, 0x72, 0x4a,
+    0x13, 0xbb, 0x1b, 0x82, 0x64, 0xb9, 0x97, 0xda, 0x08, 0x01, 0x81, 0x99, 0x18, 0x0f, 0x4a, 0x1b,
+    0x88, 0xaa, 0xaa, 0x9c, 0x25, 0xd6, 0xb8, 0xfb, 0x90, 0x70, 0x1e, 0x66, 0x67, 0x91, 0x73, 0x96,
+    0x17, 0xd5, 0xc3, 0x89, 0xe4, 0xc4, 0x7c, 0x0f, 0x44, 0x03, 0x47, 0xb2, 0x2e, 0x11, 0x05, 0x34,
+    0x45, 0xa4, 0xa8, 0x7a, 0xb2, 0x42, 0x94, 0xd0, 0x3d, 0x29, 0x10, 0x49, 0xf3, 0xbe, 0x42, 0xab,
+    0x2c, 0x5b, 0x2d, 0xa4, 0x66, 0x81, 0xc0, 0x79, 0x6b, 0x5e, 0x02, 0x9d, 0xfb, 0xb6, 0x6d, 0x97,
+    0x2c, 0x19, 0x94, 0x96, 0x9c, 0x4d, 0x0d, 0xb4, 0x66, 0xa7, 0xc5, 0xa5, 0xbc, 0x68, 0x3d, 0xdd,
+    0xa1, 0x96, 0xc3, 0xa0, 0x26, 0x27, 0x01, 0x0f, 0xde, 0x90, 0x8a, 0xa0, 0xbc, 0x80, 0x80, 0x07,
+    0x1d, 0x59, 0x81, 0x68, 0x08, 0x6d, 0x28, 0xd3, 0xb0, 0x31, 0xda, 0x60, 0x8f, 0xf1, 0x27, 0x89,
+    0x7e, 0x9d, 0x0d, 0x99, 0xb7, 0xfd, 0x27, 0x37, 0x4a, 0x14, 0x0e, 0x48, 0xd0, 0xaa, 0x8c, 0xf7,
+    0xbb, 0xd1, 0x73, 0x73, 0x3e, 0x92, 0x57, 0x28, 0x27, 0xf3, 0xf5, 0x68, 0x04, 0x5f, 0x6e, 0xb7,
+    0x2a, 0xaf, 0x77, 0x5b, 0x9d, 0xc9, 0xae, 0x51, 0x99, 0x66, 0xeb, 0x5b, 0xab, 0x6e, 0xa9, 0xbd,
+    0xef, 0x9c, 0x60, 0xae, 0x37, 0x6d, 0xeb, 0xa4, 0x9f, 0x7d, 0x28, 0xaa, 0xfc, 0x5f, 0xa6, 0xc6,
+    0xf2, 0x1f, 0xa3, 0xf4, 0x87, 0x66, 0xcf, 0x1e, 0xd4, 0xf1, 0xaf, 0xda, 0xde, 0xfd, 0x05, 0xbc,
+    0xc0, 0xfa, 0xc9, 0xbd, 0x04, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0x85, 0x53, 0xdb, 0x6e, 0x9b, 0x40, 0x10, 0x7d, 0xcf, 0x57, 0x8c, 0x36, 0x2f, 0x8d, 0x2a,
+    0x96, 0xbd, 0xc2, 0xae, 0x05, 0x8e, 0x54, 0x55, 0x91, 0xfa, 0xda, 0x8b, 0xfa, 0x4c, 0x60, 0xb1,
+    0x69, 0x80, 0xb5, 0x60, 0x1d, 0x27, 0x7f, 0xdf, 0x59, 0x1c, 0xdb, 0x49, 0x95, 0xb6, 0x92, 0x65,
+    0x76, 0x76, 0x0e, 0x33, 0xe7, 0xcc, 0x1c, 0x8a, 0xdb, 0xa7, 0xa1, 0x87, 0x47, 0x37, 0xcd, 0x9d,
+    0x1f, 0x4b, 0xc2, 0x29, 0x23, 0xe0, 0xc6, 0xda, 0x37, 0xdd, 0xb8, 0x29, 0xc9, 0x8f, 0xef, 0x77,
+    0x89, 0x21, 0xb7, 0xeb, 0xab, 0x62, 0x7e, 0xdc, 0xc0, 0xa1, 0x6b, 0xc2, 0xb6, 0x24, 0x9a, 0x0d,
+    0x03, 0x81, 0xad, 0xeb, 0x36, 0xdb, 0x70, 0x8a, 0x5e, 0x15, 0xe0, 0x18, 0x75, 0xee, 0xf0, 0xc9,
+    0x3f, 0x95, 0x84, 0x01, 0x03, 0x1d, 0x7f, 0x04, 0xb0, 0xcd, 0x38, 0x97, 0x64, 0x1b, 0xc2, 0x6e,
+    0x95, 0xa6, 0x87, 0xc3, 0x81, 0x1e, 0x24, 0xf5, 0xd3, 0x26, 0x15, 0x8c, 0xb1, 0x14, 0xcb, 0xbf,
+    0x40, 0x56, 0x75, 0x7d, 0x46, 0xd5, 0x93, 0xab, 0x42, 0xf7, 0xe8, 0x6a, 0x3f, 0x0c, 0x7e, 0x9c,
+    0x17, 0xf8, 0x38, 0x5f, 0x9f, 0x90, 0xcd, 0x05, 0xb9, 0xdb, 0x4f, 0xfd, 0x92, 0x6e, 0xea, 0xd4,
+    0xf5, 0x6e, 0x70, 0x63, 0x98, 0x53, 0xe4, 0x92, 0x9e, 0xb0, 0x53, 0xd3, 0xbe, 0xd7, 0x9c, 0x5b,
+    0x6b, 0x53, 0x26, 0x52, 0x21, 0x12, 0x44, 0x24, 0xf3, 0xf3, 0x18, 0xaa, 0xa7, 0x24, 0xf6, 0x58,
+    0x5f, 0x41, 0x31, 0xb8, 0x50, 0x35, 0x55, 0xa8, 0xf0, 0x0c, 0x05, 0xe6, 0x57, 0x5f, 0x3f, 0xdf,
+    0xc5, 0x33, 0x14, 0x75, 0xbd, 0xfa, 0xe9, 0xa7, 0x07, 0x88, 0x97, 0xd5, 0xbd, 0xdf, 0xe3, 0x20,
+    0xc8, 0x92, 0x81, 0xa2, 0xa9, 0x57, 0xad, 0x9f, 0x86, 0x2a, 0xac, 0xbb, 0xa1, 0xda, 0xb8, 0x28,
+    0xed, 0x23, 0x72, 0x28, 0xd2, 0x4b, 0xe2, 0x0c, 0x0c, 0xcf, 0x3b, 0xb7, 0xd4, 0x98, 0xdc, 0xec,
+    0xf7, 0x53, 0xed, 0xde, 0x15, 0xd4, 0xd4, 0x43, 0x17, 0x91, 0xe9, 0xb7, 0xd0, 0xf5, 0xfd, 0x97,
+    0x58, 0x95, 0xa4, 0xaf, 0x8a, 0x74, 0xa1, 0x77, 0xc7, 0xb8, 0x48, 0x5f, 0x88, 0x2d, 0x8c, 0xd3,
+    0x0b, 0xe5, 0x22, 0x7d, 0xa5, 0xa5, 0xd8, 0x40, 0x98, 0xaa, 0x71, 0x8e, 0x6c, 0x4a, 0xb2, 0x1c,
+    0xfb, 0x2a, 0xb8, 0x0f, 0x09, 0xe7, 0x9a, 0x66, 0x1c, 0x12, 0x6d, 0xa9, 0x30, 0xf6, 0x86, 0x40,
+    0xd3, 0xcd, 0xbb, 0xbe, 0x7a, 0x2e, 0xc9, 0xe8, 0x47, 0x47, 0x8e, 0x63, 0x70, 0x75, 0x00, 0x5c,
+    0x6d, 0x22, 0x19, 0x15, 0xd2, 0x10, 0xc0, 0x6c, 0x22, 0x28, 0xcb, 0x8d, 0x25, 0x27, 0x87, 0x88,
+    0x4c, 0x53, 0xae, 0x2f, 0x1e, 0xe1, 0x2a, 0xc3, 0x82, 0x04, 0x5a, 0xa4, 0x5f, 0x92, 0x6b, 0x7e,
+    0x2f, 0xb8, 0xe4, 0xc7, 0x30, 0x99, 0xf6, 0x3d, 0xaa, 0x76, 0x8f, 0x6e, 0xf4, 0x4d, 0x43, 0xc0,
+    0xef, 0xaa, 0x1a, 0xc5, 0x96, 0x84, 0x5a, 0x6b, 0x16, 0x95, 0x45, 0xba, 0x89, 0xff, 0xbb, 0x2a,
+    0x6c, 0xa1, 0x29, 0xc9, 0x20, 0x04, 0xd5, 0x0a, 0x04, 0x76, 0x30, 0xb6, 0x4e, 0x38, 0x95, 0x4c,
+    0x19, 0x60, 0xc8, 0x9b, 0x59, 0x8c, 0x54, 0x96, 0x8b, 0xf8, 0xd0, 0xb9, 0xc6, 0x07, 0xe3, 0x5a,
+    0x21, 0x39, 0x9e, 0x99, 0x1c, 0x38, 0x15, 0x42, 0x65, 0x78, 0x69, 0x45, 0xae, 0x40, 0x51, 0x26,
+    0xb9, 0xc4, 0x48, 0x58, 0x6e, 0x40, 0x53, 0xa9, 0x45, 0xac, 0xc2, 0xa5, 0x61, 0x12, 0x04, 0x95,
+    0x99, 0xb4, 0xf8, 0xd0, 0x3a, 0x5f, 0x5e, 0x34, 0xd6, 0x40, 0x46, 0xb5, 0xc9, 0xec, 0xf1, 0x0d,
+    0x05, 0x86, 0x6a, 0x89, 0x91, 0xa4, 0xb9, 0x31, 0x1c, 0x91, 0x26, 0xe3, 0x79, 0x62, 0x91, 0x93,
+    0x80, 0x48, 0x29, 0x72, 0xe1, 0x34, 0x17, 0x1c, 0xbb, 0x2b, 0xa5, 0x0c, 0x02, 0xa5, 0x51, 0x3c,
+    0x51, 0x28, 0x4b, 0x44, 0x66, 0x92, 0x1b, 0xb5, 0x40, 0xac, 0x00, 0x49, 0xb5, 0x35, 0xc8, 0x1a,
+    0x93, 0x4c, 0x63, 0x1f, 0x6e, 0x72, 0xc4, 0x5b, 0x9e, 0x5b, 0xc0, 0x3b, 0xc5, 0x4c, 0xc4, 0x4b,
+    0x2b, 0x81, 0x1b, 0xca, 0x8c, 0x45, 0xee, 0xb9, 0xe6, 0x59, 0x94, 0x20, 0xf2, 0x88, 0xcf, 0x32,
+    0x15, 0x59, 0x5a, 0x81, 0x4a, 0x70, 0x83, 0x8a, 0x29, 0xec, 0xc3, 0x51, 0x06, 0xc3, 0xb5, 0xe4,
+    0xa7, 0xb1, 0x2f, 0x2b, 0x84, 0x39, 0x4c, 0xfe, 0x01, 0x07, 0x7e, 0xdd, 0xb6, 0xed, 0x29, 0x4a,
+    0xfa, 0x6e, 0x74, 0x75, 0xb5, 0x2b, 0xc9, 0xe4, 0xf7, 0x63, 0x73, 0xbe, 0x3e, 0x6d, 0xf3, 0xb8,
+    0x86, 0xbf, 0x9a, 0x46, 0xe3, 0x2c, 0xd0, 0x34, 0x38, 0x74, 0x93, 0xdf, 0xfc, 0xd1, 0xe1, 0x8d,
+    0x65, 0x38, 0xfa, 0x4a, 0xf3, 0xc5, 0x31, 0x22, 0x82, 0xcf, 0x7e, 0x51, 0xe6, 0xe2, 0x95, 0x78,
+    0x9e, 0x10, 0x91, 0x51, 0xdc, 0x44, 0xf6, 0x96, 0xfc, 0x5b, 0x73, 0xbc, 0xaf, 0xa5, 0xa9, 0xe6,
+    0xad, 0x6f, 0xdb, 0xd9, 0x61, 0x2d, 0x99, 0xe3, 0x7c, 0xf5, 0xff, 0x64, 0xc6, 0xeb, 0x5f, 0xbe,
+    0x1b, 0xff, 0x2d, 0x3f, 0xba, 0xb0, 0x88, 0x1f, 0xf3, 0xfa, 0xea, 0x37, 0x59, 0x9b, 0x57, 0x35,
+    0x34, 0x05, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x94,
+    0xcb, 0x6e, 0xdb, 0x30, 0x10, 0x45, 0xf7, 0xf9, 0x0a, 0x82, 0xd9, 0xb4, 0x68, 0xf9, 0x94, 0x29,
+    0x91, 0x86, 0xe4, 0x00, 0x45, 0x11, 0xa0, 0xdb, 0x3e, 0xd0, 0xb5, 0x22, 0x51, 0x96, 0x1a, 0x89,
+    0x34, 0x24, 0x5a, 0x4e, 0xfa, 0xf5, 0x25, 0xe9, 0xd8, 0x72, 0x82, 0xf4, 0x05, 0x18, 0x36, 0x39,
+    0x73, 0x31, 0x73, 0xee, 0x0c, 0xe1, 0xfc, 0xe6, 0x61, 0xe8, 0xc1, 0xac, 0xc7, 0xa9, 0xb3, 0xa6,
+    0x80, 0x0c, 0x53, 0x08, 0xb4, 0xa9, 0x6c, 0xdd, 0x99, 0x6d, 0x01, 0xbf, 0x7d, 0xbd, 0x45, 0x12,
+    0xde, 0x6c, 0xae, 0xf2, 0x69, 0xde, 0x82, 0x43, 0x57, 0xbb, 0xb6, 0x80, 0x82, 0x0e, 0x03, 0x04,
+    0xad, 0xee, 0xb6, 0xad, 0x3b, 0xdd, 0x2e, 0x0a, 0x30, 0x7f, 0xeb, 0xf4, 0xe1, 0x83, 0x7d, 0x28,
+    0x20, 0x05, 0x14, 0x88, 0xf0, 0x81, 0xc0, 0xb7, 0x31, 0x53, 0x01, 0x5b, 0xe7, 0x76, 0x6b, 0x42,
+    0x0e, 0x87, 0x03, 0x3e, 0x24, 0xd8, 0x8e, 0x5b, 0xc2, 0x29, 0xa5, 0xc4, 0x97, 0x7f, 0x92, 0xac,
+    0xab, 0xea, 0xac, 0xaa, 0x46, 0x5d, 0xba, 0x6e, 0xd6, 0x95, 0x1d, 0x06, 0x6b, 0xa6, 0x28, 0x37,
+    0xd3, 0xf5, 0x49, 0x59, 0x2f, 0xca, 0xdd, 0x7e, 0xec, 0x63, 0xba, 0xae, 0x88, 0xee, 0xf5, 0xa0,
+    0x8d, 0x9b, 0x88, 0x67, 0x21, 0x27, 0xed, 0x58, 0x37, 0xaf, 0x35, 0x67, 0x4a, 0x29, 0x42, 0x39,
+    0xe1, 0x1c, 0x79, 0x05, 0x9a, 0x1e, 0x8d, 0x2b, 0x1f, 0x50, 0xe8, 0xb1, 0xb9, 0x02, 0xf9, 0xa0,
+    0x5d, 0x59, 0x97, 0xae, 0xf4, 0x67, 0x90, 0xfb, 0xfc, 0xfa, 0xf3, 0xc7, 0xdb, 0x70, 0x06, 0x79,
+    0x55, 0xad, 0xbf, 0xdb, 0xf1, 0x1e, 0x84, 0x60, 0x79, 0x67, 0xf7, 0x7e, 0x10, 0x30, 0x66, 0x40,
+    0x5e, 0x57, 0xeb, 0xc6, 0x8e, 0x43, 0xe9, 0x36, 0xdd, 0x50, 0x6e, 0x75, 0xb0, 0xf6, 0xce, 0x33,
+    0xe4, 0x64, 0x49, 0x9c, 0x85, 0xee, 0x71, 0xa7, 0x63, 0x8d, 0x51, 0x4f, 0x76, 0x3f, 0x56, 0xfa,
+    0x55, 0x43, 0x75, 0x35, 0x74, 0x41, 0x49, 0xbe, 0xb8, 0xae, 0xef, 0x3f, 0x85, 0xaa, 0x90, 0x5c,
+    0x14, 0xe9, 0x5c, 0xaf, 0x8f, 0xf7, 0x9c, 0x3c, 0x81, 0x45, 0x62, 0xb2, 0x20, 0xe7, 0xe4, 0xc2,
+    0x4b, 0xbe, 0x05, 0x6e, 0x2c, 0xcd, 0x14, 0x68, 0x0a, 0x18, 0x8f, 0x7d, 0xe9, 0xf4, 0x1b, 0x94,
+    0x52, 0xac, 0x14, 0x40, 0x42, 0xe1, 0x34, 0xcd, 0xde, 0x42, 0x50, 0x77, 0xd3, 0xae, 0x2f, 0x1f,
+    0x0b, 0x68, 0xac, 0xd1, 0xf0, 0x38, 0x05, 0x5d, 0x39, 0xe0, 0x37, 0x8b, 0x12, 0x8a, 0x79, 0x22,
+    0x21, 0xf0, 0x59, 0xc4, 0x31, 0xcd, 0xa4, 0x82, 0xa7, 0x07, 0xc2, 0x53, 0x81, 0x99, 0x58, 0x9e,
+    0x08, 0x5b, 0xa5, 0x98, 0x7b, 0x69, 0xe3, 0xe9, 0x0b, 0x78, 0xcd, 0xee, 0x38, 0x4b, 0xd8, 0xf1,
+    0x8a, 0xc6, 0x7d, 0xef, 0x4d, 0xeb, 0x59, 0x1b, 0x5b, 0xd7, 0x10, 0xd8, 0x5d, 0x59, 0x79, 0xaf,
+    0x05, 0xf4, 0x20, 0x32, 0x9a, 0xcc, 0xc9, 0xf6, 0x4f, 0xc8, 0x4c, 0x48, 0x2c, 0x18, 0x40, 0x0c,
+    0xaf, 0x64, 0x40, 0x9e, 0xdc, 0x68, 0xef, 0x7d, 0xc5, 0xeb, 0xa6, 0x69, 0x9e, 0x13, 0x33, 0x6f,
+    0x4b, 0xb0, 0x08, 0xcc, 0x83, 0xf8, 0x8c, 0xbb, 0x92, 0x0b, 0x6a, 0x38, 0x8f, 0x5e, 0x91, 0x62,
+    0x49, 0x93, 0xf4, 0x84, 0x1c, 0xed, 0xbf, 0x60, 0x7b, 0xde, 0xe9, 0xe9, 0x86, 0xea, 0x72, 0x6a,
+    0x6d, 0xd3, 0x4c, 0xda, 0xd7, 0x4a, 0x32, 0x9c, 0x29, 0x71, 0x4e, 0xf5, 0x9d, 0xd1, 0x55, 0xb9,
+    0x2b, 0xe0, 0x68, 0xf7, 0xa6, 0x7e, 0x16, 0xfe, 0x61, 0x3b, 0xf3, 0x32, 0x7e, 0x9a, 0xe5, 0xbf,
+    0x0c, 0x21, 0xee, 0xed, 0xfd, 0xb2, 0xb7, 0x4b, 0xea, 0x57, 0x31, 0xff, 0xda, 0x34, 0x4e, 0x6e,
+    0x57, 0xba, 0x16, 0xd4, 0x05, 0x1c, 0x52, 0x89, 0x79, 0x9a, 0x02, 0xa9, 0x82, 0xf3, 0x39, 0x7c,
+    0x2b, 0xd5, 0x32, 0x8a, 0x29, 0x5f, 0xcd, 0x7e, 0x03, 0x2d, 0x12, 0x98, 0xb2, 0x4c, 0xf5, 0x28,
+    0x84, 0x92, 0x14, 0xac, 0xb0, 0xca, 0x52, 0xf1, 0xf3, 0xf8, 0x48, 0x97, 0x32, 0x32, 0xc3, 0x8a,
+    0x4a, 0x90, 0x7a, 0x4c, 0x95, 0xcd, 0xa2, 0x65, 0x62, 0x46, 0x67, 0xd5, 0x69, 0x4d, 0x59, 0x82,
+    0xb9, 0x8a, 0x5b, 0x3a, 0xea, 0xce, 0x6b, 0xba, 0x78, 0x50, 0xe2, 0x37, 0xcb, 0xf8, 0x8f, 0xf1,
+    0xbf, 0x40, 0x63, 0x94, 0x63, 0xc5, 0xa2, 0x43, 0x19, 0xf8, 0x99, 0x46, 0x2b, 0x80, 0xbc, 0x0f,
+    0x29, 0x53, 0x74, 0x74, 0x8a, 0x12, 0xac, 0x78, 0x0c, 0x0b, 0x9c, 0x86, 0x5f, 0x26, 0xc0, 0xd1,
+    0x37, 0x60, 0x58, 0x85, 0x40, 0x74, 0x2f, 0x51, 0xa8, 0x91, 0xc9, 0x9f, 0xcb, 0xe2, 0xf2, 0xf0,
+    0x1f, 0xb0, 0xb9, 0xfa, 0x05, 0x5d, 0x70, 0x0b, 0x23, 0x6b, 0x05, 0x00, 0x00, 0x1f, 0x8b, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x1c, 0x69, 0x77, 0xdb, 0xc6, 0xf1, 0x33, 0xf5,
+    0x2b, 0xd6, 0x48, 0x5b, 0x93, 0x0e, 0x41, 0x82, 0xb4, 0x18, 0xdb, 0x94, 0xa8, 0xd4, 0x96, 0x95,
+    0xa3, 0xb5, 0xad, 0x3c, 0x4b, 0x69, 0xda, 0x97, 0xb8, 0x7e, 0x20, 0xb0, 0x24, 0x51, 0xe1, 0x60,
+    0xb1, 0x4b, 0x51, 0x8c, 0xaa, 0xff, 0xde, 0x99, 0x3d, 0x80, 0x05, 0x08, 0x5e, 0x92, 0x2c, 0xa7,
+    0x87, 0x9f, 0x25, 0x11, 0xbb, 0xb3, 0x73, 0xef, 0xcc, 0xec, 0x01, 0x1e, 0x3e, 0x7a, 0x7d, 0x7a,
+    0x7c, 0xfe, 0xb7, 0x1f, 0x4e, 0xc8, 0x77, 0xe7, 0x6f, 0xdf, 0x1c, 0xed, 0x1d, 0x4e, 0x78, 0x14,
+    0x92, 0xd0, 0x8d, 0xc7, 0x03, 0xcb, 0xa7, 0xd6, 0xd1, 0x5e, 0xed, 0x70, 0x42, 0x5d, 0x1f, 0xff,
+    0x46, 0x94, 0xbb, 0xc4, 0x9b, 0xb8, 0x29, 0xa3, 0x7c, 0x60, 0xfd, 0x78, 0xfe, 0x8d, 0xfd, 0x1c,
+    0xfa, 0x09, 0xfc, 0x93, 0x5d, 0xb1, 0x1b, 0xd1, 0x81, 0x75, 0x19, 0xd0, 0xf9, 0x34, 0x49, 0xb9,
+    0x45, 0xbc, 0x24, 0xe6, 0x34, 0x06, 0xd0, 0x79, 0xe0, 0xf3, 0xc9, 0xc0, 0xa7, 0x97, 0x81, 0x47,
+    0x6d, 0xf1, 0xd0, 0x24, 0x41, 0x1c, 0xf0, 0xc0, 0x0d, 0x6d, 0xe6, 0xb9, 0x21, 0x1d, 0x74, 0x34,
+    0x22, 0xc6, 0x17, 0x21, 0x05, 0x62, 0x7b, 0xb5, 0x61, 0xe2, 0x2f, 0xae, 0xf7, 0x6a, 0xb5, 0xa1,
+    0xeb, 0x5d, 0x8c, 0xd3, 0x64, 0x16, 0xfb, 0xb6, 0x97, 0x84, 0x49, 0xda, 0x27, 0x5f, 0x74, 0xc5,
+    0xbf, 0x03, 0xe8, 0x1c, 0x01, 0x09, 0x7b, 0xe4, 0x46, 0x41, 0xb8, 0xe8, 0x13, 0xdb, 0x9d, 0x4e,
+    0x43, 0x6a, 0xb3, 0x05, 0xe3, 0x34, 0x6a, 0x12, 0xe8, 0xae, 0xbd, 0x0a, 0x83, 0xf8, 0xe2, 0xad,
+    0xeb, 0x9d, 0x89, 0xb6, 0x6f, 0x00, 0x5a, 0xb6, 0x5b, 0x67, 0x74, 0x9c, 0x50, 0xf2, 0xe3, 0xf7,
+    0x96, 0x7c, 0x7e, 0x9f, 0x0c, 0x13, 0x9e, 0xc8, 0xcf, 0xa7, 0x57, 0x8b, 0x31, 0x8d, 0xed, 0x33,
+    0x37, 0x66, 0xb2, 0xe1, 0xc7, 0xe1, 0x2c, 0xe6, 0x33, 0xf9, 0xf9, 0xd8, 0x8d, 0xb9, 0x9b, 0xd2,
+    0x30, 0x54, 0x78, 0xbe, 0xa3, 0xe1, 0x25, 0xe5, 0x81, 0xe7, 0x92, 0x77, 0x74, 0x46, 0x15, 0x36,
+    0x06, 0x43, 0x6d, 0x46, 0xd3, 0x60, 0x84, 0x3c, 0x2a, 0xae, 0xe7, 0x93, 0x80, 0xd3, 0x83, 0x82,
+    0x40, 0x7d, 0x02, 0xec, 0x51, 0x37, 0xb5, 0xc7, 0xa9, 0xeb, 0x07, 0xa0, 0xaa, 0xfa, 0x0b, 0xc7,
+    0xa7, 0xe3, 0x26, 0xf9, 0x62, 0x34, 0x72, 0x5f, 0xb8, 0x2f, 0xe0, 0xc3, 0x57, 0xfb, 0x6e, 0x87,
+    0x3a, 0xcb, 0x2d, 0x8d, 0x22, 0x26, 0x9b, 0x05, 0xbf, 0xd2, 0x3e, 0xd9, 0x77, 0x9c, 0xdf, 0x8b,
+    0x5f, 0xd8, 0x6b, 0xcf, 0xe9, 0xf0, 0x22, 0xe0, 0xb6, 0x1b, 0x07, 0x91, 0xcb, 0x83, 0x24, 0xee,
+    0x13, 0x4d, 0xe7, 0xd5, 0xb7, 0xa4, 0xb3, 0xcf, 0x08, 0x75, 0x19, 0x05, 0x43, 0x8c, 0xd0, 0x16,
+    0x94, 0x8c, 0x92, 0x74, 0xee, 0xa6, 0x3e, 0xc3, 0xb1, 0xb7, 0x19, 0x23, 0x6c, 0x31, 0xa7, 0xc1,
+    0x78, 0xc2, 0x51, 0x30, 0xf8, 0x43, 0x53, 0x68, 0xbf, 0xd9, 0xab, 0xb5, 0x9f, 0x3c, 0x21, 0x2f,
+    0x05, 0x46, 0xea, 0x13, 0x53, 0xfc, 0xe3, 0xc4, 0xa7, 0xe4, 0xd5, 0x82, 0xfc, 0x44, 0x87, 0xe0,
+    0x1d, 0x3c, 0x0d, 0xbc, 0x0b, 0x52, 0x27, 0x13, 0xce, 0xa7, 0xac, 0xdf, 0x6e, 0xcf, 0xf3, 0xd6,
+    0x96, 0x97, 0x44, 0xa4, 0x41, 0x9e, 0x3c, 0x69, 0xef, 0xd5, 0xfe, 0xa8, 0x05, 0xbb, 0xa0, 0x8b,
+    0x51, 0x0a, 0x3e, 0xc7, 0x4c, 0x1e, 0xd1, 0x65, 0x40, 0x09, 0xf8, 0xc7, 0xd4, 0xcf, 0x34, 0x61,
+    0x81, 0x94, 0x07, 0x3a, 0x7b, 0x52, 0x41, 0xc0, 0x59, 0xad, 0xb7, 0x16, 0xb6, 0xe3, 0x14, 0xa1,
+    0xc5, 0xf3, 0x96, 0xa8, 0x6f, 0xd0, 0x89, 0xff, 0xf8, 0x1f, 0xc0, 0xe3, 0xa4, 0x83, 0xe0, 0x84,
+    0xac, 0xb0, 0x1f, 0x21, 0x21, 0xe5, 0xf0, 0xd1, 0x66, 0x53, 0xd7, 0x0b, 0xe2, 0x71, 0x9f, 0xb4,
+    0x3a, 0xdd, 0x5e, 0x4a, 0x23, 0xd1, 0xc7, 0xe9, 0x15, 0xb7, 0x79, 0x0a, 0x0e, 0x0f, 0xae, 0x10,
+    0xf5, 0xc9, 0x6c, 0x3a, 0xa5, 0xa9, 0x07, 0x3e, 0x22, 0x7a, 0x4b, 0xae, 0xaf, 0xc0, 0x5d, 0x40,
+    0x0e, 0x9c, 0x78, 0xa0, 0x0c, 0x45, 0x41, 0x90, 0x96, 0x2e, 0x7c, 0x65, 0x87, 0x6e, 0x3a, 0xa6,
+    0x07, 0x8a, 0xb9, 0xd6, 0x70, 0xc6, 0x79, 0x12, 0x1f, 0x87, 0x2e, 0x63, 0x06, 0x9b, 0x02, 0xb6,
+    0xd3, 0x9b, 0x5e, 0xe5, 0xc3, 0x55, 0x14, 0x78, 0x99, 0x42, 0x54, 0x11, 0xad, 0x22, 0xd0, 0xf4,
+    0x9f, 0x39, 0x0a, 0x68, 0x22, 0x25, 0xcb, 0x9e, 0x25, 0x6f, 0x30, 0xaf, 0x46, 0x07, 0x65, 0xe9,
+    0xbb, 0x8e, 0x23, 0xda, 0x86, 0x49, 0xea, 0x83, 0xe0, 0x3c, 0x99, 0xda, 0x21, 0x1d, 0x71, 0x1b,
+    0x2d, 0x38, 0x63, 0xfd, 0xce, 0xbe, 0x42, 0x61, 0xf4, 0xa7, 0x38, 0x70, 0x15, 0x00, 0xc4, 0x16,
+    0x9e, 0x44, 0x6b, 0x71, 0x28, 0x90, 0x6a, 0x34, 0x7e, 0xc0, 0xa6, 0xa1, 0x0b, 0x11, 0x6e, 0x14,
+    0x52, 0xd9, 0x22, 0x54, 0x68, 0x83, 0x56, 0x23, 0x56, 0x50, 0xe4, 0x3f, 0x66, 0x8c, 0x07, 0xa3,
+    0x85, 0xad, 0x42, 0x6f, 0xa1, 0xcf, 0x8e, 0x92, 0x5f, 0xed, 0x19, 0x43, 0x4b, 0xd2, 0x90, 0x7a,
+    0xd0, 0x19, 0x27, 0xb1, 0x34, 0x8b, 0x9e, 0x51, 0x2b, 0x7a, 0x23, 0x56, 0xe8, 0xc9, 0x3a, 0x2a,
+    0x1b, 0xed, 0xa4, 0x0a, 0xf8, 0x66, 0xaf, 0x68, 0xcb, 0xfe, 0x24, 0xb9, 0xa4, 0xa9, 0xb4, 0x68,
+    0x82, 0x8e, 0xc5, 0x41, 0x3c, 0xa7, 0xf5, 0x2c, 0xb3, 0xfb, 0x38, 0x0d, 0x7c, 0x21, 0x86, 0x0b,
+    0x21, 0x32, 0xdd, 0xd1, 0xf4, 0x99, 0xc2, 0x10, 0x8b, 0x68, 0x51, 0xe8, 0xc2, 0x59, 0x14, 0xdb,
+    0x63, 0x77, 0xda, 0x27, 0x1a, 0x81, 0xe8, 0x48, 0x93, 0x79, 0x45, 0x2b, 0x68, 0x17, 0xb0, 0x70,
+    0xaa, 0xc6, 0x81, 0xa6, 0xdd, 0x19, 0x4f, 0xf2, 0x5f, 0x02, 0x72, 0xea, 0xfa, 0xbe, 0x98, 0x15,
+    0x1d, 0xe9, 0x58, 0x42, 0x50, 0x31, 0x1c, 0xad, 0x23, 0xf9, 0x5e, 0xe1, 0xf5, 0x19, 0x97, 0x41,
+    0x8c, 0x79, 0xc0, 0x1e, 0x86, 0x89, 0x77, 0xb1, 0x7a, 0x9a, 0x08, 0xcc, 0x7e, 0xc2, 0xc5, 0xe4,
+    0x56, 0x6e, 0xa3, 0x3c, 0x85, 0x74, 0xe5, 0x94, 0x2e, 0x3b, 0x4a, 0x6d, 0x95, 0x3f, 0x90, 0xf6,
+    0x13, 0xe9, 0x43, 0x64, 0x92, 0xa4, 0xc1, 0xaf, 0xa8, 0xe6, 0x90, 0x60, 0x70, 0xad, 0x55, 0x79,
+    0x56, 0x0e, 0x0d, 0x36, 0xc3, 0x64, 0x27, 0x61, 0x35, 0x43, 0xe0, 0x58, 0x10, 0xc6, 0xaf, 0x3f,
+    0x0f, 0x7d, 0xd7, 0xe3, 0xc1, 0x25, 0xcd, 0x55, 0x02, 0xba, 0x98, 0x5e, 0x11, 0x96, 0x84, 0x81,
+    0x2f, 0x83, 0x18, 0xc4, 0xdd, 0x85, 0xd6, 0x1e, 0x32, 0x2a, 0x70, 0x5f, 0x97, 0xf2, 0x70, 0x3a,
+    0x1e, 0xba, 0xf5, 0x1e, 0xa4, 0xd7, 0xde, 0x33, 0xf9, 0xe3, 0xb4, 0x9e, 0x3a, 0xcf, 0x1b, 0x4b,
+    0xe3, 0xa4, 0xdb, 0xe2, 0xe8, 0x25, 0xa7, 0x05, 0x30, 0xcd, 0x1d, 0x5a, 0xd3, 0x30, 0x92, 0x9c,
+    0xdb, 0xe0, 0x21, 0x19, 0x63, 0x82, 0x5c, 0xb7, 0xd7, 0x6b, 0x92, 0xfc, 0x17, 0x50, 0xec, 0x7d,
+    0x05, 0x14, 0xb1, 0x0c, 0xaa, 0x55, 0x39, 0x80, 0xe8, 0x28, 0x45, 0x54, 0x24, 0x1b, 0xc4, 0xd3,
+    0x19, 0xff, 0x99, 0x2f, 0xa6, 0x50, 0x7c, 0x79, 0x13, 0xea, 0x5d, 0x0c, 0x93, 0x2b, 0xeb, 0xc3,
+    0xb5, 0x59, 0x01, 0x40, 0x50, 0x76, 0x21, 0x46, 0x7b, 0x34, 0x9b, 0xd5, 0x35, 0x11, 0x0d, 0xaa,
+    0x3a, 0x2a, 0x81, 0x15, 0x22, 0xee, 0x4e, 0xed, 0x09, 0x28, 0x55, 0x28, 0x56, 0x97, 0x63, 0x22,
+    0xfa, 0x4f, 0xa1, 0x28, 0x8a, 0xb9, 0x28, 0x77, 0x66, 0x29, 0xc3, 0xe6, 0x69, 0x12, 0xe4, 0x8e,
+    0x0b, 0xca, 0xe1, 0xc9, 0x78, 0x1c, 0x0a, 0xb5, 0xa8, 0x48, 0x4c, 0x9e, 0x76, 0xc5, 0x8c, 0xa9,
+    0xc9, 0x40, 0x4d, 0x7a, 0xea, 0xb1, 0xe4, 0xda, 0x9d, 0xaf, 0x64, 0xf3, 0xaa, 0xd9, 0x52, 0xcb,
+    0x73, 0x1b, 0xd4, 0x65, 0x2e, 0x7a, 0x03, 0xb6, 0x46, 0x90, 0x45, 0x02, 0xcc, 0x77, 0x07, 0x95,
+    0xae, 0xf1, 0xc5, 0xfe, 0xb3, 0xfd, 0x67, 0xbd, 0x9e, 0x3b, 0xdc, 0x54, 0x91, 0x75, 0x9e, 0xab,
+    0x92, 0xac, 0xeb, 0x77, 0x47, 0x4f, 0x5f, 0xb8, 0x43, 0xc8, 0xa0, 0xf0, 0xd4, 0x19, 0x75, 0x9d,
+    0xee, 0x33, 0x78, 0xc2, 0x74, 0x2b, 0x8a, 0x31, 0xa1, 0x06, 0xc5, 0x08, 0xb8, 0x00, 0x69, 0x75,
+    0x65, 0xb1, 0xa4, 0x9d, 0x43, 0xca, 0xdf, 0x77, 0x47, 0x5c, 0x3a, 0x50, 0x36, 0x25, 0x1e, 0x3f,
+    0x2e, 0x4a, 0xe1, 0x0e, 0x81, 0xc5, 0x99, 0xac, 0x15, 0x21, 0xb5, 0x08, 0xae, 0xf1, 0x33, 0xa6,
+    0x8f, 0xec, 0x41, 0xe9, 0xac, 0x2b, 0x53, 0x44, 0xa6, 0x52, 0xfd, 0x5c, 0xd2, 0xa1, 0xca, 0xf8,
+    0xa6, 0x9c, 0x79, 0x39, 0x9a, 0x5c, 0xd9, 0x6c, 0xe2, 0xfa, 0xc9, 0x1c, 0x94, 0x25, 0x7c, 0x14,
+    0xb5, 0x24, 0x3c, 0x74, 0x7f, 0xbf, 0x29, 0xff, 0xb7, 0xba, 0x2b, 0x45, 0xf4, 0x66, 0xc3, 0xc0,
+    0xb3, 0x87, 0xf4, 0xd7, 0x80, 0xa6, 0xf5, 0x56, 0xaf, 0xd9, 0xea, 0x34, 0x5b, 0xcf, 0x7a, 0xcd,
+    0x0e, 0x78, 0x73, 0xa3, 0x24, 0xba, 0x70, 0x4e, 0xea, 0x1b, 0x33, 0x43, 0x79, 0xd0, 0xd2, 0x3c,
+    0x2d, 0x0e, 0xe8, 0xe7, 0x4a, 0x33, 0x2a, 0x0d, 0xf1, 0x11, 0xc3, 0xf3, 0x55, 0xbd, 0x0b, 0xa1,
+    0x57, 0x13, 0x0b, 0xdd, 0x21, 0x0d, 0x45, 0x30, 0x32, 0xe7, 0x90, 0xc8, 0xab, 0xc2, 0x3b, 0x43,
+    0xb0, 0x6e, 0x1f, 0xb2, 0x2e, 0x9f, 0x88, 0x9a, 0x35, 0x4c, 0x5c, 0xde, 0x47, 0xcd, 0xe6, 0x3e,
+    0x23, 0x93, 0xb0, 0x4e, 0x31, 0x35, 0x3d, 0xa9, 0x35, 0xaa, 0x28, 0xf0, 0xfd, 0x30, 0xb3, 0xaa,
+    0x9e, 0x70, 0x79, 0xaa, 0x32, 0xe3, 0xa0, 0x0e, 0x83, 0xf8, 0xd7, 0xf6, 0x83, 0x14, 0x12, 0xa2,
+    0x74, 0xd4, 0x64, 0x5e, 0x19, 0x1d, 0xb1, 0xc4, 0x02, 0xcf, 0xa6, 0x7c, 0x4e, 0x69, 0x7c, 0xb0,
+    0x22, 0x1a, 0x1a, 0xce, 0x6d, 0xe6, 0x1c, 0x5c, 0xa5, 0xe9, 0xc0, 0x53, 0x99, 0x3f, 0x8a, 0x05,
+    0xba, 0xac, 0x71, 0x6a, 0x46, 0xe5, 0x25, 0xea, 0x2e, 0x03, 0x7d, 0x16, 0xb7, 0x7a, 0x06, 0x11,
+    0x10, 0x9e, 0xc6, 0x85, 0x50, 0x6f, 0x26, 0x78, 0x14, 0x24, 0x4d, 0xc2, 0x6a, 0x65, 0x90, 0x5d,
+    0xb5, 0x51, 0xcc, 0x7c, 0xe0, 0xf1, 0xa0, 0x1a, 0x51, 0x41, 0x28, 0xce, 0xae, 0xf3, 0x79, 0xf0,
+    0x1c, 0x1c, 0x9c, 0x18, 0xf3, 0x60, 0x1f, 0x15, 0x43, 0xca, 0x9a, 0xc2, 0x86, 0x2c, 0x5f, 0x2b,
+    0xf3, 0x2e, 0x2f, 0x2f, 0x85, 0xeb, 0x77, 0xf6, 0x21, 0x09, 0xc8, 0x5f, 0xbd, 0xe7, 0x18, 0x9c,
+    0xf7, 0x33, 0x6f, 0x76, 0x53, 0x2c, 0x17, 0x24, 0x27, 0x06, 0x0b, 0xcf, 0x34, 0x05, 0xcd, 0x83,
+    0xaa, 0x34, 0x6f, 0x41, 0x81, 0x53, 0x58, 0xf4, 0xb0, 0x95, 0xc2, 0x76, 0x9c, 0x5e, 0x89, 0xd4,
+    0x92, 0xb8, 0xb7, 0x15, 0x2e, 0x88, 0xc6, 0xd7, 0x3a, 0x39, 0x54, 0x15, 0x83, 0xb5, 0xd5, 0x95,
+    0x22, 0x14, 0x6d, 0xb5, 0xaa, 0x21, 0x42, 0x22, 0x06, 0x4b, 0x08, 0xd0, 0xba, 0xa1, 0xb5, 0xea,
+    0x78, 0x57, 0x59, 0x4d, 0xa9, 0xc1, 0xac, 0xe8, 0x56, 0x5a, 0x76, 0xa5, 0x65, 0x33, 0x36, 0xc9,
+    0x2e, 0xd2, 0x11, 0xcb, 0x52, 0x4c, 0xd8, 0x30, 0xcd, 0x21, 0xba, 0x49, 0xe7, 0xcd, 0xb0, 0x4e,
+    0x92, 0xb9, 0x89, 0xa7, 0xfb, 0x7c, 0x03, 0x26, 0x31, 0x2a, 0x9e, 0x45, 0x43, 0x11, 0xb8, 0xee,
+    0x61, 0xb6, 0xeb, 0xb0, 0xb3, 0xc3, 0x24, 0x67, 0xee, 0x25, 0x35, 0x94, 0x98, 0x65, 0xd2, 0x2a,
+    0xfb, 0x93, 0xdd, 0x1d, 0x80, 0xc0, 0x98, 0xc3, 0xb6, 0xde, 0x83, 0x39, 0xe4, 0x01, 0x87, 0x0f,
+    0x3f, 0x9d, 0xbe, 0x7f, 0x7d, 0xfc, 0xe6, 0xf4, 0xf8, 0xcf, 0xa4, 0xdb, 0x72, 0x0e, 0xdb, 0xb2,
+    0x11, 0x7a, 0x71, 0x6b, 0x05, 0x53, 0xee, 0xc0, 0x0a, 0x40, 0x24, 0x8b, 0xc8, 0x0a, 0x04, 0x56,
+    0xf9, 0x63, 0xda, 0x66, 0x97, 0x63, 0x8b, 0x4c, 0x52, 0x3a, 0x1a, 0x58, 0xad, 0x36, 0x76, 0xb3,
+    0xb6, 0x87, 0xf9, 0xba, 0x85, 0x1d, 0x38, 0xb8, 0x2d, 0x37, 0x95, 0xe0, 0x13, 0xee, 0xf3, 0x90,
+    0x24, 0x16, 0x5a, 0xb9, 0xe2, 0x11, 0x8d, 0x67, 0x03, 0x2b, 0xa5, 0x7c, 0x96, 0xc6, 0x64, 0xe4,
+    0x86, 0x8c, 0x5a, 0x47, 0xe4, 0xf0, 0x91, 0x6d, 0x93, 0x69, 0x4a, 0x2f, 0x41, 0x37, 0xb0, 0x5a,
+    0xa0, 0x31, 0x78, 0x03, 0x49, 0x46, 0xc4, 0x18, 0x43, 0x6c, 0xfb, 0x08, 0x05, 0x3e, 0xf4, 0x83,
+    0x4b, 0xe2, 0xe1, 0x0a, 0x63, 0x60, 0x15, 0x9d, 0xce, 0x42, 0x22, 0x61, 0xe0, 0x5d, 0x0c, 0x2c,
+    0x99, 0x5e, 0xce, 0x94, 0x5b, 0xd5, 0x1b, 0xd6, 0xd1, 0x21, 0x38, 0x3e, 0x61, 0xa9, 0x47, 0x06,
+    0x24, 0x63, 0x58, 0xbb, 0x9d, 0xe0, 0x99, 0x08, 0xa5, 0x0c, 0xac, 0x89, 0x5e, 0x21, 0x4e, 0xaf,
+    0xac, 0xf6, 0xd1, 0x61, 0x1b, 0xc8, 0x81, 0x38, 0xe8, 0xfb, 0x87, 0xb0, 0x8e, 0x0e, 0x7c, 0x84,
+    0x90, 0x71, 0xd8, 0x2a, 0x2b, 0x6e, 0xd2, 0xd1, 0x90, 0xc8, 0x23, 0x82, 0x2e, 0x3b, 0xb6, 0x55,
+    0xe2, 0xdd, 0xec, 0xc2, 0xd1, 0x05, 0xf9, 0xca, 0xbe, 0x28, 0x21, 0xc0, 0x30, 0x22, 0x05, 0x42,
+    0x96, 0x1c, 0x58, 0x43, 0x91, 0xcb, 0x62, 0xca, 0x98, 0x75, 0xf4, 0x2a, 0xfb, 0xdc, 0x3f, 0x6c,
+    0x0b, 0x18, 0x05, 0x2f, 0x0a, 0x48, 0x65, 0x3e, 0xf0, 0xfd, 0x31, 0xb5, 0x04, 0x77, 0xc6, 0x58,
+    0xbd, 0xb5, 0x87, 0xeb, 0x20, 0xe8, 0x8d, 0x82, 0x78, 0x60, 0x75, 0x1c, 0xf8, 0xe0, 0x5e, 0x0d,
+    0x2c, 0xa8, 0x5e, 0x15, 0x6f, 0x5a, 0x1b, 0xbb, 0x72, 0x29, 0x5c, 0x93, 0x4d, 0x82, 0x11, 0x67,
+    0x53, 0x4a, 0x7d, 0xeb, 0xe8, 0x18, 0x1b, 0x88, 0x68, 0x21, 0xa2, 0x69, 0x3b, 0x8e, 0xcb, 0x78,
+    0xaa, 0xd8, 0xd6, 0x5c, 0xf7, 0x9c, 0x3b, 0x32, 0x1d, 0x47, 0x1f, 0x19, 0x77, 0x71, 0x9f, 0x53,
+    0xb9, 0x86, 0x9c, 0xc6, 0x10, 0xfd, 0x46, 0x32, 0xd5, 0xd9, 0xb2, 0xfb, 0xe8, 0x1d, 0xaa, 0x51,
+    0x2c, 0x91, 0x44, 0x03, 0xe1, 0x41, 0x04, 0xd9, 0x56, 0x0b, 0x44, 0x96, 0x25, 0x42, 0x00, 0x29,
+    0x50, 0x4e, 0x43, 0x4a, 0x92, 0x3f, 0x4b, 0x59, 0x9c, 0xbe, 0x93, 0x59, 0xe1, 0x69, 0xbf, 0xf7,
+    0xe2, 0xee, 0x22, 0xd1, 0xd8, 0xdf, 0x41, 0x20, 0x80, 0x2e, 0x89, 0xb3, 0x41, 0x1a, 0x81, 0x3e,
+    0x93, 0x45, 0x3c, 0xed, 0x2e, 0xc9, 0x72, 0xcd, 0x55, 0x21, 0x8b, 0x60, 0xf2, 0x2d, 0x30, 0xb9,
+    0xbd, 0x38, 0x25, 0x93, 0x68, 0xd2, 0x99, 0x3c, 0x82, 0x6f, 0x62, 0x62, 0x46, 0xa9, 0x8c, 0xc7,
+    0xd2, 0x1a, 0x4c, 0xf3, 0x2b, 0xc3, 0x8d, 0xe6, 0x31, 0x17, 0xe9, 0x1e, 0x84, 0x3b, 0x4b, 0xa0,
+    0x6a, 0xdb, 0xc1, 0x60, 0xa3, 0x24, 0x84, 0x54, 0xc8, 0x08, 0x9f, 0x07, 0xa2, 0xe8, 0xde, 0x55,
+    0x64, 0x45, 0xaf, 0x20, 0xb7, 0x6a, 0x7b, 0x30, 0xe1, 0xdf, 0x53, 0x08, 0x8e, 0x3f, 0x05, 0xa3,
+    0x60, 0xa3, 0xdc, 0x02, 0x92, 0x20, 0xe8, 0x96, 0x72, 0x1a, 0xa8, 0x51, 0x44, 0xe3, 0xf1, 0x3e,
+    0xa4, 0x33, 0xb7, 0x32, 0x8d, 0x44, 0x6e, 0x24, 0x26, 0x6c, 0x35, 0xd3, 0xd2, 0xd9, 0xcb, 0xbf,
+    0x9c, 0x64, 0xb8, 0xd4, 0x87, 0x52, 0x92, 0x33, 0xf7, 0x1c, 0x2c, 0x03, 0xac, 0x08, 0x95, 0x27,
+    0x25, 0x64, 0xea, 0xed, 0xe9, 0xeb, 0x93, 0x55, 0x90, 0xc5, 0x7d, 0xb7, 0xe5, 0xa4, 0x93, 0x6f,
+    0x6d, 0x65, 0x9b, 0x22, 0x90, 0x3e, 0x61, 0xe1, 0x12, 0x6b, 0x08, 0xbd, 0x23, 0x64, 0xc8, 0x85,
+    0x8f, 0xde, 0x04, 0x03, 0x75, 0x9d, 0x4f, 0x02, 0x06, 0x15, 0x07, 0xe6, 0x5c, 0xd7, 0x10, 0x1c,
+    0x42, 0xc1, 0x71, 0x12, 0x45, 0x6e, 0xec, 0xd7, 0x1f, 0xb7, 0xda, 0x5e, 0xe4, 0x7f, 0x8d, 0x63,
+    0x06, 0xa2, 0x68, 0x78, 0xdc, 0xb0, 0x2a, 0x54, 0x98, 0x59, 0x3f, 0xab, 0x8a, 0x61, 0x0d, 0x50,
+    0x9d, 0xc9, 0xf3, 0xd2, 0xa3, 0x94, 0xc6, 0x7b, 0x3a, 0x8d, 0xbb, 0xf0, 0x83, 0x32, 0x1c, 0x55,
+    0x5b, 0xee, 0x7e, 0x84, 0xee, 0x6c, 0x29, 0xb4, 0x1f, 0xdc, 0x8f, 0xd8, 0x0a, 0xcf, 0xe7, 0x17,
+    0xbc, 0xbb, 0xa5, 0xe0, 0x6c, 0x1a, 0xa4, 0x6e, 0x78, 0x67, 0xb9, 0x25, 0x9a, 0xcf, 0x2f, 0xf6,
+    0xd3, 0x2d, 0xc5, 0x96, 0xcb, 0xbd, 0x3b, 0x8b, 0x2d, 0xd1, 0x7c, 0x7e, 0xb1, 0xf7, 0xb7, 0xb5,
+    0x76, 0xec, 0x5e, 0xd0, 0xbb, 0x1b, 0x1b, 0xb1, 0x7c, 0x7e, 0xa1, 0x7b, 0x5b, 0x0a, 0x3d, 0x85,
+    0xd0, 0x3e, 0x4d, 0xe2, 0xf1, 0x9d, 0xe5, 0xd6, 0x88, 0x76, 0x14, 0xbd, 0x32, 0xe6, 0xaf, 0x4a,
+    0xbb, 0x66, 0xd6, 0x7d, 0x73, 0xf2, 0xfa, 0xe3, 0xe9, 0x68, 0xb4, 0x31, 0xe7, 0x02, 0x1c, 0x23,
+    0xa7, 0xdf, 0x7c, 0x53, 0xc8, 0xb8, 0x79, 0xc2, 0x2d, 0xe6, 0xdb, 0x0c, 0x29, 0x66, 0xdb, 0xec,
+    0x61, 0x8b, 0x5c, 0x7b, 0x77, 0x79, 0x5e, 0xce, 0x78, 0x72, 0x3c, 0x91, 0x6b, 0x87, 0x0d, 0x22,
+    0x21, 0x28, 0x9e, 0x86, 0x7b, 0xc2, 0x43, 0x88, 0xb4, 0xbb, 0x59, 0xf0, 0xae, 0x12, 0xcf, 0xa4,
+    0x81, 0x12, 0x9a, 0xcf, 0x9f, 0x42, 0x48, 0x20, 0x82, 0x2e, 0x92, 0x2f, 0x83, 0xd6, 0xc8, 0x2f,
+    0x96, 0x58, 0x67, 0x08, 0xb4, 0x51, 0xfe, 0xd7, 0x0b, 0x90, 0x27, 0xf0, 0xf2, 0x11, 0xdb, 0xc8,
+    0x6e, 0xe2, 0x47, 0xd9, 0xcd, 0xe7, 0x5b, 0xc9, 0x5e, 0x12, 0x3f, 0x02, 0xb9, 0x8c, 0xf3, 0x41,
+    0xb9, 0xb7, 0x63, 0x2c, 0x03, 0xd7, 0x94, 0x30, 0x4b, 0x25, 0xd3, 0x8a, 0x7a, 0xad, 0x58, 0x34,
+    0xd5, 0x8e, 0x4f, 0xdf, 0x9c, 0xbe, 0x5f, 0x53, 0xbb, 0x96, 0xf7, 0x3e, 0x75, 0x55, 0xb8, 0xa1,
+    0xb8, 0x5a, 0x11, 0x8d, 0x96, 0x63, 0xd0, 0xc6, 0x00, 0x13, 0x52, 0x7f, 0x00, 0x8b, 0x71, 0xdb,
+    0xb1, 0x9d, 0x0d, 0xe1, 0xc5, 0x38, 0x08, 0x48, 0xc7, 0x43, 0x71, 0x12, 0xe5, 0x34, 0x9d, 0x06,
+    0x86, 0x9a, 0xaa, 0x70, 0xf9, 0x29, 0x58, 0xec, 0x74, 0x9f, 0xdf, 0x86, 0x49, 0x18, 0xf6, 0xa0,
+    0x6c, 0xc2, 0xef, 0xdb, 0xb0, 0x09, 0xbf, 0x1f, 0x88, 0x4d, 0x50, 0xc8, 0x6d, 0xd8, 0x84, 0x61,
+    0x0f, 0xca, 0xa6, 0x73, 0x1b, 0x26, 0x9d, 0x07, 0x66, 0x11, 0x75, 0x79, 0x0b, 0x26, 0x51, 0x97,
+    0x0f, 0xc7, 0x26, 0xfa, 0xa5, 0xfa, 0xd9, 0xdd, 0x33, 0xd5, 0xcf, 0x83, 0x69, 0x14, 0x19, 0xdd,
+    0x79, 0xa6, 0x0b, 0xa3, 0x3f, 0xe0, 0x4c, 0x97, 0x6c, 0x3a, 0xb7, 0x61, 0xd2, 0x79, 0xc0, 0x59,
+    0x7e, 0x0b, 0x26, 0x95, 0x67, 0x3e, 0x5c, 0x68, 0x77, 0x40, 0x97, 0xce, 0xee, 0xf9, 0xc7, 0x01,
+    0x6d, 0x3a, 0x0f, 0x9b, 0x81, 0x44, 0xdc, 0xdc, 0x7d, 0x02, 0x89, 0xb8, 0xb9, 0x9a, 0xcd, 0x8a,
+    0x2d, 0x20, 0xbd, 0x6d, 0xb3, 0x7d, 0xfd, 0x22, 0x96, 0x34, 0xf7, 0x5f, 0xbf, 0x9c, 0xbd, 0x7b,
+    0xf9, 0xe7, 0x93, 0x87, 0xab, 0x5f, 0xb4, 0x12, 0x8d, 0x9b, 0x57, 0x7d, 0xd2, 0x3d, 0xc8, 0x2e,
+    0x5c, 0xc1, 0xea, 0xe6, 0x40, 0x63, 0x58, 0xb9, 0x4d, 0x66, 0x9e, 0xb5, 0x5a, 0x6b, 0xed, 0x2a,
+    0x94, 0x36, 0x98, 0x4d, 0xd1, 0xa4, 0xb3, 0x58, 0x9e, 0x41, 0xba, 0x43, 0x64, 0x00, 0x46, 0x56,
+    0xae, 0xa0, 0x04, 0xee, 0x8f, 0x78, 0x08, 0x57, 0xb5, 0x86, 0x92, 0x47, 0x6a, 0xf9, 0x7d, 0x83,
+    0x34, 0xe1, 0x2e, 0xa7, 0xf2, 0x82, 0x2e, 0xd8, 0xbf, 0x5d, 0x74, 0x4e, 0xe3, 0xf3, 0xce, 0x3a,
+    0xe9, 0x98, 0x3a, 0xe9, 0xde, 0xbf, 0x4e, 0x50, 0xc2, 0x7b, 0xd5, 0xca, 0x1a, 0xe1, 0x6f, 0xeb,
+    0x0a, 0x9f, 0x40, 0x6c, 0x3f, 0x99, 0xc7, 0x9f, 0xd8, 0x19, 0xec, 0xcd, 0xde, 0xb0, 0x83, 0x42,
+    0x9e, 0x7e, 0x62, 0x85, 0x88, 0xe3, 0xbc, 0x5d, 0x35, 0x22, 0x06, 0xdd, 0xc2, 0x13, 0x36, 0xee,
+    0xf4, 0x6f, 0x11, 0x6d, 0x4c, 0x61, 0x97, 0x6f, 0x7f, 0x6c, 0x23, 0x72, 0x4c, 0xe7, 0xdb, 0x0b,
+    0x9c, 0xd2, 0x51, 0x4a, 0xd9, 0x64, 0x95, 0xb0, 0x05, 0x59, 0xef, 0x10, 0xdd, 0xe5, 0x36, 0xdd,
+    0xfd, 0x87, 0xf7, 0xf3, 0x93, 0xf3, 0xf7, 0xdf, 0x9f, 0xfd, 0xd7, 0xc6, 0x77, 0xa9, 0xb6, 0xff,
+    0x07, 0xf8, 0x2a, 0xa5, 0xfc, 0xcf, 0x45, 0x78, 0x25, 0xf7, 0xff, 0x43, 0x7c, 0x59, 0x23, 0xff,
+    0xd1, 0x31, 0xbe, 0xea, 0xda, 0xdb, 0x56, 0x52, 0xe3, 0xed, 0xab, 0x7b, 0x89, 0xf3, 0xe5, 0x6b,
+    0x3d, 0x9f, 0x82, 0x57, 0x77, 0xc6, 0xe8, 0xf6, 0xcc, 0xa2, 0x68, 0x62, 0xc8, 0x56, 0xec, 0x6e,
+    0x38, 0x2b, 0x5e, 0x93, 0x95, 0xf0, 0x28, 0xe1, 0xfe, 0x73, 0xd2, 0x0f, 0xa7, 0xef, 0xbe, 0xbd,
+    0xe7, 0x8c, 0x74, 0xb7, 0xe8, 0xbb, 0x73, 0x4a, 0x2a, 0x9d, 0xc7, 0xe0, 0x45, 0xcb, 0xf5, 0x66,
+    0x46, 0x45, 0x7e, 0xe6, 0x2c, 0xf5, 0xc0, 0x09, 0xea, 0x76, 0x2a, 0xfa, 0xec, 0xb1, 0xfb, 0x37,
+    0x51, 0xa6, 0x0a, 0x55, 0x3c, 0x58, 0x95, 0x0a, 0xb5, 0x0b, 0x3e, 0x30, 0x2f, 0x0d, 0xa6, 0x5c,
+    0x6a, 0xe0, 0xd2, 0x4d, 0x49, 0xb4, 0xf8, 0x0b, 0xfc, 0x1e, 0x90, 0x78, 0x16, 0x86, 0x07, 0xb5,
+    0x5a, 0xbb, 0x8d, 0x17, 0xd5, 0x38, 0xc5, 0x1b, 0x96, 0x7c, 0x42, 0x89, 0xb8, 0x44, 0x40, 0xea,
+    0x6d, 0xdf, 0xe5, 0xee, 0xd7, 0x17, 0x74, 0x31, 0xc0, 0x53, 0xb0, 0x26, 0x99, 0x4d, 0x7d, 0xf9,
+    0x3e, 0xe7, 0x42, 0x40, 0xfd, 0x44, 0x87, 0x67, 0x00, 0x47, 0x79, 0x43, 0xa3, 0x65, 0xe2, 0xb1,
+    0x80, 0x77, 0x3a, 0x63, 0x13, 0x71, 0x7e, 0x16, 0xd3, 0xb0, 0xaf, 0x0e, 0xd2, 0x7c, 0x45, 0x6d,
+    0x14, 0xd0, 0xd0, 0x67, 0x64, 0x94, 0x26, 0x51, 0x4e, 0xb6, 0x49, 0xc6, 0x6e, 0x44, 0x89, 0x32,
+    0x03, 0x84, 0xdd, 0x24, 0xef, 0x2b, 0xd2, 0x39, 0x9d, 0xd2, 0x98, 0xe2, 0xf1, 0x97, 0xb8, 0x34,
+    0x7a, 0x20, 0x84, 0x03, 0x8a, 0xf8, 0x4a, 0xf0, 0x82, 0xd4, 0x15, 0xa9, 0x46, 0x81, 0x56, 0xd3,
+    0x10, 0x0f, 0x39, 0xa3, 0x0c, 0x6c, 0x15, 0x4a, 0x71, 0x14, 0x37, 0xf3, 0x49, 0xe0, 0x4d, 0x34,
+    0xa3, 0x88, 0x72, 0x34, 0x8b, 0xc5, 0xad, 0x5e, 0x89, 0xf8, 0x4c, 0xf8, 0x99, 0xd4, 0x44, 0x43,
+    0xbc, 0x73, 0x59, 0x0b, 0x46, 0x75, 0xa5, 0x4f, 0x29, 0x78, 0x23, 0x53, 0xef, 0xf5, 0xcd, 0x81,
+    0x80, 0x00, 0x17, 0x05, 0x86, 0xc0, 0x96, 0x9c, 0x80, 0x36, 0x49, 0x10, 0x93, 0x02, 0x82, 0x9a,
+    0x80, 0xff, 0x19, 0xba, 0x3e, 0xc0, 0x20, 0xd9, 0x25, 0x9e, 0xe4, 0xe8, 0x1b, 0xf1, 0x1b, 0x87,
+    0x27, 0x21, 0x6d, 0x85, 0xc9, 0x58, 0x93, 0x97, 0x22, 0x23, 0x7d, 0x71, 0x3a, 0x1d, 0xf8, 0xd6,
+    0x32, 0x6a, 0x34, 0x2d, 0x98, 0x44, 0x1c, 0x63, 0x4a, 0x2f, 0x95, 0x0a, 0x91, 0xbd, 0xc2, 0x17,
+    0xa0, 0x4b, 0xf6, 0x30, 0xa0, 0xee, 0x27, 0xde, 0x2c, 0xa2, 0x31, 0x6f, 0x8d, 0x29, 0x3f, 0x09,
+    0x29, 0x7e, 0x64, 0xaf, 0x16, 0xc2, 0xd5, 0xdf, 0x81, 0x5d, 0xea, 0xf9, 0xd1, 0x78, 0x43, 0x72,
+    0x67, 0x0a, 0x47, 0xe5, 0x00, 0x74, 0x23, 0x03, 0xab, 0x66, 0xa5, 0xa6, 0xba, 0x5b, 0x62, 0x16,
+    0xbd, 0x09, 0x18, 0x6f, 0xa5, 0x34, 0x4a, 0x2e, 0x01, 0xa9, 0x7c, 0xa5, 0x2b, 0x43, 0x79, 0x93,
+    0x73, 0x27, 0xad, 0x37, 0x20, 0x53, 0x7c, 0x07, 0xfd, 0xfb, 0x98, 0x2b, 0xd9, 0x5b, 0x52, 0x60,
+    0x3d, 0x00, 0x54, 0x20, 0x01, 0x0f, 0x4d, 0xc2, 0xad, 0x90, 0xc6, 0x63, 0x3e, 0x69, 0x98, 0x6d,
+    0x3f, 0x0b, 0xb8, 0x0f, 0x06, 0x0f, 0xae, 0xef, 0x97, 0x19, 0xb8, 0x91, 0x8a, 0x55, 0xba, 0xd3,
+    0xa7, 0x96, 0x92, 0x17, 0x96, 0xe9, 0x3c, 0xd6, 0xd7, 0xe1, 0x5e, 0xe2, 0x60, 0x9c, 0x19, 0xa6,
+    0xfe, 0xab, 0x34, 0xf9, 0x6a, 0xf1, 0x3d, 0xd0, 0xca, 0xaf, 0x0f, 0x36, 0x5a, 0xea, 0x7d, 0x17,
+    0x10, 0x50, 0x0b, 0xb6, 0x8c, 0x15, 0xfd, 0xca, 0xea, 0x68, 0xde, 0x0a, 0x94, 0xf5, 0xe5, 0xbc,
+    0x5d, 0xa8, 0xca, 0x31, 0x6b, 0x49, 0x0b, 0x90, 0x65, 0xb2, 0x21, 0xf5, 0x13, 0x71, 0x74, 0xbf,
+    0x05, 0x39, 0x7d, 0xb4, 0x5f, 0x45, 0x47, 0xe2, 0x59, 0xc6, 0x2f, 0xf4, 0x5b, 0x38, 0x41, 0xdf,
+    0x82, 0x90, 0x01, 0x5f, 0x45, 0xab, 0x84, 0x73, 0x99, 0x68, 0x7e, 0x74, 0xbe, 0x1d, 0x3d, 0xe3,
+    0x54, 0xbb, 0x8a, 0x5e, 0x8e, 0x2e, 0x27, 0x55, 0x61, 0x37, 0x79, 0xa5, 0x77, 0x1b, 0x7a, 0xd9,
+    0x05, 0xe0, 0x46, 0xeb, 0xd2, 0x0d, 0x67, 0x34, 0x8b, 0x10, 0xad, 0x22, 0x36, 0x98, 0x4b, 0x50,
+    0x39, 0x7a, 0x30, 0x99, 0x6c, 0xab, 0x49, 0xac, 0x7e, 0xa5, 0xbf, 0x9c, 0xc4, 0xfe, 0xd6, 0x54,
+    0xf1, 0xaa, 0xee, 0x6a, 0x9a, 0x80, 0x69, 0x1d, 0x45, 0xf3, 0x26, 0xf9, 0x36, 0xf4, 0x0c, 0xf8,
+    0x9c, 0x66, 0x79, 0xce, 0xe7, 0x40, 0x95, 0xf6, 0x53, 0x37, 0xc0, 0xb7, 0x21, 0x57, 0x1e, 0xb4,
+    0x9a, 0x66, 0x09, 0x52, 0x5b, 0x53, 0xf6, 0xbe, 0x96, 0xaf, 0x81, 0xd4, 0xb3, 0x41, 0x22, 0x90,
+    0xeb, 0xd8, 0x24, 0x99, 0xbc, 0xd1, 0x79, 0x89, 0x89, 0xab, 0xd3, 0x98, 0x7e, 0x64, 0x41, 0x80,
+    0x51, 0xd2, 0xcd, 0x83, 0xcb, 0x7c, 0x42, 0x63, 0x12, 0x70, 0x12, 0xb0, 0x2c, 0x4b, 0xaa, 0x3c,
+    0x8b, 0xaf, 0xd8, 0x14, 0x12, 0x11, 0x04, 0xa5, 0xd9, 0xf4, 0x58, 0x0d, 0xac, 0x07, 0x7e, 0x53,
+    0xa3, 0x6c, 0x62, 0xe5, 0x21, 0x06, 0xab, 0x98, 0x8b, 0x11, 0x34, 0xa3, 0x30, 0x58, 0xa9, 0x8f,
+    0x2c, 0x90, 0x6a, 0x58, 0x0c, 0x8a, 0x27, 0xf8, 0xee, 0x05, 0x46, 0x48, 0xc8, 0xb2, 0x69, 0xfd,
+    0xb1, 0xc4, 0xfb, 0xb8, 0x49, 0xea, 0x0d, 0x32, 0x38, 0x22, 0xd7, 0x59, 0xe0, 0xcd, 0x48, 0x66,
+    0xc4, 0xeb, 0x19, 0x1a, 0x35, 0x3f, 0x74, 0x98, 0x36, 0xcb, 0x21, 0xad, 0x85, 0x2f, 0xc9, 0x12,
+    0x38, 0xf9, 0x9a, 0x58, 0x83, 0x8e, 0x45, 0xfa, 0xf0, 0xc7, 0xb1, 0x1a, 0x3a, 0x28, 0x9b, 0xfa,
+    0x2c, 0xaa, 0xc0, 0x08, 0xa9, 0x4d, 0xac, 0x9b, 0xb0, 0xce, 0x8a, 0xf5, 0x0d, 0x68, 0x37, 0x8b,
+    0xce, 0x12, 0xc1, 0xaa, 0xa1, 0x32, 0x2e, 0x2e, 0x8f, 0x67, 0x32, 0x5e, 0x56, 0x8d, 0xd5, 0x41,
+    0x2e, 0x1b, 0xa4, 0x22, 0x64, 0x25, 0xb0, 0x11, 0xa8, 0x32, 0x78, 0x11, 0x9d, 0xf0, 0xc5, 0x72,
+    0x4f, 0x45, 0xb0, 0xaa, 0x81, 0x46, 0xc4, 0xc9, 0x06, 0x1a, 0x51, 0xab, 0xa9, 0x14, 0x88, 0xb5,
+    0x4e, 0x66, 0x18, 0xb0, 0x4b, 0xd6, 0xa8, 0x4c, 0xb5, 0x7e, 0x32, 0xe4, 0xe5, 0x6e, 0xa3, 0x9c,
+    0x1b, 0xd5, 0xa2, 0x51, 0x9b, 0x01, 0xb2, 0x3c, 0xa3, 0x77, 0x41, 0xaa, 0x93, 0x7e, 0x09, 0xef,
+    0x9e, 0xb2, 0xb1, 0x9e, 0x2e, 0xb2, 0x20, 0x8d, 0x3d, 0x4a, 0x2e, 0x03, 0x97, 0x7c, 0x77, 0x7e,
+    0xfe, 0x03, 0x04, 0x59, 0x06, 0xde, 0x11, 0x8c, 0x8a, 0xe5, 0x27, 0xf1, 0xa0, 0xba, 0x4c, 0x38,
+    0x19, 0x52, 0xf1, 0xa6, 0x10, 0x88, 0x5c, 0x98, 0x2d, 0x61, 0xe2, 0xfa, 0xb2, 0x6a, 0x33, 0x26,
+    0xc5, 0x55, 0x14, 0xe2, 0x77, 0x8e, 0x60, 0xa9, 0x4a, 0xe7, 0xe4, 0xaf, 0x6f, 0xdf, 0x7c, 0x07,
+    0x4f, 0xef, 0xe9, 0x3f, 0x67, 0x94, 0xf1, 0xba, 0xe2, 0x48, 0xc1, 0xb4, 0x92, 0x38, 0x85, 0x35,
+    0xee, 0x42, 0x30, 0xe4, 0xa9, 0x2c, 0x42, 0x34, 0xfa, 0x7a, 0x23, 0x9f, 0x0a, 0x44, 0xdc, 0x0c,
+    0x6c, 0x09, 0xe8, 0x33, 0x59, 0xb7, 0x0c, 0xc8, 0x3e, 0xf9, 0xc3, 0x1f, 0x88, 0x68, 0x47, 0x04,
+    0x33, 0x86, 0x6d, 0x5d, 0xc7, 0xc9, 0x86, 0xd5, 0x8c, 0xb2, 0xf2, 0x4f, 0x67, 0xa7, 0xef, 0x5a,
+    0x22, 0x98, 0x68, 0x4c, 0x0c, 0x96, 0x0b, 0x8c, 0x9e, 0xd3, 0x2b, 0xde, 0x28, 0x16, 0x47, 0x37,
+    0x25, 0x1e, 0x41, 0xf0, 0xba, 0xf5, 0xed, 0xc9, 0xb9, 0x74, 0x91, 0x42, 0xe1, 0x0e, 0x4d, 0x3c,
+    0x9d, 0xd1, 0x92, 0x54, 0x38, 0x17, 0xeb, 0xa5, 0x10, 0x95, 0x17, 0xc7, 0xd8, 0xcb, 0xc4, 0x1b,
+    0xbf, 0x85, 0x52, 0x5d, 0xbc, 0x95, 0xab, 0x82, 0x18, 0x54, 0xf4, 0x1e, 0x17, 0x05, 0x75, 0x2c,
+    0x8b, 0x68, 0xa9, 0x1b, 0x56, 0x50, 0xbe, 0x02, 0x93, 0x86, 0xaa, 0xe7, 0x05, 0xf3, 0xa3, 0xba,
+    0x95, 0xd9, 0x4f, 0x84, 0xec, 0x79, 0x10, 0xc3, 0xfa, 0xb0, 0xa1, 0x6b, 0x45, 0xc3, 0x68, 0x4a,
+    0x6c, 0xf9, 0x82, 0x98, 0x59, 0x11, 0xe7, 0xab, 0x0d, 0x30, 0x61, 0x86, 0xad, 0x6e, 0xcd, 0xf1,
+    0x9b, 0x64, 0x2c, 0x08, 0x2c, 0x20, 0x89, 0xf8, 0x46, 0x9b, 0xd6, 0x24, 0x61, 0x1c, 0x2f, 0xa9,
+    0x41, 0x9b, 0xd5, 0x7f, 0xde, 0x69, 0x6b, 0x9f, 0x93, 0x18, 0xc0, 0xc0, 0xa8, 0xbe, 0x4a, 0xa3,
+    0x96, 0x56, 0x1a, 0xa8, 0xc7, 0x03, 0x53, 0xff, 0x19, 0x86, 0x08, 0xb2, 0x92, 0x5b, 0xf4, 0x0c,
+    0xf1, 0xf2, 0x5a, 0x86, 0xa9, 0xda, 0xcc, 0x02, 0xa6, 0x85, 0xe6, 0xca, 0xc2, 0x5c, 0x09, 0x31,
+    0xd8, 0x83, 0xd1, 0x35, 0xbc, 0xe9, 0xd5, 0x56, 0x16, 0x8f, 0x1f, 0x15, 0x78, 0x06, 0xe7, 0x2b,
+    0x2d, 0x4e, 0x96, 0x55, 0x0b, 0xf1, 0xe6, 0x3c, 0x88, 0x68, 0x32, 0xe3, 0xf5, 0x82, 0xbd, 0x9a,
+    0xe4, 0xa9, 0xe3, 0x38, 0x05, 0xbe, 0x84, 0xe6, 0x4b, 0x46, 0x15, 0x1d, 0x05, 0xab, 0x1b, 0x77,
+    0x65, 0x55, 0xcd, 0xdf, 0x24, 0x22, 0xc1, 0x2a, 0xf3, 0x9a, 0x6b, 0x19, 0x05, 0xa0, 0xa8, 0xdc,
+    0xc3, 0x82, 0x64, 0xeb, 0xf5, 0xc8, 0xb6, 0xcb, 0x11, 0xe9, 0x6d, 0xcb, 0xd0, 0xa5, 0x85, 0x43,
+    0x45, 0x5d, 0x20, 0x65, 0x36, 0xe6, 0x58, 0xa6, 0xa1, 0x22, 0x9c, 0x2a, 0x18, 0xae, 0xf7, 0x72,
+    0x1d, 0x40, 0xd8, 0xcc, 0xb7, 0xed, 0xb6, 0xd0, 0x42, 0x71, 0xa3, 0x6f, 0x83, 0x2e, 0x4c, 0xe4,
+    0xab, 0xb5, 0x51, 0x15, 0xfc, 0x8b, 0x0b, 0xde, 0x47, 0xd2, 0xa7, 0x32, 0x27, 0xab, 0xac, 0xb6,
+    0x21, 0x83, 0x6b, 0x87, 0x9d, 0x07, 0xdc, 0x9b, 0xe4, 0xd2, 0xca, 0xf8, 0x87, 0x5f, 0x1d, 0x44,
+    0x9c, 0x3e, 0x81, 0xf8, 0x93, 0x2d, 0xf2, 0xb3, 0xda, 0xe5, 0x62, 0xf8, 0xd1, 0xac, 0xa8, 0x73,
+    0x3d, 0x40, 0xa4, 0x4e, 0x17, 0x67, 0x62, 0xf7, 0x24, 0x81, 0xea, 0x44, 0x7e, 0x23, 0x46, 0xe9,
+    0xd6, 0xe9, 0x87, 0xc7, 0xda, 0xc3, 0xe5, 0xc4, 0x28, 0x62, 0x6b, 0x95, 0x13, 0xe4, 0xbd, 0xa6,
+    0xb3, 0x7c, 0x15, 0xbb, 0x09, 0x6b, 0xe9, 0xda, 0xee, 0x56, 0xa8, 0x87, 0x90, 0x63, 0x2e, 0x0e,
+    0x4c, 0x05, 0x76, 0x84, 0x02, 0xd5, 0xfb, 0x1f, 0x7b, 0x9f, 0x42, 0x9c, 0x5b, 0x4b, 0x51, 0xe1,
+    0x47, 0x95, 0x22, 0x74, 0x85, 0x08, 0xf2, 0x55, 0x8e, 0x07, 0x23, 0xfa, 0x54, 0x10, 0x95, 0x3b,
+    0xf5, 0x1b, 0x89, 0x96, 0x0f, 0x72, 0x7f, 0x1b, 0x7a, 0xdb, 0x97, 0x7a, 0xc3, 0xe3, 0xef, 0x8d,
+    0x34, 0x4b, 0x17, 0x8d, 0x7e, 0x1b, 0x02, 0xf4, 0x84, 0x00, 0xe2, 0xf5, 0x06, 0xf8, 0xd9, 0x48,
+    0xb6, 0x78, 0x70, 0xf1, 0x19, 0x45, 0x28, 0xd4, 0x63, 0x7b, 0xfa, 0xa0, 0xb8, 0x14, 0xe9, 0x2b,
+    0xd6, 0x3c, 0x2a, 0xf4, 0x81, 0xcc, 0xc5, 0xad, 0x4e, 0xac, 0x73, 0x8b, 0x95, 0x6d, 0x3d, 0x4e,
+    0x64, 0xe5, 0x9b, 0xca, 0xd2, 0x94, 0x4c, 0x21, 0x1b, 0xe0, 0x16, 0xe2, 0x34, 0xc5, 0x55, 0x70,
+    0x96, 0x2e, 0x04, 0x9e, 0x81, 0x5e, 0x06, 0xb6, 0x22, 0x17, 0xe3, 0x6c, 0xfb, 0xef, 0xbf, 0xb4,
+    0x7e, 0xc1, 0xd5, 0xc2, 0x2f, 0x5f, 0xd7, 0xeb, 0xd2, 0x75, 0xff, 0x25, 0xec, 0xff, 0x2f, 0xd4,
+    0x60, 0x63, 0xf0, 0xcb, 0xfc, 0xcb, 0xc6, 0xef, 0xda, 0xf9, 0x52, 0x5a, 0x20, 0x81, 0x50, 0xae,
+    0xea, 0x0a, 0x23, 0xb8, 0xab, 0x62, 0xa4, 0x58, 0xd8, 0x66, 0x5c, 0xb6, 0x4e, 0x7f, 0x38, 0x79,
+    0xd7, 0x28, 0x14, 0x25, 0xb2, 0xba, 0x44, 0x84, 0x3f, 0x77, 0x3e, 0xac, 0xae, 0xe0, 0x76, 0xae,
+    0xc4, 0x8d, 0x2a, 0x37, 0x5b, 0xf2, 0x6e, 0x53, 0xdb, 0xe6, 0xd6, 0x28, 0xbc, 0x6e, 0x99, 0xaf,
+    0x07, 0xe2, 0x48, 0x6c, 0xa2, 0xac, 0x59, 0x23, 0x1b, 0x1b, 0x31, 0x07, 0xc6, 0xb0, 0x93, 0xd8,
+    0xdf, 0x30, 0x48, 0xec, 0xa3, 0xe4, 0x43, 0x58, 0xe8, 0x7f, 0xcc, 0x37, 0x32, 0xd6, 0x8d, 0x35,
+    0xf7, 0x44, 0x8a, 0xe3, 0x4b, 0x9b, 0x12, 0xeb, 0x90, 0x2c, 0xed, 0x74, 0xe4, 0x98, 0x30, 0x1d,
+    0xa6, 0xfa, 0x7d, 0xd7, 0xad, 0x72, 0x6b, 0xfe, 0x76, 0x6c, 0x96, 0x5a, 0x05, 0xa2, 0xc8, 0x67,
+    0x3c, 0x95, 0x47, 0x16, 0x62, 0x55, 0x2b, 0x15, 0x3c, 0xb0, 0xd4, 0xa6, 0x82, 0xec, 0xfe, 0x72,
+    0xa0, 0xb5, 0x2c, 0x37, 0x5b, 0xf2, 0xed, 0xa3, 0x3e, 0x2e, 0x5a, 0x6c, 0xcd, 0x5a, 0x0e, 0x0e,
+    0x6d, 0xcb, 0x18, 0x70, 0xe3, 0xe9, 0xf6, 0xe3, 0x8b, 0xda, 0x97, 0x88, 0xb6, 0x1c, 0x56, 0xd2,
+    0x64, 0x61, 0xac, 0x51, 0xcf, 0xca, 0x41, 0x7a, 0x81, 0x61, 0x4e, 0x7e, 0xb3, 0x03, 0xd7, 0xe7,
+    0xa6, 0xfa, 0x97, 0x8a, 0x11, 0x73, 0xa4, 0x52, 0xab, 0x00, 0x9e, 0xa3, 0xf6, 0x0b, 0xd5, 0x58,
+    0xf9, 0xab, 0x2d, 0xaa, 0xdc, 0xbe, 0x0c, 0x63, 0xec, 0x0e, 0xad, 0x2f, 0x32, 0x55, 0xd6, 0x58,
+    0xfe, 0x6a, 0x0a, 0x43, 0x0e, 0xdd, 0x66, 0x84, 0x4d, 0xd5, 0xc6, 0x60, 0xe8, 0x24, 0x99, 0x5b,
+    0xd9, 0xb2, 0xae, 0x0a, 0x56, 0x07, 0x6d, 0x09, 0x59, 0x2c, 0xb9, 0xf3, 0x8d, 0x86, 0xaa, 0x91,
+    0x22, 0x38, 0x2f, 0x0d, 0xbb, 0x51, 0xcb, 0x91, 0xc3, 0xb6, 0x3e, 0xf5, 0x82, 0x8f, 0xf8, 0x95,
+    0x23, 0x47, 0x7b, 0x7b, 0x87, 0x6d, 0xfc, 0xae, 0xdb, 0xa3, 0x7f, 0x03, 0x2e, 0x4a, 0xc9, 0xcd,
+    0x02, 0x57, 0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x55,
+    0xdb, 0x72, 0xda, 0x30, 0x10, 0x7d, 0x86, 0xaf, 0xd0, 0xc0, 0x43, 0x9a, 0x8b, 0xc1, 0x36, 0x10,
+    0xa7, 0x62, 0xf2, 0xd0, 0x97, 0xfc, 0x44, 0x9a, 0x07, 0xc9, 0x5a, 0x61, 0x15, 0x59, 0xf2, 0x48,
+    0x32, 0x97, 0x66, 0xf2, 0xef, 0x95, 0x6c, 0x43, 0x88, 0xc7, 0x74, 0xa6, 0x1d, 0x46, 0x78, 0x58,
+    0xef, 0x9e, 0x3d, 0xbb, 0x7b, 0xb4, 0x8c, 0xe7, 0x77, 0xe8, 0x45, 0x1b, 0x54, 0x6a, 0x03, 0x48,
+    0x28, 0xae, 0x4d, 0x49, 0x9c, 0xd0, 0x0a, 0xed, 0x84, 0x15, 0x0e, 0x17, 0xce, 0x55, 0x16, 0xcf,
+    0xe7, 0x5c, 0x54, 0x56, 0x6f, 0x67, 0x0c, 0xd0, 0xdd, 0x7c, 0x4c, 0x35, 0x3b, 0xa2, 0xf7, 0xf1,
+    0x88, 0x6b, 0xe5, 0x22, 0x4e, 0x4a, 0x21, 0x8f, 0x18, 0x59, 0xa2, 0x6c, 0x64, 0xc1, 0x08, 0xbe,
+    0x1e, 0x8f, 0x28, 0xc9, 0xb7, 0x1b, 0xa3, 0x6b, 0xc5, 0xa2, 0x5c, 0x4b, 0x6d, 0x30, 0x9a, 0x3e,
+    0x65, 0x39, 0x70, 0xe2, 0xdf, 0x31, 0x61, 0x2b, 0x49, 0x7c, 0x04, 0x97, 0x70, 0xf0, 0xbf, 0xc3,
+    0x23, 0xe2, 0x52, 0xef, 0x31, 0xf2, 0xbe, 0x75, 0xa9, 0xbc, 0x8d, 0x48, 0xb1, 0x51, 0x91, 0x70,
+    0x50, 0x5a, 0x6f, 0x05, 0xe5, 0xc0, 0xac, 0xc7, 0x1f, 0xe3, 0x22, 0x79, 0x28, 0xd2, 0x90, 0xf9,
+    0x04, 0x0a, 0x49, 0xf8, 0xf8, 0x00, 0x07, 0x07, 0x17, 0xd9, 0x82, 0xb0, 0x00, 0x93, 0x56, 0x87,
+    0xf3, 0xa1, 0xd2, 0x53, 0x09, 0xb1, 0x52, 0x84, 0xc0, 0x01, 0x62, 0x1c, 0x68, 0x02, 0xa9, 0xc7,
+    0x90, 0xc2, 0x7a, 0x0c, 0x77, 0x94, 0x10, 0xb9, 0x63, 0x05, 0x18, 0x29, 0xad, 0xc0, 0xdb, 0x4b,
+    0x62, 0x36, 0x42, 0x45, 0x54, 0x3b, 0xa7, 0x4b, 0x8c, 0x92, 0xb8, 0x0a, 0xb4, 0x2b, 0xc2, 0x98,
+    0x50, 0x9b, 0x36, 0xdb, 0xca, 0x9f, 0xc4, 0x9f, 0x38, 0xd4, 0xae, 0x0f, 0x67, 0x26, 0xab, 0xee,
+    0x5d, 0x38, 0x66, 0x43, 0xc9, 0xb7, 0xf8, 0xa1, 0xf9, 0xcc, 0xb2, 0xdb, 0x8e, 0x13, 0xc1, 0x5c,
+    0x18, 0x9f, 0x37, 0x2f, 0x84, 0x64, 0x0f, 0xc8, 0x5b, 0xe8, 0x15, 0x9e, 0x4f, 0x3c, 0x5e, 0x91,
+    0xd5, 0xba, 0x6b, 0xfb, 0x1e, 0xc4, 0xa6, 0x70, 0x18, 0x51, 0x2d, 0xd9, 0xfa, 0xdc, 0x90, 0x7d,
+    0xe1, 0x7b, 0x76, 0x6a, 0x07, 0x83, 0x5c, 0x9b, 0x66, 0x98, 0xb8, 0xab, 0xa4, 0xcf, 0xf9, 0x5a,
+    0xe3, 0x92, 0xcf, 0xc6, 0x8d, 0xf2, 0xda, 0x58, 0x0f, 0x5d, 0x69, 0x71, 0x9a, 0x82, 0xe7, 0x68,
+    0x9d, 0xd1, 0x6a, 0x73, 0x31, 0x09, 0x03, 0x2c, 0xbc, 0x12, 0xaa, 0xaa, 0x5d, 0x30, 0x17, 0x2d,
+    0xbd, 0x45, 0x9b, 0xa4, 0x61, 0x6c, 0xc5, 0x6f, 0xc0, 0xc9, 0xf2, 0xb2, 0x79, 0x91, 0x04, 0xee,
+    0x6b, 0x98, 0x2d, 0xa0, 0x6c, 0x80, 0x09, 0x05, 0x89, 0xee, 0x11, 0x09, 0x08, 0xfd, 0x12, 0xba,
+    0x69, 0x04, 0x11, 0x78, 0x97, 0x92, 0x08, 0x15, 0xbc, 0x7a, 0x62, 0xfa, 0x40, 0x68, 0x4c, 0xac,
+    0xf0, 0x32, 0x7d, 0xbf, 0x22, 0x34, 0x26, 0x0c, 0xe4, 0x2d, 0xe0, 0x59, 0x6d, 0xe7, 0xb6, 0xc4,
+    0xb3, 0xb4, 0x65, 0x42, 0x6b, 0x3f, 0x6b, 0x75, 0x51, 0xc8, 0xb2, 0x1d, 0xfa, 0x5e, 0x30, 0x57,
+    0xe0, 0x64, 0x11, 0xf7, 0xcb, 0x7a, 0x6c, 0x0c, 0x9d, 0x52, 0x9c, 0xae, 0xbc, 0x4c, 0x02, 0xd2,
+    0xbf, 0x88, 0x81, 0x89, 0x1d, 0xfa, 0xcc, 0x3b, 0x20, 0x80, 0x8c, 0x72, 0xfe, 0x3d, 0x0b, 0xae,
+    0x8a, 0xec, 0x86, 0x0a, 0xfc, 0x72, 0x6b, 0x28, 0xb1, 0x20, 0x45, 0x33, 0xf6, 0x5f, 0xb5, 0x75,
+    0x82, 0x1f, 0x3d, 0x90, 0x1f, 0xa1, 0xf2, 0x0d, 0xb7, 0x15, 0xc9, 0x21, 0xa2, 0xe0, 0xf6, 0x00,
+    0x2a, 0x00, 0x4e, 0xc3, 0x20, 0x02, 0xe4, 0x25, 0x44, 0xd3, 0x2f, 0x50, 0xac, 0xaf, 0x92, 0x78,
+    0x16, 0x2a, 0x68, 0xbf, 0x83, 0x52, 0xa6, 0xd9, 0x2a, 0x5b, 0x66, 0xcb, 0x06, 0x27, 0x37, 0xe7,
+    0xc5, 0xd0, 0x57, 0x68, 0x4f, 0x47, 0x17, 0xdd, 0x43, 0xc9, 0x6c, 0xd5, 0xf6, 0x7d, 0x5a, 0x57,
+    0x21, 0xbe, 0x6d, 0x33, 0x22, 0xb5, 0xd3, 0x6b, 0xe4, 0xcd, 0x33, 0xa5, 0x1d, 0x5c, 0xbd, 0xbe,
+    0x39, 0x03, 0xf8, 0x3a, 0xc5, 0x06, 0x6d, 0x60, 0x1a, 0x4d, 0x19, 0x4d, 0x89, 0x9f, 0x5b, 0xc5,
+    0xbb, 0x1d, 0xa2, 0x2e, 0xe1, 0x22, 0x6d, 0x07, 0x4b, 0xb5, 0x61, 0x60, 0x22, 0x43, 0x98, 0xa8,
+    0xed, 0x19, 0xb0, 0xe1, 0xf1, 0xa5, 0xef, 0x27, 0x49, 0x86, 0xad, 0x89, 0x5e, 0x9d, 0x70, 0x12,
+    0xde, 0x86, 0x69, 0xda, 0xed, 0x91, 0xca, 0x1a, 0x7a, 0x65, 0x3f, 0x5e, 0x88, 0x0a, 0x25, 0x69,
+    0x73, 0x59, 0x5a, 0x34, 0xac, 0x5c, 0x11, 0x69, 0xde, 0x2c, 0xa2, 0x6f, 0xe9, 0x6d, 0x00, 0xed,
+    0xaf, 0xa1, 0x96, 0xd2, 0xeb, 0x8e, 0x78, 0xdc, 0xbb, 0xe7, 0x97, 0x66, 0x71, 0xbf, 0x5d, 0x38,
+    0xfe, 0x9f, 0x0a, 0x5f, 0x15, 0x29, 0xe1, 0x79, 0x12, 0xd8, 0x57, 0x93, 0xb7, 0xc1, 0x6a, 0x7b,
+    0x2e, 0xf7, 0xa8, 0xbd, 0xb7, 0xef, 0x43, 0x23, 0x3d, 0x91, 0x31, 0xad, 0x16, 0xba, 0x0a, 0x87,
+    0x11, 0x30, 0xa6, 0xc0, 0xc3, 0xdf, 0x50, 0xb3, 0x56, 0x3a, 0xa9, 0x4e, 0x7e, 0xc6, 0x71, 0xfa,
+    0x98, 0xc4, 0x13, 0x1f, 0x37, 0xea, 0x05, 0xe2, 0xbc, 0x80, 0x7c, 0x0b, 0xec, 0xaf, 0x00, 0x37,
+    0x2d, 0x40, 0x12, 0x1e, 0xd9, 0x8f, 0xd5, 0x4d, 0xc8, 0xff, 0x07, 0x2a, 0xc9, 0x6d, 0xf9, 0xf5,
+    0x06, 0x00, 0x00,
+};
+
+static const WebBundleEntry WEB_BUNDLE_INDEX[WEB_BUNDLE_COUNT] PROGMEM = {
+    {WEB_BUNDLE_PATH_0, 0, 1828, 3978, 0x5ad6a1d0},
+    {WEB_BUNDLE_PATH_1, 1828, 2554, 13352, 0xc01747a0},
+    {WEB_BUNDLE_PATH_2, 4382, 422, 698, 0xe1783e99},
+    {WEB_BUNDLE_PATH_3, 4804, 422, 698, 0xa40e8861},
+    {WEB_BUNDLE_PATH_4, 5226, 574, 1150, 0x42418861},
+    {WEB_BUNDLE_PATH_5, 5800, 744, 2161, 0x937be2d0},
+    {WEB_BUNDLE_PATH_6, 6544, 413, 694, 0x7eb5d731},
+    {WEB_BUNDLE_PATH_7, 6957, 591, 1170, 0xde78a7a1},
+    {WEB_BUNDLE_PATH_8, 7548, 429, 715, 0x53ae2e09},
+    {WEB_BUNDLE_PATH_9, 7977, 533, 967, 0x768d54c1},
+    {WEB_BUNDLE_PATH_10, 8510, 683, 1207, 0x231ee40e},
+    {WEB_BUNDLE_PATH_11, 9193, 609, 1297, 0xe228e486},
+    {WEB_BUNDLE_PATH_12, 9802, 605, 1213, 0xf0195fb1},
+    {WEB_BUNDLE_PATH_13, 10407, 717, 1332, 0x9b2652ce},
+    {WEB_BUNDLE_PATH_14, 11124, 665, 1387, 0xfcb790fc},
+    {WEB_BUNDLE_PATH_15, 11789, 4583, 22274, 0x0a7efbda},
+    {WEB_BUNDLE_PATH_16, 16372, 751, 1781, 0xc8b4d31b},
+};
@@ -0,0 +1,328 @@
+#include "websocket.h"
+#include "Base64.h"
+#include <string.h>
+#include <strings.h>
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+/**
+ * @brief Rotate a 32 bit word left
+ *
+ * @param value word
+ * @param bits number of bits
+ * @return uint32_t
+ */
+static uint32_t rotateLeft(uint32_t value, uint8_t bits){
+    return (value << bits) | (value >> (32 - bits));
+}
+
+/**
+ * @brief Process one 64 byte block of SHA-1
+ *
+ * @param state hash state (5 words)
+ * @param block 64 bytes
+ */
+static void sha1Block(uint32_t *state, const uint8_t *block){
+    uint32_t w[80];
+    for(uint8_t i = 0; i < 16; i++){
+        w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) | ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+    }
+    for(uint8_t i = 16; i < 80; i++){
+        w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    for(uint8_t i = 0; i < 80; i++){
+        uint32_t f, k;
+        if(i < 20){
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if(i < 40){
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if(i < 60){
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else{
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        uint32_t temp = rotateLeft(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = rotateLeft(b, 30);
+        b = a;
+        a = temp;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+/**
+ * @brief Calculate the SHA-1 hash (only used for the handshake)
+ *
+ * @param data input
+ * @param length length of the input
+ * @param digest 20 bytes
+ */
+void WebSocket::sha1(const uint8_t *data, size_t length, uint8_t digest[20]){
+    uint32_t state[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    size_t offset = 0;
+    for(; offset + 64 <= length; offset += 64){
+        sha1Block(state, data + offset);
+    }
+    // last block(s): rest, 0x80, zeros, length in bits
+    uint8_t block[128];
+    size_t rest = length - offset;
+    memcpy(block, data + offset, rest);
+    block[rest] = 0x80;
+    size_t padded = rest + 9 <= 64 ? 64 : 128;
+    memset(block + rest + 1, 0, padded - rest - 1);
+    uint64_t bits = (uint64_t)length * 8;
+    for(uint8_t i = 0; i < 8; i++){
+        block[padded - 1 - i] = bits >> (i * 8);
+    }
+    sha1Block(state, block);
+    if(padded == 128) sha1Block(state, block + 64);
+    for(uint8_t i = 0; i < 20; i++){
+        digest[i] = state[i / 4] >> (24 - (i % 4) * 8);
+    }
+}
+
+/**
+ * @brief Calculate the Sec-WebSocket-Accept value for a Sec-WebSocket-Key
+ *
+ * @param key key of the client
+ * @param accept 28 characters, terminated
+ */
+void WebSocket::acceptKey(const char *key, char accept[WS_ACCEPT_SIZE]){
+    char input[WS_KEY_SIZE + sizeof(WS_GUID)];
+    size_t keyLength = strnlen(key, WS_KEY_SIZE - 1);
+    memcpy(input, key, keyLength);
+    memcpy(input + keyLength, WS_GUID, sizeof(WS_GUID));
+    uint8_t digest[20];
+    sha1((const uint8_t*)input, keyLength + sizeof(WS_GUID) - 1, digest);
+    Base64.encode(accept, (char*)digest, sizeof(digest));
+}
+
+/**
+ * @brief Write the header of a (final, unmasked) server frame
+ *
+ * @param out buffer of WS_MAX_HEADER bytes
+ * @param opcode ws_text, ws_pong, ws_close, ...
+ * @param length length of the payload (up to 65535)
+ * @return size_t length of the header
+ */
+size_t WebSocket::writeHeader(uint8_t *out, uint8_t opcode, size_t length){
+    out[0] = 0x80 | (opcode & 0x0F);
+    if(length < 126){
+        out[1] = length;
+        return 2;
+    }
+    out[1] = 126;
+    out[2] = length >> 8;
+    out[3] = length;
+    return 4;
+}
+
+/**
+ * @brief Construct a new WebSocketHandshake object
+ *
+ */
+WebSocketHandshake::WebSocketHandshake(){
+    reset();
+}
+
+/**
+ * @brief Start a new request
+ *
+ */
+void WebSocketHandshake::reset(){
+    _lineLength = 0;
+    _total = 0;
+    _lines = 0;
+    _upgrade = false;
+    _key[0] = '\0';
+}
+
+/**
+ * @brief Parse the next character of the opening handshake request
+ *
+ * @param c character
+ * @return WebSocketParseResult wsp_done after the empty line of a valid request (getKey()),
+ *         wsp_error if it is no WebSocket request
+ */
+WebSocketParseResult WebSocketHandshake::feed(uint8_t c){
+    if(++_total > WS_HANDSHAKE_MAX) return wsp_error;
+    if(c == '\r') return wsp_more;
+    if(c != '\n'){
+        if(_lineLength < WS_HANDSHAKE_LINE - 1) _line[_lineLength++] = c;
+        return wsp_more;
+    }
+    if(_lineLength == 0){
+        // end of the header
+        return _lines > 0 && _upgrade && _key[0] != '\0' ? wsp_done : wsp_error;
+    }
+    _line[_lineLength] = '\0';
+    _lineLength = 0;
+    if(!checkLine()) return wsp_error;
+    _lines++;
+    return wsp_more;
+}
+
+/**
+ * @brief Get the Sec-WebSocket-Key of the request
+ *
+ * @return const char*
+ */
+const char* WebSocketHandshake::getKey() const{
+    return _key;
+}
+
+/**
+ * @brief Check the request line and the relevant header lines
+ *
+ * @return true if the request can still be a WebSocket request
+ */
+bool WebSocketHandshake::checkLine(){
+    if(_lines == 0) return strncmp(_line, "GET ", 4) == 0;
+    const char *value = strchr(_line, ':');
+    if(value == nullptr) return true;
+    value++;
+    while(*value == ' ') value++;
+    if(strncasecmp(_line, "Upgrade:", 8) == 0){
+        _upgrade = strncasecmp(value, "websocket", 9) == 0;
+    }
+    else if(strncasecmp(_line, "Sec-WebSocket-Key:", 18) == 0){
+        size_t length = strcspn(value, " ");
+        if(length == 0 || length >= WS_KEY_SIZE) return false;
+        memcpy(_key, value, length);
+        _key[length] = '\0';
+    }
+    return true;
+}
+
+/**
+ * @brief Construct a new WebSocketFrameParser object
+ *
+ */
+WebSocketFrameParser::WebSocketFrameParser(){
+    reset();
+}
+
+/**
+ * @brief Wait for the start of the next frame
+ *
+ */
+void WebSocketFrameParser::reset(){
+    _state = st_start;
+    _opcode = 0;
+    _count = 0;
+    _extendedSize = 0;
+    _length = 0;
+    _received = 0;
+    _payload[0] = '\0';
+}
+
+/**
+ * @brief Parse the next byte of a client frame
+ *
+ * @param c byte
+ * @return WebSocketParseResult wsp_done if a frame is complete (getOpcode(), getPayload()),
+ *         wsp_error for frames which are not supported (fragmented, unmasked, too long): the
+ *         connection has to be closed
+ */
+WebSocketParseResult WebSocketFrameParser::feed(uint8_t c){
+    switch(_state){
+        case st_start:
+            _opcode = c & 0x0F;
+            // no extensions, no fragmentation
+            if((c & 0x70) || !(c & 0x80)) return wsp_error;
+            if(_opcode != ws_text && _opcode != ws_binary && _opcode != ws_close && _opcode != ws_ping && _opcode != ws_pong){
+                return wsp_error;
+            }
+            _state = st_length;
+            return wsp_more;
+        case st_length:
+            // frames of clients are always masked
+            if(!(c & 0x80)) return wsp_error;
+            _length = c & 0x7F;
+            _count = 0;
+            if(_length == 127) return wsp_error;
+            if(_length == 126){
+                _length = 0;
+                _extendedSize = 2;
+                _state = st_extended;
+                return wsp_more;
+            }
+            if(_length > WS_MAX_MESSAGE) return wsp_error;
+            _state = st_mask;
+            return wsp_more;
+        case st_extended:
+            _length = (_length << 8) | c;
+            if(++_count < _extendedSize) return wsp_more;
+            if(_length > WS_MAX_MESSAGE) return wsp_error;
+            _count = 0;
+            _state = st_mask;
+            return wsp_more;
+        case st_mask:
+            _mask[_count++] = c;
+            if(_count < 4) return wsp_more;
+            return startPayload();
+        case st_payload:
+            _payload[_received] = c ^ _mask[_received % 4];
+            if(++_received < _length) return wsp_more;
+            _payload[_received] = '\0';
+            _state = st_start;
+            return wsp_done;
+    }
+    return wsp_error;
+}
+
+/**
+ * @brief Get the opcode of the last complete frame
+ *
+ * @return uint8_t WebSocketOpcode
+ */
+uint8_t WebSocketFrameParser::getOpcode() const{
+    return _opcode;
+}
+
+/**
+ * @brief Get the unmasked payload of the last complete frame
+ *
+ * @return const char* terminated (text messages can be used as string)
+ */
+const char* WebSocketFrameParser::getPayload() const{
+    return _payload;
+}
+
+/**
+ * @brief Get the length of the payload of the last complete frame
+ *
+ * @return size_t
+ */
+size_t WebSocketFrameParser::getLength() const{
+    return _length;
+}
+
+/**
+ * @brief Continue after the mask, frames without payload are complete
+ *
+ * @return WebSocketParseResult
+ */
+WebSocketParseResult WebSocketFrameParser::startPayload(){
+    _received = 0;
+    if(_length == 0){
+        _payload[0] = '\0';
+        _state = st_start;
+        return wsp_done;
+    }
+    _state = st_payload;
+    return wsp_more;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file websocket.h
+ * @brief Minimal WebSocket protocol (RFC 6455) for the push channel of the web UI
+ *
+ * Only what the web UI needs: the opening handshake, small unfragmented text messages from
+ * the browser (masked, up to WS_MAX_MESSAGE bytes), ping/pong and close. The server sends
+ * unmasked frames without fragmentation.
+ *
+ * The handshake and the frames are parsed byte by byte with constant memory, so the parsers
+ * can be fed directly from a WiFiClient.
+ *
+ */
+
+#ifndef websocket_h
+#define websocket_h
+
+#include <Arduino.h>
+
+#define WS_MAX_MESSAGE 128          // longest message from a client (payload)
+#define WS_MAX_HEADER 4             // header of a server frame up to 65535 bytes
+#define WS_KEY_SIZE 32              // Sec-WebSocket-Key (24 characters) + margin
+#define WS_ACCEPT_SIZE 29           // Sec-WebSocket-Accept: 28 characters + terminating zero
+#define WS_HANDSHAKE_LINE 80        // longer header lines are truncated (only the start is checked)
+#define WS_HANDSHAKE_MAX 2048       // longest opening handshake request
+
+enum WebSocketOpcode {ws_continuation = 0x0, ws_text = 0x1, ws_binary = 0x2, ws_close = 0x8, ws_ping = 0x9, ws_pong = 0xA};
+enum WebSocketParseResult {wsp_more = 0, wsp_done = 1, wsp_error = 2};
+
+class WebSocket{
+
+    public:
+        static void sha1(const uint8_t *data, size_t length, uint8_t digest[20]);
+        static void acceptKey(const char *key, char accept[WS_ACCEPT_SIZE]);
+        static size_t writeHeader(uint8_t *out, uint8_t opcode, size_t length);
+};
+
+class WebSocketHandshake{
+
+    public:
+        WebSocketHandshake();
+        void reset();
+        WebSocketParseResult feed(uint8_t c);
+        const char* getKey() const;
+
+    private:
+        char _line[WS_HANDSHAKE_LINE];
+        uint8_t _lineLength;
+        uint16_t _total;
+        uint16_t _lines;
+        bool _upgrade;
+        char _key[WS_KEY_SIZE];
+
+        bool checkLine();
+};
+
+class WebSocketFrameParser{
+
+    public:
+        WebSocketFrameParser();
+        void reset();
+        WebSocketParseResult feed(uint8_t c);
+        uint8_t getOpcode() const;
+        const char* getPayload() const;
+        size_t getLength() const;
+
+    private:
+        enum State {st_start, st_length, st_extended, st_mask, st_payload};
+        State _state;
+        uint8_t _opcode;
+        uint8_t _count;             // bytes of the extended length or mask read
+        uint8_t _extendedSize;
+        uint16_t _length;
+        uint16_t _received;
+        uint8_t _mask[4];
+        char _payload[WS_MAX_MESSAGE + 1];
+
+        WebSocketParseResult startPayload();
+};
+
+#endif
@@ -0,0 +1,228 @@
+#include "websocket_server.h"
+
+/**
+ * @brief Construct a new WebSocketServer object
+ *
+ * @param port TCP port (WS_PORT, the webserver has port 80)
+ */
+WebSocketServer::WebSocketServer(uint16_t port) : _server(port){
+    _handler = nullptr;
+    for(uint8_t i = 0; i < WS_MAX_CLIENTS; i++){
+        _slots[i].used = false;
+        _slots[i].open = false;
+        _slots[i].since = 0;
+    }
+}
+
+/**
+ * @brief Start listening
+ *
+ */
+void WebSocketServer::begin(){
+    _server.begin();
+}
+
+/**
+ * @brief Accept new clients and handle the received data (call from the main loop)
+ *
+ * @param now millis()
+ */
+void WebSocketServer::loop(uint32_t now){
+    accept(now);
+    for(uint8_t i = 0; i < WS_MAX_CLIENTS; i++){
+        Slot &slot = _slots[i];
+        if(!slot.used) continue;
+        if(!slot.client.connected() && !slot.client.available()){
+            close(i);
+            continue;
+        }
+        if(!slot.open){
+            handleHandshake(i);
+            if(slot.used && !slot.open && now - slot.since > WS_HANDSHAKE_TIMEOUT) close(i);
+        }
+        else{
+            handleFrames(i);
+        }
+    }
+}
+
+/**
+ * @brief Set the function which is called for connects, messages and disconnects
+ *
+ * @param handler
+ */
+void WebSocketServer::onEvent(WebSocketEventHandler handler){
+    _handler = handler;
+}
+
+/**
+ * @brief Send a text message to one client
+ *
+ * @param client index of the client (from the event handler)
+ * @param text message
+ * @param length length of the message
+ * @return true if the message was written
+ */
+bool WebSocketServer::send(uint8_t client, const char *text, size_t length){
+    if(client >= WS_MAX_CLIENTS) return false;
+    return sendFrame(client, ws_text, text, length);
+}
+
+/**
+ * @brief Send a text message to all connected clients
+ *
+ * @param text message
+ * @param length length of the message
+ */
+void WebSocketServer::broadcast(const char *text, size_t length){
+    for(uint8_t i = 0; i < WS_MAX_CLIENTS; i++){
+        if(_slots[i].open) sendFrame(i, ws_text, text, length);
+    }
+}
+
+/**
+ * @brief Get the number of clients which finished the handshake
+ *
+ * @return uint8_t
+ */
+uint8_t WebSocketServer::getClientCount() const{
+    uint8_t count = 0;
+    for(uint8_t i = 0; i < WS_MAX_CLIENTS; i++){
+        if(_slots[i].open) count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Take a waiting connection into a free slot, reject it if all slots are used
+ *
+ * @param now millis()
+ */
+void WebSocketServer::accept(uint32_t now){
+    if(!_server.hasClient()) return;
+    WiFiClient client = _server.accept();
+    for(uint8_t i = 0; i < WS_MAX_CLIENTS; i++){
+        Slot &slot = _slots[i];
+        if(slot.used) continue;
+        slot.client = client;
+        slot.client.setNoDelay(true);
+        slot.handshake.reset();
+        slot.parser.reset();
+        slot.used = true;
+        slot.open = false;
+        slot.since = now;
+        return;
+    }
+    client.write("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n");
+    client.stop();
+}
+
+/**
+ * @brief Read the opening handshake request and answer it
+ *
+ * @param index slot
+ */
+void WebSocketServer::handleHandshake(uint8_t index){
+    Slot &slot = _slots[index];
+    while(slot.client.available()){
+        int c = slot.client.read();
+        if(c < 0) return;
+        WebSocketParseResult result = slot.handshake.feed(c);
+        if(result == wsp_error){
+            slot.client.write("HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n");
+            close(index);
+            return;
+        }
+        if(result == wsp_done){
+            char accept[WS_ACCEPT_SIZE];
+            WebSocket::acceptKey(slot.handshake.getKey(), accept);
+            char response[128];
+            int length = snprintf(response, sizeof(response), "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                                  "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+            slot.client.write((const uint8_t*)response, length);
+            slot.open = true;
+            if(_handler != nullptr) _handler(index, ws_connected, nullptr, 0);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Read the frames of an open connection
+ *
+ * @param index slot
+ */
+void WebSocketServer::handleFrames(uint8_t index){
+    Slot &slot = _slots[index];
+    while(slot.used && slot.client.available()){
+        int c = slot.client.read();
+        if(c < 0) return;
+        WebSocketParseResult result = slot.parser.feed(c);
+        if(result == wsp_error){
+            // status 1002: protocol error (also for unsupported frames)
+            const char status[] = {0x03, (char)0xEA};
+            sendFrame(index, ws_close, status, sizeof(status));
+            close(index);
+            return;
+        }
+        if(result != wsp_done) continue;
+        switch(slot.parser.getOpcode()){
+            case ws_text:
+                if(_handler != nullptr) _handler(index, ws_message, slot.parser.getPayload(), slot.parser.getLength());
+                break;
+            case ws_ping:
+                sendFrame(index, ws_pong, slot.parser.getPayload(), slot.parser.getLength());
+                break;
+            case ws_close:
+                // echo the status code
+                sendFrame(index, ws_close, slot.parser.getPayload(), slot.parser.getLength() >= 2 ? 2 : 0);
+                close(index);
+                return;
+            default:
+                // binary messages and pongs are ignored
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Write a frame, a client which cannot take it without blocking is closed
+ *
+ * The client reconnects and gets the whole state again, so nothing is lost for the web UI.
+ *
+ * @param index slot
+ * @param opcode WebSocketOpcode
+ * @param payload data
+ * @param length length of the data
+ * @return true if written
+ */
+bool WebSocketServer::sendFrame(uint8_t index, uint8_t opcode, const char *payload, size_t length){
+    Slot &slot = _slots[index];
+    if(!slot.open || length > 0xFFFF) return false;
+    uint8_t frame[WS_MAX_FRAME];
+    size_t headerLength = WebSocket::writeHeader(frame, opcode, length);
+    if((size_t)slot.client.availableForWrite() < headerLength + length){
+        close(index);
+        return false;
+    }
+    if(headerLength + length <= sizeof(frame)){
+        memcpy(frame + headerLength, payload, length);
+        return slot.client.write(frame, headerLength + length) == headerLength + length;
+    }
+    return slot.client.write(frame, headerLength) == headerLength &&
+           slot.client.write((const uint8_t*)payload, length) == length;
+}
+
+/**
+ * @brief Close the connection of a slot and free it
+ *
+ * @param index slot
+ */
+void WebSocketServer::close(uint8_t index){
+    Slot &slot = _slots[index];
+    bool wasOpen = slot.open;
+    slot.open = false;
+    slot.used = false;
+    slot.client.stop();
+    if(wasOpen && _handler != nullptr) _handler(index, ws_disconnected, nullptr, 0);
+}
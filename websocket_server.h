@@ -0,0 +1,59 @@
+/**
+ * @file websocket_server.h
+ * @brief WebSocket server on its own port for the push channel of the web UI
+ *
+ * Runs next to the ESP8266WebServer and is polled from the main loop like it. Every client
+ * is a WiFiClient kept open in one of WS_MAX_CLIENTS slots; a client which does not finish the
+ * handshake within WS_HANDSHAKE_TIMEOUT ms is dropped. Text messages of the clients are passed
+ * to the event handler, ping and close are answered here.
+ *
+ */
+
+#ifndef websocket_server_h
+#define websocket_server_h
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include "websocket.h"
+
+#define WS_PORT 81
+#define WS_MAX_CLIENTS 3
+#define WS_HANDSHAKE_TIMEOUT 2000
+#define WS_MAX_FRAME 512            // frames up to this size are written with one write()
+
+enum WebSocketEvent {ws_connected, ws_message, ws_disconnected};
+
+typedef void (*WebSocketEventHandler)(uint8_t client, WebSocketEvent event, const char *message, size_t length);
+
+class WebSocketServer{
+
+    public:
+        WebSocketServer(uint16_t port);
+        void begin();
+        void loop(uint32_t now);
+        void onEvent(WebSocketEventHandler handler);
+        bool send(uint8_t client, const char *text, size_t length);
+        void broadcast(const char *text, size_t length);
+        uint8_t getClientCount() const;
+
+    private:
+        struct Slot {
+            WiFiClient client;
+            WebSocketHandshake handshake;
+            WebSocketFrameParser parser;
+            bool used;
+            bool open;              // handshake done
+            uint32_t since;         // millis() of the connect
+        };
+        WiFiServer _server;
+        Slot _slots[WS_MAX_CLIENTS];
+        WebSocketEventHandler _handler;
+
+        void accept(uint32_t now);
+        void handleHandshake(uint8_t index);
+        void handleFrames(uint8_t index);
+        bool sendFrame(uint8_t index, uint8_t opcode, const char *payload, size_t length);
+        void close(uint8_t index);
+};
+
+#endif
@@ -34,6 +34,10 @@
 #include <DNSServer.h>
 #include <WiFiManager.h>                //https://github.com/tzapu/WiFiManager WiFi Configuration Magic
 #include <EEPROM.h>                     //from ESP8266 Arduino Core (automatically installed when ESP8266 was installed via Boardmanager)
+#include <coredecls.h>                  //from ESP8266 Arduino Core, settimeofday_cb()
+extern "C" {
+#include <user_interface.h>              //from ESP8266 Arduino Core, system_get_rtc_time()
+}
 
 // own libraries
 #include "udplogger.h"
@@ -43,13 +47,30 @@
 #include "snake.h"
 #include "pong.h"
 #include "weather_client.h"
+#include "network_health.h"
+#include "timezone_table.h"
+#include "ip_api_parser.h"
+#include "brightness_schedule.h"
+#include "event_calendar.h"
+#include "solar_calc.h"
+#include "time_sync.h"
+#include "rtc_time.h"
+#include "telemetry.h"
+#include "crash_log.h"
+#include "led_frame.h"
+#include "ddp_receiver.h"
+#include "websocket_server.h"
+#include "state_cache.h"
+#include "json_writer.h"
+#include "web_assets.h"
+#include "web_bundle.h"
 
 
 // ----------------------------------------------------------------------------------
 //                                        CONSTANTS
 // ----------------------------------------------------------------------------------
 
-#define EEPROM_SIZE 30      // size of EEPROM to save persistent variables
+#define EEPROM_SIZE 31      // size of EEPROM to save persistent variables
 #define ADR_NM_START_H 0
 #define ADR_NM_END_H 4
 #define ADR_NM_START_M 8
@@ -62,6 +83,7 @@
 #define ADR_NM_ACTIVATED 27
 #define ADR_COLSHIFTSPEED 28
 #define ADR_COLSHIFTACTIVE 29
+#define ADR_NM_SOLAR 30
 
 
 #define NEOPIXELPIN 5       // pin to which the NeoPixels are attached
@@ -81,9 +103,28 @@
 #define PERIOD_NTPUPDATE 30000
 #define PERIOD_TIMEVISUUPDATE 1000
 #define PERIOD_MATRIXUPDATE 100
-#define PERIOD_NIGHTMODECHECK 5000
+#define PERIOD_NIGHTMODECHECK 1000
+#define PERIOD_RTCTIMESAVE 60000
+#define PERIOD_STATEPUSH 200
+#define STATE_JSON_SIZE 400     // all state fields as JSON
+#define RTC_TIME_MAX_AGE_S 600  // restored time is rejected if the restart took longer (RTC clock is only accurate to ~1%)
+#define NIGHTMODE_TRANSITION_MIN 30  // duration of fade in/out of nightmode in minutes
 #define DOUBLE_CLICK_TIME 400
 #define TEMP_MODE_TIMEOUT 5000
+#define MIN_VALID_EPOCH 1577836800 // 2020-01-01, older timestamps mean NTP has not synced yet
+#define LOCATION_LATITUDE_E4 492394   // default location for sunrise/sunset (Oedheim, Germany) in 1/10000 degree
+#define LOCATION_LONGITUDE_E4 92553
+
+// NTP servers, a server in the local network can be added in secrets.h (e.g. #define NTP_SERVER_LOCAL "192.168.0.1")
+#ifdef NTP_SERVER_LOCAL
+#define NTP_SERVER_1 NTP_SERVER_LOCAL
+#define NTP_SERVER_2 "pool.ntp.org"
+#define NTP_SERVER_3 "time.google.com"
+#else
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+#define NTP_SERVER_3 "ptbtime1.ptb.de"
+#endif
 
 #define SHORTPRESS 50
 #define LONGPRESS 3000
@@ -108,6 +149,18 @@ enum direction {right, left, up, down};
 enum ClockState {st_clock, st_diclock, st_spiral, st_tetris, st_snake, st_pingpong, st_temperature};
 const String stateNames[] = {"Clock", "DiClock", "Sprial", "Tetris", "Snake", "PingPong", "Temperature"};
 
+// own datatype for time-triggered events in the calendar
+enum CalendarEvent {ev_randommessage, ev_siebensechs, ev_nightmode, ev_solar};
+
+// own datatype for the body of a /leddirect request (decided at its first bytes)
+enum LedDirectBody {ld_none, ld_start, ld_frame, ld_base64};
+
+// fields of the state pushed to the web UI (names as in /data?key=mode)
+enum StateField {sf_mode, sf_modeid, sf_stateautochange, sf_ledoff, sf_nightmodeactivated, sf_nightmodestart, sf_nightmodeend,
+                 sf_nightmodesolar, sf_solardawn, sf_solardusk, sf_brightness, sf_colorshift, sf_colorshiftspeed, sf_count};
+const char *const stateFieldNames[sf_count] = {"mode", "modeid", "stateAutoChange", "ledoff", "nightModeActivated", "nightModeStart",
+                 "nightModeEnd", "nightModeSolar", "solarDawn", "solarDusk", "brightness", "colorshift", "colorshiftspeed"};
+
 // ports
 const unsigned int localPort = 2390;
 const unsigned int HTTPPort = 80;
@@ -168,10 +221,14 @@ long lastheartbeat = millis();      // time of last heartbeat sending
 long lastStep = millis();           // time of last animation step
 long lastLEDdirect = -TIMEOUT_LEDDIRECT; // time of last direct LED command (=> fall back to normal mode after timeout)
 long lastStateChange = millis();    // time of last state change
-long lastNTPUpdate = 0;  // Not used anymore with configTime
+long lastNTPUpdate = 0;             // time of last NTP status log
+long lastRTCTimeSave = 0;           // time of last save of the wall-clock time to RTC memory
+long lastStatePush = 0;             // time of last check for state changes to push to the web UI
 long lastAnimationStep = millis();  // time of last Matrix update
 long lastNightmodeCheck = millis()  - (PERIOD_NIGHTMODECHECK-3000); // time of last nightmode check
-long lastRandomMessageCheck = 0;    // time of last random message check
+time_t lastCalendarCheck = 0;       // epoch of last calendar check (detects clock steps backwards)
+uint32_t lastLoopStart = 0;         // micros() at the start of the last loop (loop latency)
+uint32_t loopCount = 0;             // loops since boot
 long buttonPressStart = 0;          // time of push button press start 
 long tempModeStart = 0;             // time when temp mode started
 int  lastTempClickCount = 0;        // click counter for double click
@@ -181,18 +238,39 @@ uint16_t behaviorUpdatePeriod = PERIOD_TIMEVISUUPDATE; // holdes the period in w
 
 // Create necessary global objects
 UDPLogger logger;
-const char* TZ_INFO = "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00"; // Central Europe (Oedheim, Germany)
+char TZ_INFO[TZ_POSIX_SIZE] = "CET-1CEST-2,M3.5.0/02:00:00,M10.5.0/03:00:00"; // Central Europe (Oedheim, Germany) until resolveTimezone()
 LEDMatrix ledmatrix = LEDMatrix(&matrix, brightness, &logger);
 Tetris mytetris = Tetris(&ledmatrix, &logger);
 Snake mysnake = Snake(&ledmatrix, &logger);
 Pong mypong = Pong(&ledmatrix, &logger);
 WeatherClient weather = WeatherClient();
+NetworkHealth network = NetworkHealth();
+BrightnessSchedule brightnessSchedule = BrightnessSchedule();
+EventCalendar calendar = EventCalendar();
+SolarCalc solarCalc = SolarCalc();
+TimeSync timeSync = TimeSync();
+LatencyHistogram loopLatency = LatencyHistogram();
+CrashTail crashTail = CrashTail();  // tail of the log in RTC memory (postmortem log)
+uint32_t telemetrySequence = 0;     // sequence number of the next telemetry frame
+uint32_t telemetryFrames = 0;       // LED frame count at the last telemetry frame
+uint32_t telemetryMillis = 0;       // millis() of the last telemetry frame
+LedFrameDecoder ledFrameDecoder = LedFrameDecoder(&ledmatrix, WIDTH, HEIGHT); // binary /leddirect frames
+FrameRateMeter ledDirectRate = FrameRateMeter();
+LedBase64Decoder ledBase64Decoder = LedBase64Decoder(&ledmatrix, WIDTH, HEIGHT); // old base64 /leddirect pictures
+uint8_t ledDirectBody = ld_none;    // decoder the body was streamed into by handleLEDDirectRaw()
+DdpReceiver ddpReceiver = DdpReceiver(&ledmatrix, WIDTH, HEIGHT); // realtime frames via UDP
+WebSocketServer webSocket = WebSocketServer(WS_PORT);              // push channel of the web UI
+StateCache stateCache = StateCache(stateFieldNames, sf_count);     // state last pushed to the web UI
+AssetManifest assetManifest = AssetManifest();                     // ETags of the web UI files
+AssetStats assetStats = AssetStats();
+uint32_t bundleOverrides = 0;       // bit per file of the web bundle which is replaced by a file in LittleFS
 
 float filterFactor = DEFAULT_SMOOTHING_FACTOR;// stores smoothing factor for led transition
 uint8_t currentState = st_clock;              // stores current state
 bool stateAutoChange = false;                 // stores state of automatic state change
 bool nightMode = false;                       // stores state of nightmode
 bool nightModeActivated = true;               // stores if the function nightmode is activated (its not the state of nightmode)
+bool nightModeSolar = false;                  // stores if nightmode follows civil twilight instead of the fixed times
 bool ledOff = false;                          // stores state of led off
 uint32_t maincolor_clock = colors24bit[2];    // color of the clock and digital clock
 uint32_t maincolor_snake = colors24bit[1];    // color of the random snake animation
@@ -202,14 +280,21 @@ uint8_t dynColorShiftPhase = 0;               // stores the phase of the dynamic
 uint8_t dynColorShiftSpeed = 1;               // stores the speed of the dynamic color shift -> used to calc update period
 bool randomMessageActive = false;             // stores if a random message is currently being displayed
 bool siebenSechsAnimActive = false;           // stores if 18:07 animation is active
-bool siebenSechsAnimDone = false;             // stores if 18:07 animation has finished for today
 long siebenSechsAnimStart = 0;                // start time of 18:07 animation
+time_t siebenSechsPendingUntil = 0;           // 18:07 event waiting for st_clock until this epoch (0 = none)
+bool timeEventsScheduled = false;             // stores if the calendar has been filled (needs valid time)
+bool brightnessRamping = false;               // stores if the brightness curve is currently fading
+volatile bool timeSyncPending = false;        // set by the SNTP callback, handled in the loop
+volatile int64_t timeSyncEpochMicros = 0;     // system time right after the last sync
+volatile uint64_t timeSyncMonotonicMicros = 0;// micros64() right after the last sync
 
 // nightmode settings
 uint8_t nightModeStartHour = 22;
 uint8_t nightModeStartMin = 0;
 uint8_t nightModeEndHour = 7;
 uint8_t nightModeEndMin = 0;
+int16_t solarDawnMin = -1;  // begin of civil twilight today (minutes after local midnight, -1 if not available)
+int16_t solarDuskMin = -1;  // end of civil twilight today (minutes after local midnight, -1 if not available)
 
 // counter for time updates
 int timeUpdateCounter = 0;
@@ -243,6 +328,9 @@ void setup() {
   ledmatrix.setupMatrix();
   ledmatrix.setCurrentLimit(CURRENT_LIMIT_LED);
 
+  // restore the time saved before a soft restart, SNTP only fine-tunes it later
+  bool timeRestored = restoreTimeFromRTC();
+
   // if(ESP.getResetReason().equals("Power On") || ESP.getResetReason().equals("External System")){
   //   // Turn on minutes leds (blue)
   //   ledmatrix.setMinIndicator(15, colors24bit[6]);
@@ -319,30 +407,48 @@ void setup() {
   // init ESP8266 File manager (LittleFS)
   setupFS();
 
+  // save the log tail of a crash before the reset, then mirror the log into RTC memory
+  setupCrashLog();
+
+  // shared retry policy of all network requests (jitter differs between clocks)
+  network.setSeed(ESP.random());
+  network.updateLink(WiFi.status() == WL_CONNECTED, millis());
+  weather.setNetworkHealth(&network);
+
   // setup OTA
   setupOTA(hostname);
 
   server.on("/cmd", handleCommand); // process commands
   server.on("/data", handleDataRequest); // process datarequests
-  server.on("/leddirect", HTTP_POST, handleLEDDirect); // Call the 'handleLEDDirect' function when a POST request is made to URI "/leddirect"
+  server.on("/leddirect", HTTP_POST, handleLEDDirect, handleLEDDirectRaw); // Call the 'handleLEDDirect' function when a POST request is made to URI "/leddirect", binary bodies are decoded while they are received
   server.begin();
+  ddpReceiver.begin(DDP_PORT);
+  webSocket.onEvent(handleWebSocketEvent);
+  webSocket.begin();
   
   // create UDP Logger to send logging messages via UDP multicast
-  logger = UDPLogger(WiFi.localIP(), logMulticastIP, logMulticastPort);
+  logger.begin(WiFi.localIP(), logMulticastIP, logMulticastPort);
   logger.setName("Wordclock 2.0");
-  logger.logString("Start program\n");
-  delay(10);
-  logger.logString("Sketchname: "+ String(__FILE__));
-  delay(10);
-  logger.logString("Build: " + String(__TIMESTAMP__));
-  delay(10);
-  logger.logString("IP: " + WiFi.localIP().toString());
-  delay(10);
-  logger.logString("Reset Reason: " + ESP.getResetReason());
-
-  // setup NTP
-  configTime(TZ_INFO, "pool.ntp.org");
-  logger.logString("NTP running (configTime)");
+  LOG_INFO(logger, "Start program\n");
+  LOG_INFO(logger, "Sketchname: "+ String(__FILE__));
+  LOG_INFO(logger, "Build: " + String(__TIMESTAMP__));
+  LOG_INFO(logger, "IP: " + WiFi.localIP().toString());
+  LOG_INFO(logger, "Reset Reason: " + ESP.getResetReason());
+
+  // timezone of the location (IP-API only on the first boot in a network)
+  resolveTimezone(logger);
+
+  // setup NTP (the first request is sent without startup delay, the callback signals every sync)
+  settimeofday_cb(onTimeSync);
+  configTime(TZ_INFO, NTP_SERVER_1, NTP_SERVER_2, NTP_SERVER_3);
+  LOG_INFO(logger, "NTP running (configTime): " + String(NTP_SERVER_1) + ", " + String(NTP_SERVER_2) + ", " + String(NTP_SERVER_3));
+
+  // forecast in the resolved timezone and location, the cache is checked against the local date
+  int32_t latE4, lonE4;
+  getLocationE4(&latE4, &lonE4);
+  weather.setLocation(getTimezoneName().c_str(), latE4, lonE4);
+  // show the last weather forecast until the first refresh
+  weather.loadCache();
 
   // load persistent variables from EEPROM
   loadMainColorFromEEPROM();
@@ -350,6 +456,16 @@ void setup() {
   loadNightmodeSettingsFromEEPROM();
   loadBrightnessSettingsFromEEPROM();
   loadColorShiftStateFromEEPROM();
+  rebuildBrightnessSchedule();
+
+  if(timeRestored){
+    // show the correct clock face right away (calendar and nightmode are set up in the first loop)
+    scheduleTimeEvents(time(nullptr));
+    if(!nightMode && (currentState == st_clock || currentState == st_diclock)){
+      updateStateBehavior(currentState);
+      ledmatrix.drawOnMatrixInstant();
+    }
+  }
   
   if(ESP.getResetReason().equals("Power On") || ESP.getResetReason().equals("External System")){
     // test quickly each LED
@@ -384,6 +500,9 @@ void setup() {
 
   // run the entry action for the initial state
   entryAction(currentState);
+
+  // send the log lines of the setup
+  logger.flush();
 }
 
 
@@ -392,39 +511,66 @@ void setup() {
 // ----------------------------------------------------------------------------------
 
 void loop() {
+  // duration of the last loop including the background tasks of the core (telemetry)
+  uint32_t loopStart = micros();
+  if(loopCount++ > 0){
+    loopLatency.record(loopStart - lastLoopStart);
+  }
+  lastLoopStart = loopStart;
+
   // handle OTA
   handleOTA();
   
   // handle Webserver
   server.handleClient();
 
+  // push channel of the web UI: game controls from the clients, changed state fields to the clients
+  webSocket.loop(millis());
+  if(webSocket.getClientCount() > 0 && millis() - lastStatePush > PERIOD_STATEPUSH){
+    pushState();
+    lastStatePush = millis();
+  }
+
+  // send the queued log lines (batched multicast datagrams)
+  logger.loop();
+
+  // realtime frames via UDP (DDP), they overwrite the normal program like /leddirect
+  if(ddpReceiver.loop(millis()) == ddp_frame){
+    ledmatrix.drawOnMatrixInstant();
+    lastLEDdirect = millis();
+    ledDirectRate.record(lastLEDdirect);
+  }
+
   // send regularly heartbeat messages via UDP multicast
   if(millis() - lastheartbeat > PERIOD_HEARTBEAT){
-    logger.logPrintf("Heartbeat, state: %s, FreeHeap: %u, HeapFrag: %u, MaxFreeBlock: %u",
+    sendTelemetry();
+    LOG_DEBUG(logger, "Heartbeat, state: %s, FreeHeap: %u, HeapFrag: %u, MaxFreeBlock: %u",
              stateNames[currentState].c_str(), ESP.getFreeHeap(), ESP.getHeapFragmentation(), ESP.getMaxFreeBlockSize());
     lastheartbeat = millis();
 
     // Check wifi status (only if no apmode)
-    if(!apmode && WiFi.status() != WL_CONNECTED){
+    if(!apmode && !network.isLinkUp()){
       Serial.println("connection lost");
       // Non-blocking indicator: briefly mark a pixel without delay-based blocking
       ledmatrix.setMinIndicator(15, colors24bit[1]);
       ledmatrix.drawOnMatrixInstant();
-      // Attempt a reconnect without blocking
-      WiFi.reconnect();
     }
+  }
 
-    // Detect reconnection edge and refresh network-bound subsystems
-    static wl_status_t prevWiFiStatus = WL_DISCONNECTED;
-    wl_status_t currStatus = WiFi.status();
-    if (!apmode && prevWiFiStatus != currStatus && currStatus == WL_CONNECTED) {
+  // Single reconnect policy for the whole sketch (link loss and ghost connections)
+  if (!apmode) {
+    if (network.updateLink(WiFi.status() == WL_CONNECTED, millis())) {
       Serial.println("WiFi reconnected; refreshing multicast logger");
       logger.refreshInterface(WiFi.localIP());
       // Force weather refresh after reconnect
       weather.invalidateCache();
-      weather.invalidateCache();
     }
-    prevWiFiStatus = currStatus;
+    if (network.shouldReconnect(millis())) {
+      // Attempt a reconnect without blocking
+      LOG_WARN(logger, "Forcing WiFi reconnect (link %s, breaker %s)", network.isLinkUp() ? "up" : "down",
+                       NetworkHealth::getBreakerName(network.getBreakerState(millis())));
+      WiFi.reconnect();
+    }
   }
 
   // handle state behaviours (trigger loopCycles of different states depending on current state)
@@ -433,17 +579,8 @@ void loop() {
     lastStep = millis();
   }
 
-  // Handle Weather Updates
+  // Handle Weather Updates (failures open the breaker of the NetworkHealth, which requests a reconnect)
   weather.update();
-  
-  // Proactive WiFi Monitor: if weather service fails repeatedly despite "connected" status,
-  // it usually means a ghost connection. Force a reconnect.
-  if (!apmode && weather.getConsecutiveFailures() >= 3) {
-    Serial.println("Weather client failed 3 times; forcing WiFi reconnect");
-    logger.logString("Connectivity check failed; forcing WiFi reconnect");
-    WiFi.reconnect();
-    weather.invalidateCache(); // reset to try again brand new
-  }
 
   // Handle Temperature Mode Timeout
   if (currentState == st_temperature) {
@@ -475,46 +612,56 @@ void loop() {
     lastStateChange = millis();
   }
 
-  // NTP time update
+  // keep the wall-clock time in RTC memory for restarts which are not initiated by restartClock() (exceptions, watchdog)
+  if(millis() - lastRTCTimeSave > PERIOD_RTCTIMESAVE){
+    saveTimeToRTC();
+    lastRTCTimeSave = millis();
+  }
+
+  // NTP sync signaled by the SNTP callback
+  if(timeSyncPending){
+    timeSyncPending = false;
+    handleTimeSync();
+  }
+
   // Periodic NTP Status Log
   if(millis() - lastNTPUpdate > 3600000){ // Log every hour
-    time_t now = time(nullptr);
-    struct tm* timeinfo = localtime(&now);
-    if (timeinfo->tm_year > 70) { // Check if synced
-      logger.logPrintf("NTP Status: OK, Time: %02d:%02d:%02d", timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
-      lastNTPUpdate = millis();
-      updateBrightnessAndNightMode();
+    if (timeSync.isSynced()) {
+      LOG_INFO(logger, "NTP Status: OK, last sync %lus ago, drift %ldppb", (unsigned long)timeSync.getSecondsSinceLastSync(micros64()), (long)timeSync.getDriftPpb());
     } else {
-      logger.logString("NTP Status: Not yet synced");
+      LOG_INFO(logger, "NTP Status: Not yet synced");
       // configTime handles retries automatically
     }
+    lastNTPUpdate = millis();
   }
 
-  // check if nightmode need to be activated
-  if(millis() - lastNightmodeCheck > PERIOD_NIGHTMODECHECK){
+  // fade brightness every second while the nightmode curve is ramping (edges are triggered by the calendar)
+  if(brightnessRamping && millis() - lastNightmodeCheck > PERIOD_NIGHTMODECHECK){
     updateBrightnessAndNightMode();
     lastNightmodeCheck = millis();
   }
 
-  // Check if it's time to display a random message
-  if(millis() - lastRandomMessageCheck > 1000) { // Check every second
-    lastRandomMessageCheck = millis();
-    
-    // Get current time components
-    time_t now = time(nullptr);
-    struct tm* timeinfo = localtime(&now);
-    uint8_t hours = timeinfo->tm_hour;
-    uint8_t minutes = timeinfo->tm_min;
-    uint8_t seconds = timeinfo->tm_sec;
-    
-    // Check if we should start displaying a random message
-    if(!randomMessageActive && !nightMode && !ledOff && shouldDisplayRandomMessage(hours, minutes, seconds)) {
-      // Force a time update so the background clock shows the NEW minute
-      updateStateBehavior(currentState);
-      ledmatrix.drawOnMatrixInstant(); 
+  // Time-triggered events: random message, 18:07 animation, nightmode edges
+  time_t now = time(nullptr);
+  if(!timeEventsScheduled || now < lastCalendarCheck){
+    // (re)fill the calendar once the time is valid or if the clock was stepped backwards
+    if(now >= MIN_VALID_EPOCH){
+      scheduleTimeEvents(now);
+    }
+  }
+  else if(calendar.isDue(now)){
+    handleCalendarEvents(now);
+  }
+  lastCalendarCheck = now;
 
-      randomMessageActive = true;
-      displayRandomMessage(true); // Initialize the message display
+  // 18:07 event that fired while another state was shown: start it once the clock is back
+  if(siebenSechsPendingUntil != 0){
+    if(now > siebenSechsPendingUntil){
+      siebenSechsPendingUntil = 0;
+    }
+    else if(currentState == st_clock){
+      siebenSechsPendingUntil = 0;
+      startSiebenSechsAnimation();
     }
   }
   
@@ -539,6 +686,46 @@ void loop() {
 //                                        OTHER FUNCTIONS
 // ----------------------------------------------------------------------------------
 
+/**
+ * @brief Send a binary telemetry frame on the multicast log group and start a new latency interval
+ * 
+ */
+void sendTelemetry(){
+  uint32_t nowMs = millis();
+  uint32_t frames = ledmatrix.getFrameCount();
+  TelemetryFrame frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.state = currentState;
+  frame.rssi = network.isLinkUp() ? WiFi.RSSI() : 0;
+  frame.chipId = ESP.getChipId();
+  frame.sequence = telemetrySequence++;
+  frame.uptimeSeconds = nowMs / 1000;
+  frame.loops = loopCount;
+  frame.frames = frames;
+  frame.reconnects = network.getReconnectCount();
+  frame.breakerOpened = network.getBreakerOpenCount();
+  frame.logDropped = logger.getDropped();
+  frame.stallMillis = network.getStallMillis();
+  frame.freeHeap = ESP.getFreeHeap();
+  frame.maxFreeBlock = ESP.getMaxFreeBlockSize();
+  frame.heapFragmentation = ESP.getHeapFragmentation();
+  frame.flags = (network.isLinkUp() ? TELEMETRY_FLAG_LINK : 0) | (timeSync.isSynced() ? TELEMETRY_FLAG_SYNCED : 0) |
+                (nightMode ? TELEMETRY_FLAG_NIGHTMODE : 0) | (ledOff ? TELEMETRY_FLAG_LEDOFF : 0);
+  if(telemetryMillis != 0 && nowMs > telemetryMillis){
+    frame.fpsX10 = (uint64_t)(frames - telemetryFrames) * 10000 / (nowMs - telemetryMillis);
+  }
+  frame.loopP50 = loopLatency.getPercentile(50);
+  frame.loopP90 = loopLatency.getPercentile(90);
+  frame.loopP99 = loopLatency.getPercentile(99);
+  frame.loopMax = loopLatency.getMax();
+  Telemetry::encode(&frame);
+  logger.sendBinary((const uint8_t*)&frame, sizeof(frame));
+
+  loopLatency.reset();
+  telemetryFrames = frames;
+  telemetryMillis = nowMs;
+}
+
 /**
  * @brief Update mode behaviour depending on current state
  */
@@ -557,47 +744,19 @@ void updateStateBehavior(uint8_t state){
           filterFactor = DEFAULT_SMOOTHING_FACTOR;
           behaviorUpdatePeriod = PERIOD_TIMEVISUUPDATE;
         }
-        time_t now = time(nullptr);
-        struct tm* timeinfo = localtime(&now);
-        uint8_t hours = timeinfo->tm_hour;
-        uint8_t minutes = timeinfo->tm_min;
-        if (hours == 18 && minutes == 7) {
-          if (!siebenSechsAnimActive && !siebenSechsAnimDone) {
-             siebenSechsAnimActive = true;
-             siebenSechsAnimStart = millis();
-          }
-          
-          if (siebenSechsAnimActive) {
-             bool done = animateSiebenSechs(millis() - siebenSechsAnimStart);
-             if (done) {
-               siebenSechsAnimActive = false;
-               siebenSechsAnimDone = true;
-               // Force a redraw of the clock immediately after animation ends
-               // by falling through to the normal clock update below?
-               // Actually we should probably just let the next cycle handle it,
-               // but to be smooth, let's just clear for this frame or re-enter standard clock.
-               entryAction(st_clock); 
-             }
-          } else {
-             // Animation done, show normal time
-             // We need to duplicate the normal clock logic here or fall through?
-             // The original plan: "If done: Show normal time."
-             // So we should copy the logic from the else block.
-             static uint8_t lastMinutes = 0;
-             static String timeAsString = "";
-             // Force update since we just came back from animation
-             timeAsString = timeToString(hours, minutes);
-             lastMinutes = minutes;
-             
-             showStringOnClock(timeAsString, maincolor_clock);
-             drawMinuteIndicator(minutes, maincolor_clock);
+        if (siebenSechsAnimActive) {
+          // 18:07 animation started by the calendar
+          bool done = animateSiebenSechs(millis() - siebenSechsAnimStart);
+          if (done) {
+            siebenSechsAnimActive = false;
+            // Force a redraw of the clock with the next cycle
+            entryAction(st_clock);
           }
         } else {
-          // Reset done flag if not 18:07
-          if (siebenSechsAnimDone) {
-             siebenSechsAnimDone = false;
-          }
-          
+          time_t now = time(nullptr);
+          struct tm* timeinfo = localtime(&now);
+          uint8_t hours = timeinfo->tm_hour;
+          uint8_t minutes = timeinfo->tm_min;
           static uint8_t lastMinutes = 0;
           static String timeAsString = "";
           if(lastMinutes != minutes){
@@ -697,7 +856,8 @@ void updateStateBehavior(uint8_t state){
              ledmatrix.gridAddPixel(circleX[pos], circleY[pos], color);
            }
          } else {
-           // Normal weather display
+           // Normal weather display: the forecast for the next noon (today until 12:00, then tomorrow),
+           // kept on purpose together with the daily sunshine. The current hour is at /data?key=weather (tempNow).
            time_t now = time(nullptr);
            struct tm* timeinfo = localtime(&now);
            bool tomorrow = (timeinfo->tm_hour >= 12);
@@ -720,15 +880,53 @@ void updateStateBehavior(uint8_t state){
 }
 
 /**
- * @brief Check if nightmode should be activated and handle brightness transitions
- * 
+ * @brief Compile the nightmode settings into the daily brightness curve.
+ *        Needs to be called whenever nightmode settings or brightness change.
  */
+void rebuildBrightnessSchedule(){
+  if (nightModeActivated && nightModeSolar && solarDawnMin >= 0) {
+    // night starts at the end of dusk and ends at the begin of dawn
+    brightnessSchedule.compileNightMode(solarDuskMin, solarDawnMin, NIGHTMODE_TRANSITION_MIN, brightness);
+  } else if (nightModeActivated) {
+    brightnessSchedule.compileNightMode(nightModeStartHour * 60 + nightModeStartMin,
+                                        nightModeEndHour * 60 + nightModeEndMin,
+                                        NIGHTMODE_TRANSITION_MIN, brightness);
+  } else {
+    brightnessSchedule.compileConstant(brightness);
+  }
+}
+
 /**
- * @brief Helper function to check if time t is between a and b, handling wrap-around
+ * @brief Calculate dawn and dusk (civil twilight) of the current local day for the configured location.
+ *        On days without a twilight (polar day/night) the fixed nightmode times are used.
+ * 
+ * @param now current epoch (needs to be a valid time)
  */
-bool isBetween(int t, int a, int b) {
-  if (a <= b) return t >= a && t < b;
-  else return t >= a || t < b; 
+void updateSolarTimes(time_t now){
+  int32_t latE4, lonE4;
+  getLocationE4(&latE4, &lonE4);
+  solarCalc.setLocation(latE4, lonE4);
+
+  struct tm today;
+  localtime_r(&now, &today);
+  int32_t dawnUtc, duskUtc;
+  if(solarCalc.calcTwilight(today.tm_year + 1900, today.tm_yday + 1, &dawnUtc, &duskUtc) != solar_normal){
+    solarDawnMin = -1;
+    solarDuskMin = -1;
+    LOG_INFO(logger, "No civil twilight today, using fixed nightmode times");
+    return;
+  }
+
+  time_t midnight = SolarCalc::utcMidnight(today.tm_year + 1900, today.tm_yday + 1);
+  time_t dawn = midnight + dawnUtc;
+  time_t dusk = midnight + duskUtc;
+  struct tm t;
+  localtime_r(&dawn, &t);
+  solarDawnMin = t.tm_hour * 60 + t.tm_min;
+  localtime_r(&dusk, &t);
+  solarDuskMin = t.tm_hour * 60 + t.tm_min;
+  LOG_INFO(logger, "Civil dawn: " + leadingZero2Digit(solarDawnMin / 60) + ":" + leadingZero2Digit(solarDawnMin % 60) +
+                   ", dusk: " + leadingZero2Digit(solarDuskMin / 60) + ":" + leadingZero2Digit(solarDuskMin % 60));
 }
 
 /**
@@ -743,20 +941,18 @@ void updateBrightnessAndNightMode(){
   if (timeinfo->tm_year < 120) { // tm_year is years since 1900. 120 = 2020.
       if (nightMode) {
          nightMode = false;
-         logger.logString("Time invalid (<2020), forcing Day Mode");
+         LOG_WARN(logger, "Time invalid (<2020), forcing Day Mode");
          ledmatrix.setBrightness(brightness); // Restore full brightness
       }
       return; 
   }
 
-  int hours = timeinfo->tm_hour;
-  int minutes = timeinfo->tm_min;
-  
   bool previousNightMode = nightMode;
-  bool nextNightMode = false; // Default to active (Day mode)
 
   // If night mode is not activated in settings, ensure full brightness and return
   if (!nightModeActivated) {
+    brightnessRamping = false;
+    calendar.cancel(ev_nightmode);
     if (nightMode) {
        // Transitioning from Night Mode (stale state) to Manual Deactivation
        nightMode = false;
@@ -776,54 +972,469 @@ void updateBrightnessAndNightMode(){
     return;
   }
 
-  // Convert all times to minutes for easier comparison
-  int currentTimeInMinutes = hours * 60 + minutes;
-  int startInMinutes = nightModeStartHour * 60 + nightModeStartMin;
-  int endInMinutes = nightModeEndHour * 60 + nightModeEndMin;
-
-  // Duration of fade in/out in minutes
-  const int transitionDuration = 30;
-
-  // Calculate generic intervals
-  int sunsetEnd = (startInMinutes + transitionDuration) % 1440;
-  int sunriseEnd = (endInMinutes + transitionDuration) % 1440;
-
-  // 1. Check Night Mode (Strict OFF)
-  if (isBetween(currentTimeInMinutes, sunsetEnd, endInMinutes)) {
-      nextNightMode = true;
-  }
-  // 2. Check Sunset (Fade Out)
-  else if (isBetween(currentTimeInMinutes, startInMinutes, sunsetEnd)) {
-      int elapsed = currentTimeInMinutes - startInMinutes;
-      if (elapsed < 0) elapsed += 1440;
-      float progress = (float)elapsed / transitionDuration;
-      uint8_t newBrightness = (uint8_t)(brightness * (1.0 - progress));
-      ledmatrix.setBrightness(newBrightness);
-      nextNightMode = false;
-  }
-  // 3. Check Sunrise (Fade In)
-  else if (isBetween(currentTimeInMinutes, endInMinutes, sunriseEnd)) {
-      int elapsed = currentTimeInMinutes - endInMinutes;
-      if (elapsed < 0) elapsed += 1440;
-      float progress = (float)elapsed / transitionDuration;
-      uint8_t newBrightness = (uint8_t)(brightness * progress);
-      ledmatrix.setBrightness(newBrightness);
-      nextNightMode = false;
-  }
-  // 4. Day Mode
-  else {
-      ledmatrix.setBrightness(brightness);
-      nextNightMode = false;
-  }
-  
-  nightMode = nextNightMode;
+  // Read brightness for the current second from the precompiled curve (fades are interpolated per second)
+  uint32_t secondOfDay = timeinfo->tm_hour * 3600UL + timeinfo->tm_min * 60UL + timeinfo->tm_sec;
+  uint8_t newBrightness = brightnessSchedule.levelAt(secondOfDay);
+  ledmatrix.setBrightness(newBrightness);
+
+  // Wake up again at the next edge of the curve, in between only poll while fading
+  brightnessRamping = brightnessSchedule.isRamping(secondOfDay);
+  calendar.schedule(ev_nightmode, now + brightnessSchedule.secondsToNextPoint(secondOfDay), 0);
+
+  // Night Mode (Strict OFF) between the end of the fade out and the start of the fade in,
+  // not in the first seconds of the fade in which still round to zero
+  nightMode = brightnessSchedule.isNight(secondOfDay);
 
   if (nightMode != previousNightMode) {
-    logger.logString("Nightmode state changed: " + String(nightMode ? "Active (OFF)" : "Inactive (ON)"));
-    logger.logString("Current Time: " + String(hours) + ":" + String(minutes));
+    LOG_INFO(logger, "Nightmode state changed: " + String(nightMode ? "Active (OFF)" : "Inactive (ON)"));
+    LOG_INFO(logger, "Current Time: " + String(timeinfo->tm_hour) + ":" + String(timeinfo->tm_min));
+  }
+}
+
+/**
+ * @brief Callback of the SNTP client after the system time was set.
+ *        Runs in the system context, so only the timestamps are captured here.
+ * 
+ * @param fromSntp true if the time was set by SNTP
+ */
+void onTimeSync(bool fromSntp){
+  if(!fromSntp) return;
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  timeSyncEpochMicros = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+  timeSyncMonotonicMicros = micros64();
+  timeSyncPending = true;
+}
+
+/**
+ * @brief Handle a finished NTP sync: update statistics, refill the calendar for the corrected time
+ *        and draw the correct time immediately instead of waiting for the next update period
+ */
+void handleTimeSync(){
+  bool firstSync = !timeSync.isSynced();
+  timeSync.recordSync(timeSyncEpochMicros, timeSyncMonotonicMicros);
+  if(firstSync){
+    LOG_INFO(logger, "NTP first sync after %lums", (unsigned long)timeSync.getTimeToFirstSyncMillis());
+  }
+  else{
+    LOG_INFO(logger, "NTP sync #%lu, correction %ldus, drift %ldppb", (unsigned long)timeSync.getSyncCount(),
+                     (long)timeSync.getLastCorrectionMicros(), (long)timeSync.getDriftPpb());
+  }
+
+  time_t now = time(nullptr);
+  if(now < MIN_VALID_EPOCH) return;
+  scheduleTimeEvents(now);
+  lastCalendarCheck = now;
+
+  if(!nightMode && !ledOff && !randomMessageActive && (currentState == st_clock || currentState == st_diclock)){
+    updateStateBehavior(currentState);
+    ledmatrix.drawOnMatrixInstant();
+    lastStep = millis();
+  }
+}
+
+/**
+ * @brief Save the current wall-clock time and the RTC counter to RTC user memory (survives soft restarts)
+ * 
+ */
+void saveTimeToRTC(){
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if(tv.tv_sec < MIN_VALID_EPOCH) return;
+  RtcTimeRecord record;
+  RtcTime::encode(&record, (int64_t)tv.tv_sec * 1000000 + tv.tv_usec, system_get_rtc_time(), system_rtc_clock_cali_proc());
+  ESP.rtcUserMemoryWrite(RTC_TIME_BLOCK, (uint32_t*)&record, sizeof(record));
+}
+
+/**
+ * @brief Restore the wall-clock time saved by saveTimeToRTC() after a software or watchdog restart
+ * 
+ * @return true if the time was restored
+ */
+bool restoreTimeFromRTC(){
+  uint32_t reason = ESP.getResetInfoPtr()->reason;
+  if(reason != REASON_SOFT_RESTART && reason != REASON_EXCEPTION_RST && reason != REASON_SOFT_WDT_RST && reason != REASON_WDT_RST){
+    return false;
+  }
+  RtcTimeRecord record;
+  int64_t epochMicros;
+  if(!ESP.rtcUserMemoryRead(RTC_TIME_BLOCK, (uint32_t*)&record, sizeof(record)) ||
+     !RtcTime::decode(&record, system_get_rtc_time(), system_rtc_clock_cali_proc(), RTC_TIME_MAX_AGE_S, &epochMicros)){
+    LOG_INFO(logger, "No valid time in RTC memory");
+    return false;
+  }
+  struct timeval tv;
+  tv.tv_sec = epochMicros / 1000000;
+  tv.tv_usec = epochMicros % 1000000;
+  settimeofday(&tv, nullptr);
+  setenv("TZ", TZ_INFO, 1);
+  tzset();
+  LOG_INFO(logger, "Time restored from RTC memory: " + String((unsigned long)tv.tv_sec));
+  return true;
+}
+
+/**
+ * @brief Write the changed part of the log tail to RTC user memory
+ * 
+ */
+void writeCrashTailToRTC(){
+  uint8_t firstWord;
+  uint8_t wordCount;
+  if(crashTail.getDirty(&firstWord, &wordCount)){
+    ESP.rtcUserMemoryWrite(CRASH_RTC_BLOCK + firstWord, crashTail.getWords() + firstWord, wordCount * 4);
+    crashTail.clearDirty();
+  }
+}
+
+/**
+ * @brief Mirror of the logger: keep every log line in the tail in RTC memory
+ * 
+ * @param line log line without prefix
+ * @param length length of the line
+ */
+void mirrorLogToRTC(const char *line, size_t length){
+  crashTail.append(line, length);
+  crashTail.append("\n", 1);
+  writeCrashTailToRTC();
+}
+
+/**
+ * @brief Restore the log tail from RTC memory. After an exception or watchdog reset it is saved
+ *        with the reset info as a record in the crash file (LittleFS must be mounted).
+ * 
+ */
+void setupCrashLog(){
+  ESP.rtcUserMemoryRead(CRASH_RTC_BLOCK, crashTail.getWords(), CRASH_RTC_WORDS * 4);
+  bool tailValid = crashTail.restore();
+  struct rst_info *resetInfo = ESP.getResetInfoPtr();
+  bool crashed = resetInfo->reason == REASON_EXCEPTION_RST || resetInfo->reason == REASON_SOFT_WDT_RST || resetInfo->reason == REASON_WDT_RST;
+  if(crashed && tailValid && saveCrashRecord(resetInfo)){
+    crashTail.clear();
+  }
+  writeCrashTailToRTC();
+  logger.setMirror(mirrorLogToRTC);
+  LOG_INFO(logger, "Boot, reset reason: %s", CrashLog::getReasonName(resetInfo->reason));
+}
+
+/**
+ * @brief Write the log tail and the reset info into the next slot of the crash file
+ * 
+ * @param resetInfo info of the last reset
+ * @return true if the record was written
+ */
+bool saveCrashRecord(struct rst_info *resetInfo){
+  // preallocate the file, records are written as whole slots (no growth, bounded flash wear)
+  if(!LittleFS.exists(CRASH_FILE) || LittleFS.open(CRASH_FILE, "r").size() != CRASH_FILE_SIZE){
+    File file = LittleFS.open(CRASH_FILE, "w");
+    if(!file) return false;
+    uint8_t empty[64] = {0};
+    for(uint32_t i = 0; i < CRASH_FILE_SIZE / sizeof(empty); i++){
+      file.write(empty, sizeof(empty));
+    }
+    file.close();
+  }
+  File file = LittleFS.open(CRASH_FILE, "r+");
+  if(!file) return false;
+  // next sequence number after the newest record
+  uint32_t sequence = 0;
+  for(uint32_t slot = 0; slot < CRASH_SLOT_COUNT; slot++){
+    uint32_t header[2];
+    file.seek(slot * CRASH_SLOT_SIZE, SeekSet);
+    if(file.read((uint8_t*)header, sizeof(header)) == sizeof(header) && header[0] == CRASH_RECORD_MAGIC && header[1] + 1 > sequence){
+      sequence = header[1] + 1;
+    }
+  }
+  CrashRecord *record = new CrashRecord;
+  time_t now = time(nullptr);
+  CrashLog::makeRecord(record, sequence, now >= MIN_VALID_EPOCH ? (uint32_t)now : 0, resetInfo->reason, resetInfo->exccause,
+                       resetInfo->epc1, resetInfo->excvaddr, &crashTail);
+  file.seek(CrashLog::slotOffset(sequence), SeekSet);
+  bool written = file.write((const uint8_t*)record, sizeof(CrashRecord)) == sizeof(CrashRecord);
+  file.close();
+  delete record;
+  return written;
+}
+
+/**
+ * @brief Stream the crash records (newest first) and the current log tail as text,
+ *        one record at a time (not loaded into RAM as a whole)
+ * 
+ */
+void sendCrashLog(){
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain", "");
+  char line[128];
+  File file = LittleFS.open(CRASH_FILE, "r");
+  if(file){
+    // newest record
+    int64_t newest = -1;
+    for(uint32_t slot = 0; slot < CRASH_SLOT_COUNT; slot++){
+      uint32_t header[2];
+      file.seek(slot * CRASH_SLOT_SIZE, SeekSet);
+      if(file.read((uint8_t*)header, sizeof(header)) == sizeof(header) && header[0] == CRASH_RECORD_MAGIC && (int64_t)header[1] > newest){
+        newest = header[1];
+      }
+    }
+    CrashRecord *record = new CrashRecord;
+    for(int64_t sequence = newest; sequence >= 0 && sequence > newest - CRASH_SLOT_COUNT; sequence--){
+      file.seek(CrashLog::slotOffset(sequence), SeekSet);
+      if(file.read((uint8_t*)record, sizeof(CrashRecord)) != sizeof(CrashRecord) || !CrashLog::isValid(record) || record->sequence != sequence){
+        continue;
+      }
+      snprintf(line, sizeof(line), "=== crash #%lu, epoch %lu, %s, exccause %lu, epc1 0x%08lx, excvaddr 0x%08lx ===\n",
+               (unsigned long)record->sequence, (unsigned long)record->epoch, CrashLog::getReasonName(record->reason),
+               (unsigned long)record->exccause, (unsigned long)record->epc1, (unsigned long)record->excvaddr);
+      server.sendContent(line);
+      server.sendContent(record->text, record->length);
+    }
+    delete record;
+    file.close();
+  }
+  server.sendContent("=== log tail (RTC memory) ===\n");
+  char tail[CRASH_TAIL_SIZE];
+  server.sendContent(tail, crashTail.copyTo(tail, sizeof(tail)));
+  server.sendContent("");
+}
+
+/**
+ * @brief Load the ETags of the web UI files in LittleFS (written by scripts/build_web_assets.py)
+ *        and check which files of the web bundle are replaced by files in LittleFS
+ * 
+ */
+void loadWebAssets(){
+  assetManifest.clear();
+  File file = LittleFS.open(WEB_ASSET_MANIFEST, "r");
+  if(file){
+    char line[WEB_ASSET_LINE];
+    while(file.available()){
+      size_t length = file.readBytesUntil('\n', line, sizeof(line) - 1);
+      line[length] = '\0';
+      assetManifest.parseLine(line);
+    }
+    file.close();
+  }
+  bundleOverrides = 0;
+  uint8_t overrides = 0;
+  char path[WEB_ASSET_LINE];
+  for(uint8_t i = 0; i < WebBundle::getCount(); i++){
+    WebBundle::getPath(i, path, sizeof(path));
+    if(LittleFS.exists(path) || LittleFS.exists(String(path) + ".gz")){
+      bundleOverrides |= 1UL << i;
+      overrides++;
+    }
+  }
+  LOG_INFO(logger, "Web assets: %u in manifest, %u of %u bundled files replaced by LittleFS",
+           assetManifest.getCount(), overrides, WebBundle::getCount());
+}
+
+/**
+ * @brief Answer 304 if the client has the current version of a file already
+ * 
+ * @param etag ETag of the file
+ * @param gzip ETag of the gzip variant (for the statistics)
+ * @param start millis() of the start of the response
+ * @return true if 304 was sent
+ */
+bool sendNotModified(const char *etag, bool gzip, uint32_t start){
+  if(!AssetManifest::matches(server.header("If-None-Match").c_str(), etag)) return false;
+  server.send(304);
+  assetStats.record(0, millis() - start, true, gzip);
+  return true;
+}
+
+/**
+ * @brief Send a web UI file, from LittleFS if it is stored there (user override), else from
+ *        the web bundle in flash
+ * 
+ * @param path path of the uncompressed file
+ * @return true if the file exists
+ */
+bool sendStaticFile(const String &path){
+  uint32_t start = millis();
+  int8_t bundled = WebBundle::find(path.c_str());
+  if(bundled >= 0 && !(bundleOverrides & (1UL << bundled))) return sendBundledFile(bundled, path, start);
+  return sendFileFromFS(path, start);
+}
+
+/**
+ * @brief Send a file of the web bundle (gzip) directly from flash, no filesystem access.
+ *        The bundle has only the gzip variants, clients which do not accept gzip get 406
+ *        (a bundled file is only used if LittleFS has no copy of it).
+ * 
+ * @param index index of the file in the bundle
+ * @param path path of the uncompressed file (for the content type)
+ * @param start millis() of the start of the response
+ * @return true
+ */
+bool sendBundledFile(uint8_t index, const String &path, uint32_t start){
+  server.sendHeader("Vary", "Accept-Encoding");
+  if(!AssetManifest::acceptsGzip(server.header("Accept-Encoding").c_str())){
+    server.send(406, "text/plain", "Not Acceptable: only available with Accept-Encoding: gzip");
+    return true;
+  }
+  WebBundleEntry entry;
+  WebBundle::getEntry(index, &entry);
+  char etag[WEB_ETAG_SIZE];
+  WebBundle::getETag(entry, etag);
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", AssetManifest::getCacheControl(path.c_str()));
+  if(sendNotModified(etag, true, start)) return true;
+  server.sendHeader("Content-Encoding", "gzip");
+  server.setContentLength(entry.length);
+  server.send(200, mime::getContentType(path).c_str(), "");
+  uint32_t sent = 0;
+  if(server.method() != HTTP_HEAD){
+    server.sendContent_P(WebBundle::getData(entry), entry.length);
+    sent = entry.length;
+  }
+  assetStats.record(sent, millis() - start, false, true);
+  return true;
+}
+
+/**
+ * @brief Send a file of LittleFS, the gzip variant if there is one, with ETag and Cache-Control
+ *        if the file is in the asset manifest (304 if the client has it already)
+ * 
+ * @param path path of the uncompressed file
+ * @param start millis() of the start of the response
+ * @return true if the file exists
+ */
+bool sendFileFromFS(const String &path, uint32_t start){
+  File file = LittleFS.open(path, "r");
+  uint32_t size = file ? file.size() : WEB_SIZE_UNKNOWN;
+  String gzipPath = path + ".gz";
+  char etag[WEB_ETAG_SIZE];
+  // the gzip variant is only used if it belongs to the current file (manifest entry with its size)
+  bool hasETag = assetManifest.getETag(path.c_str(), size, false, etag);
+  bool hasGzip = (hasETag || !file) && LittleFS.exists(gzipPath);
+  bool gzip = hasGzip && (!file || AssetManifest::acceptsGzip(server.header("Accept-Encoding").c_str()));
+  if(gzip){
+    if(file) file.close();
+    file = LittleFS.open(gzipPath, "r");
+    hasETag = assetManifest.getETag(path.c_str(), size, true, etag);
+  }
+  if(!file) return false;
+  if(hasETag){
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", AssetManifest::getCacheControl(path.c_str()));
+  }
+  if(hasGzip) server.sendHeader("Vary", "Accept-Encoding");
+  if(hasETag && sendNotModified(etag, gzip, start)){
+    file.close();
+    return true;
+  }
+  if(gzip) server.sendHeader("Content-Encoding", "gzip");
+  uint32_t length = file.size();
+  server.setContentLength(length);
+  server.send(200, mime::getContentType(path).c_str(), "");
+  uint32_t sent = 0;
+  if(server.method() != HTTP_HEAD){
+    // larger writes than streamFile(), fewer and fuller TCP segments
+    uint8_t *buffer = new uint8_t[WEB_SEND_BUFFER];
+    while(sent < length){
+      int count = file.read(buffer, WEB_SEND_BUFFER);
+      if(count <= 0) break;
+      server.sendContent((const char*)buffer, count);
+      sent += count;
+    }
+    delete[] buffer;
+  }
+  file.close();
+  assetStats.record(sent, millis() - start, false, gzip);
+  return true;
+}
+
+/**
+ * @brief Restart the ESP and keep the current time in RTC memory
+ * 
+ */
+void restartClock(){
+  saveTimeToRTC();
+  logger.flush();
+  ESP.restart();
+}
+
+/**
+ * @brief Fill the calendar with the next fire time of every time-triggered feature
+ * 
+ * @param now current epoch (needs to be a valid time)
+ */
+void scheduleTimeEvents(time_t now){
+  calendar.clear();
+  calendar.schedule(ev_randommessage, nextRandomMessageTime(now, false), 60);
+  calendar.schedule(ev_siebensechs, EventCalendar::nextDailyOccurrence(now, 18, 7, 0), 59);
+  calendar.schedule(ev_solar, EventCalendar::nextDailyOccurrence(now, 0, 5, 0), 0);
+  updateSolarTimes(now);
+  rebuildBrightnessSchedule();
+  updateBrightnessAndNightMode(); // schedules ev_nightmode
+  timeEventsScheduled = true;
+}
+
+/**
+ * @brief Handle all due calendar events in fire time order. Events delayed by a loop stall
+ *        are still delivered, the ones delayed beyond their grace period are skipped.
+ * 
+ * @param now current epoch
+ */
+void handleCalendarEvents(time_t now){
+  bool missed = false;
+  time_t fireTime = 0;
+  int16_t id;
+  while((id = calendar.popDue(now, &missed, &fireTime)) >= 0){
+    switch(id){
+      case ev_randommessage: {
+        // next slot in the hour after the due one, so a late delivery does not shift the schedule
+        time_t next = nextRandomMessageTime(fireTime, true);
+        if(next <= now) next = nextRandomMessageTime(now, false);
+        calendar.schedule(ev_randommessage, next, 60);
+        if(missed){
+          LOG_WARN(logger, "Random message skipped (fire time missed)");
+        }
+        else if(!randomMessageActive && !nightMode && !ledOff){
+          // Force a time update so the background clock shows the NEW minute
+          updateStateBehavior(currentState);
+          ledmatrix.drawOnMatrixInstant(); 
+
+          randomMessageActive = true;
+          displayRandomMessage(true); // Initialize the message display
+        }
+        break;
+      }
+      case ev_siebensechs:
+        calendar.schedule(ev_siebensechs, EventCalendar::nextDailyOccurrence(now, 18, 7, 0), 59);
+        if(missed) break;
+        if(currentState == st_clock){
+          startSiebenSechsAnimation();
+        }
+        else{
+          // keep it pending for the rest of the grace period, the loop starts it in st_clock
+          siebenSechsPendingUntil = fireTime + 59;
+        }
+        break;
+      case ev_nightmode:
+        updateBrightnessAndNightMode(); // schedules the next edge
+        break;
+      case ev_solar:
+        // recalculate twilight once per day (also after a stall, the result is still needed)
+        calendar.schedule(ev_solar, EventCalendar::nextDailyOccurrence(now, 0, 5, 0), 0);
+        updateSolarTimes(now);
+        rebuildBrightnessSchedule();
+        updateBrightnessAndNightMode();
+        break;
+    }
   }
 }
 
+/**
+ * @brief Start the 18:07 animation (drawn by the st_clock behavior)
+ * 
+ */
+void startSiebenSechsAnimation(){
+  if(siebenSechsAnimActive) return;
+  siebenSechsAnimActive = true;
+  siebenSechsAnimStart = millis();
+}
+
 /**
  * @brief call entry action of given state
  * 
@@ -904,7 +1515,7 @@ void stateChange(uint8_t newState, bool persistant){
   // set new state
   currentState = newState;
   entryAction(currentState);
-  logger.logString("State change to: " + stateNames[currentState]);
+  LOG_INFO(logger, "State change to: " + stateNames[currentState]);
   if(persistant){
     // save state to EEPROM
     EEPROM.write(ADR_STATE, currentState);
@@ -964,13 +1575,15 @@ void loadNightmodeSettingsFromEEPROM()
   nightModeEndHour = EEPROM.read(ADR_NM_END_H);
   nightModeEndMin = EEPROM.read(ADR_NM_END_M);
   nightModeActivated = EEPROM.read(ADR_NM_ACTIVATED);
+  nightModeSolar = (EEPROM.read(ADR_NM_SOLAR) == 1);
   if(nightModeStartHour > 23) nightModeStartHour = 22;
   if(nightModeStartMin > 59) nightModeStartMin = 0;
   if(nightModeEndHour > 23) nightModeEndHour = 7;
   if(nightModeEndMin > 59) nightModeEndMin = 0;
-  logger.logString("Nightmode activated: " + String(nightModeActivated));
-  logger.logString("Nightmode starts at: " + String(nightModeStartHour) + ":" + String(nightModeStartMin));
-  logger.logString("Nightmode ends at: " + String(nightModeEndHour) + ":" + String(nightModeEndMin));
+  LOG_INFO(logger, "Nightmode activated: " + String(nightModeActivated));
+  LOG_INFO(logger, "Nightmode follows twilight: " + String(nightModeSolar));
+  LOG_INFO(logger, "Nightmode starts at: " + String(nightModeStartHour) + ":" + String(nightModeStartMin));
+  LOG_INFO(logger, "Nightmode ends at: " + String(nightModeEndHour) + ":" + String(nightModeEndMin));
 }
 
 /**
@@ -982,7 +1595,7 @@ void loadBrightnessSettingsFromEEPROM()
 {
   brightness = EEPROM.read(ADR_BRIGHTNESS);
   if(brightness < 10) brightness = 10;
-  logger.logString("Brightness: " + String(brightness));
+  LOG_INFO(logger, "Brightness: " + String(brightness));
   ledmatrix.setBrightness(brightness);
 }
 
@@ -994,69 +1607,101 @@ void loadColorShiftStateFromEEPROM()
 {
   dynColorShiftSpeed = EEPROM.read(ADR_COLSHIFTSPEED);
   if (dynColorShiftSpeed == 0) dynColorShiftSpeed = 1;
-  logger.logString("ColorShiftSpeed: " + String(dynColorShiftSpeed));
+  LOG_INFO(logger, "ColorShiftSpeed: " + String(dynColorShiftSpeed));
   dynColorShiftActive = EEPROM.read(ADR_COLSHIFTACTIVE);
-  logger.logString("ColorShiftActive: " + String(dynColorShiftActive));
+  LOG_INFO(logger, "ColorShiftActive: " + String(dynColorShiftActive));
 }
 
 /**
  * @brief Handler for POST requests to /leddirect.
  * 
  * Allows the control of all LEDs from external source. 
- * It will overwrite the normal program for 5 seconds.
- * A 11x11 picture can be sent as base64 encoded string to be displayed on matrix.
+ * It will overwrite the normal program for TIMEOUT_LEDDIRECT milliseconds.
+ * Either a binary frame (see led_frame.h, body sent as application/octet-stream) or a 11x11 picture
+ * as base64 encoded string (4 bytes per pixel, whole body or form field) is displayed on the matrix.
+ * Both are decoded by handleLEDDirectRaw() while the body is received, only multipart form data is
+ * decoded here. Responds with the achieved frames per second.
  * 
  */
 void handleLEDDirect() {
   if (server.method() != HTTP_POST) {
     server.send(405, "text/plain", "Method Not Allowed");
-  } else {
-    String message = "POST data was:\n";
-    /*logger.logString(message);
-    delay(10);
-    for (uint8_t i = 0; i < server.args(); i++) {
-      message += " " + server.argName(i) + ": " + server.arg(i) + "\n";
-      logger.logString(server.arg(i));
-      delay(10);
-    }*/
-    if(server.args() == 1){
-      String data = String(server.arg(0));
-      int dataLength = data.length();
-      
-      // Validate input size to prevent stack overflow (max 11x11 pixels * 4 bytes + base64 overhead)
-      const int MAX_BASE64_SIZE = 800;
-      if(dataLength > MAX_BASE64_SIZE || dataLength == 0) {
-        server.send(400, "text/plain", "Invalid data size");
-        return;
-      }
+    return;
+  }
+  uint8_t body = ledDirectBody;
+  ledDirectBody = ld_none;
+  if(body == ld_frame){
+    if(!ledFrameDecoder.finish()){
+      server.send(400, "text/plain", "Invalid frame");
+      return;
+    }
+  }
+  else if(body == ld_start || body == ld_base64){
+    // ld_start: empty body
+    if(body == ld_start || !ledBase64Decoder.finish()){
+      server.send(400, "text/plain", "Invalid data size");
+      return;
+    }
+  }
+  else if(server.args() == 1){
+    // multipart form data is parsed by the webserver, the base64 string is one argument
+    const String &data = server.arg(0);
+    ledBase64Decoder.reset(false);
+    ledBase64Decoder.feed((const uint8_t*)data.c_str(), data.length());
+    if(!ledBase64Decoder.finish()){
+      server.send(400, "text/plain", "Invalid data size");
+      return;
+    }
+  }
+  else{
+    server.send(400, "text/plain", "No frame");
+    return;
+  }
+  ledmatrix.drawOnMatrixInstant();
+  lastLEDdirect = millis();
+  ledDirectRate.record(lastLEDdirect);
+
+  String message = "{";
+  message += "\"frames\":\"" + String(ledDirectRate.getFrameCount()) + "\"";
+  message += ",";
+  uint16_t fpsX10 = ledDirectRate.getFpsX10(lastLEDdirect);
+  message += "\"fps\":\"" + String(fpsX10 / 10) + "." + String(fpsX10 % 10) + "\"";
+  message += "}";
+  server.send(200, "application/json", message);
+}
 
-      // base64 decoding with bounded buffer
-      char base64data[MAX_BASE64_SIZE + 1];
-      data.toCharArray(base64data, dataLength + 1);
-      int decodedLength = Base64.decodedLength(base64data, dataLength);
-      
-      // Validate decoded size
-      const int MAX_DECODED_SIZE = 600; // 11x11x4 = 484 + margin
-      if(decodedLength > MAX_DECODED_SIZE || decodedLength < 4) {
-        server.send(400, "text/plain", "Invalid decoded size");
-        return;
+/**
+ * @brief Raw body handler of /leddirect, decodes the body directly into the target grid
+ * 
+ * Called by the webserver while the body is received (before handleLEDDirect()) for all bodies except
+ * multipart form data. Binary frames (application/octet-stream, or starting with 'W' if the type is no
+ * form or text) go to ledFrameDecoder, all other bodies are the old base64 picture (whole body or
+ * form field), decoded 4 characters at a time by ledBase64Decoder.
+ * 
+ */
+void handleLEDDirectRaw() {
+  HTTPRaw& raw = server.raw();
+  if(raw.status == RAW_START){
+    ledDirectBody = ld_start;
+  }
+  else if(raw.status == RAW_WRITE){
+    if(ledDirectBody == ld_start && raw.currentSize > 0){
+      const String &type = server.header("Content-Type");
+      bool form = type.startsWith("application/x-www-form-urlencoded");
+      if(type.startsWith("application/octet-stream") || (!form && !type.startsWith("text/") && raw.buf[0] == LED_FRAME_MAGIC)){
+        ledFrameDecoder.reset();
+        ledDirectBody = ld_frame;
       }
-      
-      char byteArray[MAX_DECODED_SIZE];
-      Base64.decode(byteArray, base64data, dataLength);
-
-      // Use decodedLength (not dataLength) to iterate through decoded bytes
-      for(int i = 0; i < decodedLength; i += 4) {
-        uint8_t red = byteArray[i]; // red
-        uint8_t green = byteArray[i + 1]; // green
-        uint8_t blue = byteArray[i + 2]; // blue
-        ledmatrix.gridAddPixel((i/4) % WIDTH, (i/4) / HEIGHT, LEDMatrix::Color24bit(red, green, blue));
+      else{
+        ledBase64Decoder.reset(form);
+        ledDirectBody = ld_base64;
       }
-      ledmatrix.drawOnMatrixInstant();
-
-      lastLEDdirect = millis();
     }
-    server.send(200, "text/plain", message);
+    if(ledDirectBody == ld_frame) ledFrameDecoder.feed(raw.buf, raw.currentSize);
+    else if(ledDirectBody == ld_base64) ledBase64Decoder.feed(raw.buf, raw.currentSize);
+  }
+  else if(raw.status == RAW_ABORTED){
+    ledDirectBody = ld_none;
   }
 }
 
@@ -1079,19 +1724,19 @@ void handleButton(){
   if (lastButtonState == HIGH && currentButtonState == LOW) {
       buttonPressStart = millis();
       buttonWaitRelease = true;
-      logger.logString("Button Pressed");
+      LOG_DEBUG(logger, "Button Pressed");
   }
 
   // Release Detection (Rising Edge)
   if (lastButtonState == LOW && currentButtonState == HIGH && buttonWaitRelease) {
       long pressDuration = millis() - buttonPressStart;
       buttonWaitRelease = false;
-      logger.logString("Button Released, Duration: " + String(pressDuration));
+      LOG_DEBUG(logger, "Button Released, Duration: " + String(pressDuration));
 
       if (pressDuration > LONGPRESS) {
           // Long Press -> Reset
-          logger.logString("Long Press -> Reset");
-          ESP.restart();
+          LOG_INFO(logger, "Long Press -> Reset");
+          restartClock();
       } else if (pressDuration > SHORTPRESS) {
           // Short Press -> Register Click
           lastTempClickCount++;
@@ -1105,7 +1750,7 @@ void handleButton(){
   if (lastTempClickCount > 0 && (millis() - lastButtonRelease > DOUBLE_CLICK_TIME)) {
       if (lastTempClickCount == 1) {
           // Single Click -> Temperature Mode
-          logger.logString("Single Click Action -> Temp Mode");
+          LOG_INFO(logger, "Single Click Action -> Temp Mode");
           if (ledOff) {
              ledOff = false;
           } else if (currentState != st_temperature) {
@@ -1118,7 +1763,7 @@ void handleButton(){
           }
       } else {
           // Double (or more) Click -> Next Mode
-          logger.logString("Double Click Action -> Next Mode");
+          LOG_INFO(logger, "Double Click Action -> Next Mode");
           stateChange((currentState + 1) % (NUM_STATES - 1), true); // Skip st_temperature in normal cycle if desired, or include it?
           // User said "revert back to word clock mode after 5 seconds" for temp mode
           // And "If clicked twice, you enter the mode switch routine".
@@ -1142,8 +1787,7 @@ void handleButton(){
 void handleCommand() {
   // receive command and handle accordingly
   for (uint8_t i = 0; i < server.args(); i++) {
-    String log_str = "Command received: " + server.argName(i) + " " + server.arg(i);
-    logger.logString(log_str);
+    LOG_DEBUG(logger, "Command received: %s %s", server.argName(i).c_str(), server.arg(i).c_str());
   }
   
   if (server.argName(0) == "led") // the parameter which was sent to this server is led color
@@ -1152,17 +1796,17 @@ void handleCommand() {
     String redstr = split(colorstr, '-', 0);
     String greenstr= split(colorstr, '-', 1);
     String bluestr = split(colorstr, '-', 2);
-    logger.logString(colorstr);
-    logger.logString("r: " + String(redstr.toInt()));
-    logger.logString("g: " + String(greenstr.toInt()));
-    logger.logString("b: " + String(bluestr.toInt()));
+    LOG_DEBUG(logger, colorstr);
+    LOG_DEBUG(logger, "r: " + String(redstr.toInt()));
+    LOG_DEBUG(logger, "g: " + String(greenstr.toInt()));
+    LOG_DEBUG(logger, "b: " + String(bluestr.toInt()));
     // set new main color
     setMainColor(redstr.toInt(), greenstr.toInt(), bluestr.toInt());
   }
   else if (server.argName(0) == "mode") // the parameter which was sent to this server is mode change
   {
     String modestr = server.arg(0);
-    logger.logString("Mode change via Webserver to: " + modestr);
+    LOG_INFO(logger, "Mode change via Webserver to: " + modestr);
     // set current mode/state accordant sent mode
     if(modestr == "clock"){
       stateChange(st_clock, true);
@@ -1185,24 +1829,36 @@ void handleCommand() {
   }
   else if(server.argName(0) == "ledoff"){
     String modestr = server.arg(0);
-    logger.logString("LED off change via Webserver to: " + modestr);
+    LOG_INFO(logger, "LED off change via Webserver to: " + modestr);
     if(modestr == "1") ledOff = true;
     else ledOff = false;
   }
   else if(server.argName(0) == "nightmodeactivated"){
     String modestr = server.arg(0);
-    logger.logString("nightModeActivated change via Webserver to: " + modestr);
+    LOG_INFO(logger, "nightModeActivated change via Webserver to: " + modestr);
     if(modestr == "1") nightModeActivated = true;
     else nightModeActivated = false;
     EEPROM.write(ADR_NM_ACTIVATED, nightModeActivated);
     ESP.wdtFeed(); // Feed before commit
     EEPROM.commit();
     ESP.wdtFeed(); // Feed after commit
+    rebuildBrightnessSchedule();
+    updateBrightnessAndNightMode();
+  }
+  else if(server.argName(0) == "nightmodesolar"){
+    String modestr = server.arg(0);
+    LOG_INFO(logger, "nightModeSolar change via Webserver to: " + modestr);
+    nightModeSolar = (modestr == "1");
+    EEPROM.write(ADR_NM_SOLAR, nightModeSolar);
+    ESP.wdtFeed(); // Feed before commit
+    EEPROM.commit();
+    ESP.wdtFeed(); // Feed after commit
+    rebuildBrightnessSchedule();
     updateBrightnessAndNightMode();
   }
   else if(server.argName(0) == "setting"){
     String timestr = server.arg(0) + "-";
-    logger.logString("Nightmode setting change via Webserver to: " + timestr);
+    LOG_INFO(logger, "Nightmode setting change via Webserver to: " + timestr);
     nightModeStartHour = split(timestr, '-', 0).toInt();
     nightModeStartMin = split(timestr, '-', 1).toInt();
     nightModeEndHour = split(timestr, '-', 2).toInt();
@@ -1224,12 +1880,13 @@ void handleCommand() {
     ESP.wdtFeed(); // Feed before commit
     EEPROM.commit();
     ESP.wdtFeed(); // Feed after commit
-    logger.logString("Nightmode starts at: " + String(nightModeStartHour) + ":" + String(nightModeStartMin));
-    logger.logString("Nightmode ends at: " + String(nightModeEndHour) + ":" + String(nightModeEndMin));
-    logger.logString("Brightness: " + String(brightness));
-    logger.logString("ColorShiftSpeed: " + String(dynColorShiftSpeed));
+    LOG_INFO(logger, "Nightmode starts at: " + String(nightModeStartHour) + ":" + String(nightModeStartMin));
+    LOG_INFO(logger, "Nightmode ends at: " + String(nightModeEndHour) + ":" + String(nightModeEndMin));
+    LOG_INFO(logger, "Brightness: " + String(brightness));
+    LOG_INFO(logger, "ColorShiftSpeed: " + String(dynColorShiftSpeed));
     ledmatrix.setBrightness(brightness);
-    lastNightmodeCheck = millis()  - PERIOD_NIGHTMODECHECK;
+    rebuildBrightnessSchedule();
+    updateBrightnessAndNightMode();
   }
   else if(server.argName(0) == "resetwifi"){
     wifiManager.resetSettings();
@@ -1250,69 +1907,18 @@ void handleCommand() {
   }
   else if(server.argName(0) == "stateautochange"){
     String modestr = server.arg(0);
-    logger.logString("stateAutoChange change via Webserver to: " + modestr);
+    LOG_INFO(logger, "stateAutoChange change via Webserver to: " + modestr);
     if(modestr == "1") stateAutoChange = true;
     else stateAutoChange = false;
   }
-  else if(server.argName(0) == "tetris"){
-    String cmdstr = server.arg(0);
-    logger.logString("Tetris cmd via Webserver to: " + cmdstr);
-    if(cmdstr == "up"){
-      mytetris.ctrlUp();
-    }
-    else if(cmdstr == "left"){
-      mytetris.ctrlLeft();
-    }
-    else if(cmdstr == "right"){
-      mytetris.ctrlRight();
-    }
-    else if(cmdstr == "down"){
-      mytetris.ctrlDown();
-    }
-    else if(cmdstr == "play"){
-      mytetris.ctrlStart();
-    }
-    else if(cmdstr == "pause"){
-      mytetris.ctrlPlayPause();
-    }
-  }
-  else if(server.argName(0) == "snake"){
-    String cmdstr = server.arg(0);
-    logger.logString("Snake cmd via Webserver to: " + cmdstr);
-    if(cmdstr == "up"){
-      mysnake.ctrlUp();
-    }
-    else if(cmdstr == "left"){
-      mysnake.ctrlLeft();
-    }
-    else if(cmdstr == "right"){
-      mysnake.ctrlRight();
-    }
-    else if(cmdstr == "down"){
-      mysnake.ctrlDown();
-    }
-    else if(cmdstr == "new"){
-      mysnake.initGame();
-    }
-  }
-  else if(server.argName(0) == "pong"){
-    String cmdstr = server.arg(0);
-    logger.logString("Pong cmd via Webserver to: " + cmdstr);
-    if(cmdstr == "up"){
-      mypong.ctrlUp(1);
-    }
-    else if(cmdstr == "down"){
-      mypong.ctrlDown(1);
-    }
-    else if(cmdstr == "new"){
-      mypong.initGame(1);
-    }
+  else if(server.argName(0) == "tetris" || server.argName(0) == "snake" || server.argName(0) == "pong"){
+    handleGameCommand(server.argName(0).c_str(), server.arg(0).c_str());
   }
   else if(server.argName(0) == "reboot"){
-    logger.logString("Reboot via Webserver");
+    LOG_INFO(logger, "Reboot via Webserver");
     server.send(204, "text/plain", "No Content"); // this page doesn't send back content --> 204
     delay(1000);
-    ESP.restart();
+    restartClock();
   }
   else if(server.argName(0) == "colorshift"){
     Serial.println("ColorShift change via Webserver");
@@ -1325,9 +1931,131 @@ void handleCommand() {
     EEPROM.commit();
     ESP.wdtFeed();
   }
+  else if(server.argName(0) == "loglevel"){
+    // level as number (0 = none ... 5 = trace) or name (none, error, warn, info, debug, trace)
+    uint8_t level;
+    if(!UDPLogger::parseLevel(server.arg(0).c_str(), &level)){
+      server.send(400, "text/plain", "Unknown log level, use 0-5 or none, error, warn, info, debug, trace");
+      return;
+    }
+    logger.setLevel(level);
+    logger.logPrintf("Log level change via Webserver to: %s", UDPLogger::getLevelName(logger.getLevel()));
+  }
   server.send(204, "text/plain", "No Content"); // this page doesn't send back content --> 204
 }
 
+/**
+ * @brief Control of the games (from /cmd or the WebSocket)
+ * 
+ * @param game "tetris", "snake" or "pong"
+ * @param cmd command of the game, e.g. "up" or "new"
+ * @return true if the command is known
+ */
+bool handleGameCommand(const char *game, const char *cmd){
+  LOG_DEBUG(logger, "Game cmd via Webserver: %s %s", game, cmd);
+  if(strcmp(game, "tetris") == 0){
+    if(strcmp(cmd, "up") == 0) mytetris.ctrlUp();
+    else if(strcmp(cmd, "left") == 0) mytetris.ctrlLeft();
+    else if(strcmp(cmd, "right") == 0) mytetris.ctrlRight();
+    else if(strcmp(cmd, "down") == 0) mytetris.ctrlDown();
+    else if(strcmp(cmd, "play") == 0) mytetris.ctrlStart();
+    else if(strcmp(cmd, "pause") == 0) mytetris.ctrlPlayPause();
+    else return false;
+  }
+  else if(strcmp(game, "snake") == 0){
+    if(strcmp(cmd, "up") == 0) mysnake.ctrlUp();
+    else if(strcmp(cmd, "left") == 0) mysnake.ctrlLeft();
+    else if(strcmp(cmd, "right") == 0) mysnake.ctrlRight();
+    else if(strcmp(cmd, "down") == 0) mysnake.ctrlDown();
+    else if(strcmp(cmd, "new") == 0) mysnake.initGame();
+    else return false;
+  }
+  else if(strcmp(game, "pong") == 0){
+    if(strcmp(cmd, "up") == 0) mypong.ctrlUp(1);
+    else if(strcmp(cmd, "down") == 0) mypong.ctrlDown(1);
+    else if(strcmp(cmd, "new") == 0) mypong.initGame(1);
+    else return false;
+  }
+  else{
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Events of the WebSocket push channel
+ * 
+ * A new client gets all state fields. Messages of the clients are game controls "<game>=<cmd>"
+ * (same as the /cmd arguments, e.g. "snake=up"), so a game needs no HTTP request per key press.
+ * 
+ * @param client index of the client
+ * @param event connected, message or disconnected
+ * @param message text of a message
+ * @param length length of the message
+ */
+void handleWebSocketEvent(uint8_t client, WebSocketEvent event, const char *message, size_t length){
+  if(event == ws_connected){
+    LOG_DEBUG(logger, "WebSocket client %u connected", client);
+    updateStateCache();
+    char json[STATE_JSON_SIZE];
+    size_t jsonLength = stateCache.writeJson(json, sizeof(json), true);
+    if(jsonLength > 0) webSocket.send(client, json, jsonLength);
+  }
+  else if(event == ws_message){
+    const char *separator = strchr(message, '=');
+    char game[8];
+    if(separator == nullptr || (size_t)(separator - message) >= sizeof(game)) return;
+    memcpy(game, message, separator - message);
+    game[separator - message] = '\0';
+    if(!handleGameCommand(game, separator + 1)){
+      LOG_DEBUG(logger, "Unknown WebSocket message (%u bytes)", (unsigned int)length);
+    }
+  }
+  else{
+    LOG_DEBUG(logger, "WebSocket client %u disconnected", client);
+  }
+}
+
+/**
+ * @brief Set the current values of all state fields pushed to the web UI
+ * 
+ */
+void updateStateCache(){
+  char text[STATE_VALUE_SIZE];
+  stateCache.set(sf_mode, stateNames[currentState].c_str());
+  stateCache.setInt(sf_modeid, currentState);
+  stateCache.setInt(sf_stateautochange, stateAutoChange);
+  stateCache.setInt(sf_ledoff, ledOff);
+  stateCache.setInt(sf_nightmodeactivated, nightModeActivated);
+  snprintf(text, sizeof(text), "%02d-%02d", nightModeStartHour, nightModeStartMin);
+  stateCache.set(sf_nightmodestart, text);
+  snprintf(text, sizeof(text), "%02d-%02d", nightModeEndHour, nightModeEndMin);
+  stateCache.set(sf_nightmodeend, text);
+  stateCache.setInt(sf_nightmodesolar, nightModeSolar);
+  if(solarDawnMin >= 0){
+    snprintf(text, sizeof(text), "%02d-%02d", solarDawnMin / 60, solarDawnMin % 60);
+    stateCache.set(sf_solardawn, text);
+    snprintf(text, sizeof(text), "%02d-%02d", solarDuskMin / 60, solarDuskMin % 60);
+    stateCache.set(sf_solardusk, text);
+  }
+  stateCache.setInt(sf_brightness, brightness);
+  stateCache.setInt(sf_colorshift, dynColorShiftActive);
+  stateCache.setInt(sf_colorshiftspeed, dynColorShiftSpeed);
+}
+
+/**
+ * @brief Send the state fields which changed since the last push to all WebSocket clients
+ * 
+ */
+void pushState(){
+  updateStateCache();
+  if(!stateCache.hasChanges()) return;
+  char json[STATE_JSON_SIZE];
+  size_t jsonLength = stateCache.writeJson(json, sizeof(json), false);
+  if(jsonLength > 0) webSocket.broadcast(json, jsonLength);
+  stateCache.clearChanges();
+}
+
 /**
  * @brief Splits a string at given character and return specified element
  * 
@@ -1365,54 +2093,152 @@ void handleDataRequest() {
   
   if (server.argName(0) == "key") // the parameter which was sent to this server is led color
   {
-    String message = "{";
     String keystr = server.arg(0);
+    if(keystr == "crashlog"){
+      // plain text, streamed
+      sendCrashLog();
+      return;
+    }
+    // streamed in chunks of JSON_WRITER_CHUNK bytes, the size of the response does not matter for the heap
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+    JsonWriter json(sendJsonChunk);
+    json.beginObject();
     if(keystr == "mode"){
-      message += "\"mode\":\"" + stateNames[currentState] + "\"";
-      message += ",";
-      message += "\"modeid\":\"" + String(currentState) + "\"";
-      message += ",";
-      message += "\"stateAutoChange\":\"" + String(stateAutoChange) + "\"";
-      message += ",";
-      message += "\"ledoff\":\"" + String(ledOff) + "\"";
-      message += ",";
-      message += "\"nightModeActivated\":\"" + String(nightModeActivated) + "\"";
-      message += ",";
-      message += "\"nightModeStart\":\"" + leadingZero2Digit(nightModeStartHour) + "-" + leadingZero2Digit(nightModeStartMin) + "\"";
-      message += ",";
-      message += "\"nightModeEnd\":\"" + leadingZero2Digit(nightModeEndHour) + "-" + leadingZero2Digit(nightModeEndMin) + "\"";
-      message += ",";
-      message += "\"brightness\":\"" + String(brightness) + "\"";
-      message += ",";
-      message += "\"colorshift\":\"" + String(dynColorShiftActive) + "\"";
-      message += ",";
-      message += "\"colorshiftspeed\":\"" + String(dynColorShiftSpeed) + "\"";
+      json.field("mode", stateNames[currentState].c_str());
+      json.fieldInt("modeid", currentState);
+      json.fieldInt("stateAutoChange", stateAutoChange);
+      json.fieldInt("ledoff", ledOff);
+      json.fieldInt("nightModeActivated", nightModeActivated);
+      json.fieldf("nightModeStart", "%02d-%02d", nightModeStartHour, nightModeStartMin);
+      json.fieldf("nightModeEnd", "%02d-%02d", nightModeEndHour, nightModeEndMin);
+      json.fieldInt("nightModeSolar", nightModeSolar);
+      if(solarDawnMin >= 0){
+        json.fieldf("solarDawn", "%02d-%02d", solarDawnMin / 60, solarDawnMin % 60);
+        json.fieldf("solarDusk", "%02d-%02d", solarDuskMin / 60, solarDuskMin % 60);
+      }
+      json.fieldInt("brightness", brightness);
+      json.fieldInt("colorshift", dynColorShiftActive);
+      json.fieldInt("colorshiftspeed", dynColorShiftSpeed);
+    }
+    else if(keystr == "time"){
+      json.fieldInt("synced", timeSync.isSynced());
+      json.fieldUInt("epoch", (unsigned long)time(nullptr));
+      json.fieldUInt("timeToFirstSync", timeSync.getTimeToFirstSyncMillis());
+      json.fieldUInt("syncCount", timeSync.getSyncCount());
+      json.fieldUInt("stepCount", timeSync.getStepCount());
+      json.fieldUInt("lastSyncAge", timeSync.getSecondsSinceLastSync(micros64()));
+      json.fieldInt("lastCorrection", (long)timeSync.getLastCorrectionMicros());
+      json.fieldInt("driftPpb", timeSync.getDriftPpb());
+      json.beginString("servers");
+      json.append(NTP_SERVER_1);
+      json.append(" ");
+      json.append(NTP_SERVER_2);
+      json.append(" ");
+      json.append(NTP_SERVER_3);
+      json.endString();
+      json.field("timezone", getTimezoneName().c_str());
+      json.field("tz", TZ_INFO);
+      json.field("tzSource", getTimezoneSource());
     }
     else if(keystr == "weather"){
       time_t now = time(nullptr);
       struct tm* timeinfo = localtime(&now);
       bool tomorrow = (timeinfo->tm_hour >= 12);
-      message += "\"dataValid\":\"" + String(weather.isDataValid()) + "\"";
-      message += ",";
-      message += "\"sunshineToday\":\"" + String(weather.getSunshineDuration(false)) + "\"";
-      message += ",";
-      message += "\"sunshineTodayHours\":\"" + String(weather.getSunshineDuration(false) / 3600.0) + "\"";
-      message += ",";
-      message += "\"sunshineTomorrow\":\"" + String(weather.getSunshineDuration(true)) + "\"";
-      message += ",";
-      message += "\"sunshineTomorrowHours\":\"" + String(weather.getSunshineDuration(true) / 3600.0) + "\"";
-      message += ",";
-      message += "\"tempToday\":\"" + String(weather.getTemperature(false)) + "\"";
-      message += ",";
-      message += "\"tempTomorrow\":\"" + String(weather.getTemperature(true)) + "\"";
-      message += ",";
-      message += "\"displayingTomorrow\":\"" + String(tomorrow) + "\"";
+      json.fieldInt("dataValid", weather.isDataValid());
+      json.fieldFloat("sunshineToday", weather.getSunshineDuration(false), 2);
+      json.fieldFloat("sunshineTodayHours", weather.getSunshineDuration(false) / 3600.0, 2);
+      json.fieldFloat("sunshineTomorrow", weather.getSunshineDuration(true), 2);
+      json.fieldFloat("sunshineTomorrowHours", weather.getSunshineDuration(true) / 3600.0, 2);
+      json.fieldInt("tempToday", weather.getTemperature(false));
+      json.fieldInt("tempTomorrow", weather.getTemperature(true));
+      json.fieldInt("displayingTomorrow", tomorrow);
+      const HourlyForecast &forecast = weather.getForecast();
+      int16_t hourIndex = forecast.getIndex(timeinfo);
+      json.fieldFloat("tempNow", hourIndex >= 0 ? forecast.getTemperature(hourIndex) : (float)WEATHER_MISSING, 1);
+      json.fieldInt("codeNow", hourIndex >= 0 ? forecast.getWeatherCode(hourIndex) : WEATHER_MISSING);
+      json.field("fetchPhase", WeatherFetch::getPhaseName(weather.getFetchPhase()));
+      json.fieldUInt("fetchProgress", weather.getFetchProgress());
+      const ConnectionStats &tls = weather.getConnectionStats();
+      json.fieldUInt("tlsConnects", tls.getConnectCount());
+      json.fieldUInt("tlsResumed", tls.getResumedCount());
+      json.fieldUInt("tlsFailed", tls.getFailedCount());
+      json.fieldUInt("handshakeFullMs", tls.getLastFullHandshakeMillis());
+      json.fieldUInt("handshakeResumedMs", tls.getLastResumedHandshakeMillis());
+      json.fieldUInt("handshakeMaxMs", tls.getMaxHandshakeMillis());
+      json.fieldUInt("tlsHeap", tls.getMaxConnectionHeap());
+      json.fieldUInt("minFreeHeap", tls.getMinFreeHeap());
+      json.fieldInt("mfln", weather.getMflnStatus());
+    }
+    else if(keystr == "forecast"){
+      // hourly forecast, index 0 is the current local hour
+      time_t now = time(nullptr);
+      struct tm* timeinfo = localtime(&now);
+      const HourlyForecast &forecast = weather.getForecast();
+      int16_t first = forecast.getIndex(timeinfo);
+      json.fieldInt("hour", timeinfo->tm_hour);
+      json.beginString("temperature");
+      for(int16_t i = first; first >= 0 && i < FORECAST_HOURS; i++){
+        json.appendf(i > first ? ",%.1f" : "%.1f", forecast.getTemperature(i));
+      }
+      json.endString();
+      json.beginString("weathercode");
+      for(int16_t i = first; first >= 0 && i < FORECAST_HOURS; i++){
+        json.appendf(i > first ? ",%d" : "%d", forecast.getWeatherCode(i));
+      }
+      json.endString();
+    }
+    else if(keystr == "network"){
+      uint32_t nowMs = millis();
+      json.fieldInt("link", network.isLinkUp());
+      json.field("breaker", NetworkHealth::getBreakerName(network.getBreakerState(nowMs)));
+      json.fieldUInt("breakerOpened", network.getBreakerOpenCount());
+      json.fieldUInt("reconnects", network.getReconnectCount());
+      json.fieldUInt("stallMs", network.getStallMillis());
+      json.fieldUInt("longestStallMs", network.getLongestStallMillis());
+      json.fieldUInt("weatherFailures", network.getFailures(ne_weather));
+      json.fieldUInt("weatherRetryMs", network.getRetryDelay(ne_weather, nowMs));
+      json.fieldUInt("logDropped", logger.getDropped());
+      json.fieldUInt("logHighWater", logger.getHighWater());
+      json.field("logLevel", UDPLogger::getLevelName(logger.getLevel()));
+    }
+    else if(keystr == "web"){
+      json.fieldUInt("assets", assetManifest.getCount());
+      json.fieldUInt("bundled", WebBundle::getCount());
+      json.fieldUInt("overrides", __builtin_popcount(bundleOverrides));
+      json.fieldUInt("requests", assetStats.getRequestCount());
+      json.fieldUInt("notModified", assetStats.getNotModifiedCount());
+      json.fieldUInt("gzip", assetStats.getGzipCount());
+      json.fieldUInt("bytes", assetStats.getBytes());
+      json.fieldUInt("sendMs", assetStats.getMillis());
+      json.fieldUInt("maxSendMs", assetStats.getMaxMillis());
     }
-    message += "}";
-    server.send(200, "application/json", message);
+    else if(keystr == "stream"){
+      uint16_t fpsX10 = ledDirectRate.getFpsX10(millis());
+      json.fieldUInt("frames", ledDirectRate.getFrameCount());
+      json.fieldf("fps", "%u.%u", fpsX10 / 10, fpsX10 % 10);
+      json.fieldUInt("ddpPackets", ddpReceiver.getPacketCount());
+      json.fieldUInt("ddpFrames", ddpReceiver.getFrameCount());
+      json.fieldUInt("ddpLost", ddpReceiver.getLostCount());
+      json.fieldUInt("ddpLate", ddpReceiver.getLateCount());
+      json.fieldUInt("ddpInvalid", ddpReceiver.getInvalidCount());
+    }
+    json.endObject();
+    json.flush();
+    server.sendContent("");
   }
 }
 
+/**
+ * @brief Send a chunk of a streamed JSON response (JsonWriter output)
+ * 
+ * @param data chunk
+ * @param length length of the chunk
+ */
+void sendJsonChunk(const char *data, size_t length){
+  server.sendContent(data, length);
+}
+
 /**
  * @brief Convert Integer to String with leading zero
  * 
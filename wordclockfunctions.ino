@@ -167,7 +167,7 @@ int displayRandomMessage(bool init) {
       savedCoords[i][1] = y;
     }
     
-    logger.logString("Starting random message display: " + String(currentMessage));
+    LOG_INFO(logger, "Starting random message display: " + String(currentMessage));
     return 0;
   }
 
@@ -231,7 +231,7 @@ int displayRandomMessage(bool init) {
     isClearing = true;
     currentLed = 0;
     lastLedTime = currentTime;
-    logger.logString("Clearing random message");
+    LOG_DEBUG(logger, "Clearing random message");
     return 0;
   }
   
@@ -261,7 +261,7 @@ int displayRandomMessage(bool init) {
   if (isClearing && currentLed >= messageLengths[currentMessage]) {
     isDisplaying = false;
     isClearing = false;
-    logger.logString("Random message display complete");
+    LOG_INFO(logger, "Random message display complete");
     return 1;
   }
   
@@ -269,32 +269,23 @@ int displayRandomMessage(bool init) {
 }
 
 /**
- * @brief Check if it's time to display a random message (at a random time each hour)
+ * @brief Calculate when the next random message should be displayed (at a random minute each hour)
  * 
- * @param hours Current hour
- * @param minutes Current minute
- * @param seconds Current second
- * @return bool - true if a new message should be displayed
+ * @param now current epoch
+ * @param skipCurrentHour if true, the message is placed in the next hour (e.g. after a message was shown)
+ * @return time_t epoch of the next random message
  */
-bool shouldDisplayRandomMessage(uint8_t hours, uint8_t minutes, uint8_t seconds) {
-  static uint8_t lastHour = 255; // Initialize to invalid hour
-  static uint8_t targetMinute = 0;
-  
-  // If the hour has changed, set a new random minute for this hour
-  if (hours != lastHour) {
-    targetMinute = random(0, 60); // Random minute in the hour
-    lastHour = hours;
-    logger.logString("New random message time set: " + String(hours) + ":" + String(targetMinute));
-    return false;
-  }
-  
-  // Check if we've reached the target minute and the seconds are 0
-  // This ensures we only trigger once per hour at the exact minute
-  if (minutes == targetMinute && seconds == 0) {
-    return true;
-  }
-  
-  return false;
+time_t nextRandomMessageTime(time_t now, bool skipCurrentHour) {
+  uint8_t targetMinute = random(0, 60); // Random minute in the hour
+  time_t fireTime;
+  if (skipCurrentHour) {
+    fireTime = EventCalendar::nextHourlyOccurrence(now, 0, 0) + targetMinute * 60;
+  } else {
+    fireTime = EventCalendar::nextHourlyOccurrence(now, targetMinute, 0);
+  }
+  struct tm* timeinfo = localtime(&fireTime);
+  LOG_INFO(logger, "New random message time set: " + String(timeinfo->tm_hour) + ":" + String(timeinfo->tm_min));
+  return fireTime;
 }
 
 /**
@@ -337,7 +328,7 @@ int showStringOnClock(String message, uint32_t color){
         }
         else{
           // word is not possible to show on clock
-          logger.logString("word is not possible to show on clock: " + String(word));
+          LOG_WARN(logger, "word is not possible to show on clock: " + String(word));
           return -1;
         }
       }else{
@@ -474,7 +465,7 @@ String timeToString(uint8_t hours,uint8_t minutes){
     message += "UHR ";
   }
 
-  logger.logString("time as String: " + String(message));
+  LOG_DEBUG(logger, "time as String: " + String(message));
 
   return message;
 }